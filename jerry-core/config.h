@@ -126,6 +126,16 @@
  */
 // #define CONFIG_ECMA_LCACHE_DISABLE
 
+/**
+ * Disable ECMA for-in enumeration cache
+ */
+// #define CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+
+/**
+ * Disable ECMA cache of compiled eval and Function constructor code
+ */
+// #define CONFIG_ECMA_EVAL_CACHE_DISABLE
+
 /**
  * Share of newly allocated since last GC objects among all currently allocated objects,
  * after achieving which, GC is started upon low severity try-give-memory-back requests.
@@ -157,6 +167,8 @@
 #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_DATE_BUILTIN
 #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
 #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ANNEXB_BUILTIN
+#define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+#define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_WEAKMAP_BUILTIN
 #endif /* CONFIG_ECMA_COMPACT_PROFILE */
 
 /**
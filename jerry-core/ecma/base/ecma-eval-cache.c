@@ -0,0 +1,238 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-eval-cache.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+#include "lit-strings.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaevalcache Compiled code cache of eval
+ * @{
+ */
+
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+/**
+ * Maximum size of a source code stored in the eval cache
+ */
+#define ECMA_EVAL_CACHE_MAX_SOURCE_SIZE (1024)
+
+/**
+ * Reference count of the cached code (or of its nested function code), above which the cached code is recompiled
+ *
+ * Every function object created by the cached code references the same function code,
+ * so half of the reference counter range is left for the code of a single run.
+ */
+#define ECMA_EVAL_CACHE_MAX_BYTECODE_REFS ((ECMA_BYTECODE_REF_PINNED - 1) / 2)
+
+/**
+ * Flags of the eval cache entries, which are part of the key
+ */
+#define ECMA_EVAL_CACHE_FLAG_STRICT (1u << 0) /**< the code is parsed in strict mode */
+#define ECMA_EVAL_CACHE_FLAG_DIRECT (1u << 1) /**< the code is run by direct eval */
+
+/**
+ * Get the flags of an eval cache key
+ *
+ * @return ECMA_EVAL_CACHE_FLAG_* flags
+ */
+static uint8_t
+ecma_eval_cache_get_flags (bool is_strict, /**< the code is parsed in strict mode */
+                           bool is_direct) /**< the code is run by direct eval */
+{
+  return (uint8_t) ((is_strict ? ECMA_EVAL_CACHE_FLAG_STRICT : 0)
+                    | (is_direct ? ECMA_EVAL_CACHE_FLAG_DIRECT : 0));
+} /* ecma_eval_cache_get_flags */
+
+/**
+ * Release the compiled code and the source code of an eval cache entry
+ */
+static void
+ecma_eval_cache_invalidate_entry (ecma_eval_cache_entry_t *entry_p) /**< entry to invalidate */
+{
+  JERRY_ASSERT (entry_p != NULL && entry_p->bytecode_p != NULL);
+
+  ecma_bytecode_deref (entry_p->bytecode_p);
+  mem_heap_free_block (entry_p->source_p);
+
+  entry_p->bytecode_p = NULL;
+  entry_p->source_p = NULL;
+} /* ecma_eval_cache_invalidate_entry */
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+
+/**
+ * Initialize eval cache
+ */
+void
+ecma_eval_cache_init (void)
+{
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+  memset (JERRY_CONTEXT (ecma_eval_cache_table), 0, sizeof (JERRY_CONTEXT (ecma_eval_cache_table)));
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+} /* ecma_eval_cache_init */
+
+/**
+ * Invalidate all entries of the eval cache
+ */
+void
+ecma_eval_cache_invalidate_all (void)
+{
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+  for (uint32_t entry_index = 0; entry_index < ECMA_EVAL_CACHE_ENTRIES_COUNT; entry_index++)
+  {
+    if (JERRY_CONTEXT (ecma_eval_cache_table)[entry_index].bytecode_p != NULL)
+    {
+      ecma_eval_cache_invalidate_entry (JERRY_CONTEXT (ecma_eval_cache_table) + entry_index);
+    }
+  }
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+} /* ecma_eval_cache_invalidate_all */
+
+/**
+ * Look up the compiled code of a source code
+ *
+ * @return compiled code, whose reference counter is increased (the caller should deref it),
+ *         NULL - if the source code is not in the cache
+ */
+ecma_compiled_code_t *
+ecma_eval_cache_lookup (const lit_utf8_byte_t *source_p, /**< source code */
+                        lit_utf8_size_t source_size, /**< size of the source code */
+                        bool is_strict, /**< the code is parsed in strict mode */
+                        bool is_direct) /**< the code is run by direct eval */
+{
+  JERRY_ASSERT (source_p != NULL);
+
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+  if (source_size > ECMA_EVAL_CACHE_MAX_SOURCE_SIZE)
+  {
+    return NULL;
+  }
+
+  lit_string_hash_t hash = lit_utf8_string_calc_hash (source_p, source_size);
+  uint8_t flags = ecma_eval_cache_get_flags (is_strict, is_direct);
+
+  for (uint32_t entry_index = 0; entry_index < ECMA_EVAL_CACHE_ENTRIES_COUNT; entry_index++)
+  {
+    ecma_eval_cache_entry_t *entry_p = JERRY_CONTEXT (ecma_eval_cache_table) + entry_index;
+
+    if (entry_p->bytecode_p == NULL)
+    {
+      /* Empty entries are at the end of the table. */
+      break;
+    }
+
+    if (entry_p->hash == hash
+        && entry_p->flags == flags
+        && entry_p->source_size == source_size
+        && memcmp (entry_p->source_p, source_p, source_size) == 0)
+    {
+      if (ecma_bytecode_tree_reaches_refs (entry_p->bytecode_p, ECMA_EVAL_CACHE_MAX_BYTECODE_REFS))
+      {
+        /* The entry is removed, so the source is compiled again and its new code replaces the entry. */
+        ecma_eval_cache_invalidate_entry (entry_p);
+
+        memmove (entry_p,
+                 entry_p + 1,
+                 (ECMA_EVAL_CACHE_ENTRIES_COUNT - entry_index - 1) * sizeof (ecma_eval_cache_entry_t));
+        memset (JERRY_CONTEXT (ecma_eval_cache_table) + ECMA_EVAL_CACHE_ENTRIES_COUNT - 1,
+                0,
+                sizeof (ecma_eval_cache_entry_t));
+        return NULL;
+      }
+
+      ecma_eval_cache_entry_t found_entry = *entry_p;
+
+      /* Move the entry to the front. */
+      memmove (JERRY_CONTEXT (ecma_eval_cache_table) + 1,
+               JERRY_CONTEXT (ecma_eval_cache_table),
+               entry_index * sizeof (ecma_eval_cache_entry_t));
+      JERRY_CONTEXT (ecma_eval_cache_table)[0] = found_entry;
+
+      ecma_bytecode_ref (found_entry.bytecode_p);
+      return found_entry.bytecode_p;
+    }
+  }
+#else /* CONFIG_ECMA_EVAL_CACHE_DISABLE */
+  (void) source_size;
+  (void) is_strict;
+  (void) is_direct;
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+
+  return NULL;
+} /* ecma_eval_cache_lookup */
+
+/**
+ * Insert the compiled code of a source code into the eval cache
+ *
+ * Note:
+ *      the least recently used entry is replaced, if the cache is full,
+ *      too long source codes are not cached
+ */
+void
+ecma_eval_cache_insert (const lit_utf8_byte_t *source_p, /**< source code */
+                        lit_utf8_size_t source_size, /**< size of the source code */
+                        bool is_strict, /**< the code is parsed in strict mode */
+                        bool is_direct, /**< the code is run by direct eval */
+                        ecma_compiled_code_t *bytecode_p) /**< compiled code of the source code
+                                                           *   (the entry takes a new reference) */
+{
+  JERRY_ASSERT (source_p != NULL && bytecode_p != NULL);
+
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+  if (source_size == 0 || source_size > ECMA_EVAL_CACHE_MAX_SOURCE_SIZE)
+  {
+    return;
+  }
+
+  /* The allocation might invalidate the cache, so the table is updated afterwards. */
+  lit_utf8_byte_t *source_copy_p = (lit_utf8_byte_t *) mem_heap_alloc_block (source_size,
+                                                                             MEM_HEAP_ALLOC_LONG_TERM);
+  memcpy (source_copy_p, source_p, source_size);
+
+  ecma_eval_cache_entry_t *last_entry_p = JERRY_CONTEXT (ecma_eval_cache_table) + ECMA_EVAL_CACHE_ENTRIES_COUNT - 1;
+
+  if (last_entry_p->bytecode_p != NULL)
+  {
+    ecma_eval_cache_invalidate_entry (last_entry_p);
+  }
+
+  memmove (JERRY_CONTEXT (ecma_eval_cache_table) + 1,
+           JERRY_CONTEXT (ecma_eval_cache_table),
+           (ECMA_EVAL_CACHE_ENTRIES_COUNT - 1) * sizeof (ecma_eval_cache_entry_t));
+
+  ecma_bytecode_ref (bytecode_p);
+
+  JERRY_CONTEXT (ecma_eval_cache_table)[0].bytecode_p = bytecode_p;
+  JERRY_CONTEXT (ecma_eval_cache_table)[0].source_p = source_copy_p;
+  JERRY_CONTEXT (ecma_eval_cache_table)[0].source_size = source_size;
+  JERRY_CONTEXT (ecma_eval_cache_table)[0].hash = lit_utf8_string_calc_hash (source_p, source_size);
+  JERRY_CONTEXT (ecma_eval_cache_table)[0].flags = ecma_eval_cache_get_flags (is_strict, is_direct);
+#else /* CONFIG_ECMA_EVAL_CACHE_DISABLE */
+  (void) source_size;
+  (void) is_strict;
+  (void) is_direct;
+  (void) bytecode_p;
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+} /* ecma_eval_cache_insert */
+
+/**
+ * @}
+ * @}
+ */
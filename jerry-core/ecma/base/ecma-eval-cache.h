@@ -0,0 +1,59 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_EVAL_CACHE_H
+#define ECMA_EVAL_CACHE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaevalcache Compiled code cache of eval
+ * @{
+ */
+
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+/**
+ * Number of entries in the eval cache
+ */
+#define ECMA_EVAL_CACHE_ENTRIES_COUNT (8)
+
+/**
+ * Entry of the eval cache
+ */
+typedef struct
+{
+  ecma_compiled_code_t *bytecode_p; /**< compiled code (referenced by the entry),
+                                     *   or NULL - if the entry is empty */
+  lit_utf8_byte_t *source_p; /**< copy of the source code */
+  lit_utf8_size_t source_size; /**< size of the source code */
+  lit_string_hash_t hash; /**< hash of the source code */
+  uint8_t flags; /**< ECMA_EVAL_CACHE_FLAG_* flags */
+} ecma_eval_cache_entry_t;
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+
+extern void ecma_eval_cache_init (void);
+extern void ecma_eval_cache_invalidate_all (void);
+extern ecma_compiled_code_t *ecma_eval_cache_lookup (const lit_utf8_byte_t *, lit_utf8_size_t, bool, bool);
+extern void ecma_eval_cache_insert (const lit_utf8_byte_t *, lit_utf8_size_t, bool, bool, ecma_compiled_code_t *);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* ECMA_EVAL_CACHE_H */
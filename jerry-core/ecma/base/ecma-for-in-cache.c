@@ -0,0 +1,355 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-for-in-cache.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaforincache For-in enumeration cache
+ * @{
+ */
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+/**
+ * Maximum number of property names stored in a cache entry
+ */
+#define ECMA_FOR_IN_CACHE_MAX_NAMES (32)
+
+/**
+ * Compute the filter bit of a compressed pointer
+ */
+#define ECMA_FOR_IN_CACHE_MASK_BIT(cp) (1u << ((cp) & 0x1f))
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
+/**
+ * Initialize for-in cache
+ */
+void
+ecma_for_in_cache_init (void)
+{
+  JERRY_CONTEXT (ecma_for_in_delete_epoch) = 0;
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  memset (JERRY_CONTEXT (ecma_for_in_cache_table), 0, sizeof (JERRY_CONTEXT (ecma_for_in_cache_table)));
+  JERRY_CONTEXT (ecma_for_in_cache_next_index) = 0;
+  JERRY_CONTEXT (ecma_for_in_cache_chain_mask) = 0;
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+} /* ecma_for_in_cache_init */
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+/**
+ * Invalidate specified for-in cache entry
+ */
+static void
+ecma_for_in_cache_invalidate_entry (ecma_for_in_cache_entry_t *entry_p) /**< entry to invalidate */
+{
+  JERRY_ASSERT (entry_p != NULL);
+  JERRY_ASSERT (entry_p->chain_cp[0] != ECMA_NULL_POINTER);
+
+  ecma_free_values_collection (entry_p->names_p, true);
+
+  entry_p->chain_cp[0] = ECMA_NULL_POINTER;
+  entry_p->names_p = NULL;
+} /* ecma_for_in_cache_invalidate_entry */
+
+/**
+ * Recompute the filter mask after entries were removed
+ */
+static void
+ecma_for_in_cache_update_mask (void)
+{
+  uint32_t mask = 0;
+
+  for (uint32_t entry_index = 0; entry_index < ECMA_FOR_IN_CACHE_ENTRIES_COUNT; entry_index++)
+  {
+    ecma_for_in_cache_entry_t *entry_p = JERRY_CONTEXT (ecma_for_in_cache_table) + entry_index;
+
+    for (uint32_t i = 0; i < ECMA_FOR_IN_CACHE_MAX_CHAIN_LENGTH; i++)
+    {
+      if (entry_p->chain_cp[i] == ECMA_NULL_POINTER)
+      {
+        break;
+      }
+
+      mask |= ECMA_FOR_IN_CACHE_MASK_BIT (entry_p->chain_cp[i]);
+    }
+  }
+
+  JERRY_CONTEXT (ecma_for_in_cache_chain_mask) = mask;
+} /* ecma_for_in_cache_update_mask */
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
+/**
+ * Invalidate all entries of the for-in cache
+ */
+void
+ecma_for_in_cache_invalidate_all (void)
+{
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  for (uint32_t entry_index = 0; entry_index < ECMA_FOR_IN_CACHE_ENTRIES_COUNT; entry_index++)
+  {
+    if (JERRY_CONTEXT (ecma_for_in_cache_table)[entry_index].chain_cp[0] != ECMA_NULL_POINTER)
+    {
+      ecma_for_in_cache_invalidate_entry (JERRY_CONTEXT (ecma_for_in_cache_table) + entry_index);
+    }
+  }
+
+  JERRY_CONTEXT (ecma_for_in_cache_chain_mask) = 0;
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+} /* ecma_for_in_cache_invalidate_all */
+
+/**
+ * Invalidate the entries whose prototype chain contains the specified object
+ *
+ * Must be called whenever the set of properties or the enumerability
+ * of a property of the object changes.
+ */
+void
+ecma_for_in_cache_invalidate (ecma_object_t *object_p) /**< object or lexical environment */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  mem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  if (likely ((JERRY_CONTEXT (ecma_for_in_cache_chain_mask) & ECMA_FOR_IN_CACHE_MASK_BIT (object_cp)) == 0))
+  {
+    return;
+  }
+
+  bool is_invalidated = false;
+
+  for (uint32_t entry_index = 0; entry_index < ECMA_FOR_IN_CACHE_ENTRIES_COUNT; entry_index++)
+  {
+    ecma_for_in_cache_entry_t *entry_p = JERRY_CONTEXT (ecma_for_in_cache_table) + entry_index;
+
+    for (uint32_t i = 0; i < ECMA_FOR_IN_CACHE_MAX_CHAIN_LENGTH; i++)
+    {
+      if (entry_p->chain_cp[i] == ECMA_NULL_POINTER)
+      {
+        break;
+      }
+
+      if (entry_p->chain_cp[i] == object_cp)
+      {
+        ecma_for_in_cache_invalidate_entry (entry_p);
+        is_invalidated = true;
+        break;
+      }
+    }
+  }
+
+  if (is_invalidated)
+  {
+    ecma_for_in_cache_update_mask ();
+  }
+#else /* CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+  (void) object_p;
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+} /* ecma_for_in_cache_invalidate */
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+/**
+ * Create a copy of a strings collection
+ *
+ * @return new collection, which should be freed with ecma_free_values_collection
+ */
+static ecma_collection_header_t *
+ecma_for_in_cache_copy_names (ecma_collection_header_t *names_p) /**< collection to copy */
+{
+  ecma_collection_header_t *copy_p = ecma_new_values_collection (NULL, 0, true);
+
+  ecma_collection_iterator_t iter;
+  ecma_collection_iterator_init (&iter, names_p);
+
+  while (ecma_collection_iterator_next (&iter))
+  {
+    ecma_append_to_values_collection (copy_p, *iter.current_value_p, true);
+  }
+
+  return copy_p;
+} /* ecma_for_in_cache_copy_names */
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
+/**
+ * Look up the enumerable property names of an object
+ *
+ * @return copy of the cached property names, which should be freed with ecma_free_values_collection
+ *         NULL - if the object is not in the cache
+ */
+ecma_collection_header_t *
+ecma_for_in_cache_lookup (ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (object_p != NULL
+                && !ecma_is_lexical_environment (object_p));
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  mem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  if ((JERRY_CONTEXT (ecma_for_in_cache_chain_mask) & ECMA_FOR_IN_CACHE_MASK_BIT (object_cp)) == 0)
+  {
+    return NULL;
+  }
+
+  for (uint32_t entry_index = 0; entry_index < ECMA_FOR_IN_CACHE_ENTRIES_COUNT; entry_index++)
+  {
+    if (JERRY_CONTEXT (ecma_for_in_cache_table)[entry_index].chain_cp[0] == object_cp)
+    {
+      return ecma_for_in_cache_copy_names (JERRY_CONTEXT (ecma_for_in_cache_table)[entry_index].names_p);
+    }
+  }
+#else /* CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+  (void) object_p;
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
+  return NULL;
+} /* ecma_for_in_cache_lookup */
+
+/**
+ * Insert the enumerable property names of an object into the for-in cache
+ *
+ * Note:
+ *      objects with too long prototype chains, too many properties or host objects in the chain are not cached
+ *
+ *      the cache does not reference the objects, the garbage collector invalidates
+ *      the entries of the objects it frees (see also: ecma_gc_sweep)
+ */
+void
+ecma_for_in_cache_insert (ecma_object_t *object_p, /**< object */
+                          ecma_collection_header_t *names_p) /**< enumerable property names of the object
+                                                              *   (the collection is copied) */
+{
+  JERRY_ASSERT (object_p != NULL
+                && !ecma_is_lexical_environment (object_p));
+  JERRY_ASSERT (names_p != NULL);
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  if (names_p->unit_number == 0 || names_p->unit_number > ECMA_FOR_IN_CACHE_MAX_NAMES)
+  {
+    return;
+  }
+
+  mem_cpointer_t chain_cp[ECMA_FOR_IN_CACHE_MAX_CHAIN_LENGTH];
+  uint32_t chain_length = 0;
+
+  for (ecma_object_t *iter_p = object_p;
+       iter_p != NULL;
+       iter_p = ecma_get_object_prototype (iter_p))
+  {
+    /* the property names of host objects are provided by the embedder, and can change at any time */
+    if (chain_length == ECMA_FOR_IN_CACHE_MAX_CHAIN_LENGTH
+        || ecma_get_object_type (iter_p) == ECMA_OBJECT_TYPE_HOST)
+    {
+      return;
+    }
+
+    ECMA_SET_NON_NULL_POINTER (chain_cp[chain_length], iter_p);
+    chain_length++;
+  }
+
+  uint32_t next_index = JERRY_CONTEXT (ecma_for_in_cache_next_index);
+  ecma_for_in_cache_entry_t *entry_p = JERRY_CONTEXT (ecma_for_in_cache_table) + next_index;
+  JERRY_CONTEXT (ecma_for_in_cache_next_index) = (next_index + 1) % ECMA_FOR_IN_CACHE_ENTRIES_COUNT;
+
+  if (entry_p->chain_cp[0] != ECMA_NULL_POINTER)
+  {
+    ecma_for_in_cache_invalidate_entry (entry_p);
+    ecma_for_in_cache_update_mask ();
+  }
+
+  for (uint32_t i = 0; i < ECMA_FOR_IN_CACHE_MAX_CHAIN_LENGTH; i++)
+  {
+    if (i < chain_length)
+    {
+      entry_p->chain_cp[i] = chain_cp[i];
+      JERRY_CONTEXT (ecma_for_in_cache_chain_mask) |= ECMA_FOR_IN_CACHE_MASK_BIT (chain_cp[i]);
+    }
+    else
+    {
+      entry_p->chain_cp[i] = ECMA_NULL_POINTER;
+    }
+  }
+
+  entry_p->names_p = ecma_for_in_cache_copy_names (names_p);
+#else /* CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+  (void) object_p;
+  (void) names_p;
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+} /* ecma_for_in_cache_insert */
+
+/**
+ * Record that a property has been deleted
+ */
+void
+ecma_for_in_cache_notify_delete (void)
+{
+  JERRY_CONTEXT (ecma_for_in_delete_epoch)++;
+
+  if (JERRY_CONTEXT (ecma_for_in_delete_epoch) == ECMA_FOR_IN_DELETE_EPOCH_UNKNOWN)
+  {
+    JERRY_CONTEXT (ecma_for_in_delete_epoch) = 0;
+  }
+} /* ecma_for_in_cache_notify_delete */
+
+/**
+ * Get the number of property deletions performed so far
+ *
+ * @return deletion counter
+ */
+uint32_t
+ecma_for_in_cache_get_delete_epoch (void)
+{
+  return JERRY_CONTEXT (ecma_for_in_delete_epoch);
+} /* ecma_for_in_cache_get_delete_epoch */
+
+/**
+ * Get the delete epoch of an enumeration, which is compared to the current delete epoch
+ * to decide whether the existence check of the enumerated property names can be skipped
+ *
+ * Note:
+ *      the properties of host objects can disappear without ecma_delete_property,
+ *      so ECMA_FOR_IN_DELETE_EPOCH_UNKNOWN is returned, if a host object is on the prototype chain
+ *
+ * @return delete epoch
+ */
+uint32_t
+ecma_for_in_cache_get_enumeration_epoch (ecma_object_t *object_p) /**< enumerated object */
+{
+  for (ecma_object_t *iter_p = object_p;
+       iter_p != NULL;
+       iter_p = ecma_get_object_prototype (iter_p))
+  {
+    if (ecma_get_object_type (iter_p) == ECMA_OBJECT_TYPE_HOST)
+    {
+      return ECMA_FOR_IN_DELETE_EPOCH_UNKNOWN;
+    }
+  }
+
+  return JERRY_CONTEXT (ecma_for_in_delete_epoch);
+} /* ecma_for_in_cache_get_enumeration_epoch */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,75 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_FOR_IN_CACHE_H
+#define ECMA_FOR_IN_CACHE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaforincache For-in enumeration cache
+ * @{
+ */
+
+/**
+ * Delete epoch of an enumeration, whose property names must always be checked for existence
+ * (ecma_for_in_cache_get_delete_epoch never returns this value)
+ */
+#define ECMA_FOR_IN_DELETE_EPOCH_UNKNOWN UINT32_MAX
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+/**
+ * Maximum number of objects on a cached prototype chain (including the enumerated object)
+ */
+#define ECMA_FOR_IN_CACHE_MAX_CHAIN_LENGTH (4)
+
+/**
+ * Number of entries in the for-in cache
+ */
+#define ECMA_FOR_IN_CACHE_ENTRIES_COUNT (4)
+
+/**
+ * Entry of the for-in cache
+ */
+typedef struct
+{
+  /** Compressed pointers to the enumerated object (first item) and its
+   *  prototypes; the rest of the chain is filled with ECMA_NULL_POINTER
+   *  (ECMA_NULL_POINTER as first item marks the entry empty) */
+  mem_cpointer_t chain_cp[ECMA_FOR_IN_CACHE_MAX_CHAIN_LENGTH];
+
+  /** Enumerable property names of the object and its prototype chain */
+  ecma_collection_header_t *names_p;
+} ecma_for_in_cache_entry_t;
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
+extern void ecma_for_in_cache_init (void);
+extern void ecma_for_in_cache_invalidate_all (void);
+extern void ecma_for_in_cache_invalidate (ecma_object_t *);
+extern ecma_collection_header_t *ecma_for_in_cache_lookup (ecma_object_t *);
+extern void ecma_for_in_cache_insert (ecma_object_t *, ecma_collection_header_t *);
+extern void ecma_for_in_cache_notify_delete (void);
+extern uint32_t ecma_for_in_cache_get_delete_epoch (void);
+extern uint32_t ecma_for_in_cache_get_enumeration_epoch (ecma_object_t *);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* ECMA_FOR_IN_CACHE_H */
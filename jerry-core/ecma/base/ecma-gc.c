@@ -26,12 +26,18 @@
 
 #include "ecma-alloc.h"
 #include "ecma-globals.h"
+#include "ecma-eval-cache.h"
+#include "ecma-for-in-cache.h"
 #include "ecma-gc.h"
+#include "ecma-handle-table.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
+#include "ecma-regexp-object.h"
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "jrt-bit-fields.h"
+#include "re-compiler.h"
 #include "vm-defines.h"
 #include "vm-stack.h"
 
@@ -43,46 +49,6 @@
  *      Extract GC to a separate component
  */
 
-/**
- * An object's GC color
- *
- * Tri-color marking:
- *   WHITE_GRAY, unvisited -> WHITE // not referenced by a live object or the reference not found yet
- *   WHITE_GRAY, visited   -> GRAY  // referenced by some live object
- *   BLACK                 -> BLACK // all referenced objects are gray or black
- */
-typedef enum
-{
-  ECMA_GC_COLOR_WHITE_GRAY, /**< white or gray */
-  ECMA_GC_COLOR_BLACK, /**< black */
-  ECMA_GC_COLOR__COUNT /**< number of colors */
-} ecma_gc_color_t;
-
-/**
- * List of marked (visited during current GC session) and umarked objects
- */
-static ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT];
-
-/**
- * Current state of an object's visited flag that indicates whether the object is in visited state:
- *  visited_field | visited_flip_flag | real_value
- *         false  |            false  |     false
- *         false  |             true  |      true
- *          true  |            false  |      true
- *          true  |             true  |     false
- */
-static bool ecma_gc_visited_flip_flag = false;
-
-/**
- * Number of currently allocated objects
- */
-static size_t ecma_gc_objects_number = 0;
-
-/**
- * Number of newly allocated objects since last GC session
- */
-static size_t ecma_gc_new_objects_since_last_gc = 0;
-
 static void ecma_gc_mark (ecma_object_t *object_p);
 static void ecma_gc_sweep (ecma_object_t *object_p);
 
@@ -162,7 +128,7 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
                                                   ECMA_OBJECT_GC_VISITED_POS,
                                                   ECMA_OBJECT_GC_VISITED_WIDTH);
 
-  return (flag_value != ecma_gc_visited_flip_flag);
+  return (flag_value != JERRY_CONTEXT (ecma_gc_visited_flip_flag));
 } /* ecma_gc_is_object_visited */
 
 /**
@@ -174,7 +140,7 @@ ecma_gc_set_object_visited (ecma_object_t *object_p, /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  if (ecma_gc_visited_flip_flag)
+  if (JERRY_CONTEXT (ecma_gc_visited_flip_flag))
   {
     is_visited = !is_visited;
   }
@@ -191,15 +157,15 @@ ecma_gc_set_object_visited (ecma_object_t *object_p, /**< object */
 void
 ecma_init_gc_info (ecma_object_t *object_p) /**< object */
 {
-  ecma_gc_objects_number++;
-  ecma_gc_new_objects_since_last_gc++;
+  JERRY_CONTEXT (ecma_gc_objects_number)++;
+  JERRY_CONTEXT (ecma_gc_new_objects_since_last_gc)++;
 
-  JERRY_ASSERT (ecma_gc_new_objects_since_last_gc <= ecma_gc_objects_number);
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_new_objects_since_last_gc) <= JERRY_CONTEXT (ecma_gc_objects_number));
 
   ecma_gc_set_object_refs (object_p, 1);
 
-  ecma_gc_set_object_next (object_p, ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY]);
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = object_p;
+  ecma_gc_set_object_next (object_p, JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY]);
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] = object_p;
 
   /* Should be set to false at the beginning of garbage collection */
   ecma_gc_set_object_visited (object_p, false);
@@ -239,10 +205,165 @@ ecma_deref_object (ecma_object_t *object_p) /**< object */
 void
 ecma_gc_init (void)
 {
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = NULL;
-  ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] = NULL;
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] = NULL;
 } /* ecma_gc_init */
 
+/**
+ * Check whether an object references memory outside of the heap
+ *
+ * @return true - if the object has a native handler, handle, free callback or host property interceptors,
+ *                or its byte code is stored in a snapshot buffer,
+ *                or it is an ArrayBuffer object, which references a buffer of the embedder,
+ *         false - otherwise.
+ */
+static bool
+ecma_gc_is_object_referencing_external_memory (ecma_object_t *object_p) /**< object */
+{
+  if (ecma_is_lexical_environment (object_p))
+  {
+    return false;
+  }
+
+  if (ecma_find_internal_property (object_p, ECMA_INTERNAL_PROPERTY_NATIVE_CODE) != NULL
+      || ecma_find_internal_property (object_p, ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE) != NULL
+      || ecma_find_internal_property (object_p, ECMA_INTERNAL_PROPERTY_FREE_CALLBACK) != NULL
+      || ecma_find_internal_property (object_p, ECMA_INTERNAL_PROPERTY_HOST_HANDLERS) != NULL)
+  {
+    return true;
+  }
+
+  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_FUNCTION
+      && !ecma_get_object_is_builtin (object_p))
+  {
+    ecma_property_t *bytecode_prop_p = ecma_get_internal_property (object_p, ECMA_INTERNAL_PROPERTY_CODE_BYTECODE);
+    const ecma_compiled_code_t *bytecode_p = MEM_CP_GET_NON_NULL_POINTER (const ecma_compiled_code_t,
+                                                                          bytecode_prop_p->u.internal_property.value);
+
+    return cbc_is_byte_code_external (bytecode_p);
+  }
+
+  ecma_property_t *arraybuffer_prop_p = ecma_find_internal_property (object_p, ECMA_INTERNAL_PROPERTY_ARRAYBUFFER);
+
+  if (arraybuffer_prop_p != NULL)
+  {
+    uint32_t arraybuffer_cp = arraybuffer_prop_p->u.internal_property.value;
+    const ecma_arraybuffer_t *arraybuffer_p = ECMA_GET_NON_NULL_POINTER (const ecma_arraybuffer_t, arraybuffer_cp);
+
+    return arraybuffer_p->external_buffer_p != NULL;
+  }
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
+  ecma_property_t *regexp_bytecode_prop_p = ecma_find_internal_property (object_p,
+                                                                         ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE);
+
+  if (regexp_bytecode_prop_p != NULL)
+  {
+    const re_compiled_code_t *re_bytecode_p = MEM_CP_GET_POINTER (const re_compiled_code_t,
+                                                                  regexp_bytecode_prop_p->u.internal_property.value);
+
+    return (re_bytecode_p != NULL && (re_bytecode_p->flags & RE_FLAG_BYTECODE_IN_SNAPSHOT));
+  }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
+
+  return false;
+} /* ecma_gc_is_object_referencing_external_memory */
+
+/**
+ * Save state of the garbage collector to a heap image
+ *
+ * Note:
+ *      the objects are saved with the heap area, so only objects which can be
+ *      restored by copying the heap area are accepted
+ *
+ * @return true - if the state was written successfully,
+ *         false - if the buffer is too small, an object references memory outside of the heap,
+ *                 or a WeakMap object exists.
+ */
+bool
+ecma_gc_save_image (uint8_t *buffer_p, /**< buffer */
+                    size_t buffer_size, /**< size of buffer */
+                    size_t *in_out_buffer_offset_p) /**< in: offset to write to,
+                                                     *   out: offset, incremented on size of the written data */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] == NULL);
+
+  if (JERRY_CONTEXT (ecma_weakmaps_p) != NULL)
+  {
+    /* The list of WeakMaps is not part of the image */
+    return false;
+  }
+
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY];
+       obj_iter_p != NULL;
+       obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
+  {
+    if (ecma_gc_is_object_referencing_external_memory (obj_iter_p))
+    {
+      return false;
+    }
+  }
+
+  mem_cpointer_t objects_list_cp;
+  ECMA_SET_POINTER (objects_list_cp, JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY]);
+
+  return (jrt_write_to_buffer_by_offset (buffer_p,
+                                         buffer_size,
+                                         in_out_buffer_offset_p,
+                                         &objects_list_cp,
+                                         sizeof (objects_list_cp))
+          && jrt_write_to_buffer_by_offset (buffer_p,
+                                            buffer_size,
+                                            in_out_buffer_offset_p,
+                                            &JERRY_CONTEXT (ecma_gc_visited_flip_flag),
+                                            sizeof (JERRY_CONTEXT (ecma_gc_visited_flip_flag)))
+          && jrt_write_to_buffer_by_offset (buffer_p,
+                                            buffer_size,
+                                            in_out_buffer_offset_p,
+                                            &JERRY_CONTEXT (ecma_gc_objects_number),
+                                            sizeof (JERRY_CONTEXT (ecma_gc_objects_number))));
+} /* ecma_gc_save_image */
+
+/**
+ * Restore state of the garbage collector from a heap image
+ *
+ * @return true - if the state was restored successfully,
+ *         false - if the image is truncated.
+ */
+bool
+ecma_gc_load_image (const uint8_t *buffer_p, /**< buffer */
+                    size_t buffer_size, /**< size of buffer */
+                    size_t *in_out_buffer_offset_p) /**< in: offset to read from,
+                                                     *   out: offset, incremented on size of the read data */
+{
+  mem_cpointer_t objects_list_cp;
+
+  if (!jrt_read_from_buffer_by_offset (buffer_p,
+                                       buffer_size,
+                                       in_out_buffer_offset_p,
+                                       &objects_list_cp,
+                                       sizeof (objects_list_cp))
+      || !jrt_read_from_buffer_by_offset (buffer_p,
+                                          buffer_size,
+                                          in_out_buffer_offset_p,
+                                          &JERRY_CONTEXT (ecma_gc_visited_flip_flag),
+                                          sizeof (JERRY_CONTEXT (ecma_gc_visited_flip_flag)))
+      || !jrt_read_from_buffer_by_offset (buffer_p,
+                                          buffer_size,
+                                          in_out_buffer_offset_p,
+                                          &JERRY_CONTEXT (ecma_gc_objects_number),
+                                          sizeof (JERRY_CONTEXT (ecma_gc_objects_number))))
+  {
+    return false;
+  }
+
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] = ECMA_GET_POINTER (ecma_object_t, objects_list_cp);
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] = NULL;
+  JERRY_CONTEXT (ecma_gc_new_objects_since_last_gc) = 0;
+
+  return true;
+} /* ecma_gc_load_image */
+
 /**
  * Mark objects as visited starting from specified object as root
  */
@@ -359,10 +480,27 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
             case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_0_31: /* an integer (bit-mask) */
             case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_32_63: /* an integer (bit-mask) */
             case ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE:
+            case ECMA_INTERNAL_PROPERTY_ARRAYBUFFER: /* compressed pointer to an ecma_arraybuffer_t */
+            case ECMA_INTERNAL_PROPERTY_TYPEDARRAY_OFFSET: /* an integer */
+            case ECMA_INTERNAL_PROPERTY_TYPEDARRAY_LENGTH: /* an integer */
+            case ECMA_INTERNAL_PROPERTY_HOST_HANDLERS: /* an external pointer */
+            case ECMA_INTERNAL_PROPERTY_HOST_SLOT: /* compressed pointer to an own property */
+            case ECMA_INTERNAL_PROPERTY_WEAKMAP: /* compressed pointer to an ecma_weakmap_t,
+                                                  * whose values are marked by ecma_gc_mark_weakmap_values */
             {
               break;
             }
 
+            case ECMA_INTERNAL_PROPERTY_TYPEDARRAY_BUFFER: /* compressed pointer to an object, and an enum */
+            {
+              mem_cpointer_t buffer_cp = (mem_cpointer_t) (property_value & ((1u << ECMA_TYPEDARRAY_TYPE_POS) - 1));
+              ecma_object_t *obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, buffer_cp);
+
+              ecma_gc_set_object_visited (obj_p, true);
+
+              break;
+            }
+
             case ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_BOUND_THIS: /* an ecma value */
             {
               if (ecma_is_value_object (property_value))
@@ -430,6 +568,9 @@ ecma_gc_sweep (ecma_object_t *object_p) /**< object to free */
 
   if (!ecma_is_lexical_environment (object_p))
   {
+    /* the for-in cache is not a root, so its entries must not outlive the objects */
+    ecma_for_in_cache_invalidate (object_p);
+
     /* if the object provides free callback, invoke it with handle stored in the object */
 
     ecma_external_pointer_t freecb_p;
@@ -463,24 +604,163 @@ ecma_gc_sweep (ecma_object_t *object_p) /**< object to free */
     }
   }
 
-  JERRY_ASSERT (ecma_gc_objects_number > 0);
-  ecma_gc_objects_number--;
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_objects_number) > 0);
+  JERRY_CONTEXT (ecma_gc_objects_number)--;
 
   ecma_dealloc_object (object_p);
 } /* ecma_gc_sweep */
 
+/**
+ * Mark the objects of the strong handles as roots
+ */
+static void
+ecma_gc_mark_handles (void)
+{
+  ecma_handle_t *entry_p = JERRY_CONTEXT (ecma_handle_table_p);
+  ecma_handle_t *end_p = entry_p + JERRY_CONTEXT (ecma_handle_table_size);
+
+  for (; entry_p < end_p; entry_p++)
+  {
+    if (entry_p->type == ECMA_HANDLE_STRONG)
+    {
+      ecma_gc_set_object_visited (entry_p->u.object_p, true);
+    }
+  }
+} /* ecma_gc_mark_handles */
+
+/**
+ * Clear the weak handles, whose objects are not marked, and notify the embedder
+ */
+static void
+ecma_gc_clear_weak_handles (void)
+{
+  for (uint32_t handle = 0; handle < JERRY_CONTEXT (ecma_handle_table_size); handle++)
+  {
+    ecma_handle_t *entry_p = JERRY_CONTEXT (ecma_handle_table_p) + handle;
+
+    if (entry_p->type == ECMA_HANDLE_WEAK
+        && entry_p->u.object_p != NULL
+        && !ecma_gc_is_object_visited (entry_p->u.object_p))
+    {
+      entry_p->u.object_p = NULL;
+
+      if (entry_p->weak_callback != (ecma_external_pointer_t) NULL)
+      {
+        jerry_dispatch_weak_handle_callback (entry_p->weak_callback, handle, entry_p->user_p);
+      }
+    }
+  }
+} /* ecma_gc_clear_weak_handles */
+
+/**
+ * Mark the values of the WeakMap entries, whose map and key are both marked
+ *
+ * Note:
+ *      an entry is an ephemeron: its value is reachable only through the key,
+ *      so the marking is repeated until no more values become reachable
+ *
+ * @return true - if any object was marked,
+ *         false - otherwise.
+ */
+static bool
+ecma_gc_mark_weakmap_values (void)
+{
+  bool marked_anything = false;
+
+  for (ecma_weakmap_t *weakmap_p = JERRY_CONTEXT (ecma_weakmaps_p);
+       weakmap_p != NULL;
+       weakmap_p = weakmap_p->next_p)
+  {
+    if (!ecma_gc_is_object_visited (weakmap_p->object_p))
+    {
+      continue;
+    }
+
+    for (uint32_t i = 0; i < weakmap_p->capacity; i++)
+    {
+      ecma_weakmap_entry_t *entry_p = weakmap_p->entries_p + i;
+
+      if (entry_p->key_p != NULL
+          && ecma_gc_is_object_visited (entry_p->key_p)
+          && ecma_is_value_object (entry_p->value))
+      {
+        ecma_object_t *value_obj_p = ecma_get_object_from_value (entry_p->value);
+
+        if (!ecma_gc_is_object_visited (value_obj_p))
+        {
+          ecma_gc_set_object_visited (value_obj_p, true);
+          marked_anything = true;
+        }
+      }
+    }
+  }
+
+  return marked_anything;
+} /* ecma_gc_mark_weakmap_values */
+
+/**
+ * Remove the WeakMaps, which are not marked, from the list of WeakMaps,
+ * and delete the entries of the marked WeakMaps, whose keys are not marked
+ *
+ * Note:
+ *      the hash tables are not resized here, as allocation is not allowed during garbage collection
+ */
+static void
+ecma_gc_prune_weakmaps (void)
+{
+  ecma_weakmap_t *prev_p = NULL;
+  ecma_weakmap_t *weakmap_p = JERRY_CONTEXT (ecma_weakmaps_p);
+
+  while (weakmap_p != NULL)
+  {
+    ecma_weakmap_t *next_p = weakmap_p->next_p;
+
+    if (!ecma_gc_is_object_visited (weakmap_p->object_p))
+    {
+      /* The hash table is freed together with the WeakMap object during sweep */
+      if (prev_p != NULL)
+      {
+        prev_p->next_p = next_p;
+      }
+      else
+      {
+        JERRY_CONTEXT (ecma_weakmaps_p) = next_p;
+      }
+    }
+    else
+    {
+      for (uint32_t i = 0; i < weakmap_p->capacity; i++)
+      {
+        ecma_weakmap_entry_t *entry_p = weakmap_p->entries_p + i;
+
+        if (entry_p->key_p != NULL && !ecma_gc_is_object_visited (entry_p->key_p))
+        {
+          ecma_free_value_if_not_object (entry_p->value);
+          entry_p->key_p = NULL;
+          entry_p->value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+          weakmap_p->count--;
+        }
+      }
+
+      prev_p = weakmap_p;
+    }
+
+    weakmap_p = next_p;
+  }
+} /* ecma_gc_prune_weakmaps */
+
 /**
  * Run garbage collecting
  */
 void
 ecma_gc_run (void)
 {
-  ecma_gc_new_objects_since_last_gc = 0;
+  JERRY_CONTEXT (ecma_gc_new_objects_since_last_gc) = 0;
 
-  JERRY_ASSERT (ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] == NULL);
 
   /* if some object is referenced from stack or globals (i.e. it is root), mark it */
-  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY];
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY];
        obj_iter_p != NULL;
        obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
   {
@@ -492,13 +772,17 @@ ecma_gc_run (void)
     }
   }
 
+  ecma_gc_mark_handles ();
+
   bool marked_anything_during_current_iteration = false;
 
   do
   {
     marked_anything_during_current_iteration = false;
 
-    for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY], *obj_prev_p = NULL, *obj_next_p;
+    for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY],
+                       *obj_prev_p = NULL,
+                       *obj_next_p;
          obj_iter_p != NULL;
          obj_iter_p = obj_next_p)
     {
@@ -507,8 +791,8 @@ ecma_gc_run (void)
       if (ecma_gc_is_object_visited (obj_iter_p))
       {
         /* Moving the object to list of marked objects */
-        ecma_gc_set_object_next (obj_iter_p, ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK]);
-        ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = obj_iter_p;
+        ecma_gc_set_object_next (obj_iter_p, JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK]);
+        JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] = obj_iter_p;
 
         if (likely (obj_prev_p != NULL))
         {
@@ -518,7 +802,7 @@ ecma_gc_run (void)
         }
         else
         {
-          ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = obj_next_p;
+          JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] = obj_next_p;
         }
 
         ecma_gc_mark (obj_iter_p);
@@ -530,10 +814,13 @@ ecma_gc_run (void)
       }
     }
   }
-  while (marked_anything_during_current_iteration);
+  while (marked_anything_during_current_iteration || ecma_gc_mark_weakmap_values ());
+
+  ecma_gc_prune_weakmaps ();
+  ecma_gc_clear_weak_handles ();
 
   /* Sweeping objects that are currently unmarked */
-  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY], *obj_next_p;
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY], *obj_next_p;
        obj_iter_p != NULL;
        obj_iter_p = obj_next_p)
   {
@@ -545,10 +832,11 @@ ecma_gc_run (void)
   }
 
   /* Unmarking all objects */
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK];
-  ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] =
+    JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK];
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] = NULL;
 
-  ecma_gc_visited_flip_flag = !ecma_gc_visited_flip_flag;
+  JERRY_CONTEXT (ecma_gc_visited_flip_flag) = !JERRY_CONTEXT (ecma_gc_visited_flip_flag);
 } /* ecma_gc_run */
 
 /**
@@ -564,7 +852,8 @@ ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity)
      * If there is enough newly allocated objects since last GC, probably it is worthwhile to start GC now.
      * Otherwise, probability to free sufficient space is considered to be low.
      */
-    if (ecma_gc_new_objects_since_last_gc * CONFIG_ECMA_GC_NEW_OBJECTS_SHARE_TO_START_GC > ecma_gc_objects_number)
+    if (JERRY_CONTEXT (ecma_gc_new_objects_since_last_gc) * CONFIG_ECMA_GC_NEW_OBJECTS_SHARE_TO_START_GC
+        > JERRY_CONTEXT (ecma_gc_objects_number))
     {
       ecma_gc_run ();
     }
@@ -575,6 +864,8 @@ ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity)
 
     /* Freeing as much memory as we currently can */
     ecma_lcache_invalidate_all ();
+    ecma_for_in_cache_invalidate_all ();
+    ecma_eval_cache_invalidate_all ();
 
     ecma_gc_run ();
   }
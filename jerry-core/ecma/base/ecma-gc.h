@@ -26,12 +26,29 @@
 #include "ecma-globals.h"
 #include "mem-allocator.h"
 
+/**
+ * An object's GC color
+ *
+ * Tri-color marking:
+ *   WHITE_GRAY, unvisited -> WHITE // not referenced by a live object or the reference not found yet
+ *   WHITE_GRAY, visited   -> GRAY  // referenced by some live object
+ *   BLACK                 -> BLACK // all referenced objects are gray or black
+ */
+typedef enum
+{
+  ECMA_GC_COLOR_WHITE_GRAY, /**< white or gray */
+  ECMA_GC_COLOR_BLACK, /**< black */
+  ECMA_GC_COLOR__COUNT /**< number of colors */
+} ecma_gc_color_t;
+
 extern void ecma_gc_init (void);
 extern void ecma_init_gc_info (ecma_object_t *);
 extern void ecma_ref_object (ecma_object_t *);
 extern void ecma_deref_object (ecma_object_t *);
 extern void ecma_gc_run (void);
 extern void ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t);
+extern bool ecma_gc_save_image (uint8_t *, size_t, size_t *);
+extern bool ecma_gc_load_image (const uint8_t *, size_t, size_t *);
 
 #endif /* !ECMA_GC_H */
 
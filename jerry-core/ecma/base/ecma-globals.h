@@ -180,6 +180,43 @@ typedef enum
    */
   ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE,
 
+  /**
+   * Backing store of an ArrayBuffer object (compressed pointer to ecma_arraybuffer_t)
+   */
+  ECMA_INTERNAL_PROPERTY_ARRAYBUFFER,
+
+  /**
+   * Viewed ArrayBuffer object and element type of a typed array or a DataView object
+   * (see also: ECMA_TYPEDARRAY_TYPE_POS)
+   */
+  ECMA_INTERNAL_PROPERTY_TYPEDARRAY_BUFFER,
+
+  /**
+   * Offset of a typed array or a DataView object in the viewed ArrayBuffer, in bytes
+   */
+  ECMA_INTERNAL_PROPERTY_TYPEDARRAY_OFFSET,
+
+  /**
+   * Length of a typed array in elements, or length of a DataView object in bytes
+   */
+  ECMA_INTERNAL_PROPERTY_TYPEDARRAY_LENGTH,
+
+  /**
+   * Property interceptors of a host object (external pointer to jerry_api_host_object_handlers_t)
+   */
+  ECMA_INTERNAL_PROPERTY_HOST_HANDLERS,
+
+  /**
+   * Property of a host object, which holds the value of the last requested host property
+   * (compressed pointer to ecma_property_t, or NULL)
+   */
+  ECMA_INTERNAL_PROPERTY_HOST_SLOT,
+
+  /**
+   * Entries of a WeakMap object (compressed pointer to ecma_weakmap_t)
+   */
+  ECMA_INTERNAL_PROPERTY_WEAKMAP,
+
   /**
    * Number of internal properties' types
    */
@@ -321,10 +358,35 @@ typedef enum
   ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION, /** One of built-in functions described in section 15
                                           of ECMA-262 v5 specification */
   ECMA_OBJECT_TYPE_ARGUMENTS, /**< Arguments object (10.6) */
-  ECMA_OBJECT_TYPE_ARRAY /**< Array object (15.4) */
-  // ECMA_OBJECT_TYPE_HOST /**< Host object */
+  ECMA_OBJECT_TYPE_ARRAY, /**< Array object (15.4) */
+  ECMA_OBJECT_TYPE_TYPEDARRAY, /**< Typed array object (ECMA-262 v6, 22.2) */
+  ECMA_OBJECT_TYPE_HOST /**< Host object, the properties of which are provided by the embedder */
 } ecma_object_type_t;
 
+/**
+ * Element types of typed arrays
+ */
+typedef enum
+{
+  ECMA_TYPEDARRAY_INT8, /**< Int8Array */
+  ECMA_TYPEDARRAY_UINT8, /**< Uint8Array */
+  ECMA_TYPEDARRAY_UINT8_CLAMPED, /**< Uint8ClampedArray */
+  ECMA_TYPEDARRAY_INT16, /**< Int16Array */
+  ECMA_TYPEDARRAY_UINT16, /**< Uint16Array */
+  ECMA_TYPEDARRAY_INT32, /**< Int32Array */
+  ECMA_TYPEDARRAY_UINT32, /**< Uint32Array */
+  ECMA_TYPEDARRAY_FLOAT32, /**< Float32Array */
+  ECMA_TYPEDARRAY_FLOAT64, /**< Float64Array */
+  ECMA_TYPEDARRAY_DATAVIEW /**< DataView object (not a typed array, its elements are bytes) */
+} ecma_typedarray_type_t;
+
+/**
+ * Position of the element type (ecma_typedarray_type_t) in value of
+ * ECMA_INTERNAL_PROPERTY_TYPEDARRAY_BUFFER internal property,
+ * the lower bits contain compressed pointer to the viewed ArrayBuffer object
+ */
+#define ECMA_TYPEDARRAY_TYPE_POS (ECMA_POINTER_FIELD_WIDTH)
+
 /**
  * Description of ECMA-object or lexical environment
  * (depending on is_lexical_environment).
@@ -580,6 +642,21 @@ typedef double ecma_number_t;
  */
 #define ECMA_NUMBER_HALF ((ecma_number_t) 0.5f)
 
+/**
+ * NaN value of ecma_number_t, usable in static initializers
+ *
+ * See also: ecma_number_make_nan
+ */
+#define ECMA_NUMBER_NAN ((ecma_number_t) (0.0 / 0.0))
+
+/**
+ * Positive and negative Infinity values of ecma_number_t, usable in static initializers
+ *
+ * See also: ecma_number_make_infinity
+ */
+#define ECMA_NUMBER_POSITIVE_INFINITY ((ecma_number_t) (1.0 / 0.0))
+#define ECMA_NUMBER_NEGATIVE_INFINITY ((ecma_number_t) (-1.0 / 0.0))
+
 /**
  * Minimum positive and maximum value of ecma-number
  */
@@ -686,6 +763,11 @@ typedef struct
   mem_cpointer_t next_chunk_cp;
 } ecma_collection_chunk_t;
 
+/**
+ * Representation for native external pointer
+ */
+typedef uintptr_t ecma_external_pointer_t;
+
 /**
  * Identifier for ecma-string's actual data container
  */
@@ -698,9 +780,69 @@ typedef enum
   ECMA_STRING_CONTAINER_UINT32_IN_DESC, /**< actual data is UInt32-represeneted Number
                                              stored locally in the string's descriptor */
   ECMA_STRING_CONTAINER_MAGIC_STRING, /**< the ecma-string is equal to one of ECMA magic strings */
-  ECMA_STRING_CONTAINER_MAGIC_STRING_EX /**< the ecma-string is equal to one of external magic strings */
+  ECMA_STRING_CONTAINER_MAGIC_STRING_EX, /**< the ecma-string is equal to one of external magic strings */
+  ECMA_STRING_CONTAINER_EXTERNAL /**< actual data is in an immutable buffer owned by the embedder,
+                                      described by an ecma_external_string_t on the heap */
 } ecma_string_container_t;
 
+/**
+ * Description of an immutable string buffer owned by the embedder
+ */
+typedef struct
+{
+  const lit_utf8_byte_t *buffer_p; /**< characters of the string */
+  lit_utf8_size_t size; /**< size of the buffer */
+  ecma_length_t length; /**< number of characters in the buffer */
+  ecma_external_pointer_t free_cb; /**< callback, which releases the buffer,
+                                    *   when the string is freed (jerry_api_string_free_callback_t) */
+} ecma_external_string_t;
+
+/**
+ * Backing store of an ArrayBuffer object
+ *
+ * Note:
+ *      if the store is allocated on the engine's heap,
+ *      the data immediately follows the descriptor
+ */
+typedef struct
+{
+  uint8_t *external_buffer_p; /**< buffer owned by the embedder, or NULL if the data follows the descriptor */
+  ecma_external_pointer_t free_cb; /**< callback, which releases the embedder's buffer,
+                                    *   when the ArrayBuffer is freed (jerry_api_arraybuffer_free_callback_t) */
+  uint32_t length; /**< length of the buffer, in bytes */
+} ecma_arraybuffer_t;
+
+/**
+ * Entry of a WeakMap object
+ *
+ * Note:
+ *      a free entry has NULL key and empty value,
+ *      a deleted entry has NULL key and undefined value
+ */
+typedef struct
+{
+  ecma_object_t *key_p; /**< key object, which is not referenced by the entry */
+  ecma_value_t value; /**< value, which is kept alive only while the key is alive
+                       *   (an object value is not referenced, like the value of a named data property) */
+} ecma_weakmap_entry_t;
+
+/**
+ * Hash table of a WeakMap object
+ *
+ * Note:
+ *      the entries are addressed with linear probing,
+ *      the capacity is always a power of 2
+ */
+typedef struct ecma_weakmap_t
+{
+  struct ecma_weakmap_t *next_p; /**< next WeakMap in the list of all WeakMaps */
+  ecma_object_t *object_p; /**< the WeakMap object */
+  ecma_weakmap_entry_t *entries_p; /**< entries, or NULL if the capacity is 0 */
+  uint32_t count; /**< number of live entries */
+  uint32_t used; /**< number of live and deleted entries */
+  uint32_t capacity; /**< number of entries */
+} ecma_weakmap_t;
+
 /**
  * ECMA string-value descriptor
  */
@@ -729,6 +871,9 @@ typedef struct ecma_string_t
     /** Compressed pointer to an ecma_number_t */
     __extension__ mem_cpointer_t number_cp : ECMA_POINTER_FIELD_WIDTH;
 
+    /** Compressed pointer to an ecma_external_string_t */
+    __extension__ mem_cpointer_t external_cp : ECMA_POINTER_FIELD_WIDTH;
+
     /** UInt32-represented number placed locally in the descriptor */
     uint32_t uint32_number;
 
@@ -743,11 +888,6 @@ typedef struct ecma_string_t
   } u;
 } ecma_string_t;
 
-/**
- * Representation for native external pointer
- */
-typedef uintptr_t ecma_external_pointer_t;
-
 /**
  * Compiled byte code data.
   */
@@ -764,6 +904,27 @@ typedef struct
  */
 #define ECMA_BYTECODE_REF_SHIFT 6
 
+/**
+ * Reference counter value of function code executed in place from a snapshot buffer.
+ * The references of such code are counted by the literal map of the snapshot.
+ */
+#define ECMA_BYTECODE_REF_SNAPSHOT 0x3ff
+
+/**
+ * Reference counter value of pinned compiled code (see also: ecma_bytecode_pin).
+ * Such code is not reference counted, it is freed when the engine is finalized.
+ */
+#define ECMA_BYTECODE_REF_PINNED 0x3fe
+
+/**
+ * Element of the list of pinned compiled code trees
+ */
+typedef struct
+{
+  mem_cpointer_t next_cp; /**< next element */
+  mem_cpointer_t bytecode_cp; /**< root of the compiled code tree */
+} ecma_pinned_bytecode_t;
+
 /**
  * @}
  */
@@ -0,0 +1,192 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-globals.h"
+#include "ecma-handle-table.h"
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+#include "mem-heap.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmahandletable Handle table of the embedder's object references
+ * @{
+ *
+ * The handles keep references of the embedder to objects without using the reference counter of the objects.
+ * The garbage collector marks the objects of the strong handles directly from the table, and clears
+ * the weak handles, whose objects are collected. The free entries of the table are linked into a list,
+ * so handles are created and released in constant time.
+ */
+
+/**
+ * Number of entries of the handle table, when the first handle is created
+ */
+#define ECMA_HANDLE_TABLE_INITIAL_SIZE (16)
+
+/**
+ * Double the size of the handle table, and link the new entries into the free list
+ */
+static void
+ecma_handle_table_grow (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_handle_table_free_list) == 0);
+
+  uint32_t old_size = JERRY_CONTEXT (ecma_handle_table_size);
+  uint32_t new_size = (old_size == 0) ? ECMA_HANDLE_TABLE_INITIAL_SIZE : old_size * 2;
+
+  if (new_size <= old_size)
+  {
+    jerry_fatal (ERR_OUT_OF_MEMORY);
+  }
+
+  /* The garbage collector, which may run during the allocation, uses the old table. */
+  ecma_handle_t *new_table_p = (ecma_handle_t *) mem_heap_alloc_block (new_size * sizeof (ecma_handle_t),
+                                                                       MEM_HEAP_ALLOC_LONG_TERM);
+  ecma_handle_t *old_table_p = JERRY_CONTEXT (ecma_handle_table_p);
+
+  if (old_table_p != NULL)
+  {
+    memcpy (new_table_p, old_table_p, old_size * sizeof (ecma_handle_t));
+    mem_heap_free_block (old_table_p);
+  }
+
+  for (uint32_t i = old_size; i < new_size; i++)
+  {
+    new_table_p[i].u.next_free = (i + 1 < new_size) ? i + 2 : 0;
+    new_table_p[i].type = ECMA_HANDLE_FREE;
+  }
+
+  JERRY_CONTEXT (ecma_handle_table_p) = new_table_p;
+  JERRY_CONTEXT (ecma_handle_table_size) = new_size;
+  JERRY_CONTEXT (ecma_handle_table_free_list) = old_size + 1;
+} /* ecma_handle_table_grow */
+
+/**
+ * Get an allocated entry of the handle table
+ *
+ * @return pointer to the entry
+ */
+static ecma_handle_t *
+ecma_handle_table_get_entry (uint32_t handle) /**< handle */
+{
+  JERRY_ASSERT (handle < JERRY_CONTEXT (ecma_handle_table_size));
+
+  ecma_handle_t *entry_p = JERRY_CONTEXT (ecma_handle_table_p) + handle;
+
+  JERRY_ASSERT (entry_p->type != ECMA_HANDLE_FREE);
+
+  return entry_p;
+} /* ecma_handle_table_get_entry */
+
+/**
+ * Create a handle, which references an object
+ *
+ * @return the handle (index of its entry in the handle table)
+ */
+uint32_t
+ecma_handle_table_create (ecma_object_t *object_p, /**< object */
+                          bool is_weak, /**< true - create a weak handle,
+                                         *   false - create a strong handle */
+                          ecma_external_pointer_t weak_callback, /**< callback of a weak handle, or NULL */
+                          ecma_external_pointer_t user_p) /**< user pointer passed to the weak callback */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (is_weak || weak_callback == (ecma_external_pointer_t) NULL);
+
+  if (JERRY_CONTEXT (ecma_handle_table_free_list) == 0)
+  {
+    ecma_handle_table_grow ();
+  }
+
+  uint32_t handle = JERRY_CONTEXT (ecma_handle_table_free_list) - 1;
+  ecma_handle_t *entry_p = JERRY_CONTEXT (ecma_handle_table_p) + handle;
+
+  JERRY_ASSERT (entry_p->type == ECMA_HANDLE_FREE);
+
+  JERRY_CONTEXT (ecma_handle_table_free_list) = entry_p->u.next_free;
+  JERRY_CONTEXT (ecma_handles_number)++;
+
+  entry_p->u.object_p = object_p;
+  entry_p->weak_callback = weak_callback;
+  entry_p->user_p = user_p;
+  entry_p->type = (uint8_t) (is_weak ? ECMA_HANDLE_WEAK : ECMA_HANDLE_STRONG);
+
+  return handle;
+} /* ecma_handle_table_create */
+
+/**
+ * Get the object of a handle
+ *
+ * @return pointer to the object,
+ *         NULL - if the object of the weak handle was collected.
+ */
+ecma_object_t *
+ecma_handle_table_get (uint32_t handle) /**< handle */
+{
+  return ecma_handle_table_get_entry (handle)->u.object_p;
+} /* ecma_handle_table_get */
+
+/**
+ * Release a handle
+ */
+void
+ecma_handle_table_release (uint32_t handle) /**< handle */
+{
+  ecma_handle_t *entry_p = ecma_handle_table_get_entry (handle);
+
+  entry_p->u.next_free = JERRY_CONTEXT (ecma_handle_table_free_list);
+  entry_p->type = ECMA_HANDLE_FREE;
+
+  JERRY_CONTEXT (ecma_handle_table_free_list) = handle + 1;
+
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_handles_number) > 0);
+  JERRY_CONTEXT (ecma_handles_number)--;
+} /* ecma_handle_table_release */
+
+/**
+ * Check whether there are no allocated handles
+ *
+ * @return true - if no handle is allocated,
+ *         false - otherwise.
+ */
+bool
+ecma_handle_table_is_empty (void)
+{
+  return JERRY_CONTEXT (ecma_handles_number) == 0;
+} /* ecma_handle_table_is_empty */
+
+/**
+ * Release all handles (without calling the weak callbacks) and free the handle table
+ */
+void
+ecma_handle_table_finalize (void)
+{
+  if (JERRY_CONTEXT (ecma_handle_table_p) != NULL)
+  {
+    mem_heap_free_block (JERRY_CONTEXT (ecma_handle_table_p));
+  }
+
+  JERRY_CONTEXT (ecma_handle_table_p) = NULL;
+  JERRY_CONTEXT (ecma_handle_table_size) = 0;
+  JERRY_CONTEXT (ecma_handle_table_free_list) = 0;
+  JERRY_CONTEXT (ecma_handles_number) = 0;
+} /* ecma_handle_table_finalize */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,67 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_HANDLE_TABLE_H
+#define ECMA_HANDLE_TABLE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmahandletable Handle table of the embedder's object references
+ * @{
+ */
+
+/**
+ * Type of a handle table entry
+ */
+typedef enum
+{
+  ECMA_HANDLE_FREE, /**< unused entry, which is linked into the free list */
+  ECMA_HANDLE_STRONG, /**< strong handle, its object is a root of the garbage collector */
+  ECMA_HANDLE_WEAK /**< weak handle, its object is not kept alive by the handle */
+} ecma_handle_type_t;
+
+/**
+ * Entry of the handle table
+ */
+typedef struct
+{
+  union
+  {
+    ecma_object_t *object_p; /**< referenced object, or NULL - if the object of a weak handle was collected */
+    uint32_t next_free; /**< index + 1 of the next free entry, or 0 - for the last free entry */
+  } u;
+
+  ecma_external_pointer_t weak_callback; /**< callback of a weak handle (jerry_api_weak_handle_callback_t),
+                                          *   or NULL */
+  ecma_external_pointer_t user_p; /**< user pointer passed to the weak callback */
+  uint8_t type; /**< type of the entry (ecma_handle_type_t) */
+} ecma_handle_t;
+
+extern uint32_t ecma_handle_table_create (ecma_object_t *, bool, ecma_external_pointer_t, ecma_external_pointer_t);
+extern ecma_object_t *ecma_handle_table_get (uint32_t);
+extern void ecma_handle_table_release (uint32_t);
+extern bool ecma_handle_table_is_empty (void);
+extern void ecma_handle_table_finalize (void);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* ECMA_HANDLE_TABLE_H */
@@ -31,7 +31,8 @@
  *      property identifier should be one of the following:
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_CODE;
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE;
- *        - ECMA_INTERNAL_PROPERTY_FREE_CALLBACK.
+ *        - ECMA_INTERNAL_PROPERTY_FREE_CALLBACK;
+ *        - ECMA_INTERNAL_PROPERTY_HOST_HANDLERS.
  *
  * @return true - if property was just created with specified value,
  *         false - otherwise, if property existed before the call, it's value was updated.
@@ -44,7 +45,8 @@ ecma_create_external_pointer_property (ecma_object_t *obj_p, /**< object to crea
 {
   JERRY_ASSERT (id == ECMA_INTERNAL_PROPERTY_NATIVE_CODE
                 || id == ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE
-                || id == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK);
+                || id == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK
+                || id == ECMA_INTERNAL_PROPERTY_HOST_HANDLERS);
 
   bool is_new;
   ecma_property_t *prop_p = ecma_find_internal_property (obj_p, id);
@@ -95,7 +97,8 @@ ecma_create_external_pointer_property (ecma_object_t *obj_p, /**< object to crea
  *      property identifier should be one of the following:
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_CODE;
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE;
- *        - ECMA_INTERNAL_PROPERTY_FREE_CALLBACK.
+ *        - ECMA_INTERNAL_PROPERTY_FREE_CALLBACK;
+ *        - ECMA_INTERNAL_PROPERTY_HOST_HANDLERS.
  *
  * @return true - if property exists and it's value is returned through out_pointer_p,
  *         false - otherwise (value returned through out_pointer_p is NULL).
@@ -108,7 +111,8 @@ ecma_get_external_pointer_value (ecma_object_t *obj_p, /**< object to get proper
 {
   JERRY_ASSERT (id == ECMA_INTERNAL_PROPERTY_NATIVE_CODE
                 || id == ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE
-                || id == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK);
+                || id == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK
+                || id == ECMA_INTERNAL_PROPERTY_HOST_HANDLERS);
 
   ecma_property_t *prop_p = ecma_find_internal_property (obj_p, id);
 
@@ -142,14 +146,16 @@ ecma_get_external_pointer_value (ecma_object_t *obj_p, /**< object to get proper
  *      property identifier should be one of the following:
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_CODE;
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE;
- *        - ECMA_INTERNAL_PROPERTY_FREE_CALLBACK.
+ *        - ECMA_INTERNAL_PROPERTY_FREE_CALLBACK;
+ *        - ECMA_INTERNAL_PROPERTY_HOST_HANDLERS.
  */
 void
 ecma_free_external_pointer_in_property (ecma_property_t *prop_p) /**< internal property */
 {
   JERRY_ASSERT (prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_NATIVE_CODE
                 || prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE
-                || prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK);
+                || prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK
+                || prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_HOST_HANDLERS);
 
   if (sizeof (ecma_external_pointer_t) == sizeof (uint32_t))
   {
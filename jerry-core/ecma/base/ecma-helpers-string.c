@@ -25,6 +25,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "lit-char-helpers.h"
@@ -33,6 +34,9 @@
 #include "rcs-records.h"
 #include "vm.h"
 
+#define JERRY_INTERNAL
+#include "jerry-internal.h"
+
 /**
  * Maximum length of strings' concatenation
  */
@@ -420,6 +424,66 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
   return string_desc_p;
 } /* ecma_new_ecma_string_from_utf8 */
 
+/**
+ * Allocate new ecma-string, which references an immutable buffer owned by the embedder
+ *
+ * Note:
+ *      the buffer must be kept alive and unchanged until the free callback is called;
+ *      if the string is equal to a magic string, the buffer is not referenced,
+ *      and the callback is called before the function returns
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_new_ecma_external_string (const lit_utf8_byte_t *string_p, /**< utf-8 string */
+                               lit_utf8_size_t string_size, /**< string size */
+                               ecma_external_pointer_t free_cb) /**< callback, which releases the buffer
+                                                                 *   (jerry_api_string_free_callback_t) */
+{
+  JERRY_ASSERT (string_p != NULL || string_size == 0);
+  JERRY_ASSERT (lit_is_cesu8_string_valid (string_p, string_size));
+
+  ecma_string_t *string_desc_p = NULL;
+
+  lit_magic_string_id_t magic_string_id;
+  lit_magic_string_ex_id_t magic_string_ex_id;
+
+  if (lit_is_utf8_string_magic (string_p, string_size, &magic_string_id))
+  {
+    string_desc_p = ecma_get_magic_string (magic_string_id);
+  }
+  else if (lit_is_ex_utf8_string_magic (string_p, string_size, &magic_string_ex_id))
+  {
+    string_desc_p = ecma_get_magic_string_ex (magic_string_ex_id);
+  }
+
+  if (string_desc_p != NULL)
+  {
+    jerry_dispatch_external_string_free_callback (free_cb, string_p, string_size);
+    return string_desc_p;
+  }
+
+  ecma_external_string_t *external_p;
+  external_p = (ecma_external_string_t *) mem_heap_alloc_block (sizeof (ecma_external_string_t),
+                                                                MEM_HEAP_ALLOC_SHORT_TERM);
+  external_p->buffer_p = string_p;
+  external_p->size = string_size;
+  external_p->length = lit_utf8_string_length (string_p, string_size);
+  external_p->free_cb = free_cb;
+
+  string_desc_p = ecma_alloc_string ();
+  string_desc_p->refs = 1;
+  string_desc_p->container = ECMA_STRING_CONTAINER_EXTERNAL;
+  string_desc_p->hash = lit_utf8_string_calc_hash (string_p, string_size);
+
+  string_desc_p->u.common_field = 0;
+  ECMA_SET_NON_NULL_POINTER (string_desc_p->u.external_cp, external_p);
+
+  JERRY_CONTEXT (ecma_external_strings_number)++;
+
+  return string_desc_p;
+} /* ecma_new_ecma_external_string */
+
 /**
  * Allocate new ecma-string and fill it with cesu-8 character which represents specified code unit
  *
@@ -651,6 +715,17 @@ ecma_copy_ecma_string (ecma_string_t *string_desc_p) /**< string descriptor */
       break;
     }
 
+    case ECMA_STRING_CONTAINER_EXTERNAL:
+    {
+      /* The external buffer can only be released once, so the characters are copied to the heap. */
+      const ecma_external_string_t *external_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                            string_desc_p->u.external_cp);
+
+      new_str_p = ecma_new_ecma_string_from_utf8 (external_p->buffer_p, external_p->size);
+
+      break;
+    }
+
     default:
     {
       JERRY_UNREACHABLE ();
@@ -739,6 +814,19 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
 
       break;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL:
+    {
+      ecma_external_string_t *external_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                      string_p->u.external_cp);
+
+      JERRY_ASSERT (JERRY_CONTEXT (ecma_external_strings_number) > 0);
+      JERRY_CONTEXT (ecma_external_strings_number)--;
+
+      jerry_dispatch_external_string_free_callback (external_p->free_cb, external_p->buffer_p, external_p->size);
+      mem_heap_free_block (external_p);
+
+      break;
+    }
     case ECMA_STRING_CONTAINER_LIT_TABLE:
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
@@ -803,6 +891,14 @@ ecma_string_to_number (const ecma_string_t *str_p) /**< ecma-string */
       return *num_p;
     }
 
+    case ECMA_STRING_CONTAINER_EXTERNAL:
+    {
+      const ecma_external_string_t *external_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                            str_p->u.external_cp);
+
+      return ecma_utf8_string_to_number (external_p->buffer_p, external_p->size);
+    }
+
     case ECMA_STRING_CONTAINER_LIT_TABLE:
     case ECMA_STRING_CONTAINER_HEAP_CHUNKS:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
@@ -905,6 +1001,15 @@ ecma_string_to_utf8_string (const ecma_string_t *string_desc_p, /**< ecma-string
 
       break;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL:
+    {
+      const ecma_external_string_t *external_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                            string_desc_p->u.external_cp);
+
+      memcpy (buffer_p, external_p->buffer_p, external_p->size);
+
+      break;
+    }
     case ECMA_STRING_CONTAINER_LIT_TABLE:
     {
       lit_literal_t lit = lit_get_literal_by_cp (string_desc_p->u.lit_cp);
@@ -999,7 +1104,8 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
       default:
       {
         JERRY_ASSERT (string1_p->container == ECMA_STRING_CONTAINER_HEAP_NUMBER
-                      || string1_p->container == ECMA_STRING_CONTAINER_HEAP_CHUNKS);
+                      || string1_p->container == ECMA_STRING_CONTAINER_HEAP_CHUNKS
+                      || string1_p->container == ECMA_STRING_CONTAINER_EXTERNAL);
         break;
       }
     }
@@ -1047,6 +1153,15 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
 
         return ecma_compare_chars_collection (chars_collection1_p, chars_collection2_p);
       }
+      case ECMA_STRING_CONTAINER_EXTERNAL:
+      {
+        const ecma_external_string_t *external1_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                               string1_p->u.external_cp);
+        const ecma_external_string_t *external2_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                               string2_p->u.external_cp);
+
+        return memcmp (external1_p->buffer_p, external2_p->buffer_p, strings_size) == 0;
+      }
       default:
       {
         JERRY_ASSERT (false);
@@ -1309,6 +1424,10 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
     {
       return (ecma_length_t) ecma_string_get_heap_number_size (string_p->u.number_cp);
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL:
+    {
+      return ECMA_GET_NON_NULL_POINTER (ecma_external_string_t, string_p->u.external_cp)->length;
+    }
     default:
     {
       JERRY_ASSERT ((ecma_string_container_t) string_p->container == ECMA_STRING_CONTAINER_HEAP_CHUNKS);
@@ -1354,6 +1473,10 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
     {
       return ecma_string_get_heap_number_size (string_p->u.number_cp);
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL:
+    {
+      return ECMA_GET_NON_NULL_POINTER (ecma_external_string_t, string_p->u.external_cp)->size;
+    }
     default:
     {
       JERRY_ASSERT ((ecma_string_container_t) string_p->container == ECMA_STRING_CONTAINER_HEAP_CHUNKS);
@@ -1365,6 +1488,47 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
   }
 } /* ecma_string_get_size */
 
+/**
+ * Get the characters of an ecma-string, if they are stored in a contiguous buffer
+ *
+ * Note:
+ *      the buffer is valid while the string is referenced
+ *
+ * @return pointer to the characters - if the string is stored in an external buffer or it is a magic string,
+ *         NULL - otherwise (the characters should be copied with ecma_string_to_utf8_string).
+ */
+const lit_utf8_byte_t *
+ecma_string_get_chars_buffer (const ecma_string_t *string_p, /**< ecma-string */
+                              lit_utf8_size_t *out_size_p) /**< out: size of the characters */
+{
+  switch ((ecma_string_container_t) string_p->container)
+  {
+    case ECMA_STRING_CONTAINER_EXTERNAL:
+    {
+      const ecma_external_string_t *external_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                            string_p->u.external_cp);
+
+      *out_size_p = external_p->size;
+      return external_p->buffer_p;
+    }
+    case ECMA_STRING_CONTAINER_MAGIC_STRING:
+    {
+      *out_size_p = lit_get_magic_string_size (string_p->u.magic_string_id);
+      return lit_get_magic_string_utf8 (string_p->u.magic_string_id);
+    }
+    case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
+    {
+      *out_size_p = lit_get_magic_string_ex_size (string_p->u.magic_string_ex_id);
+      return lit_get_magic_string_ex_utf8 (string_p->u.magic_string_ex_id);
+    }
+    default:
+    {
+      *out_size_p = 0;
+      return NULL;
+    }
+  }
+} /* ecma_string_get_chars_buffer */
+
 /**
  * Get character from specified position in the ecma-string.
  *
@@ -1377,6 +1541,14 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
   ecma_length_t string_length = ecma_string_get_length (string_p);
   JERRY_ASSERT (index < string_length);
 
+  if (string_p->container == ECMA_STRING_CONTAINER_EXTERNAL)
+  {
+    const ecma_external_string_t *external_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                          string_p->u.external_cp);
+
+    return lit_utf8_string_code_unit_at (external_p->buffer_p, external_p->size, index);
+  }
+
   lit_utf8_size_t buffer_size = ecma_string_get_size (string_p);
 
   ecma_char_t ch;
@@ -1405,6 +1577,11 @@ ecma_string_get_byte_at_pos (const ecma_string_t *string_p, /**< ecma-string */
   lit_utf8_size_t buffer_size = ecma_string_get_size (string_p);
   JERRY_ASSERT (index < (lit_utf8_size_t) buffer_size);
 
+  if (string_p->container == ECMA_STRING_CONTAINER_EXTERNAL)
+  {
+    return ECMA_GET_NON_NULL_POINTER (ecma_external_string_t, string_p->u.external_cp)->buffer_p[index];
+  }
+
   lit_utf8_byte_t byte;
 
   MEM_DEFINE_LOCAL_ARRAY (utf8_str_p, buffer_size, lit_utf8_byte_t);
@@ -22,14 +22,20 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-for-in-cache.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
+#include "jcontext.h"
 #include "jrt-bit-fields.h"
 #include "byte-code.h"
+#include "js-parser.h"
 #include "re-compiler.h"
 
+#define JERRY_INTERNAL
+#include "jerry-internal.h"
+
 /**
  * Create an object with specified prototype object
  * (or NULL prototype if there is not prototype for the object)
@@ -544,6 +550,7 @@ ecma_create_named_data_property (ecma_object_t *obj_p, /**< object */
   ecma_set_property_list (obj_p, prop_p);
 
   ecma_lcache_invalidate (obj_p, name_p, NULL);
+  ecma_for_in_cache_invalidate (obj_p);
 
   return prop_p;
 } /* ecma_create_named_data_property */
@@ -596,6 +603,7 @@ ecma_create_named_accessor_property (ecma_object_t *obj_p, /**< object */
   ecma_set_named_accessor_property_setter (obj_p, prop_p, set_p);
 
   ecma_lcache_invalidate (obj_p, name_p, NULL);
+  ecma_for_in_cache_invalidate (obj_p);
 
   return prop_p;
 } /* ecma_create_named_accessor_property */
@@ -787,6 +795,7 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
     case ECMA_INTERNAL_PROPERTY_NATIVE_CODE: /* an external pointer */
     case ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE: /* an external pointer */
     case ECMA_INTERNAL_PROPERTY_FREE_CALLBACK: /* an external pointer */
+    case ECMA_INTERNAL_PROPERTY_HOST_HANDLERS: /* an external pointer */
     {
       ecma_free_external_pointer_in_property (property_p);
 
@@ -805,7 +814,47 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
     case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_0_31: /* an integer (bit-mask) */
     case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_32_63: /* an integer (bit-mask) */
     case ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_TARGET_FUNCTION:
+    case ECMA_INTERNAL_PROPERTY_TYPEDARRAY_BUFFER: /* compressed pointer to an object, and an enum */
+    case ECMA_INTERNAL_PROPERTY_TYPEDARRAY_OFFSET: /* an integer */
+    case ECMA_INTERNAL_PROPERTY_TYPEDARRAY_LENGTH: /* an integer */
+    case ECMA_INTERNAL_PROPERTY_HOST_SLOT: /* compressed pointer to an own property */
+    {
+      break;
+    }
+
+    case ECMA_INTERNAL_PROPERTY_ARRAYBUFFER: /* compressed pointer to an ecma_arraybuffer_t */
     {
+      ecma_arraybuffer_t *arraybuffer_p = ECMA_GET_NON_NULL_POINTER (ecma_arraybuffer_t, property_value);
+
+      if (arraybuffer_p->external_buffer_p != NULL)
+      {
+        jerry_dispatch_arraybuffer_free_callback (arraybuffer_p->free_cb,
+                                                  arraybuffer_p->external_buffer_p,
+                                                  arraybuffer_p->length);
+      }
+
+      mem_heap_free_block (arraybuffer_p);
+      break;
+    }
+
+    case ECMA_INTERNAL_PROPERTY_WEAKMAP: /* compressed pointer to an ecma_weakmap_t */
+    {
+      ecma_weakmap_t *weakmap_p = ECMA_GET_NON_NULL_POINTER (ecma_weakmap_t, property_value);
+
+      for (uint32_t i = 0; i < weakmap_p->capacity; i++)
+      {
+        if (weakmap_p->entries_p[i].key_p != NULL)
+        {
+          ecma_free_value_if_not_object (weakmap_p->entries_p[i].value);
+        }
+      }
+
+      if (weakmap_p->entries_p != NULL)
+      {
+        mem_heap_free_block (weakmap_p->entries_p);
+      }
+
+      mem_heap_free_block (weakmap_p);
       break;
     }
 
@@ -895,6 +944,9 @@ void
 ecma_delete_property (ecma_object_t *obj_p, /**< object */
                       ecma_property_t *prop_p) /**< property */
 {
+  ecma_for_in_cache_invalidate (obj_p);
+  ecma_for_in_cache_notify_delete ();
+
   for (ecma_property_t *cur_prop_p = ecma_get_property_list (obj_p), *prev_prop_p = NULL, *next_prop_p;
        cur_prop_p != NULL;
        prev_prop_p = cur_prop_p, cur_prop_p = next_prop_p)
@@ -1327,6 +1379,43 @@ ecma_get_property_descriptor_from_property (ecma_property_t *prop_p) /**< proper
   return prop_desc;
 } /* ecma_get_property_descriptor_from_property */
 
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+
+/**
+ * Free the literal map of a snapshot executed in place, together with its compiled code.
+ */
+static void
+ecma_free_snapshot_literal_map (cbc_snapshot_literal_map_t *literal_map_p) /**< literal map */
+{
+  lit_cpointer_t *entries_p = (lit_cpointer_t *) (literal_map_p + 1);
+
+  for (uint32_t i = literal_map_p->compiled_code_start; i < literal_map_p->entries_num; i++)
+  {
+    if (entries_p[i].u.packed_value == MEM_CP_NULL)
+    {
+      /* The compiled code has never been instantiated. */
+      continue;
+    }
+
+    ecma_compiled_code_t *bytecode_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t,
+                                                                  entries_p[i].u.value.base_cp);
+
+    if (bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
+    {
+      JERRY_ASSERT (CBC_IS_IN_SNAPSHOT (bytecode_p));
+      mem_heap_free_block (bytecode_p);
+    }
+    else
+    {
+      ecma_bytecode_deref (bytecode_p);
+    }
+  }
+
+  mem_heap_free_block (literal_map_p);
+} /* ecma_free_snapshot_literal_map */
+
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
 /**
  * Increase reference counter of Compact
  * Byte Code or regexp byte code.
@@ -1334,8 +1423,22 @@ ecma_get_property_descriptor_from_property (ecma_property_t *prop_p) /**< proper
 void
 ecma_bytecode_ref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
 {
-  /* Abort program if maximum reference number is reached. */
-  if ((bytecode_p->status_flags >> ECMA_BYTECODE_REF_SHIFT) >= 0x3ff)
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  if (CBC_IS_IN_SNAPSHOT (bytecode_p))
+  {
+    cbc_get_snapshot_literal_map (bytecode_p)->refs++;
+    return;
+  }
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
+  if ((bytecode_p->status_flags >> ECMA_BYTECODE_REF_SHIFT) == ECMA_BYTECODE_REF_PINNED)
+  {
+    return;
+  }
+
+  /* Abort program if maximum reference number is reached.
+   * The two highest values are reserved for ECMA_BYTECODE_REF_PINNED and ECMA_BYTECODE_REF_SNAPSHOT. */
+  if ((bytecode_p->status_flags >> ECMA_BYTECODE_REF_SHIFT) >= ECMA_BYTECODE_REF_PINNED - 1)
   {
     jerry_fatal (ERR_REF_COUNT_LIMIT);
   }
@@ -1350,6 +1453,26 @@ ecma_bytecode_ref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
 void
 ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
 {
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  if (CBC_IS_IN_SNAPSHOT (bytecode_p))
+  {
+    cbc_snapshot_literal_map_t *literal_map_p = cbc_get_snapshot_literal_map (bytecode_p);
+
+    JERRY_ASSERT (literal_map_p->refs > 0);
+
+    if (--literal_map_p->refs == 0)
+    {
+      ecma_free_snapshot_literal_map (literal_map_p);
+    }
+    return;
+  }
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
+  if ((bytecode_p->status_flags >> ECMA_BYTECODE_REF_SHIFT) == ECMA_BYTECODE_REF_PINNED)
+  {
+    return;
+  }
+
   JERRY_ASSERT ((bytecode_p->status_flags >> ECMA_BYTECODE_REF_SHIFT) > 0);
 
   bytecode_p->status_flags = (uint16_t) (bytecode_p->status_flags - (1u << ECMA_BYTECODE_REF_SHIFT));
@@ -1360,7 +1483,16 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
     return;
   }
 
-  if (bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
+  if (CBC_IS_LAZY_FUNCTION (bytecode_p))
+  {
+    cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) bytecode_p;
+
+    if (lazy_function_p->compiled_code_cp != MEM_CP_NULL)
+    {
+      ecma_bytecode_deref (MEM_CP_GET_NON_NULL_POINTER (ecma_compiled_code_t, lazy_function_p->compiled_code_cp));
+    }
+  }
+  else if (bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
   {
     lit_cpointer_t *literal_start_p = NULL;
     uint32_t literal_end;
@@ -1410,6 +1542,230 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
   mem_heap_free_block (bytecode_p);
 } /* ecma_bytecode_deref */
 
+/**
+ * Get the nested function code literals of a function code
+ *
+ * @return pointer to the first nested function code literal
+ */
+static lit_cpointer_t *
+ecma_bytecode_get_nested_code (ecma_compiled_code_t *bytecode_p, /**< function code */
+                               uint32_t *out_count_p) /**< out: number of nested function code literals */
+{
+  JERRY_ASSERT (bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION);
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_p;
+    *out_count_p = (uint32_t) (args_p->literal_end - args_p->const_literal_end);
+    return ((lit_cpointer_t *) (args_p + 1)) + args_p->const_literal_end;
+  }
+
+  cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_p;
+  *out_count_p = (uint32_t) (args_p->literal_end - args_p->const_literal_end);
+  return ((lit_cpointer_t *) (args_p + 1)) + args_p->const_literal_end;
+} /* ecma_bytecode_get_nested_code */
+
+/**
+ * Check whether the reference counter of a compiled code or of its nested function code reaches a limit
+ *
+ * Note:
+ *      pinned code and function code executed in place from a snapshot buffer are ignored,
+ *      since their reference counters are not changed
+ *
+ * @return true - if any reference counter of the tree is greater than or equal to the limit,
+ *         false - otherwise.
+ */
+bool
+ecma_bytecode_tree_reaches_refs (ecma_compiled_code_t *bytecode_p, /**< byte code pointer */
+                                 uint32_t refs_limit) /**< limit of the reference counters */
+{
+  uint32_t refs = (uint32_t) bytecode_p->status_flags >> ECMA_BYTECODE_REF_SHIFT;
+
+  if (refs == ECMA_BYTECODE_REF_PINNED || refs == ECMA_BYTECODE_REF_SNAPSHOT)
+  {
+    return false;
+  }
+
+  if (refs >= refs_limit)
+  {
+    return true;
+  }
+
+  if (CBC_IS_LAZY_FUNCTION (bytecode_p))
+  {
+    mem_cpointer_t compiled_code_cp = ((cbc_lazy_function_t *) bytecode_p)->compiled_code_cp;
+
+    return (compiled_code_cp != MEM_CP_NULL
+            && ecma_bytecode_tree_reaches_refs (MEM_CP_GET_NON_NULL_POINTER (ecma_compiled_code_t, compiled_code_cp),
+                                                refs_limit));
+  }
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
+  {
+    uint32_t nested_count;
+    lit_cpointer_t *nested_p = ecma_bytecode_get_nested_code (bytecode_p, &nested_count);
+
+    for (uint32_t i = 0; i < nested_count; i++)
+    {
+      ecma_compiled_code_t *nested_code_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t,
+                                                                       nested_p[i].u.value.base_cp);
+
+      /* Self references are ignored. */
+      if (nested_code_p != bytecode_p
+          && ecma_bytecode_tree_reaches_refs (nested_code_p, refs_limit))
+      {
+        return true;
+      }
+    }
+  }
+
+  return false;
+} /* ecma_bytecode_tree_reaches_refs */
+
+/**
+ * Pin the reference counter of a compiled code and its nested function code
+ *
+ * Note:
+ *      lazy function code is compiled in advance, if the compilation fails, the
+ *      error is reported when the function is called (as without pinning);
+ *      function code executed in place from a snapshot buffer is not modified,
+ *      since its references are counted by the literal map of the snapshot
+ */
+static void
+ecma_bytecode_pin_tree (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
+{
+  uint32_t refs = (uint32_t) bytecode_p->status_flags >> ECMA_BYTECODE_REF_SHIFT;
+
+  if (refs == ECMA_BYTECODE_REF_PINNED || refs == ECMA_BYTECODE_REF_SNAPSHOT)
+  {
+    return;
+  }
+
+  bytecode_p->status_flags &= (1u << ECMA_BYTECODE_REF_SHIFT) - 1;
+  bytecode_p->status_flags |= ECMA_BYTECODE_REF_PINNED << ECMA_BYTECODE_REF_SHIFT;
+
+  if (CBC_IS_LAZY_FUNCTION (bytecode_p))
+  {
+    ecma_compiled_code_t *compiled_code_p;
+
+    if (parser_compile_lazy_function (bytecode_p, &compiled_code_p) == JSP_STATUS_OK)
+    {
+      ecma_bytecode_pin_tree (compiled_code_p);
+    }
+  }
+  else if (bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
+  {
+    uint32_t nested_count;
+    lit_cpointer_t *nested_p = ecma_bytecode_get_nested_code (bytecode_p, &nested_count);
+
+    for (uint32_t i = 0; i < nested_count; i++)
+    {
+      /* Self references are already pinned. */
+      ecma_bytecode_pin_tree (ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t, nested_p[i].u.value.base_cp));
+    }
+  }
+} /* ecma_bytecode_pin_tree */
+
+/**
+ * Restore the reference counters of a pinned compiled code and its nested function code
+ *
+ * Note:
+ *      the compiled code is referenced by the code containing it (or the list
+ *      of pinned code) only, when the engine is finalized
+ */
+static void
+ecma_bytecode_unpin_tree (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
+{
+  if ((bytecode_p->status_flags >> ECMA_BYTECODE_REF_SHIFT) != ECMA_BYTECODE_REF_PINNED)
+  {
+    return;
+  }
+
+  bytecode_p->status_flags &= (1u << ECMA_BYTECODE_REF_SHIFT) - 1;
+  bytecode_p->status_flags |= 1u << ECMA_BYTECODE_REF_SHIFT;
+
+  if (CBC_IS_LAZY_FUNCTION (bytecode_p))
+  {
+    mem_cpointer_t compiled_code_cp = ((cbc_lazy_function_t *) bytecode_p)->compiled_code_cp;
+
+    if (compiled_code_cp != MEM_CP_NULL)
+    {
+      ecma_bytecode_unpin_tree (MEM_CP_GET_NON_NULL_POINTER (ecma_compiled_code_t, compiled_code_cp));
+    }
+  }
+  else if (bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
+  {
+    uint32_t nested_count;
+    lit_cpointer_t *nested_p = ecma_bytecode_get_nested_code (bytecode_p, &nested_count);
+
+    for (uint32_t i = 0; i < nested_count; i++)
+    {
+      ecma_bytecode_unpin_tree (ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t, nested_p[i].u.value.base_cp));
+    }
+  }
+} /* ecma_bytecode_unpin_tree */
+
+/**
+ * Pin the reference counters of a compiled code tree
+ *
+ * Calls and closures no longer write the reference counters of the tree. The code
+ * stays in the heap of the engine, so other contexts can not reference it. Pinned
+ * code is freed by ecma_free_pinned_bytecode, when the engine is finalized.
+ */
+void
+ecma_bytecode_pin (ecma_compiled_code_t *bytecode_p) /**< root of the compiled code tree */
+{
+  uint32_t refs = (uint32_t) bytecode_p->status_flags >> ECMA_BYTECODE_REF_SHIFT;
+
+  if (refs == ECMA_BYTECODE_REF_PINNED || refs == ECMA_BYTECODE_REF_SNAPSHOT)
+  {
+    return;
+  }
+
+  ecma_pinned_bytecode_t *item_p = (ecma_pinned_bytecode_t *) mem_pools_alloc ();
+
+  ECMA_SET_NON_NULL_POINTER (item_p->bytecode_cp, bytecode_p);
+  item_p->next_cp = JERRY_CONTEXT (ecma_pinned_bytecode_list_cp);
+  ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_pinned_bytecode_list_cp), item_p);
+
+  ecma_bytecode_pin_tree (bytecode_p);
+} /* ecma_bytecode_pin */
+
+/**
+ * Check whether any compiled code is pinned
+ *
+ * @return true - if compiled code was pinned by ecma_bytecode_pin,
+ *         false - otherwise.
+ */
+bool
+ecma_has_pinned_bytecode (void)
+{
+  return JERRY_CONTEXT (ecma_pinned_bytecode_list_cp) != MEM_CP_NULL;
+} /* ecma_has_pinned_bytecode */
+
+/**
+ * Free the pinned compiled code
+ *
+ * Note:
+ *      the routine should be called after all objects and the global code are released
+ */
+void
+ecma_free_pinned_bytecode (void)
+{
+  while (JERRY_CONTEXT (ecma_pinned_bytecode_list_cp) != MEM_CP_NULL)
+  {
+    ecma_pinned_bytecode_t *item_p = ECMA_GET_NON_NULL_POINTER (ecma_pinned_bytecode_t,
+                                                                JERRY_CONTEXT (ecma_pinned_bytecode_list_cp));
+    ecma_compiled_code_t *bytecode_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t, item_p->bytecode_cp);
+
+    JERRY_CONTEXT (ecma_pinned_bytecode_list_cp) = item_p->next_cp;
+    mem_pools_free ((uint8_t *) item_p);
+
+    ecma_bytecode_unpin_tree (bytecode_p);
+    ecma_bytecode_deref (bytecode_p);
+  }
+} /* ecma_free_pinned_bytecode */
+
 /**
  * @}
  * @}
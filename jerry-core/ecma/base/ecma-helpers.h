@@ -85,6 +85,7 @@ extern void ecma_free_value_if_not_object (ecma_value_t);
 
 /* ecma-helpers-string.c */
 extern ecma_string_t *ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t);
+extern ecma_string_t *ecma_new_ecma_external_string (const lit_utf8_byte_t *, lit_utf8_size_t, ecma_external_pointer_t);
 extern ecma_string_t *ecma_new_ecma_string_from_code_unit (ecma_char_t);
 extern ecma_string_t *ecma_new_ecma_string_from_uint32 (uint32_t);
 extern ecma_string_t *ecma_new_ecma_string_from_number (ecma_number_t);
@@ -106,6 +107,7 @@ extern bool ecma_compare_ecma_strings (const ecma_string_t *, const ecma_string_
 extern bool ecma_compare_ecma_strings_relational (const ecma_string_t *, const ecma_string_t *);
 extern ecma_length_t ecma_string_get_length (const ecma_string_t *);
 extern lit_utf8_size_t ecma_string_get_size (const ecma_string_t *);
+extern const lit_utf8_byte_t *ecma_string_get_chars_buffer (const ecma_string_t *, lit_utf8_size_t *);
 extern ecma_char_t ecma_string_get_char_at_pos (const ecma_string_t *, ecma_length_t);
 extern lit_utf8_byte_t ecma_string_get_byte_at_pos (const ecma_string_t *, lit_utf8_size_t);
 
@@ -230,6 +232,10 @@ extern ecma_property_descriptor_t ecma_get_property_descriptor_from_property (ec
 
 extern void ecma_bytecode_ref (ecma_compiled_code_t *);
 extern void ecma_bytecode_deref (ecma_compiled_code_t *);
+extern bool ecma_bytecode_tree_reaches_refs (ecma_compiled_code_t *, uint32_t);
+extern void ecma_bytecode_pin (ecma_compiled_code_t *);
+extern bool ecma_has_pinned_bytecode (void);
+extern void ecma_free_pinned_bytecode (void);
 
 /* ecma-helpers-external-pointers.c */
 extern bool
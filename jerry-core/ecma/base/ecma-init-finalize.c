@@ -14,7 +14,10 @@
  */
 
 #include "ecma-builtins.h"
+#include "ecma-eval-cache.h"
+#include "ecma-for-in-cache.h"
 #include "ecma-gc.h"
+#include "ecma-handle-table.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
 #include "ecma-lcache.h"
@@ -36,6 +39,8 @@ ecma_init (void)
 {
   ecma_init_builtins ();
   ecma_lcache_init ();
+  ecma_for_in_cache_init ();
+  ecma_eval_cache_init ();
   ecma_init_environment ();
 
   mem_register_a_try_give_memory_back_callback (ecma_try_to_give_back_some_memory);
@@ -49,12 +54,81 @@ ecma_finalize (void)
 {
   mem_unregister_a_try_give_memory_back_callback (ecma_try_to_give_back_some_memory);
 
+  ecma_handle_table_finalize ();
   ecma_finalize_environment ();
   ecma_lcache_invalidate_all ();
+  ecma_for_in_cache_invalidate_all ();
+  ecma_eval_cache_invalidate_all ();
   ecma_finalize_builtins ();
   ecma_gc_run ();
 } /* ecma_finalize */
 
+/**
+ * Release the caches of ECMA components and collect unreferenced objects
+ * before the heap is saved to a heap image
+ */
+void
+ecma_prepare_image (void)
+{
+  ecma_lcache_invalidate_all ();
+  ecma_for_in_cache_invalidate_all ();
+  ecma_eval_cache_invalidate_all ();
+  ecma_gc_run ();
+} /* ecma_prepare_image */
+
+/**
+ * Save state of ECMA components to a heap image
+ *
+ * Note:
+ *      ecma_prepare_image should be called before the heap is saved
+ *
+ * @return true - if the state was written successfully,
+ *         false - if the buffer is too small, the heap contains objects that
+ *                 cannot be restored from an image, or the embedder holds handles.
+ */
+bool
+ecma_save_image (uint8_t *buffer_p, /**< buffer */
+                 size_t buffer_size, /**< size of buffer */
+                 size_t *in_out_buffer_offset_p) /**< in: offset to write to,
+                                                  *   out: offset, incremented on size of the written data */
+{
+  return (ecma_handle_table_is_empty ()
+          && ecma_gc_save_image (buffer_p, buffer_size, in_out_buffer_offset_p)
+          && ecma_save_builtins_image (buffer_p, buffer_size, in_out_buffer_offset_p)
+          && ecma_save_environment_image (buffer_p, buffer_size, in_out_buffer_offset_p));
+} /* ecma_save_image */
+
+/**
+ * Initialize ECMA components from a heap image
+ *
+ * Note:
+ *      the routine should be called instead of ecma_init, after the heap is restored
+ *
+ * @return true - if the state was restored successfully,
+ *         false - if the image is truncated.
+ */
+bool
+ecma_load_image (const uint8_t *buffer_p, /**< buffer */
+                 size_t buffer_size, /**< size of buffer */
+                 size_t *in_out_buffer_offset_p) /**< in: offset to read from,
+                                                  *   out: offset, incremented on size of the read data */
+{
+  if (!ecma_gc_load_image (buffer_p, buffer_size, in_out_buffer_offset_p)
+      || !ecma_load_builtins_image (buffer_p, buffer_size, in_out_buffer_offset_p)
+      || !ecma_load_environment_image (buffer_p, buffer_size, in_out_buffer_offset_p))
+  {
+    return false;
+  }
+
+  ecma_lcache_init ();
+  ecma_for_in_cache_init ();
+  ecma_eval_cache_init ();
+
+  mem_register_a_try_give_memory_back_callback (ecma_try_to_give_back_some_memory);
+
+  return true;
+} /* ecma_load_image */
+
 /**
  * @}
  * @}
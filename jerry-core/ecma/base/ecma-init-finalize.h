@@ -27,6 +27,9 @@
 
 extern void ecma_init (void);
 extern void ecma_finalize (void);
+extern void ecma_prepare_image (void);
+extern bool ecma_save_image (uint8_t *, size_t, size_t *);
+extern bool ecma_load_image (const uint8_t *, size_t, size_t *);
 
 /**
  * @}
@@ -0,0 +1,327 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-builtins.h"
+#include "ecma-globals.h"
+#include "ecma-typedarray-object.h"
+#include "jrt.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-dataview-prototype.inc.h"
+#define BUILTIN_UNDERSCORED_ID dataview_prototype
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup dataviewprototype ECMA DataView.prototype object built-in
+ * @{
+ */
+
+/**
+ * The DataView.prototype object's 'getInt8' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_int8 (ecma_value_t this_arg, /**< 'this' argument */
+                                                 ecma_value_t byte_offset, /**< byte offset */
+                                                 ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_get_value (this_arg, byte_offset, is_little_endian, ECMA_TYPEDARRAY_INT8);
+} /* ecma_builtin_dataview_prototype_object_get_int8 */
+
+/**
+ * The DataView.prototype object's 'getUint8' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_uint8 (ecma_value_t this_arg, /**< 'this' argument */
+                                                  ecma_value_t byte_offset, /**< byte offset */
+                                                  ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_get_value (this_arg, byte_offset, is_little_endian, ECMA_TYPEDARRAY_UINT8);
+} /* ecma_builtin_dataview_prototype_object_get_uint8 */
+
+/**
+ * The DataView.prototype object's 'getInt16' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_int16 (ecma_value_t this_arg, /**< 'this' argument */
+                                                  ecma_value_t byte_offset, /**< byte offset */
+                                                  ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_get_value (this_arg, byte_offset, is_little_endian, ECMA_TYPEDARRAY_INT16);
+} /* ecma_builtin_dataview_prototype_object_get_int16 */
+
+/**
+ * The DataView.prototype object's 'getUint16' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_uint16 (ecma_value_t this_arg, /**< 'this' argument */
+                                                   ecma_value_t byte_offset, /**< byte offset */
+                                                   ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_get_value (this_arg, byte_offset, is_little_endian, ECMA_TYPEDARRAY_UINT16);
+} /* ecma_builtin_dataview_prototype_object_get_uint16 */
+
+/**
+ * The DataView.prototype object's 'getInt32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_int32 (ecma_value_t this_arg, /**< 'this' argument */
+                                                  ecma_value_t byte_offset, /**< byte offset */
+                                                  ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_get_value (this_arg, byte_offset, is_little_endian, ECMA_TYPEDARRAY_INT32);
+} /* ecma_builtin_dataview_prototype_object_get_int32 */
+
+/**
+ * The DataView.prototype object's 'getUint32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_uint32 (ecma_value_t this_arg, /**< 'this' argument */
+                                                   ecma_value_t byte_offset, /**< byte offset */
+                                                   ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_get_value (this_arg, byte_offset, is_little_endian, ECMA_TYPEDARRAY_UINT32);
+} /* ecma_builtin_dataview_prototype_object_get_uint32 */
+
+/**
+ * The DataView.prototype object's 'getFloat32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_float32 (ecma_value_t this_arg, /**< 'this' argument */
+                                                    ecma_value_t byte_offset, /**< byte offset */
+                                                    ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_get_value (this_arg, byte_offset, is_little_endian, ECMA_TYPEDARRAY_FLOAT32);
+} /* ecma_builtin_dataview_prototype_object_get_float32 */
+
+/**
+ * The DataView.prototype object's 'getFloat64' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_float64 (ecma_value_t this_arg, /**< 'this' argument */
+                                                    ecma_value_t byte_offset, /**< byte offset */
+                                                    ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_get_value (this_arg, byte_offset, is_little_endian, ECMA_TYPEDARRAY_FLOAT64);
+} /* ecma_builtin_dataview_prototype_object_get_float64 */
+
+/**
+ * The DataView.prototype object's 'setInt8' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_int8 (ecma_value_t this_arg, /**< 'this' argument */
+                                                 ecma_value_t byte_offset, /**< byte offset */
+                                                 ecma_value_t value, /**< new value */
+                                                 ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_set_value (this_arg, byte_offset, is_little_endian, value, ECMA_TYPEDARRAY_INT8);
+} /* ecma_builtin_dataview_prototype_object_set_int8 */
+
+/**
+ * The DataView.prototype object's 'setUint8' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_uint8 (ecma_value_t this_arg, /**< 'this' argument */
+                                                  ecma_value_t byte_offset, /**< byte offset */
+                                                  ecma_value_t value, /**< new value */
+                                                  ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_set_value (this_arg, byte_offset, is_little_endian, value, ECMA_TYPEDARRAY_UINT8);
+} /* ecma_builtin_dataview_prototype_object_set_uint8 */
+
+/**
+ * The DataView.prototype object's 'setInt16' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_int16 (ecma_value_t this_arg, /**< 'this' argument */
+                                                  ecma_value_t byte_offset, /**< byte offset */
+                                                  ecma_value_t value, /**< new value */
+                                                  ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_set_value (this_arg, byte_offset, is_little_endian, value, ECMA_TYPEDARRAY_INT16);
+} /* ecma_builtin_dataview_prototype_object_set_int16 */
+
+/**
+ * The DataView.prototype object's 'setUint16' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_uint16 (ecma_value_t this_arg, /**< 'this' argument */
+                                                   ecma_value_t byte_offset, /**< byte offset */
+                                                   ecma_value_t value, /**< new value */
+                                                   ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_set_value (this_arg, byte_offset, is_little_endian, value, ECMA_TYPEDARRAY_UINT16);
+} /* ecma_builtin_dataview_prototype_object_set_uint16 */
+
+/**
+ * The DataView.prototype object's 'setInt32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_int32 (ecma_value_t this_arg, /**< 'this' argument */
+                                                  ecma_value_t byte_offset, /**< byte offset */
+                                                  ecma_value_t value, /**< new value */
+                                                  ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_set_value (this_arg, byte_offset, is_little_endian, value, ECMA_TYPEDARRAY_INT32);
+} /* ecma_builtin_dataview_prototype_object_set_int32 */
+
+/**
+ * The DataView.prototype object's 'setUint32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_uint32 (ecma_value_t this_arg, /**< 'this' argument */
+                                                   ecma_value_t byte_offset, /**< byte offset */
+                                                   ecma_value_t value, /**< new value */
+                                                   ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_set_value (this_arg, byte_offset, is_little_endian, value, ECMA_TYPEDARRAY_UINT32);
+} /* ecma_builtin_dataview_prototype_object_set_uint32 */
+
+/**
+ * The DataView.prototype object's 'setFloat32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_float32 (ecma_value_t this_arg, /**< 'this' argument */
+                                                    ecma_value_t byte_offset, /**< byte offset */
+                                                    ecma_value_t value, /**< new value */
+                                                    ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_set_value (this_arg, byte_offset, is_little_endian, value, ECMA_TYPEDARRAY_FLOAT32);
+} /* ecma_builtin_dataview_prototype_object_set_float32 */
+
+/**
+ * The DataView.prototype object's 'setFloat64' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_float64 (ecma_value_t this_arg, /**< 'this' argument */
+                                                    ecma_value_t byte_offset, /**< byte offset */
+                                                    ecma_value_t value, /**< new value */
+                                                    ecma_value_t is_little_endian) /**< byte order */
+{
+  return ecma_op_dataview_set_value (this_arg, byte_offset, is_little_endian, value, ECMA_TYPEDARRAY_FLOAT64);
+} /* ecma_builtin_dataview_prototype_object_set_float64 */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
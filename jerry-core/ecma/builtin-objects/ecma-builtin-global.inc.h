@@ -30,7 +30,7 @@
 #endif /* !NUMBER_VALUE */
 
 #ifndef OBJECT_VALUE
-# define OBJECT_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable)
+# define OBJECT_VALUE(name, builtin_id, prop_writable, prop_enumerable, prop_configurable)
 #endif /* !OBJECT_VALUE */
 
 #ifndef CP_UNIMPLEMENTED_VALUE
@@ -59,31 +59,31 @@ SIMPLE_VALUE (LIT_MAGIC_STRING_UNDEFINED,
 
 // ECMA-262 v5, 15.1.1.1
 NUMBER_VALUE (LIT_MAGIC_STRING_NAN,
-              ecma_number_make_nan (),
+              ECMA_NUMBER_NAN,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 // ECMA-262 v5, 15.1.1.2
 NUMBER_VALUE (LIT_MAGIC_STRING_INFINITY_UL,
-              ecma_number_make_infinity (false),
+              ECMA_NUMBER_POSITIVE_INFINITY,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 /* Object properties:
- *  (property name, object pointer getter) */
+ *  (property name, built-in object identifier) */
 
 // ECMA-262 v5, 15.1.4.1
 OBJECT_VALUE (LIT_MAGIC_STRING_OBJECT_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT),
+              ECMA_BUILTIN_ID_OBJECT,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
 
 // ECMA-262 v5, 15.1.4.2
 OBJECT_VALUE (LIT_MAGIC_STRING_FUNCTION_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_FUNCTION),
+              ECMA_BUILTIN_ID_FUNCTION,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
@@ -91,7 +91,7 @@ OBJECT_VALUE (LIT_MAGIC_STRING_FUNCTION_UL,
 // ECMA-262 v5, 15.1.4.3
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ARRAY_BUILTIN
 OBJECT_VALUE (LIT_MAGIC_STRING_ARRAY_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_ARRAY),
+              ECMA_BUILTIN_ID_ARRAY,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
@@ -100,7 +100,7 @@ OBJECT_VALUE (LIT_MAGIC_STRING_ARRAY_UL,
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_STRING_BUILTIN
 // ECMA-262 v5, 15.1.4.4
 OBJECT_VALUE (LIT_MAGIC_STRING_STRING_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_STRING),
+              ECMA_BUILTIN_ID_STRING,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
@@ -109,7 +109,7 @@ OBJECT_VALUE (LIT_MAGIC_STRING_STRING_UL,
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_BOOLEAN_BUILTIN
 // ECMA-262 v5, 15.1.4.5
 OBJECT_VALUE (LIT_MAGIC_STRING_BOOLEAN_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_BOOLEAN),
+              ECMA_BUILTIN_ID_BOOLEAN,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
@@ -118,7 +118,7 @@ OBJECT_VALUE (LIT_MAGIC_STRING_BOOLEAN_UL,
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_NUMBER_BUILTIN
 // ECMA-262 v5, 15.1.4.6
 OBJECT_VALUE (LIT_MAGIC_STRING_NUMBER_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_NUMBER),
+              ECMA_BUILTIN_ID_NUMBER,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
@@ -127,7 +127,7 @@ OBJECT_VALUE (LIT_MAGIC_STRING_NUMBER_UL,
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_DATE_BUILTIN
 // ECMA-262 v5, 15.1.4.7
 OBJECT_VALUE (LIT_MAGIC_STRING_DATE_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_DATE),
+              ECMA_BUILTIN_ID_DATE,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
@@ -136,7 +136,7 @@ OBJECT_VALUE (LIT_MAGIC_STRING_DATE_UL,
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
 // ECMA-262 v5, 15.1.4.8
 OBJECT_VALUE (LIT_MAGIC_STRING_REGEXP_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_REGEXP),
+              ECMA_BUILTIN_ID_REGEXP,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
@@ -145,49 +145,49 @@ OBJECT_VALUE (LIT_MAGIC_STRING_REGEXP_UL,
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ERROR_BUILTINS
 // ECMA-262 v5, 15.1.4.9
 OBJECT_VALUE (LIT_MAGIC_STRING_ERROR_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_ERROR),
+              ECMA_BUILTIN_ID_ERROR,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
 
 // ECMA-262 v5, 15.1.4.10
 OBJECT_VALUE (LIT_MAGIC_STRING_EVAL_ERROR_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_EVAL_ERROR),
+              ECMA_BUILTIN_ID_EVAL_ERROR,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
 
 // ECMA-262 v5, 15.1.4.11
 OBJECT_VALUE (LIT_MAGIC_STRING_RANGE_ERROR_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_RANGE_ERROR),
+              ECMA_BUILTIN_ID_RANGE_ERROR,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
 
 // ECMA-262 v5, 15.1.4.12
 OBJECT_VALUE (LIT_MAGIC_STRING_REFERENCE_ERROR_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_REFERENCE_ERROR),
+              ECMA_BUILTIN_ID_REFERENCE_ERROR,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
 
 // ECMA-262 v5, 15.1.4.13
 OBJECT_VALUE (LIT_MAGIC_STRING_SYNTAX_ERROR_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_SYNTAX_ERROR),
+              ECMA_BUILTIN_ID_SYNTAX_ERROR,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
 
 // ECMA-262 v5, 15.1.4.14
 OBJECT_VALUE (LIT_MAGIC_STRING_TYPE_ERROR_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_TYPE_ERROR),
+              ECMA_BUILTIN_ID_TYPE_ERROR,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
 
 // ECMA-262 v5, 15.1.4.15
 OBJECT_VALUE (LIT_MAGIC_STRING_URI_ERROR_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_URI_ERROR),
+              ECMA_BUILTIN_ID_URI_ERROR,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
@@ -196,7 +196,7 @@ OBJECT_VALUE (LIT_MAGIC_STRING_URI_ERROR_UL,
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_MATH_BUILTIN
 // ECMA-262 v5, 15.1.5.1
 OBJECT_VALUE (LIT_MAGIC_STRING_MATH_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_MATH),
+              ECMA_BUILTIN_ID_MATH,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
@@ -205,15 +205,93 @@ OBJECT_VALUE (LIT_MAGIC_STRING_MATH_UL,
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_JSON_BUILTIN
 // ECMA-262 v5, 15.1.5.2
 OBJECT_VALUE (LIT_MAGIC_STRING_JSON_U,
-              ecma_builtin_get (ECMA_BUILTIN_ID_JSON),
+              ECMA_BUILTIN_ID_JSON,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_JSON_BUILTIN */
 
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+// ECMA-262 v6, 18.3
+OBJECT_VALUE (LIT_MAGIC_STRING_ARRAY_BUFFER_UL,
+              ECMA_BUILTIN_ID_ARRAYBUFFER,
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+OBJECT_VALUE (LIT_MAGIC_STRING_DATA_VIEW_UL,
+              ECMA_BUILTIN_ID_DATAVIEW,
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+OBJECT_VALUE (LIT_MAGIC_STRING_INT8_ARRAY_UL,
+              ECMA_BUILTIN_ID_INT8ARRAY,
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+OBJECT_VALUE (LIT_MAGIC_STRING_UINT8_ARRAY_UL,
+              ECMA_BUILTIN_ID_UINT8ARRAY,
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+OBJECT_VALUE (LIT_MAGIC_STRING_UINT8_CLAMPED_ARRAY_UL,
+              ECMA_BUILTIN_ID_UINT8CLAMPEDARRAY,
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+OBJECT_VALUE (LIT_MAGIC_STRING_INT16_ARRAY_UL,
+              ECMA_BUILTIN_ID_INT16ARRAY,
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+OBJECT_VALUE (LIT_MAGIC_STRING_UINT16_ARRAY_UL,
+              ECMA_BUILTIN_ID_UINT16ARRAY,
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+OBJECT_VALUE (LIT_MAGIC_STRING_INT32_ARRAY_UL,
+              ECMA_BUILTIN_ID_INT32ARRAY,
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+OBJECT_VALUE (LIT_MAGIC_STRING_UINT32_ARRAY_UL,
+              ECMA_BUILTIN_ID_UINT32ARRAY,
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+OBJECT_VALUE (LIT_MAGIC_STRING_FLOAT32_ARRAY_UL,
+              ECMA_BUILTIN_ID_FLOAT32ARRAY,
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+OBJECT_VALUE (LIT_MAGIC_STRING_FLOAT64_ARRAY_UL,
+              ECMA_BUILTIN_ID_FLOAT64ARRAY,
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_WEAKMAP_BUILTIN
+// ECMA-262 v6, 23.3.1
+OBJECT_VALUE (LIT_MAGIC_STRING_WEAK_MAP_UL,
+              ECMA_BUILTIN_ID_WEAKMAP,
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_WEAKMAP_BUILTIN */
+
 #ifdef CONFIG_ECMA_COMPACT_PROFILE
 OBJECT_VALUE (LIT_MAGIC_STRING_COMPACT_PROFILE_ERROR_UL,
-              ecma_builtin_get (ECMA_BUILTIN_ID_COMPACT_PROFILE_ERROR),
+              ECMA_BUILTIN_ID_COMPACT_PROFILE_ERROR,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
@@ -83,8 +83,8 @@ ecma_builtin_helper_object_to_string (const ecma_value_t this_arg) /**< this arg
 
   /* Building string "[object #type#]" where type is 'Undefined',
      'Null' or one of possible object's classes.
-     The string with null character is maximum 19 characters long. */
-  const ssize_t buffer_size = 19;
+     The string is maximum 26 characters long (the longest class name is 'Uint8ClampedArray'). */
+  const ssize_t buffer_size = 26;
   MEM_DEFINE_LOCAL_ARRAY (str_buffer, buffer_size, lit_utf8_byte_t);
 
   lit_utf8_byte_t *buffer_ptr = str_buffer;
@@ -151,9 +151,7 @@ ecma_builtin_object_prototype_object_has_own_property (ecma_value_t this_arg, /*
   ecma_object_t *obj_p = ecma_get_object_from_value (obj_val);
 
   /* 3. */
-  ecma_property_t *property_p = ecma_op_object_get_own_property (obj_p, property_name_string_p);
-
-  if (property_p != NULL)
+  if (ecma_op_object_has_own_property (obj_p, property_name_string_p))
   {
     return_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
   }
@@ -0,0 +1,195 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-builtin-helpers.h"
+#include "ecma-builtins.h"
+#include "ecma-conversion.h"
+#include "ecma-exceptions.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jrt.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-typedarray-prototype.inc.h"
+#define BUILTIN_UNDERSCORED_ID typedarray_prototype
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup typedarrayprototype ECMA %TypedArray%.prototype object built-in
+ * @{
+ */
+
+/**
+ * The %TypedArray%.prototype object's 'set' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.22
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_object_set (ecma_value_t this_arg, /**< 'this' argument */
+                                              ecma_value_t array, /**< source array or typed array */
+                                              ecma_value_t offset) /**< index of the first element to be written */
+{
+  if (!ecma_is_typedarray (this_arg))
+  {
+    return ecma_raise_type_error ("Argument 'this' is not a typed array");
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  ecma_object_t *obj_p = ecma_get_object_from_value (this_arg);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (offset_num, offset, ret_value);
+
+  ecma_number_t target_offset = ecma_number_is_nan (offset_num) ? ECMA_NUMBER_ZERO : ecma_number_trunc (offset_num);
+
+  if (target_offset < ECMA_NUMBER_ZERO)
+  {
+    ret_value = ecma_raise_range_error ("Invalid offset");
+  }
+  else
+  {
+    ECMA_TRY_CATCH (source_value, ecma_op_to_object (array), ret_value);
+
+    ecma_object_t *source_p = ecma_get_object_from_value (source_value);
+    ecma_number_t source_length = ECMA_NUMBER_ZERO;
+
+    if (ecma_get_object_type (source_p) == ECMA_OBJECT_TYPE_TYPEDARRAY)
+    {
+      source_length = ecma_uint32_to_number (ecma_typedarray_get_length (source_p));
+    }
+    else
+    {
+      ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+
+      ECMA_TRY_CATCH (length_value, ecma_op_object_get (source_p, length_magic_string_p), ret_value);
+      ECMA_OP_TO_NUMBER_TRY_CATCH (length_num, length_value, ret_value);
+
+      source_length = ecma_uint32_to_number (ecma_number_to_uint32 (length_num));
+
+      ECMA_OP_TO_NUMBER_FINALIZE (length_num);
+      ECMA_FINALIZE (length_value);
+
+      ecma_deref_ecma_string (length_magic_string_p);
+    }
+
+    if (ecma_is_value_empty (ret_value))
+    {
+      if (source_length + target_offset > ecma_uint32_to_number (ecma_typedarray_get_length (obj_p)))
+      {
+        ret_value = ecma_raise_range_error ("Source is too large");
+      }
+      else
+      {
+        ret_value = ecma_typedarray_copy_elements (obj_p,
+                                                   ecma_number_to_uint32 (target_offset),
+                                                   source_p,
+                                                   ecma_number_to_uint32 (source_length));
+
+        if (ecma_is_value_empty (ret_value))
+        {
+          ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+        }
+      }
+    }
+
+    ECMA_FINALIZE (source_value);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (offset_num);
+
+  return ret_value;
+} /* ecma_builtin_typedarray_prototype_object_set */
+
+/**
+ * The %TypedArray%.prototype object's 'subarray' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.26
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_object_subarray (ecma_value_t this_arg, /**< 'this' argument */
+                                                   ecma_value_t arg1, /**< begin */
+                                                   ecma_value_t arg2) /**< end */
+{
+  if (!ecma_is_typedarray (this_arg))
+  {
+    return ecma_raise_type_error ("Argument 'this' is not a typed array");
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ecma_object_t *obj_p = ecma_get_object_from_value (this_arg);
+  uint32_t len = ecma_typedarray_get_length (obj_p);
+  uint32_t begin = 0, end = len;
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (begin_num, arg1, ret_value);
+
+  begin = ecma_builtin_helper_array_index_normalize (begin_num, len);
+
+  if (!ecma_is_value_undefined (arg2))
+  {
+    ECMA_OP_TO_NUMBER_TRY_CATCH (end_num, arg2, ret_value);
+
+    end = ecma_builtin_helper_array_index_normalize (end_num, len);
+
+    ECMA_OP_TO_NUMBER_FINALIZE (end_num);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (begin_num);
+
+  if (ecma_is_value_empty (ret_value))
+  {
+    ecma_typedarray_type_t type = ecma_typedarray_get_type (obj_p);
+    uint32_t new_offset = ecma_typedarray_get_offset (obj_p) + begin * ecma_typedarray_get_element_size (type);
+    uint32_t new_len = (begin < end) ? (end - begin) : 0;
+
+    ecma_object_t *new_obj_p = ecma_typedarray_new_object (ecma_typedarray_get_arraybuffer (obj_p),
+                                                           new_offset,
+                                                           new_len,
+                                                           type);
+
+    ret_value = ecma_make_object_value (new_obj_p);
+  }
+
+  return ret_value;
+} /* ecma_builtin_typedarray_prototype_object_subarray */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
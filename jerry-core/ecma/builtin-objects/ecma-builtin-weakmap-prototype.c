@@ -0,0 +1,154 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-weakmap-object.h"
+#include "jrt.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_WEAKMAP_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-weakmap-prototype.inc.h"
+#define BUILTIN_UNDERSCORED_ID weakmap_prototype
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup weakmapprototype ECMA WeakMap.prototype object built-in
+ * @{
+ */
+
+/**
+ * The WeakMap.prototype object's 'delete' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 23.3.3.2
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_weakmap_prototype_object_delete (ecma_value_t this_arg, /**< 'this' argument */
+                                              ecma_value_t key) /**< key */
+{
+  if (!ecma_is_weakmap (this_arg))
+  {
+    return ecma_raise_type_error ("Argument 'this' is not a WeakMap");
+  }
+
+  bool is_deleted = (ecma_is_value_object (key)
+                     && ecma_op_weakmap_delete (ecma_get_object_from_value (this_arg),
+                                                ecma_get_object_from_value (key)));
+
+  return ecma_make_simple_value (is_deleted ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+} /* ecma_builtin_weakmap_prototype_object_delete */
+
+/**
+ * The WeakMap.prototype object's 'get' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 23.3.3.3
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_weakmap_prototype_object_get (ecma_value_t this_arg, /**< 'this' argument */
+                                           ecma_value_t key) /**< key */
+{
+  if (!ecma_is_weakmap (this_arg))
+  {
+    return ecma_raise_type_error ("Argument 'this' is not a WeakMap");
+  }
+
+  if (!ecma_is_value_object (key))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  return ecma_op_weakmap_get (ecma_get_object_from_value (this_arg), ecma_get_object_from_value (key));
+} /* ecma_builtin_weakmap_prototype_object_get */
+
+/**
+ * The WeakMap.prototype object's 'has' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 23.3.3.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_weakmap_prototype_object_has (ecma_value_t this_arg, /**< 'this' argument */
+                                           ecma_value_t key) /**< key */
+{
+  if (!ecma_is_weakmap (this_arg))
+  {
+    return ecma_raise_type_error ("Argument 'this' is not a WeakMap");
+  }
+
+  bool has_key = (ecma_is_value_object (key)
+                  && ecma_op_weakmap_has (ecma_get_object_from_value (this_arg),
+                                          ecma_get_object_from_value (key)));
+
+  return ecma_make_simple_value (has_key ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+} /* ecma_builtin_weakmap_prototype_object_has */
+
+/**
+ * The WeakMap.prototype object's 'set' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 23.3.3.5
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_weakmap_prototype_object_set (ecma_value_t this_arg, /**< 'this' argument */
+                                           ecma_value_t key, /**< key */
+                                           ecma_value_t value) /**< value */
+{
+  if (!ecma_is_weakmap (this_arg))
+  {
+    return ecma_raise_type_error ("Argument 'this' is not a WeakMap");
+  }
+
+  if (!ecma_is_value_object (key))
+  {
+    return ecma_raise_type_error ("Invalid value used as WeakMap key");
+  }
+
+  ecma_op_weakmap_set (ecma_get_object_from_value (this_arg), ecma_get_object_from_value (key), value);
+
+  return ecma_copy_value (this_arg, true);
+} /* ecma_builtin_weakmap_prototype_object_set */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_WEAKMAP_BUILTIN */
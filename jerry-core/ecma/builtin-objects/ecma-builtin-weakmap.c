@@ -0,0 +1,93 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-weakmap-object.h"
+#include "jrt.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_WEAKMAP_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-weakmap.inc.h"
+#define BUILTIN_UNDERSCORED_ID weakmap
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup weakmap ECMA WeakMap object built-in
+ * @{
+ */
+
+/**
+ * Handle calling [[Call]] of built-in WeakMap object
+ *
+ * See also:
+ *          ECMA-262 v6, 23.3.1.1
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_builtin_weakmap_dispatch_call (const ecma_value_t *arguments_list_p, /**< arguments list */
+                                    ecma_length_t arguments_list_len) /**< number of arguments */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  return ecma_raise_type_error ("Constructor WeakMap requires 'new'");
+} /* ecma_builtin_weakmap_dispatch_call */
+
+/**
+ * Handle calling [[Construct]] of built-in WeakMap object
+ *
+ * See also:
+ *          ECMA-262 v6, 23.3.1.1
+ *
+ * Note:
+ *      iterables are not supported, so only an undefined or null argument is accepted
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_builtin_weakmap_dispatch_construct (const ecma_value_t *arguments_list_p, /**< arguments list */
+                                         ecma_length_t arguments_list_len) /**< number of arguments */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  if (arguments_list_len > 0
+      && !ecma_is_value_undefined (arguments_list_p[0])
+      && !ecma_is_value_null (arguments_list_p[0]))
+  {
+    return ecma_raise_type_error ("Initializing a WeakMap from an iterable is not supported");
+  }
+
+  return ecma_make_object_value (ecma_op_create_weakmap_object ());
+} /* ecma_builtin_weakmap_dispatch_construct */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_WEAKMAP_BUILTIN */
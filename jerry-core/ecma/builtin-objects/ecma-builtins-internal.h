@@ -57,12 +57,102 @@
  */
 #define ECMA_BUILTIN_ROUTINE_ID_LENGTH_VALUE_WIDTH (8)
 
+/**
+ * Value of ecma_builtin_routine_desc_t::args_number for routines with variable number of arguments
+ */
+#define ECMA_BUILTIN_ROUTINE_ARGS_NON_FIXED (0xff)
+
+/**
+ * Handler of a built-in routine
+ *
+ * Note:
+ *      the handler must be converted to the type matching its number of arguments before calling
+ */
+typedef void (*ecma_builtin_routine_handler_t) (void);
+
+/**
+ * Built-in routine with no arguments
+ */
+typedef ecma_value_t (*ecma_builtin_routine_0_t) (ecma_value_t);
+
+/**
+ * Built-in routine with one argument
+ */
+typedef ecma_value_t (*ecma_builtin_routine_1_t) (ecma_value_t, ecma_value_t);
+
+/**
+ * Built-in routine with two arguments
+ */
+typedef ecma_value_t (*ecma_builtin_routine_2_t) (ecma_value_t, ecma_value_t, ecma_value_t);
+
+/**
+ * Built-in routine with three arguments
+ */
+typedef ecma_value_t (*ecma_builtin_routine_3_t) (ecma_value_t, ecma_value_t, ecma_value_t, ecma_value_t);
+
+/**
+ * Built-in routine with variable number of arguments
+ */
+typedef ecma_value_t (*ecma_builtin_routine_non_fixed_t) (ecma_value_t, const ecma_value_t *, ecma_length_t);
+
+/**
+ * Description of a built-in routine
+ */
+typedef struct
+{
+  ecma_builtin_routine_handler_t handler; /**< routine implementation */
+  uint8_t args_number; /**< number of arguments, or ECMA_BUILTIN_ROUTINE_ARGS_NON_FIXED */
+} ecma_builtin_routine_desc_t;
+
+/**
+ * Types of built-in properties
+ */
+typedef enum
+{
+  ECMA_BUILTIN_PROPERTY_SIMPLE, /**< simple value, the value field is an ecma_simple_value_t */
+  ECMA_BUILTIN_PROPERTY_NUMBER, /**< number value, the value field is an index in the built-in's number table */
+  ECMA_BUILTIN_PROPERTY_STRING, /**< string value, the value field is a lit_magic_string_id_t */
+  ECMA_BUILTIN_PROPERTY_OBJECT, /**< built-in object, the value field is an ecma_builtin_id_t */
+  ECMA_BUILTIN_PROPERTY_ROUTINE, /**< built-in routine, the value field is an ECMA_BUILTIN_ROUTINE_VALUE */
+  ECMA_BUILTIN_PROPERTY_CP_UNIMPLEMENTED, /**< property which is not implemented in the compact profile */
+  ECMA_BUILTIN_PROPERTY_END /**< terminator of a property descriptor list */
+} ecma_builtin_property_type_t;
+
+/**
+ * Pack the attributes of a built-in property into the attributes field of its descriptor
+ */
+#define ECMA_BUILTIN_PROPERTY_ATTRIBUTES(writable, enumerable, configurable) \
+  ((writable) | ((enumerable) << 1) | ((configurable) << 2))
+
+/**
+ * Width of the 'length' value in the value field of a built-in routine's property descriptor
+ */
+#define ECMA_BUILTIN_ROUTINE_VALUE_LENGTH_WIDTH (4)
+
+/**
+ * Pack the routine index and the 'length' property value of a built-in routine into a descriptor's value field
+ */
+#define ECMA_BUILTIN_ROUTINE_VALUE(routine_index, length_prop_value) \
+  (((routine_index) << ECMA_BUILTIN_ROUTINE_VALUE_LENGTH_WIDTH) | (length_prop_value))
+
+/**
+ * Description of a built-in object's property
+ *
+ * Note:
+ *      the descriptors are read-only, they are materialized into the heap
+ *      on first access of the property (see also: ecma_builtin_try_to_instantiate_property)
+ */
+typedef struct
+{
+  uint16_t magic_string_id; /**< name of the property */
+  uint8_t type; /**< ecma_builtin_property_type_t */
+  uint8_t attributes; /**< ECMA_BUILTIN_PROPERTY_ATTRIBUTES */
+  uint16_t value; /**< type specific value */
+} ecma_builtin_property_descriptor_t;
+
 /* ecma-builtins.c */
 extern ecma_object_t *
 ecma_builtin_make_function_object_for_routine (ecma_builtin_id_t, uint16_t, uint8_t);
-extern int32_t
-ecma_builtin_bin_search_for_magic_string_id_in_array (const lit_magic_string_id_t[],
-                                                      ecma_length_t, lit_magic_string_id_t);
 
 #define BUILTIN(builtin_id, \
                 object_type, \
@@ -76,21 +166,12 @@ ecma_builtin_ ## lowercase_name ## _dispatch_call (const ecma_value_t *, \
 extern ecma_value_t \
 ecma_builtin_ ## lowercase_name ## _dispatch_construct (const ecma_value_t *, \
                                                         ecma_length_t); \
-extern ecma_value_t \
-ecma_builtin_ ## lowercase_name ## _dispatch_routine (uint16_t builtin_routine_id, \
-                                                      ecma_value_t this_arg_value, \
-                                                      const ecma_value_t [], \
-                                                      ecma_length_t); \
-extern ecma_property_t * \
-ecma_builtin_ ## lowercase_name ## _try_to_instantiate_property (ecma_object_t *, \
-                                                                 ecma_string_t *); \
-extern void \
-ecma_builtin_ ## lowercase_name ## _list_lazy_property_names (ecma_object_t *, \
-                                                              bool, \
-                                                              ecma_collection_header_t *, \
-                                                              ecma_collection_header_t *); \
-extern void \
-ecma_builtin_ ## lowercase_name ## _sort_property_names (void);
+extern const ecma_builtin_routine_desc_t \
+ecma_builtin_ ## lowercase_name ## _routines[]; \
+extern const ecma_number_t \
+ecma_builtin_ ## lowercase_name ## _numbers[]; \
+extern const ecma_builtin_property_descriptor_t \
+ecma_builtin_ ## lowercase_name ## _property_descriptors[];
 #include "ecma-builtins.inc.h"
 
 #endif /* !ECMA_BUILTINS_INTERNAL_H */
@@ -19,6 +19,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-objects.h"
+#include "jcontext.h"
 #include "jrt-bit-fields.h"
 
 #define ECMA_BUILTINS_INTERNAL
@@ -39,11 +40,6 @@ ecma_builtin_dispatch_routine (ecma_builtin_id_t builtin_object_id,
                                ecma_length_t arguments_number);
 static void ecma_instantiate_builtin (ecma_builtin_id_t id);
 
-/**
- * Pointer to instances of built-in objects
- */
-static ecma_object_t *ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT];
-
 /**
  * Check if passed object is the instance of specified built-in.
  */
@@ -54,7 +50,7 @@ ecma_builtin_is (ecma_object_t *obj_p, /**< pointer to an object */
   JERRY_ASSERT (obj_p != NULL && !ecma_is_lexical_environment (obj_p));
   JERRY_ASSERT (builtin_id < ECMA_BUILTIN_ID__COUNT);
 
-  if (ecma_builtin_objects[builtin_id] == NULL)
+  if (JERRY_CONTEXT (ecma_builtin_objects)[builtin_id] == NULL)
   {
     /* If a built-in object is not instantiated,
      * the specified object cannot be the built-in object */
@@ -62,7 +58,7 @@ ecma_builtin_is (ecma_object_t *obj_p, /**< pointer to an object */
   }
   else
   {
-    return (obj_p == ecma_builtin_objects[builtin_id]);
+    return (obj_p == JERRY_CONTEXT (ecma_builtin_objects)[builtin_id]);
   }
 } /* ecma_builtin_is */
 
@@ -76,14 +72,14 @@ ecma_builtin_get (ecma_builtin_id_t builtin_id) /**< id of built-in to check on
 {
   JERRY_ASSERT (builtin_id < ECMA_BUILTIN_ID__COUNT);
 
-  if (unlikely (ecma_builtin_objects[builtin_id] == NULL))
+  if (unlikely (JERRY_CONTEXT (ecma_builtin_objects)[builtin_id] == NULL))
   {
     ecma_instantiate_builtin (builtin_id);
   }
 
-  ecma_ref_object (ecma_builtin_objects[builtin_id]);
+  ecma_ref_object (JERRY_CONTEXT (ecma_builtin_objects)[builtin_id]);
 
-  return ecma_builtin_objects[builtin_id];
+  return JERRY_CONTEXT (ecma_builtin_objects)[builtin_id];
 } /* ecma_builtin_get */
 
 /**
@@ -198,7 +194,7 @@ ecma_init_builtins (void)
        id < ECMA_BUILTIN_ID__COUNT;
        id = (ecma_builtin_id_t) (id + 1))
   {
-    ecma_builtin_objects[id] = NULL;
+    JERRY_CONTEXT (ecma_builtin_objects)[id] = NULL;
   }
 } /* ecma_init_builtins */
 
@@ -218,11 +214,7 @@ ecma_instantiate_builtin (ecma_builtin_id_t id) /**< built-in id */
                 lowercase_name) \
     case builtin_id: \
     { \
-      JERRY_ASSERT (ecma_builtin_objects[builtin_id] == NULL); \
-      if (is_static) \
-      { \
-        ecma_builtin_ ## lowercase_name ## _sort_property_names (); \
-      } \
+      JERRY_ASSERT (JERRY_CONTEXT (ecma_builtin_objects)[builtin_id] == NULL); \
       \
       ecma_object_t *prototype_obj_p; \
       if (object_prototype_builtin_id == ECMA_BUILTIN_ID__COUNT) \
@@ -231,11 +223,11 @@ ecma_instantiate_builtin (ecma_builtin_id_t id) /**< built-in id */
       } \
       else \
       { \
-        if (ecma_builtin_objects[object_prototype_builtin_id] == NULL) \
+        if (JERRY_CONTEXT (ecma_builtin_objects)[object_prototype_builtin_id] == NULL) \
         { \
           ecma_instantiate_builtin (object_prototype_builtin_id); \
         } \
-        prototype_obj_p = ecma_builtin_objects[object_prototype_builtin_id]; \
+        prototype_obj_p = JERRY_CONTEXT (ecma_builtin_objects)[object_prototype_builtin_id]; \
         JERRY_ASSERT (prototype_obj_p != NULL); \
       } \
       \
@@ -243,7 +235,7 @@ ecma_instantiate_builtin (ecma_builtin_id_t id) /**< built-in id */
                                                                prototype_obj_p, \
                                                                object_type, \
                                                                is_extensible); \
-      ecma_builtin_objects[builtin_id] = builtin_obj_p; \
+      JERRY_CONTEXT (ecma_builtin_objects)[builtin_id] = builtin_obj_p; \
       \
       break; \
     }
@@ -268,19 +260,171 @@ ecma_finalize_builtins (void)
        id < ECMA_BUILTIN_ID__COUNT;
        id = (ecma_builtin_id_t) (id + 1))
   {
-    if (ecma_builtin_objects[id] != NULL)
+    if (JERRY_CONTEXT (ecma_builtin_objects)[id] != NULL)
     {
-      ecma_deref_object (ecma_builtin_objects[id]);
-      ecma_builtin_objects[id] = NULL;
+      ecma_deref_object (JERRY_CONTEXT (ecma_builtin_objects)[id]);
+      JERRY_CONTEXT (ecma_builtin_objects)[id] = NULL;
     }
   }
 } /* ecma_finalize_builtins */
 
+/**
+ * Save the instantiated built-in objects to a heap image
+ *
+ * @return true - if the built-in objects were written successfully,
+ *         false - if the buffer is too small.
+ */
+bool
+ecma_save_builtins_image (uint8_t *buffer_p, /**< buffer */
+                          size_t buffer_size, /**< size of buffer */
+                          size_t *in_out_buffer_offset_p) /**< in: offset to write to,
+                                                           *   out: offset, incremented on size
+                                                           *        of the written data */
+{
+  for (ecma_builtin_id_t id = (ecma_builtin_id_t) 0;
+       id < ECMA_BUILTIN_ID__COUNT;
+       id = (ecma_builtin_id_t) (id + 1))
+  {
+    mem_cpointer_t builtin_cp;
+    ECMA_SET_POINTER (builtin_cp, JERRY_CONTEXT (ecma_builtin_objects)[id]);
+
+    if (!jrt_write_to_buffer_by_offset (buffer_p,
+                                        buffer_size,
+                                        in_out_buffer_offset_p,
+                                        &builtin_cp,
+                                        sizeof (builtin_cp)))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* ecma_save_builtins_image */
+
+/**
+ * Restore the instantiated built-in objects from a heap image
+ *
+ * Note:
+ *      the routine should be called instead of ecma_init_builtins
+ *
+ * @return true - if the built-in objects were restored successfully,
+ *         false - if the image is truncated.
+ */
+bool
+ecma_load_builtins_image (const uint8_t *buffer_p, /**< buffer */
+                          size_t buffer_size, /**< size of buffer */
+                          size_t *in_out_buffer_offset_p) /**< in: offset to read from,
+                                                           *   out: offset, incremented on size
+                                                           *        of the read data */
+{
+  for (ecma_builtin_id_t id = (ecma_builtin_id_t) 0;
+       id < ECMA_BUILTIN_ID__COUNT;
+       id = (ecma_builtin_id_t) (id + 1))
+  {
+    mem_cpointer_t builtin_cp;
+
+    if (!jrt_read_from_buffer_by_offset (buffer_p,
+                                         buffer_size,
+                                         in_out_buffer_offset_p,
+                                         &builtin_cp,
+                                         sizeof (builtin_cp)))
+    {
+      return false;
+    }
+
+    JERRY_CONTEXT (ecma_builtin_objects)[id] = ECMA_GET_POINTER (ecma_object_t, builtin_cp);
+  }
+
+  return true;
+} /* ecma_load_builtins_image */
+
+/**
+ * Property descriptor lists of built-in objects, indexed by built-in identifier
+ */
+static const ecma_builtin_property_descriptor_t * const ecma_builtin_property_descriptor_lists[ECMA_BUILTIN_ID__COUNT] =
+{
+#define BUILTIN(builtin_id, \
+                object_type, \
+                object_prototype_builtin_id, \
+                is_extensible, \
+                is_static, \
+                lowercase_name) \
+  ecma_builtin_ ## lowercase_name ## _property_descriptors,
+#include "ecma-builtins.inc.h"
+};
+
+/**
+ * Number tables of built-in objects, indexed by built-in identifier
+ */
+static const ecma_number_t * const ecma_builtin_number_tables[ECMA_BUILTIN_ID__COUNT] =
+{
+#define BUILTIN(builtin_id, \
+                object_type, \
+                object_prototype_builtin_id, \
+                is_extensible, \
+                is_static, \
+                lowercase_name) \
+  ecma_builtin_ ## lowercase_name ## _numbers,
+#include "ecma-builtins.inc.h"
+};
+
+/**
+ * Find the descriptor of a built-in property in a property descriptor list
+ *
+ * @return index of the descriptor, if the property is in the list,
+ *         index of the list's terminator - otherwise.
+ */
+static uint32_t
+ecma_builtin_find_property_descriptor (const ecma_builtin_property_descriptor_t *descriptors_p, /**< descriptor
+                                                                                                  *   list */
+                                       lit_magic_string_id_t magic_string_id) /**< property's name */
+{
+  JERRY_STATIC_ASSERT (LIT_MAGIC_STRING__COUNT <= UINT16_MAX);
+
+  /* The terminator's name (LIT_MAGIC_STRING__COUNT) never matches a property name */
+  uint32_t index = 0;
+
+  while (descriptors_p[index].magic_string_id != magic_string_id
+         && descriptors_p[index].type != ECMA_BUILTIN_PROPERTY_END)
+  {
+    index++;
+  }
+
+  return index;
+} /* ecma_builtin_find_property_descriptor */
+
+/**
+ * Get the bit which marks the built-in property at the specified index of
+ * the descriptor list as instantiated in the NON_INSTANTIATED_BUILT_IN_MASK internal properties
+ *
+ * @return the bit in the mask
+ */
+static uint32_t
+ecma_builtin_get_instantiated_bit (uint32_t index, /**< index of the property descriptor */
+                                   ecma_internal_property_id_t *out_mask_prop_id_p) /**< out: the internal property
+                                                                                     *   which contains the bit */
+{
+  JERRY_ASSERT (index < sizeof (uint64_t) * JERRY_BITSINBYTE);
+
+  if (index >= 32)
+  {
+    *out_mask_prop_id_p = ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_32_63;
+    return (uint32_t) 1u << (index - 32);
+  }
+
+  *out_mask_prop_id_p = ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_0_31;
+  return (uint32_t) 1u << index;
+} /* ecma_builtin_get_instantiated_bit */
+
 /**
  * If the property's name is one of built-in properties of the object
  * that is not instantiated yet, instantiate the property and
  * return pointer to the instantiated property.
  *
+ * Note:
+ *      the properties are described by the read-only descriptor lists of the built-ins,
+ *      a property is materialized into the heap only when it is accessed first
+ *
  * @return pointer property, if one was instantiated,
  *         NULL - otherwise.
  */
@@ -335,46 +479,119 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
 
     return NULL;
   }
-  else
+
+  ecma_property_t *built_in_id_prop_p = ecma_get_internal_property (object_p,
+                                                                    ECMA_INTERNAL_PROPERTY_BUILT_IN_ID);
+  ecma_builtin_id_t builtin_id = (ecma_builtin_id_t) built_in_id_prop_p->u.internal_property.value;
+
+  JERRY_ASSERT (ecma_builtin_is (object_p, builtin_id));
+
+  lit_magic_string_id_t magic_string_id;
+
+  if (!ecma_is_string_magic (string_p, &magic_string_id))
   {
-    ecma_property_t *built_in_id_prop_p = ecma_get_internal_property (object_p,
-                                                                      ECMA_INTERNAL_PROPERTY_BUILT_IN_ID);
-    ecma_builtin_id_t builtin_id = (ecma_builtin_id_t) built_in_id_prop_p->u.internal_property.value;
+    return NULL;
+  }
 
-    JERRY_ASSERT (ecma_builtin_is (object_p, builtin_id));
+  const ecma_builtin_property_descriptor_t *descriptors_p = ecma_builtin_property_descriptor_lists[builtin_id];
+  uint32_t index = ecma_builtin_find_property_descriptor (descriptors_p, magic_string_id);
 
-    switch (builtin_id)
+  if (descriptors_p[index].type == ECMA_BUILTIN_PROPERTY_END)
+  {
+    return NULL;
+  }
+
+  ecma_internal_property_id_t mask_prop_id;
+  uint32_t bit = ecma_builtin_get_instantiated_bit (index, &mask_prop_id);
+
+  ecma_property_t *mask_prop_p = ecma_find_internal_property (object_p, mask_prop_id);
+
+  if (mask_prop_p == NULL)
+  {
+    mask_prop_p = ecma_create_internal_property (object_p, mask_prop_id);
+    mask_prop_p->u.internal_property.value = 0;
+  }
+
+  if (mask_prop_p->u.internal_property.value & bit)
+  {
+    return NULL;
+  }
+
+  mask_prop_p->u.internal_property.value |= bit;
+
+  const ecma_builtin_property_descriptor_t *descriptor_p = descriptors_p + index;
+  ecma_value_t value;
+
+  switch (descriptor_p->type)
+  {
+    case ECMA_BUILTIN_PROPERTY_SIMPLE:
     {
-#define BUILTIN(builtin_id, \
-                object_type, \
-                object_prototype_builtin_id, \
-                is_extensible, \
-                is_static, \
-                lowercase_name) \
-      case builtin_id: \
-      { \
-        return ecma_builtin_ ## lowercase_name ## _try_to_instantiate_property (object_p, \
-                                                                                string_p); \
-      }
-#include "ecma-builtins.inc.h"
+      value = ecma_make_simple_value ((ecma_simple_value_t) descriptor_p->value);
+      break;
+    }
+    case ECMA_BUILTIN_PROPERTY_NUMBER:
+    {
+      ecma_number_t *num_p = ecma_alloc_number ();
+      *num_p = ecma_builtin_number_tables[builtin_id][descriptor_p->value];
 
-      case ECMA_BUILTIN_ID__COUNT:
-      {
-        JERRY_UNREACHABLE ();
-      }
+      value = ecma_make_number_value (num_p);
+      break;
+    }
+    case ECMA_BUILTIN_PROPERTY_STRING:
+    {
+      value = ecma_make_string_value (ecma_get_magic_string ((lit_magic_string_id_t) descriptor_p->value));
+      break;
+    }
+    case ECMA_BUILTIN_PROPERTY_OBJECT:
+    {
+      value = ecma_make_object_value (ecma_builtin_get ((ecma_builtin_id_t) descriptor_p->value));
+      break;
+    }
+    case ECMA_BUILTIN_PROPERTY_ROUTINE:
+    {
+      uint16_t routine_index = (uint16_t) (descriptor_p->value >> ECMA_BUILTIN_ROUTINE_VALUE_LENGTH_WIDTH);
+      uint8_t length_prop_value = (uint8_t) (descriptor_p->value
+                                             & ((1u << ECMA_BUILTIN_ROUTINE_VALUE_LENGTH_WIDTH) - 1u));
+
+      ecma_object_t *func_obj_p = ecma_builtin_make_function_object_for_routine (builtin_id,
+                                                                                 routine_index,
+                                                                                 length_prop_value);
+      value = ecma_make_object_value (func_obj_p);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (descriptor_p->type == ECMA_BUILTIN_PROPERTY_CP_UNIMPLEMENTED);
 
-      default:
-      {
 #ifdef CONFIG_ECMA_COMPACT_PROFILE
-        JERRY_UNREACHABLE ();
+      /* The object throws CompactProfileError upon invocation */
+      ecma_object_t *get_set_p = ecma_builtin_get (ECMA_BUILTIN_ID_COMPACT_PROFILE_ERROR);
+      ecma_property_t *compact_profile_thrower_property_p = ecma_create_named_accessor_property (object_p,
+                                                                                                 string_p,
+                                                                                                 get_set_p,
+                                                                                                 get_set_p,
+                                                                                                 true,
+                                                                                                 false);
+      ecma_deref_object (get_set_p);
+
+      return compact_profile_thrower_property_p;
 #else /* CONFIG_ECMA_COMPACT_PROFILE */
-        JERRY_UNIMPLEMENTED ("The built-in is not implemented.");
-#endif /* !CONFIG_ECMA_COMPACT_PROFILE */
-      }
+      JERRY_UNIMPLEMENTED ("The built-in is not implemented.");
+#endif /* CONFIG_ECMA_COMPACT_PROFILE */
     }
-
-    JERRY_UNREACHABLE ();
   }
+
+  ecma_property_t *prop_p = ecma_create_named_data_property (object_p,
+                                                             string_p,
+                                                             (descriptor_p->attributes & (1u << 0)) != 0,
+                                                             (descriptor_p->attributes & (1u << 1)) != 0,
+                                                             (descriptor_p->attributes & (1u << 2)) != 0);
+
+  ecma_named_data_property_assign_value (object_p, prop_p, value);
+
+  ecma_free_value (value);
+
+  return prop_p;
 } /* ecma_builtin_try_to_instantiate_property */
 
 /**
@@ -417,40 +634,33 @@ ecma_builtin_list_lazy_property_names (ecma_object_t *object_p, /**< a built-in
 
     JERRY_ASSERT (ecma_builtin_is (object_p, builtin_id));
 
-    switch (builtin_id)
+    ecma_collection_header_t *for_non_enumerable_p = separate_enumerable ? non_enum_collection_p : main_collection_p;
+
+    const ecma_builtin_property_descriptor_t *descriptors_p = ecma_builtin_property_descriptor_lists[builtin_id];
+
+    for (uint32_t index = 0;
+         descriptors_p[index].type != ECMA_BUILTIN_PROPERTY_END;
+         index++)
     {
-#define BUILTIN(builtin_id, \
-                object_type, \
-                object_prototype_builtin_id, \
-                is_extensible, \
-                is_static, \
-                lowercase_name) \
-      case builtin_id: \
-                       { \
-                         ecma_builtin_ ## lowercase_name ## _list_lazy_property_names (object_p, \
-                                                                                       separate_enumerable, \
-                                                                                       main_collection_p, \
-                                                                                       non_enum_collection_p); \
-                         return; \
-                       }
-#include "ecma-builtins.inc.h"
+      ecma_internal_property_id_t mask_prop_id;
+      uint32_t bit = ecma_builtin_get_instantiated_bit (index, &mask_prop_id);
 
-      case ECMA_BUILTIN_ID__COUNT:
-      {
-        JERRY_UNREACHABLE ();
-      }
+      ecma_property_t *mask_prop_p = ecma_find_internal_property (object_p, mask_prop_id);
+      bool is_instantiated = (mask_prop_p != NULL && (mask_prop_p->u.internal_property.value & bit) != 0);
 
-      default:
+      ecma_string_t *name_p = ecma_get_magic_string ((lit_magic_string_id_t) descriptors_p[index].magic_string_id);
+
+      /* A property, which is not instantiated yet, is instantiated upon first request */
+      if (!is_instantiated
+          || ecma_op_object_get_own_property (object_p, name_p) != NULL)
       {
-#ifdef CONFIG_ECMA_COMPACT_PROFILE
-        JERRY_UNREACHABLE ();
-#else /* CONFIG_ECMA_COMPACT_PROFILE */
-        JERRY_UNIMPLEMENTED ("The built-in is not implemented.");
-#endif /* !CONFIG_ECMA_COMPACT_PROFILE */
+        ecma_append_to_values_collection (for_non_enumerable_p,
+                                          ecma_make_string_value (name_p),
+                                          true);
       }
-    }
 
-    JERRY_UNREACHABLE ();
+      ecma_deref_ecma_string (name_p);
+    }
   }
 } /* ecma_builtin_list_lazy_property_names */
 
@@ -500,6 +710,45 @@ ecma_builtin_make_function_object_for_routine (ecma_builtin_id_t builtin_id, /**
   return func_obj_p;
 } /* ecma_builtin_make_function_object_for_routine */
 
+/**
+ * Call a built-in routine object
+ *
+ * Note:
+ *      the virtual machine calls the routine objects directly, without ecma_op_function_call
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+ecma_value_t
+ecma_builtin_call_routine (ecma_object_t *func_obj_p, /**< built-in routine object */
+                           ecma_value_t this_arg_value, /**< 'this' argument value */
+                           const ecma_value_t *arguments_list_p, /**< arguments list */
+                           ecma_length_t arguments_list_len) /**< arguments list length */
+{
+  JERRY_ASSERT (ecma_get_object_is_builtin (func_obj_p)
+                && ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION);
+
+  ecma_property_t *desc_prop_p = ecma_get_internal_property (func_obj_p,
+                                                             ECMA_INTERNAL_PROPERTY_BUILT_IN_ROUTINE_DESC);
+  uint64_t builtin_routine_desc = desc_prop_p->u.internal_property.value;
+
+  uint64_t built_in_id_field = jrt_extract_bit_field (builtin_routine_desc,
+                                                      ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_POS,
+                                                      ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_WIDTH);
+  JERRY_ASSERT (built_in_id_field < ECMA_BUILTIN_ID__COUNT);
+
+  uint64_t routine_id_field = jrt_extract_bit_field (builtin_routine_desc,
+                                                     ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_POS,
+                                                     ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_WIDTH);
+  JERRY_ASSERT ((uint16_t) routine_id_field == routine_id_field);
+
+  return ecma_builtin_dispatch_routine ((ecma_builtin_id_t) built_in_id_field,
+                                        (uint16_t) routine_id_field,
+                                        this_arg_value,
+                                        arguments_list_p,
+                                        arguments_list_len);
+} /* ecma_builtin_call_routine */
+
 /**
  * Handle calling [[Call]] of built-in object
  *
@@ -517,28 +766,7 @@ ecma_builtin_dispatch_call (ecma_object_t *obj_p, /**< built-in object */
 
   if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION)
   {
-    ecma_property_t *desc_prop_p = ecma_get_internal_property (obj_p,
-                                                               ECMA_INTERNAL_PROPERTY_BUILT_IN_ROUTINE_DESC);
-    uint64_t builtin_routine_desc = desc_prop_p->u.internal_property.value;
-
-    uint64_t built_in_id_field = jrt_extract_bit_field (builtin_routine_desc,
-                                                        ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_POS,
-                                                        ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_WIDTH);
-    JERRY_ASSERT (built_in_id_field < ECMA_BUILTIN_ID__COUNT);
-
-    uint64_t routine_id_field = jrt_extract_bit_field (builtin_routine_desc,
-                                                       ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_POS,
-                                                       ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_WIDTH);
-    JERRY_ASSERT ((uint16_t) routine_id_field == routine_id_field);
-
-    ecma_builtin_id_t built_in_id = (ecma_builtin_id_t) built_in_id_field;
-    uint16_t routine_id = (uint16_t) routine_id_field;
-
-    ret_value =  ecma_builtin_dispatch_routine (built_in_id,
-                                                routine_id,
-                                                this_arg_value,
-                                                arguments_list_p,
-                                                arguments_list_len);
+    ret_value = ecma_builtin_call_routine (obj_p, this_arg_value, arguments_list_p, arguments_list_len);
   }
   else
   {
@@ -651,9 +879,29 @@ ecma_builtin_dispatch_construct (ecma_object_t *obj_p, /**< built-in object */
   return ret_value;
 } /* ecma_builtin_dispatch_construct */
 
+/**
+ * Routine tables of built-in objects, indexed by built-in identifier
+ */
+static const ecma_builtin_routine_desc_t * const ecma_builtin_routine_tables[ECMA_BUILTIN_ID__COUNT] =
+{
+#define BUILTIN(builtin_id, \
+                object_type, \
+                object_prototype_builtin_id, \
+                is_extensible, \
+                is_static, \
+                lowercase_name) \
+  ecma_builtin_ ## lowercase_name ## _routines,
+#include "ecma-builtins.inc.h"
+};
+
 /**
  * Dispatcher of built-in routines
  *
+ * Note:
+ *      the routine is looked up directly in the routine table of the built-in object,
+ *      missing arguments of routines with fixed number of arguments are passed as undefined
+ *      (the argument list is used in place, if it is long enough)
+ *
  * @return ecma value
  *         Returned value must be freed with ecma_free_value.
  */
@@ -666,91 +914,54 @@ ecma_builtin_dispatch_routine (ecma_builtin_id_t builtin_object_id, /**< built-i
                                const ecma_value_t arguments_list[], /**< list of arguments passed to routine */
                                ecma_length_t arguments_number) /**< length of arguments' list */
 {
-  switch (builtin_object_id)
-  {
-#define BUILTIN(builtin_id, \
-                object_type, \
-                object_prototype_builtin_id, \
-                is_extensible, \
-                is_static, \
-                lowercase_name) \
-    case builtin_id: \
-      { \
-        return ecma_builtin_ ## lowercase_name ## _dispatch_routine (builtin_routine_id, \
-                                                                     this_arg_value, \
-                                                                     arguments_list, \
-                                                                     arguments_number); \
-      }
-#include "ecma-builtins.inc.h"
+  JERRY_ASSERT (builtin_object_id < ECMA_BUILTIN_ID__COUNT);
 
-    case ECMA_BUILTIN_ID__COUNT:
-    {
-      JERRY_UNREACHABLE ();
-    }
+  const ecma_builtin_routine_desc_t *routine_p = ecma_builtin_routine_tables[builtin_object_id] + builtin_routine_id;
+  JERRY_ASSERT (routine_p->handler != NULL);
 
-    default:
-    {
-#ifdef CONFIG_ECMA_COMPACT_PROFILE
-      JERRY_UNREACHABLE ();
-#else /* CONFIG_ECMA_COMPACT_PROFILE */
-      JERRY_UNIMPLEMENTED ("The built-in is not implemented.");
-#endif /* !CONFIG_ECMA_COMPACT_PROFILE */
-    }
+  if (routine_p->args_number == ECMA_BUILTIN_ROUTINE_ARGS_NON_FIXED)
+  {
+    ecma_builtin_routine_non_fixed_t handler = (ecma_builtin_routine_non_fixed_t) routine_p->handler;
+    return handler (this_arg_value, arguments_list, arguments_number);
   }
 
-  JERRY_UNREACHABLE ();
-} /* ecma_builtin_dispatch_routine */
+  JERRY_ASSERT (routine_p->args_number <= 3);
 
-/**
- * Binary search for magic string identifier in array.
- *
- * Warning:
- *         array should be sorted in ascending order
- *
- * @return index of identifier, if it is contained in array,
- *         -1 - otherwise.
- */
-int32_t
-ecma_builtin_bin_search_for_magic_string_id_in_array (const lit_magic_string_id_t ids[], /**< array to search in */
-                                                      ecma_length_t array_length, /**< number of elements
-                                                                                       in the array */
-                                                      lit_magic_string_id_t key) /**< value to search for */
-{
-#ifndef JERRY_NDEBUG
-  /* For binary search the values should be sorted */
-  for (ecma_length_t id_index = 1;
-       id_index < array_length;
-       id_index++)
+  const ecma_value_t *args = arguments_list;
+  ecma_value_t padded_args[3];
+
+  /* The arguments are only copied, if some of them are missing. */
+  if (arguments_number < routine_p->args_number)
   {
-    JERRY_ASSERT (ids[id_index - 1] < ids[id_index]);
-  }
-#endif /* !JERRY_NDEBUG */
+    for (ecma_length_t i = 0; i < routine_p->args_number; i++)
+    {
+      padded_args[i] = (i < arguments_number) ? arguments_list[i]
+                                              : ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
 
-  int32_t min = 0;
-  int32_t max = (int32_t) array_length - 1;
+    args = padded_args;
+  }
 
-  while (min <= max)
+  switch (routine_p->args_number)
   {
-    int32_t mid = (min + max) / 2;
-
-    if (ids[mid] == key)
+    case 0:
     {
-      return (int32_t) mid;
+      return ((ecma_builtin_routine_0_t) routine_p->handler) (this_arg_value);
     }
-    else if (ids[mid] > key)
+    case 1:
     {
-      max = mid - 1;
+      return ((ecma_builtin_routine_1_t) routine_p->handler) (this_arg_value, args[0]);
     }
-    else
+    case 2:
     {
-      JERRY_ASSERT (ids[mid] < key);
-
-      min = mid + 1;
+      return ((ecma_builtin_routine_2_t) routine_p->handler) (this_arg_value, args[0], args[1]);
+    }
+    default:
+    {
+      return ((ecma_builtin_routine_3_t) routine_p->handler) (this_arg_value, args[0], args[1], args[2]);
     }
   }
-
-  return -1;
-} /* ecma_builtin_bin_search_for_magic_string_id_in_array */
+} /* ecma_builtin_dispatch_routine */
 
 /**
  * @}
@@ -37,7 +37,12 @@ typedef enum
 /* ecma-builtins.c */
 extern void ecma_init_builtins (void);
 extern void ecma_finalize_builtins (void);
+extern bool ecma_save_builtins_image (uint8_t *, size_t, size_t *);
+extern bool ecma_load_builtins_image (const uint8_t *, size_t, size_t *);
 
+extern ecma_value_t
+ecma_builtin_call_routine (ecma_object_t *, ecma_value_t,
+                           const ecma_value_t *, ecma_length_t);
 extern ecma_value_t
 ecma_builtin_dispatch_call (ecma_object_t *, ecma_value_t,
                             const ecma_value_t *, ecma_length_t);
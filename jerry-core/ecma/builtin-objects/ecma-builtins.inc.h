@@ -290,6 +290,210 @@ BUILTIN (ECMA_BUILTIN_ID_URI_ERROR,
          uri_error)
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ERROR_BUILTINS */
 
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+/* The ArrayBuffer.prototype object (ECMA-262 v6, 24.1.4) */
+BUILTIN (ECMA_BUILTIN_ID_ARRAYBUFFER_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_OBJECT_PROTOTYPE,
+         true,
+         true,
+         arraybuffer_prototype)
+
+/* The ArrayBuffer object (ECMA-262 v6, 24.1.2) */
+BUILTIN (ECMA_BUILTIN_ID_ARRAYBUFFER,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         arraybuffer)
+
+/* The DataView.prototype object (ECMA-262 v6, 24.2.4) */
+BUILTIN (ECMA_BUILTIN_ID_DATAVIEW_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_OBJECT_PROTOTYPE,
+         true,
+         true,
+         dataview_prototype)
+
+/* The DataView object (ECMA-262 v6, 24.2.2) */
+BUILTIN (ECMA_BUILTIN_ID_DATAVIEW,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         dataview)
+
+/* The %TypedArray%.prototype object (ECMA-262 v6, 22.2.3) */
+BUILTIN (ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_OBJECT_PROTOTYPE,
+         true,
+         true,
+         typedarray_prototype)
+
+/* The Int8Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_INT8ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE,
+         true,
+         true,
+         int8array_prototype)
+
+/* The Int8Array object (ECMA-262 v6, 22.2.4) */
+BUILTIN (ECMA_BUILTIN_ID_INT8ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         int8array)
+
+/* The Uint8Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_UINT8ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE,
+         true,
+         true,
+         uint8array_prototype)
+
+/* The Uint8Array object (ECMA-262 v6, 22.2.4) */
+BUILTIN (ECMA_BUILTIN_ID_UINT8ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         uint8array)
+
+/* The Uint8ClampedArray.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_UINT8CLAMPEDARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE,
+         true,
+         true,
+         uint8clampedarray_prototype)
+
+/* The Uint8ClampedArray object (ECMA-262 v6, 22.2.4) */
+BUILTIN (ECMA_BUILTIN_ID_UINT8CLAMPEDARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         uint8clampedarray)
+
+/* The Int16Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_INT16ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE,
+         true,
+         true,
+         int16array_prototype)
+
+/* The Int16Array object (ECMA-262 v6, 22.2.4) */
+BUILTIN (ECMA_BUILTIN_ID_INT16ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         int16array)
+
+/* The Uint16Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_UINT16ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE,
+         true,
+         true,
+         uint16array_prototype)
+
+/* The Uint16Array object (ECMA-262 v6, 22.2.4) */
+BUILTIN (ECMA_BUILTIN_ID_UINT16ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         uint16array)
+
+/* The Int32Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_INT32ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE,
+         true,
+         true,
+         int32array_prototype)
+
+/* The Int32Array object (ECMA-262 v6, 22.2.4) */
+BUILTIN (ECMA_BUILTIN_ID_INT32ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         int32array)
+
+/* The Uint32Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_UINT32ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE,
+         true,
+         true,
+         uint32array_prototype)
+
+/* The Uint32Array object (ECMA-262 v6, 22.2.4) */
+BUILTIN (ECMA_BUILTIN_ID_UINT32ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         uint32array)
+
+/* The Float32Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_FLOAT32ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE,
+         true,
+         true,
+         float32array_prototype)
+
+/* The Float32Array object (ECMA-262 v6, 22.2.4) */
+BUILTIN (ECMA_BUILTIN_ID_FLOAT32ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         float32array)
+
+/* The Float64Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_FLOAT64ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE,
+         true,
+         true,
+         float64array_prototype)
+
+/* The Float64Array object (ECMA-262 v6, 22.2.4) */
+BUILTIN (ECMA_BUILTIN_ID_FLOAT64ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         float64array)
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_WEAKMAP_BUILTIN
+/* The WeakMap.prototype object (ECMA-262 v6, 23.3.3) */
+BUILTIN (ECMA_BUILTIN_ID_WEAKMAP_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_OBJECT_PROTOTYPE,
+         true,
+         true,
+         weakmap_prototype)
+
+/* The WeakMap object (ECMA-262 v6, 23.3.1) */
+BUILTIN (ECMA_BUILTIN_ID_WEAKMAP,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         weakmap)
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_WEAKMAP_BUILTIN */
+
 /**< The [[ThrowTypeError]] object (13.2.3) */
 BUILTIN (ECMA_BUILTIN_ID_TYPE_ERROR_THROWER,
          ECMA_OBJECT_TYPE_FUNCTION,
@@ -32,6 +32,43 @@
  * @{
  */
 
+/**
+ * Create an array object with the specified length and no elements
+ *
+ * @return pointer to the new array object
+ */
+ecma_object_t *
+ecma_op_new_array_object (uint32_t length) /**< length of the array */
+{
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ARRAY_BUILTIN
+  ecma_object_t *array_prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_ARRAY_PROTOTYPE);
+#else /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ARRAY_BUILTIN */
+  ecma_object_t *array_prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
+#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ARRAY_BUILTIN */
+
+  ecma_object_t *obj_p = ecma_create_object (array_prototype_obj_p, true, ECMA_OBJECT_TYPE_ARRAY);
+  ecma_deref_object (array_prototype_obj_p);
+
+  /*
+   * [[Class]] property is not stored explicitly for objects of ECMA_OBJECT_TYPE_ARRAY type.
+   *
+   * See also: ecma_object_get_class_name
+   */
+
+  ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+  ecma_number_t *length_num_p = ecma_alloc_number ();
+  *length_num_p = ecma_uint32_to_number (length);
+
+  ecma_property_t *length_prop_p = ecma_create_named_data_property (obj_p,
+                                                                    length_magic_string_p,
+                                                                    true, false, false);
+  ecma_set_named_data_property_value (length_prop_p, ecma_make_number_value (length_num_p));
+
+  ecma_deref_ecma_string (length_magic_string_p);
+
+  return obj_p;
+} /* ecma_op_new_array_object */
+
 /**
  * Array object creation operation.
  *
@@ -83,31 +120,7 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
     array_items_count = arguments_list_len;
   }
 
-#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ARRAY_BUILTIN
-  ecma_object_t *array_prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_ARRAY_PROTOTYPE);
-#else /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ARRAY_BUILTIN */
-  ecma_object_t *array_prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
-#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ARRAY_BUILTIN */
-
-  ecma_object_t *obj_p = ecma_create_object (array_prototype_obj_p, true, ECMA_OBJECT_TYPE_ARRAY);
-  ecma_deref_object (array_prototype_obj_p);
-
-  /*
-   * [[Class]] property is not stored explicitly for objects of ECMA_OBJECT_TYPE_ARRAY type.
-   *
-   * See also: ecma_object_get_class_name
-   */
-
-  ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
-  ecma_number_t *length_num_p = ecma_alloc_number ();
-  *length_num_p = ecma_uint32_to_number (length);
-
-  ecma_property_t *length_prop_p = ecma_create_named_data_property (obj_p,
-                                                                    length_magic_string_p,
-                                                                    true, false, false);
-  ecma_set_named_data_property_value (length_prop_p, ecma_make_number_value (length_num_p));
-
-  ecma_deref_ecma_string (length_magic_string_p);
+  ecma_object_t *obj_p = ecma_op_new_array_object (length);
 
   for (uint32_t index = 0;
        index < array_items_count;
@@ -444,6 +457,110 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
   JERRY_UNREACHABLE ();
 } /* ecma_op_array_object_define_own_property */
 
+/**
+ * Initialize an element of an array object, which is under construction
+ *
+ * Note:
+ *      the element is created as a writable, enumerable and configurable own data property
+ *      without going through [[DefineOwnProperty]], so the array must be created
+ *      with ecma_op_new_array_object, the index must be less than its length
+ *      and the element must not be initialized yet.
+ *
+ *      the value is moved into the property, i.e. it must not be freed by the caller,
+ *      and object values must not hold a reference (see also: ecma_copy_value).
+ */
+void
+ecma_op_array_object_init_element (ecma_object_t *obj_p, /**< array object */
+                                   uint32_t index, /**< index of the element */
+                                   ecma_value_t value) /**< value of the element */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY);
+
+  ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+
+  ecma_property_t *element_prop_p = ecma_create_named_data_property (obj_p,
+                                                                     index_string_p,
+                                                                     true, true, true);
+  ecma_set_named_data_property_value (element_prop_p, value);
+
+  ecma_deref_ecma_string (index_string_p);
+} /* ecma_op_array_object_init_element */
+
+/**
+ * Get the length of an array object
+ *
+ * @return value of the 'length' property
+ */
+uint32_t
+ecma_op_array_object_get_length (ecma_object_t *obj_p) /**< array object */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY);
+
+  ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+  ecma_property_t *length_prop_p = ecma_get_named_data_property (obj_p, length_magic_string_p);
+  ecma_deref_ecma_string (length_magic_string_p);
+
+  ecma_number_t *length_num_p = ecma_get_number_from_value (ecma_get_named_data_property_value (length_prop_p));
+
+  return ecma_number_to_uint32 (*length_num_p);
+} /* ecma_op_array_object_get_length */
+
+/**
+ * Collect a range of elements of an array object in a single walk over its property list
+ *
+ * Note:
+ *      the collected values are not copied, they are only valid until the array is modified.
+ *
+ * @return true - if each element of the range is an own data property of the array,
+ *                so all of the output values are set;
+ *         false - otherwise (holes or accessor elements are present),
+ *                 the elements should be read with [[Get]] in this case.
+ */
+bool
+ecma_op_array_object_get_own_elements (ecma_object_t *obj_p, /**< array object */
+                                       uint32_t start, /**< index of the first element */
+                                       uint32_t count, /**< number of elements */
+                                       ecma_value_t *values_p) /**< out: values of the elements */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY);
+  JERRY_ASSERT (count == 0 || values_p != NULL);
+
+  uint32_t found_count = 0;
+
+  for (ecma_property_t *property_p = ecma_get_property_list (obj_p);
+       property_p != NULL && found_count < count;
+       property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
+  {
+    if (property_p->type != ECMA_PROPERTY_NAMEDDATA)
+    {
+      continue;
+    }
+
+    ecma_string_t *name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, property_p->u.named_data_property.name_p);
+
+    /*
+     * Elements are named by ecma_new_ecma_string_from_uint32, so other string containers are skipped
+     * without parsing them. If an element is named otherwise, the range is reported as incomplete.
+     */
+    if (name_p->container != ECMA_STRING_CONTAINER_UINT32_IN_DESC)
+    {
+      continue;
+    }
+
+    uint32_t index = name_p->u.uint32_number;
+
+    if (index >= start
+        && index - start < count
+        && index != ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX)
+    {
+      values_p[index - start] = ecma_get_named_data_property_value (property_p);
+      found_count++;
+    }
+  }
+
+  return found_count == count;
+} /* ecma_op_array_object_get_own_elements */
+
 /**
  * @}
  * @}
@@ -25,12 +25,21 @@
  * @{
  */
 
+extern ecma_object_t *
+ecma_op_new_array_object (uint32_t);
 extern ecma_value_t
 ecma_op_create_array_object (const ecma_value_t *, ecma_length_t, bool);
 
 extern ecma_value_t
 ecma_op_array_object_define_own_property (ecma_object_t *, ecma_string_t *, const ecma_property_descriptor_t *, bool);
 
+extern void
+ecma_op_array_object_init_element (ecma_object_t *, uint32_t, ecma_value_t);
+extern uint32_t
+ecma_op_array_object_get_length (ecma_object_t *);
+extern bool
+ecma_op_array_object_get_own_elements (ecma_object_t *, uint32_t, uint32_t, ecma_value_t *);
+
 /**
  * @}
  * @}
@@ -0,0 +1,234 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-arraybuffer-object.h"
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-try-catch-macro.h"
+#include "jrt-libc-includes.h"
+#include "mem-heap.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaarraybufferobject ECMA ArrayBuffer object related routines
+ * @{
+ */
+
+/**
+ * Create an ArrayBuffer object for the specified backing store
+ *
+ * @return pointer to the new ArrayBuffer object
+ */
+static ecma_object_t *
+ecma_arraybuffer_create_object (ecma_arraybuffer_t *arraybuffer_p) /**< backing store */
+{
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+  ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_ARRAYBUFFER_PROTOTYPE);
+#else /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+  ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
+#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+  ecma_object_t *obj_p = ecma_create_object (prototype_obj_p, true, ECMA_OBJECT_TYPE_GENERAL);
+  ecma_deref_object (prototype_obj_p);
+
+  ecma_property_t *class_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
+  class_prop_p->u.internal_property.value = LIT_MAGIC_STRING_ARRAY_BUFFER_UL;
+
+  ecma_property_t *store_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARRAYBUFFER);
+  ECMA_SET_NON_NULL_POINTER (store_prop_p->u.internal_property.value, arraybuffer_p);
+
+  /*
+   * The byteLength accessor of ArrayBuffer.prototype (ECMA-262 v6, 24.1.4.1) is represented
+   * with a read-only own data property, as the length of an ArrayBuffer never changes.
+   */
+  ecma_string_t *byte_length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_BYTE_LENGTH_UL);
+  ecma_property_t *byte_length_prop_p = ecma_create_named_data_property (obj_p,
+                                                                         byte_length_magic_string_p,
+                                                                         false, false, false);
+  ecma_number_t *byte_length_value_p = ecma_alloc_number ();
+  *byte_length_value_p = ecma_uint32_to_number (arraybuffer_p->length);
+  ecma_set_named_data_property_value (byte_length_prop_p, ecma_make_number_value (byte_length_value_p));
+  ecma_deref_ecma_string (byte_length_magic_string_p);
+
+  return obj_p;
+} /* ecma_arraybuffer_create_object */
+
+/**
+ * Create an ArrayBuffer object, which stores its data on the engine's heap
+ *
+ * Note:
+ *      the data is filled with zeros
+ *
+ * @return pointer to the new ArrayBuffer object
+ */
+ecma_object_t *
+ecma_arraybuffer_new_object (uint32_t length) /**< length of the buffer, in bytes */
+{
+  ecma_arraybuffer_t *arraybuffer_p;
+  arraybuffer_p = (ecma_arraybuffer_t *) mem_heap_alloc_block (sizeof (ecma_arraybuffer_t) + length,
+                                                               MEM_HEAP_ALLOC_LONG_TERM);
+  arraybuffer_p->external_buffer_p = NULL;
+  arraybuffer_p->free_cb = (ecma_external_pointer_t) NULL;
+  arraybuffer_p->length = length;
+
+  memset (arraybuffer_p + 1, 0, length);
+
+  return ecma_arraybuffer_create_object (arraybuffer_p);
+} /* ecma_arraybuffer_new_object */
+
+/**
+ * Create an ArrayBuffer object, which references a buffer of the embedder without copying it
+ *
+ * Note:
+ *      the free callback is called with the buffer, when the ArrayBuffer object is freed
+ *
+ * @return pointer to the new ArrayBuffer object
+ */
+ecma_object_t *
+ecma_arraybuffer_new_external_object (uint8_t *buffer_p, /**< buffer of the embedder */
+                                      uint32_t length, /**< length of the buffer, in bytes */
+                                      ecma_external_pointer_t free_cb) /**< callback, which releases the buffer
+                                                                        *   (jerry_api_arraybuffer_free_callback_t),
+                                                                        *   or NULL */
+{
+  JERRY_ASSERT (buffer_p != NULL || length == 0);
+
+  ecma_arraybuffer_t *arraybuffer_p;
+  arraybuffer_p = (ecma_arraybuffer_t *) mem_heap_alloc_block (sizeof (ecma_arraybuffer_t),
+                                                               MEM_HEAP_ALLOC_LONG_TERM);
+  arraybuffer_p->external_buffer_p = buffer_p;
+  arraybuffer_p->free_cb = free_cb;
+  arraybuffer_p->length = length;
+
+  return ecma_arraybuffer_create_object (arraybuffer_p);
+} /* ecma_arraybuffer_new_external_object */
+
+/**
+ * ArrayBuffer object creation operation.
+ *
+ * See also: ECMA-262 v6, 24.1.2.1
+ *
+ * Note:
+ *      the length is converted like ToIndex of later editions, i.e. it is truncated to an integer
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_create_arraybuffer_object (const ecma_value_t *arguments_list_p, /**< list of arguments that
+                                                                          *   are passed to ArrayBuffer constructor */
+                                   ecma_length_t arguments_list_len) /**< length of the arguments' list */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ecma_value_t length_arg = ((arguments_list_len > 0) ? arguments_list_p[0]
+                                                      : ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (length_num, length_arg, ret_value);
+
+  ecma_number_t length = ecma_number_is_nan (length_num) ? ECMA_NUMBER_ZERO : ecma_number_trunc (length_num);
+
+  if (length < ECMA_NUMBER_ZERO
+      || length > (ecma_number_t) MEM_HEAP_AREA_SIZE)
+  {
+    ret_value = ecma_raise_range_error ("Invalid ArrayBuffer length");
+  }
+  else
+  {
+    ecma_object_t *obj_p = ecma_arraybuffer_new_object (ecma_number_to_uint32 (length));
+
+    ret_value = ecma_make_object_value (obj_p);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (length_num);
+
+  return ret_value;
+} /* ecma_op_create_arraybuffer_object */
+
+/**
+ * Check whether the value is an ArrayBuffer object
+ *
+ * @return true - if the value is an ArrayBuffer object,
+ *         false - otherwise.
+ */
+bool
+ecma_is_arraybuffer (ecma_value_t value) /**< ecma value */
+{
+  if (!ecma_is_value_object (value))
+  {
+    return false;
+  }
+
+  ecma_object_t *obj_p = ecma_get_object_from_value (value);
+
+  return (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_GENERAL
+          && ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARRAYBUFFER) != NULL);
+} /* ecma_is_arraybuffer */
+
+/**
+ * Get the backing store of an ArrayBuffer object
+ *
+ * @return pointer to the backing store descriptor
+ */
+static ecma_arraybuffer_t *
+ecma_arraybuffer_get_store (ecma_object_t *obj_p) /**< ArrayBuffer object */
+{
+  ecma_property_t *store_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARRAYBUFFER);
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_arraybuffer_t, store_prop_p->u.internal_property.value);
+} /* ecma_arraybuffer_get_store */
+
+/**
+ * Get the data of an ArrayBuffer object
+ *
+ * @return pointer to the first byte of the buffer
+ */
+uint8_t *
+ecma_arraybuffer_get_buffer (ecma_object_t *obj_p) /**< ArrayBuffer object */
+{
+  ecma_arraybuffer_t *arraybuffer_p = ecma_arraybuffer_get_store (obj_p);
+
+  if (arraybuffer_p->external_buffer_p != NULL)
+  {
+    return arraybuffer_p->external_buffer_p;
+  }
+
+  return (uint8_t *) (arraybuffer_p + 1);
+} /* ecma_arraybuffer_get_buffer */
+
+/**
+ * Get the length of an ArrayBuffer object
+ *
+ * @return length of the buffer, in bytes
+ */
+uint32_t
+ecma_arraybuffer_get_length (ecma_object_t *obj_p) /**< ArrayBuffer object */
+{
+  return ecma_arraybuffer_get_store (obj_p)->length;
+} /* ecma_arraybuffer_get_length */
+
+/**
+ * @}
+ * @}
+ */
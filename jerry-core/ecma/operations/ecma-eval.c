@@ -16,6 +16,7 @@
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
 #include "ecma-eval.h"
+#include "ecma-eval-cache.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
@@ -97,6 +98,13 @@ ecma_op_eval_chars_buffer (const jerry_api_char_t *code_p, /**< code characters
 
   bool is_strict_call = (is_direct && is_called_from_strict_mode_code);
 
+  bytecode_data_p = ecma_eval_cache_lookup (code_p, (lit_utf8_size_t) code_buffer_size, is_strict_call, is_direct);
+
+  if (bytecode_data_p != NULL)
+  {
+    return vm_run_eval (bytecode_data_p, is_direct);
+  }
+
   parse_status = parser_parse_eval (code_p,
                                     code_buffer_size,
                                     is_strict_call,
@@ -114,6 +122,8 @@ ecma_op_eval_chars_buffer (const jerry_api_char_t *code_p, /**< code characters
   {
     JERRY_ASSERT (parse_status == JSP_STATUS_OK);
 
+    ecma_eval_cache_insert (code_p, (lit_utf8_size_t) code_buffer_size, is_strict_call, is_direct, bytecode_data_p);
+
     completion = vm_run_eval (bytecode_data_p, is_direct);
   }
 
@@ -26,6 +26,7 @@
 #include "ecma-objects-general.h"
 #include "ecma-objects-arguments.h"
 #include "ecma-try-catch-macro.h"
+#include "js-parser.h"
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
@@ -585,6 +586,19 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
       const ecma_compiled_code_t *bytecode_data_p;
       bytecode_data_p = MEM_CP_GET_POINTER (const ecma_compiled_code_t, bytecode_prop_p->u.internal_property.value);
 
+      if (unlikely (CBC_IS_LAZY_FUNCTION (bytecode_data_p)))
+      {
+        ecma_compiled_code_t *compiled_code_p;
+
+        if (parser_compile_lazy_function ((ecma_compiled_code_t *) bytecode_data_p,
+                                          &compiled_code_p) != JSP_STATUS_OK)
+        {
+          return ecma_raise_syntax_error ("");
+        }
+
+        bytecode_data_p = compiled_code_p;
+      }
+
       is_strict = (bytecode_data_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) ? true : false;
       is_no_lex_env = (bytecode_data_p->status_flags & CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED) ? true : false;
 
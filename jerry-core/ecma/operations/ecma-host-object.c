@@ -0,0 +1,415 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-builtins.h"
+#include "ecma-for-in-cache.h"
+#include "ecma-function-object.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-host-object.h"
+#include "ecma-objects.h"
+#include "ecma-objects-general.h"
+
+#define JERRY_INTERNAL
+#include "jerry-internal.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmahostobject ECMA host object related routines
+ * @{
+ *
+ * The properties of a host object are provided by the property interceptors of the embedder.
+ * The host object can also have ordinary own properties (e.g. the ones that were defined with
+ * Object.defineProperty, or the ones that were not stored by the interceptors), which shadow
+ * the properties of the embedder.
+ *
+ * [[GetOwnProperty]] instantiates the property of the embedder in an own data property (the slot)
+ * of the host object. A host object has at most one slot, which is reused for the next requested property.
+ */
+
+/**
+ * Create a host object
+ *
+ * Note:
+ *      the property interceptors must remain valid while the object is alive
+ *
+ * @return pointer to the new host object
+ */
+ecma_object_t *
+ecma_op_create_host_object (ecma_external_pointer_t handlers_p) /**< property interceptors
+                                                                 *   (jerry_api_host_object_handlers_t) */
+{
+  ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
+
+  ecma_object_t *obj_p = ecma_create_object (prototype_obj_p, true, ECMA_OBJECT_TYPE_HOST);
+  ecma_deref_object (prototype_obj_p);
+
+  bool is_created = ecma_create_external_pointer_property (obj_p, ECMA_INTERNAL_PROPERTY_HOST_HANDLERS, handlers_p);
+  JERRY_ASSERT (is_created);
+
+  ecma_property_t *slot_ref_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_HOST_SLOT);
+  slot_ref_prop_p->u.internal_property.value = ECMA_NULL_POINTER;
+
+  return obj_p;
+} /* ecma_op_create_host_object */
+
+/**
+ * Get the property interceptors of a host object
+ *
+ * @return external pointer to the interceptors
+ */
+static ecma_external_pointer_t
+ecma_host_object_get_handlers (ecma_object_t *obj_p) /**< host object */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_HOST);
+
+  ecma_external_pointer_t handlers_p;
+  bool is_retrieved = ecma_get_external_pointer_value (obj_p, ECMA_INTERNAL_PROPERTY_HOST_HANDLERS, &handlers_p);
+  JERRY_ASSERT (is_retrieved);
+
+  return handlers_p;
+} /* ecma_host_object_get_handlers */
+
+/**
+ * Get the slot of a host object
+ *
+ * @return pointer to the property, which holds the last requested property of the embedder,
+ *         NULL - if there is no such property.
+ */
+static ecma_property_t *
+ecma_host_object_get_slot (ecma_object_t *obj_p) /**< host object */
+{
+  ecma_property_t *slot_ref_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_HOST_SLOT);
+
+  return ECMA_GET_POINTER (ecma_property_t, slot_ref_prop_p->u.internal_property.value);
+} /* ecma_host_object_get_slot */
+
+/**
+ * Set the slot of a host object
+ */
+static void
+ecma_host_object_set_slot (ecma_object_t *obj_p, /**< host object */
+                           ecma_property_t *slot_p) /**< new slot, or NULL */
+{
+  ecma_property_t *slot_ref_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_HOST_SLOT);
+
+  ECMA_SET_POINTER (slot_ref_prop_p->u.internal_property.value, slot_p);
+} /* ecma_host_object_set_slot */
+
+/**
+ * Delete the slot of a host object
+ */
+static void
+ecma_host_object_drop_slot (ecma_object_t *obj_p) /**< host object */
+{
+  ecma_property_t *slot_p = ecma_host_object_get_slot (obj_p);
+
+  if (slot_p != NULL)
+  {
+    ecma_delete_property (obj_p, slot_p);
+    ecma_host_object_set_slot (obj_p, NULL);
+  }
+} /* ecma_host_object_drop_slot */
+
+/**
+ * Find an ordinary own property of a host object
+ *
+ * @return pointer to the property - if it exists,
+ *         NULL - otherwise (the slot is not an ordinary property).
+ */
+static ecma_property_t *
+ecma_host_object_find_ordinary_property (ecma_object_t *obj_p, /**< host object */
+                                         ecma_string_t *property_name_p) /**< property name */
+{
+  ecma_property_t *prop_p = ecma_find_named_property (obj_p, property_name_p);
+
+  if (prop_p != NULL && prop_p == ecma_host_object_get_slot (obj_p))
+  {
+    return NULL;
+  }
+
+  return prop_p;
+} /* ecma_host_object_find_ordinary_property */
+
+/**
+ * [[Get]] ecma host object's operation
+ *
+ * See also:
+ *          ECMA-262 v5, 8.12.3
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_host_object_get (ecma_object_t *obj_p, /**< host object */
+                         ecma_string_t *property_name_p) /**< property name */
+{
+  if (ecma_host_object_find_ordinary_property (obj_p, property_name_p) != NULL)
+  {
+    return ecma_op_general_object_get (obj_p, property_name_p);
+  }
+
+  ecma_value_t value;
+
+  if (jerry_dispatch_host_object_get (obj_p, ecma_host_object_get_handlers (obj_p), property_name_p, &value))
+  {
+    return value;
+  }
+
+  /* The object does not have the property, so the lookup continues on the prototype chain
+   * without asking the interceptor again from [[GetOwnProperty]]. */
+  ecma_object_t *prototype_p = ecma_get_object_prototype (obj_p);
+
+  if (prototype_p == NULL)
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  const ecma_property_t *prop_p = ecma_op_object_get_property (prototype_p, property_name_p);
+
+  if (prop_p == NULL)
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  if (prop_p->type == ECMA_PROPERTY_NAMEDDATA)
+  {
+    return ecma_copy_value (ecma_get_named_data_property_value (prop_p), true);
+  }
+
+  ecma_object_t *getter_p = ecma_get_named_accessor_property_getter (prop_p);
+
+  if (getter_p == NULL)
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  return ecma_op_function_call (getter_p, ecma_make_object_value (obj_p), NULL, 0);
+} /* ecma_op_host_object_get */
+
+/**
+ * [[GetOwnProperty]] ecma host object's operation
+ *
+ * Note:
+ *      a property of the embedder is returned in the slot of the host object, which is valid
+ *      until the next [[GetOwnProperty]] call for a property of the embedder.
+ *
+ * @return pointer to a property - if it exists,
+ *         NULL (i.e. ecma-undefined) - otherwise.
+ */
+ecma_property_t *
+ecma_op_host_object_get_own_property (ecma_object_t *obj_p, /**< host object */
+                                      ecma_string_t *property_name_p) /**< property name */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_HOST);
+
+  ecma_property_t *prop_p = ecma_find_named_property (obj_p, property_name_p);
+
+  if (prop_p != NULL && prop_p != ecma_host_object_get_slot (obj_p))
+  {
+    return prop_p;
+  }
+
+  ecma_value_t value;
+
+  if (!jerry_dispatch_host_object_get (obj_p, ecma_host_object_get_handlers (obj_p), property_name_p, &value))
+  {
+    ecma_host_object_drop_slot (obj_p);
+    return NULL;
+  }
+
+  if (prop_p == NULL)
+  {
+    ecma_host_object_drop_slot (obj_p);
+
+    prop_p = ecma_create_named_data_property (obj_p, property_name_p, true, true, true);
+    ecma_host_object_set_slot (obj_p, prop_p);
+  }
+
+  ecma_named_data_property_assign_value (obj_p, prop_p, value);
+  ecma_free_value (value);
+
+  return prop_p;
+} /* ecma_op_host_object_get_own_property */
+
+/**
+ * Check whether the host object has an own property
+ *
+ * Note:
+ *      unlike [[GetOwnProperty]], the get interceptor is not called if the has interceptor is present
+ *
+ * @return true - if the property exists,
+ *         false - otherwise.
+ */
+bool
+ecma_op_host_object_has_own_property (ecma_object_t *obj_p, /**< host object */
+                                      ecma_string_t *property_name_p) /**< property name */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_HOST);
+
+  if (ecma_host_object_find_ordinary_property (obj_p, property_name_p) != NULL)
+  {
+    return true;
+  }
+
+  return jerry_dispatch_host_object_has (obj_p, ecma_host_object_get_handlers (obj_p), property_name_p);
+} /* ecma_op_host_object_has_own_property */
+
+/**
+ * [[Put]] ecma host object's operation
+ *
+ * Note:
+ *      if the set interceptor does not store the value, it is stored in an ordinary own property
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_host_object_put (ecma_object_t *obj_p, /**< host object */
+                         ecma_string_t *property_name_p, /**< property name */
+                         ecma_value_t value, /**< ecma value */
+                         bool is_throw) /**< flag that controls failure handling */
+{
+  if (ecma_host_object_find_ordinary_property (obj_p, property_name_p) == NULL
+      && jerry_dispatch_host_object_set (obj_p, ecma_host_object_get_handlers (obj_p), property_name_p, value))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+
+  ecma_host_object_drop_slot (obj_p);
+
+  ecma_value_t ret_value = ecma_op_general_object_put (obj_p, property_name_p, value, is_throw);
+
+  /* the property, which holds the value, is an ordinary own property from now on */
+  ecma_host_object_set_slot (obj_p, NULL);
+
+  return ret_value;
+} /* ecma_op_host_object_put */
+
+/**
+ * [[Delete]] ecma host object's operation
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_host_object_delete (ecma_object_t *obj_p, /**< host object */
+                            ecma_string_t *property_name_p, /**< property name */
+                            bool is_throw) /**< flag that controls failure handling */
+{
+  if (ecma_host_object_find_ordinary_property (obj_p, property_name_p) != NULL)
+  {
+    return ecma_op_general_object_delete (obj_p, property_name_p, is_throw);
+  }
+
+  ecma_host_object_drop_slot (obj_p);
+
+  if (!jerry_dispatch_host_object_delete (obj_p, ecma_host_object_get_handlers (obj_p), property_name_p))
+  {
+    return ecma_reject (is_throw);
+  }
+
+  ecma_for_in_cache_notify_delete ();
+
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+} /* ecma_op_host_object_delete */
+
+/**
+ * [[DefineOwnProperty]] ecma host object's operation
+ *
+ * Note:
+ *      a writable, enumerable and configurable data property is passed to the set interceptor,
+ *      other properties (and the values not stored by the interceptor) are defined as ordinary own properties
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_host_object_define_own_property (ecma_object_t *obj_p, /**< host object */
+                                         ecma_string_t *property_name_p, /**< property name */
+                                         const ecma_property_descriptor_t *property_desc_p, /**< property
+                                                                                             *   descriptor */
+                                         bool is_throw) /**< flag that controls failure handling */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_HOST);
+
+  if (property_desc_p->is_value_defined
+      && !property_desc_p->is_get_defined
+      && !property_desc_p->is_set_defined
+      && (!property_desc_p->is_writable_defined || property_desc_p->is_writable)
+      && (!property_desc_p->is_enumerable_defined || property_desc_p->is_enumerable)
+      && (!property_desc_p->is_configurable_defined || property_desc_p->is_configurable)
+      && ecma_host_object_find_ordinary_property (obj_p, property_name_p) == NULL
+      && jerry_dispatch_host_object_set (obj_p,
+                                         ecma_host_object_get_handlers (obj_p),
+                                         property_name_p,
+                                         property_desc_p->value))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+
+  ecma_host_object_drop_slot (obj_p);
+
+  ecma_value_t ret_value = ecma_op_general_object_define_own_property (obj_p,
+                                                                       property_name_p,
+                                                                       property_desc_p,
+                                                                       is_throw);
+
+  /* the defined property is an ordinary own property from now on */
+  ecma_host_object_set_slot (obj_p, NULL);
+
+  return ret_value;
+} /* ecma_op_host_object_define_own_property */
+
+/**
+ * List names of the properties of the embedder
+ *
+ * Note:
+ *      the properties of the embedder are enumerable
+ */
+void
+ecma_op_host_object_list_lazy_property_names (ecma_object_t *obj_p, /**< host object */
+                                              bool separate_enumerable, /**< true -  list enumerable properties
+                                                                         *           into main collection,
+                                                                         *           and non-enumerable to collection
+                                                                         *           of 'skipped non-enumerable'
+                                                                         *           properties,
+                                                                         *   false - list all properties into main
+                                                                         *           collection.
+                                                                         */
+                                              ecma_collection_header_t *main_collection_p, /**< 'main'
+                                                                                            *   collection */
+                                              ecma_collection_header_t *non_enum_collection_p) /**< skipped
+                                                                                                *   'non-enumerable'
+                                                                                                *   collection */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_HOST);
+
+  (void) separate_enumerable;
+  (void) non_enum_collection_p;
+
+  /* the slot is not listed with the ordinary own properties, as the embedder might not have it anymore */
+  ecma_host_object_drop_slot (obj_p);
+
+  jerry_dispatch_host_object_enumerate (obj_p, ecma_host_object_get_handlers (obj_p), main_collection_p);
+} /* ecma_op_host_object_list_lazy_property_names */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,55 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_HOST_OBJECT_H
+#define ECMA_HOST_OBJECT_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmahostobject ECMA host object related routines
+ * @{
+ */
+
+extern ecma_object_t *
+ecma_op_create_host_object (ecma_external_pointer_t);
+
+extern ecma_value_t
+ecma_op_host_object_get (ecma_object_t *, ecma_string_t *);
+extern ecma_property_t *
+ecma_op_host_object_get_own_property (ecma_object_t *, ecma_string_t *);
+extern bool
+ecma_op_host_object_has_own_property (ecma_object_t *, ecma_string_t *);
+extern ecma_value_t
+ecma_op_host_object_put (ecma_object_t *, ecma_string_t *, ecma_value_t, bool);
+extern ecma_value_t
+ecma_op_host_object_delete (ecma_object_t *, ecma_string_t *, bool);
+extern ecma_value_t
+ecma_op_host_object_define_own_property (ecma_object_t *, ecma_string_t *, const ecma_property_descriptor_t *, bool);
+extern void
+ecma_op_host_object_list_lazy_property_names (ecma_object_t *,
+                                              bool,
+                                              ecma_collection_header_t *,
+                                              ecma_collection_header_t *);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_HOST_OBJECT_H */
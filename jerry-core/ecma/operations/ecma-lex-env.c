@@ -21,6 +21,7 @@
 #include "ecma-helpers.h"
 #include "ecma-lex-env.h"
 #include "ecma-objects.h"
+#include "jcontext.h"
 #include "jrt.h"
 
 /** \addtogroup ecma ECMA
@@ -37,13 +38,6 @@
  * @{
  */
 
-/**
- * Global lexical environment
- *
- * See also: ECMA-262 v5, 10.2.3
- */
-ecma_object_t *ecma_global_lex_env_p = NULL;
-
 /**
  * Initialize Global environment
  */
@@ -51,11 +45,11 @@ void
 ecma_init_environment (void)
 {
 #ifdef CONFIG_ECMA_GLOBAL_ENVIRONMENT_DECLARATIVE
-  ecma_global_lex_env_p = ecma_create_decl_lex_env (NULL);
+  JERRY_CONTEXT (ecma_global_lex_env_p) = ecma_create_decl_lex_env (NULL);
 #else /* !CONFIG_ECMA_GLOBAL_ENVIRONMENT_DECLARATIVE */
   ecma_object_t *glob_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_GLOBAL);
 
-  ecma_global_lex_env_p = ecma_create_object_lex_env (NULL, glob_obj_p, false);
+  JERRY_CONTEXT (ecma_global_lex_env_p) = ecma_create_object_lex_env (NULL, glob_obj_p, false);
 
   ecma_deref_object (glob_obj_p);
 #endif /* !CONFIG_ECMA_GLOBAL_ENVIRONMENT_DECLARATIVE */
@@ -67,10 +61,65 @@ ecma_init_environment (void)
 void
 ecma_finalize_environment (void)
 {
-  ecma_deref_object (ecma_global_lex_env_p);
-  ecma_global_lex_env_p = NULL;
+  ecma_deref_object (JERRY_CONTEXT (ecma_global_lex_env_p));
+  JERRY_CONTEXT (ecma_global_lex_env_p) = NULL;
 } /* ecma_finalize_environment */
 
+/**
+ * Save Global environment to a heap image
+ *
+ * @return true - if the environment was written successfully,
+ *         false - if the buffer is too small.
+ */
+bool
+ecma_save_environment_image (uint8_t *buffer_p, /**< buffer */
+                             size_t buffer_size, /**< size of buffer */
+                             size_t *in_out_buffer_offset_p) /**< in: offset to write to,
+                                                              *   out: offset, incremented on size
+                                                              *        of the written data */
+{
+  mem_cpointer_t global_lex_env_cp;
+  ECMA_SET_NON_NULL_POINTER (global_lex_env_cp, JERRY_CONTEXT (ecma_global_lex_env_p));
+
+  return jrt_write_to_buffer_by_offset (buffer_p,
+                                        buffer_size,
+                                        in_out_buffer_offset_p,
+                                        &global_lex_env_cp,
+                                        sizeof (global_lex_env_cp));
+} /* ecma_save_environment_image */
+
+/**
+ * Restore Global environment from a heap image
+ *
+ * Note:
+ *      the routine should be called instead of ecma_init_environment
+ *
+ * @return true - if the environment was restored successfully,
+ *         false - if the image is truncated.
+ */
+bool
+ecma_load_environment_image (const uint8_t *buffer_p, /**< buffer */
+                             size_t buffer_size, /**< size of buffer */
+                             size_t *in_out_buffer_offset_p) /**< in: offset to read from,
+                                                              *   out: offset, incremented on size
+                                                              *        of the read data */
+{
+  mem_cpointer_t global_lex_env_cp;
+
+  if (!jrt_read_from_buffer_by_offset (buffer_p,
+                                       buffer_size,
+                                       in_out_buffer_offset_p,
+                                       &global_lex_env_cp,
+                                       sizeof (global_lex_env_cp)))
+  {
+    return false;
+  }
+
+  JERRY_CONTEXT (ecma_global_lex_env_p) = ECMA_GET_NON_NULL_POINTER (ecma_object_t, global_lex_env_cp);
+
+  return true;
+} /* ecma_load_environment_image */
+
 /**
  * Get reference to Global lexical environment
  *
@@ -79,9 +128,9 @@ ecma_finalize_environment (void)
 ecma_object_t *
 ecma_get_global_environment (void)
 {
-  ecma_ref_object (ecma_global_lex_env_p);
+  ecma_ref_object (JERRY_CONTEXT (ecma_global_lex_env_p));
 
-  return ecma_global_lex_env_p;
+  return JERRY_CONTEXT (ecma_global_lex_env_p);
 } /* ecma_get_global_environment */
 
 /**
@@ -96,7 +145,7 @@ ecma_is_lexical_environment_global (ecma_object_t *lex_env_p) /**< lexical envir
   JERRY_ASSERT (lex_env_p != NULL
                 && ecma_is_lexical_environment (lex_env_p));
 
-  return (lex_env_p == ecma_global_lex_env_p);
+  return (lex_env_p == JERRY_CONTEXT (ecma_global_lex_env_p));
 } /* ecma_is_lexical_environment_global */
 
 /**
@@ -36,6 +36,8 @@
 
 extern void ecma_init_environment (void);
 extern void ecma_finalize_environment (void);
+extern bool ecma_save_environment_image (uint8_t *, size_t, size_t *);
+extern bool ecma_load_environment_image (const uint8_t *, size_t, size_t *);
 extern ecma_object_t *ecma_get_global_environment (void);
 extern bool ecma_is_lexical_environment_global (ecma_object_t *);
 
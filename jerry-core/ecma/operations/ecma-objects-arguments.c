@@ -137,13 +137,26 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
            indx < formal_params_number;
            indx++)
       {
+        lit_cpointer_t name_cp;
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+        if (CBC_IS_IN_SNAPSHOT (bytecode_data_p))
+        {
+          name_cp = cbc_get_snapshot_literal (bytecode_data_p, indx);
+        }
+        else
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+        {
+          name_cp = literal_p[indx];
+        }
+
         // i.
-        if (literal_p[indx].u.packed_value == MEM_CP_NULL)
+        if (name_cp.u.packed_value == MEM_CP_NULL)
         {
           continue;
         }
 
-        ecma_string_t *name_p = ecma_new_ecma_string_from_lit_cp (literal_p[indx]);
+        ecma_string_t *name_p = ecma_new_ecma_string_from_lit_cp (name_cp);
         ecma_string_t *indx_string_p = ecma_new_ecma_string_from_uint32 ((uint32_t) indx);
 
         prop_desc.is_value_defined = true;
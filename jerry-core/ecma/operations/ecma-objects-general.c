@@ -16,6 +16,7 @@
 #include "ecma-builtin-helpers.h"
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
+#include "ecma-for-in-cache.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
@@ -850,6 +851,11 @@ ecma_op_general_object_define_own_property (ecma_object_t *obj_p, /**< the objec
 
   if (property_desc_p->is_enumerable_defined)
   {
+    if (ecma_is_property_enumerable (current_p) != property_desc_p->is_enumerable)
+    {
+      ecma_for_in_cache_invalidate (obj_p);
+    }
+
     ecma_set_property_enumerable_attr (current_p, property_desc_p->is_enumerable);
   }
 
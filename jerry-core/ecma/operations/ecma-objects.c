@@ -18,11 +18,13 @@
 #include "ecma-exceptions.h"
 #include "ecma-globals.h"
 #include "ecma-function-object.h"
+#include "ecma-host-object.h"
 #include "ecma-lcache.h"
 #include "ecma-string-object.h"
 #include "ecma-objects-arguments.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects.h"
+#include "ecma-typedarray-object.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -44,7 +46,9 @@ ecma_assert_object_type_is_valid (ecma_object_type_t type) /**< object's impleme
                 || type == ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION
                 || type == ECMA_OBJECT_TYPE_STRING
                 || type == ECMA_OBJECT_TYPE_ARGUMENTS
-                || type == ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION);
+                || type == ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION
+                || type == ECMA_OBJECT_TYPE_TYPEDARRAY
+                || type == ECMA_OBJECT_TYPE_HOST);
 } /* ecma_assert_object_type_is_valid */
 
 /**
@@ -84,6 +88,16 @@ ecma_op_object_get (ecma_object_t *obj_p, /**< the object */
     {
       return ecma_op_arguments_object_get (obj_p, property_name_p);
     }
+
+    case ECMA_OBJECT_TYPE_TYPEDARRAY:
+    {
+      return ecma_op_typedarray_object_get (obj_p, property_name_p);
+    }
+
+    case ECMA_OBJECT_TYPE_HOST:
+    {
+      return ecma_op_host_object_get (obj_p, property_name_p);
+    }
   }
 
   JERRY_ASSERT (false);
@@ -141,6 +155,20 @@ ecma_op_object_get_own_property_longpath (ecma_object_t *obj_p, /**< the object
 
       break;
     }
+
+    case ECMA_OBJECT_TYPE_TYPEDARRAY:
+    {
+      prop_p = ecma_op_typedarray_object_get_own_property (obj_p, property_name_p);
+
+      break;
+    }
+
+    case ECMA_OBJECT_TYPE_HOST:
+    {
+      prop_p = ecma_op_host_object_get_own_property (obj_p, property_name_p);
+
+      break;
+    }
   }
 
   if (unlikely (prop_p == NULL))
@@ -223,6 +251,58 @@ ecma_op_object_get_property (ecma_object_t *obj_p, /**< the object */
   return ecma_op_general_object_get_property (obj_p, property_name_p);
 } /* ecma_op_object_get_property */
 
+/**
+ * Check whether the object has an own property
+ *
+ * Note:
+ *      the value of a host object property is not requested
+ *
+ * @return true - if the property exists,
+ *         false - otherwise.
+ */
+bool
+ecma_op_object_has_own_property (ecma_object_t *obj_p, /**< the object */
+                                 ecma_string_t *property_name_p) /**< property name */
+{
+  JERRY_ASSERT (obj_p != NULL
+                && !ecma_is_lexical_environment (obj_p));
+  JERRY_ASSERT (property_name_p != NULL);
+
+  if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_HOST)
+  {
+    return ecma_op_host_object_has_own_property (obj_p, property_name_p);
+  }
+
+  return ecma_op_object_get_own_property (obj_p, property_name_p) != NULL;
+} /* ecma_op_object_has_own_property */
+
+/**
+ * Check whether the object or its prototype chain has a property
+ *
+ * See also:
+ *          ECMA-262 v5, 8.12.6
+ *
+ * @return true - if the property exists,
+ *         false - otherwise.
+ */
+bool
+ecma_op_object_has_property (ecma_object_t *obj_p, /**< the object */
+                             ecma_string_t *property_name_p) /**< property name */
+{
+  do
+  {
+    if (ecma_op_object_has_own_property (obj_p, property_name_p))
+    {
+      return true;
+    }
+
+    obj_p = ecma_get_object_prototype (obj_p);
+  }
+  while (obj_p != NULL);
+
+  return false;
+} /* ecma_op_object_has_property */
+
 /**
  * [[Put]] ecma object's operation
  *
@@ -256,12 +336,24 @@ ecma_op_object_put (ecma_object_t *obj_p, /**< the object */
    *   [ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION] = &ecma_op_general_object_put,
    *   [ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION] = &ecma_op_general_object_put,
    *   [ECMA_OBJECT_TYPE_ARGUMENTS]         = &ecma_op_general_object_put,
-   *   [ECMA_OBJECT_TYPE_STRING]            = &ecma_op_general_object_put
+   *   [ECMA_OBJECT_TYPE_STRING]            = &ecma_op_general_object_put,
+   *   [ECMA_OBJECT_TYPE_TYPEDARRAY]        = &ecma_op_typedarray_object_put,
+   *   [ECMA_OBJECT_TYPE_HOST]              = &ecma_op_host_object_put
    * };
    *
    * return put[type] (obj_p, property_name_p);
    */
 
+  if (type == ECMA_OBJECT_TYPE_TYPEDARRAY)
+  {
+    return ecma_op_typedarray_object_put (obj_p, property_name_p, value, is_throw);
+  }
+
+  if (type == ECMA_OBJECT_TYPE_HOST)
+  {
+    return ecma_op_host_object_put (obj_p, property_name_p, value, is_throw);
+  }
+
   return ecma_op_general_object_put (obj_p, property_name_p, value, is_throw);
 } /* ecma_op_object_put */
 
@@ -335,6 +427,7 @@ ecma_op_object_delete (ecma_object_t *obj_p, /**< the object */
     case ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION:
     case ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION:
     case ECMA_OBJECT_TYPE_STRING:
+    case ECMA_OBJECT_TYPE_TYPEDARRAY:
     {
       return ecma_op_general_object_delete (obj_p,
                                             property_name_p,
@@ -347,6 +440,13 @@ ecma_op_object_delete (ecma_object_t *obj_p, /**< the object */
                                               property_name_p,
                                               is_throw);
     }
+
+    case ECMA_OBJECT_TYPE_HOST:
+    {
+      return ecma_op_host_object_delete (obj_p,
+                                         property_name_p,
+                                         is_throw);
+    }
   }
 
   JERRY_ASSERT (false);
@@ -446,6 +546,22 @@ ecma_op_object_define_own_property (ecma_object_t *obj_p, /**< the object */
                                                            property_desc_p,
                                                            is_throw);
     }
+
+    case ECMA_OBJECT_TYPE_TYPEDARRAY:
+    {
+      return ecma_op_typedarray_object_define_own_property (obj_p,
+                                                            property_name_p,
+                                                            property_desc_p,
+                                                            is_throw);
+    }
+
+    case ECMA_OBJECT_TYPE_HOST:
+    {
+      return ecma_op_host_object_define_own_property (obj_p,
+                                                      property_name_p,
+                                                      property_desc_p,
+                                                      is_throw);
+    }
   }
 
   JERRY_ASSERT (false);
@@ -475,6 +591,8 @@ ecma_op_object_has_instance (ecma_object_t *obj_p, /**< the object */
     case ECMA_OBJECT_TYPE_GENERAL:
     case ECMA_OBJECT_TYPE_STRING:
     case ECMA_OBJECT_TYPE_ARGUMENTS:
+    case ECMA_OBJECT_TYPE_TYPEDARRAY:
+    case ECMA_OBJECT_TYPE_HOST:
     {
       return ecma_raise_type_error ("");
     }
@@ -592,6 +710,24 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
           break;
         }
 
+        case ECMA_OBJECT_TYPE_TYPEDARRAY:
+        {
+          ecma_op_typedarray_list_lazy_property_names (obj_p,
+                                                       is_enumerable_only,
+                                                       prop_names_p,
+                                                       skipped_non_enumerable_p);
+          break;
+        }
+
+        case ECMA_OBJECT_TYPE_HOST:
+        {
+          ecma_op_host_object_list_lazy_property_names (obj_p,
+                                                        is_enumerable_only,
+                                                        prop_names_p,
+                                                        skipped_non_enumerable_p);
+          break;
+        }
+
         case ECMA_OBJECT_TYPE_ARRAY:
         case ECMA_OBJECT_TYPE_GENERAL:
         case ECMA_OBJECT_TYPE_ARGUMENTS:
@@ -888,6 +1024,14 @@ ecma_object_get_class_name (ecma_object_t *obj_p) /**< object */
     {
       return LIT_MAGIC_STRING_ARGUMENTS_UL;
     }
+    case ECMA_OBJECT_TYPE_TYPEDARRAY:
+    {
+      return ecma_typedarray_get_class_name (obj_p);
+    }
+    case ECMA_OBJECT_TYPE_HOST:
+    {
+      return LIT_MAGIC_STRING_OBJECT_UL;
+    }
     case ECMA_OBJECT_TYPE_FUNCTION:
     case ECMA_OBJECT_TYPE_BOUND_FUNCTION:
     case ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION:
@@ -965,6 +1109,24 @@ ecma_object_get_class_name (ecma_object_t *obj_p) /**< object */
             return LIT_MAGIC_STRING_REGEXP_UL;
           }
 #endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+          case ECMA_BUILTIN_ID_ARRAYBUFFER_PROTOTYPE:
+          case ECMA_BUILTIN_ID_DATAVIEW_PROTOTYPE:
+          case ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_INT8ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT8ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT8CLAMPEDARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_INT16ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT16ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_INT32ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT32ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_FLOAT32ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_FLOAT64ARRAY_PROTOTYPE:
+          {
+            /* ECMA-262 v6: the prototype objects are ordinary objects, not instances */
+            return LIT_MAGIC_STRING_OBJECT_UL;
+          }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
           default:
           {
             JERRY_ASSERT (ecma_builtin_is (obj_p, ECMA_BUILTIN_ID_GLOBAL));
@@ -1338,6 +1338,11 @@ ecma_regexp_exec_helper (ecma_value_t regexp_value, /**< RegExp object */
   lit_utf8_byte_t *sub_str_p = NULL;
   uint8_t *bc_start_p = (uint8_t *) (bc_p + 1);
 
+  if (bc_p->flags & RE_FLAG_BYTECODE_IN_SNAPSHOT)
+  {
+    memcpy (&bc_start_p, bc_start_p, sizeof (uint8_t *));
+  }
+
   while (ecma_is_value_empty (ret_value))
   {
     if (index < 0 || index > (int32_t) input_str_len)
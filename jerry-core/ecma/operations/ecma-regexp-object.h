@@ -35,6 +35,8 @@
 #define RE_FLAG_GLOBAL              (1u << 1) /* ECMA-262 v5, 15.10.7.2 */
 #define RE_FLAG_IGNORE_CASE         (1u << 2) /* ECMA-262 v5, 15.10.7.3 */
 #define RE_FLAG_MULTILINE           (1u << 3) /* ECMA-262 v5, 15.10.7.4 */
+#define RE_FLAG_BYTECODE_IN_SNAPSHOT (1u << 4) /* the compiled code is followed by a pointer
+                                                * to the byte code stored in a snapshot buffer */
 
 /**
  * RegExp executor context
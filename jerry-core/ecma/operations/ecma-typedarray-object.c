@@ -0,0 +1,1344 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-arraybuffer-object.h"
+#include "ecma-builtins.h"
+#include "ecma-conversion.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-lcache.h"
+#include "ecma-objects.h"
+#include "ecma-objects-general.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jrt-libc-includes.h"
+#include "mem-heap.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmatypedarrayobject ECMA typed array and DataView object related routines
+ * @{
+ */
+
+/**
+ * Size of the elements, in bytes, indexed by ecma_typedarray_type_t
+ */
+static const uint8_t ecma_typedarray_element_sizes[] =
+{
+  1, /* ECMA_TYPEDARRAY_INT8 */
+  1, /* ECMA_TYPEDARRAY_UINT8 */
+  1, /* ECMA_TYPEDARRAY_UINT8_CLAMPED */
+  2, /* ECMA_TYPEDARRAY_INT16 */
+  2, /* ECMA_TYPEDARRAY_UINT16 */
+  4, /* ECMA_TYPEDARRAY_INT32 */
+  4, /* ECMA_TYPEDARRAY_UINT32 */
+  4, /* ECMA_TYPEDARRAY_FLOAT32 */
+  8, /* ECMA_TYPEDARRAY_FLOAT64 */
+  1 /* ECMA_TYPEDARRAY_DATAVIEW */
+};
+
+/**
+ * [[Class]] names, indexed by ecma_typedarray_type_t
+ */
+static const uint16_t ecma_typedarray_class_names[] =
+{
+  LIT_MAGIC_STRING_INT8_ARRAY_UL,
+  LIT_MAGIC_STRING_UINT8_ARRAY_UL,
+  LIT_MAGIC_STRING_UINT8_CLAMPED_ARRAY_UL,
+  LIT_MAGIC_STRING_INT16_ARRAY_UL,
+  LIT_MAGIC_STRING_UINT16_ARRAY_UL,
+  LIT_MAGIC_STRING_INT32_ARRAY_UL,
+  LIT_MAGIC_STRING_UINT32_ARRAY_UL,
+  LIT_MAGIC_STRING_FLOAT32_ARRAY_UL,
+  LIT_MAGIC_STRING_FLOAT64_ARRAY_UL,
+  LIT_MAGIC_STRING_DATA_VIEW_UL
+};
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+/**
+ * Built-in prototype objects, indexed by ecma_typedarray_type_t
+ */
+static const uint8_t ecma_typedarray_prototype_ids[] =
+{
+  ECMA_BUILTIN_ID_INT8ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_UINT8ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_UINT8CLAMPEDARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_INT16ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_UINT16ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_INT32ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_UINT32ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_FLOAT32ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_FLOAT64ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_DATAVIEW_PROTOTYPE
+};
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+/**
+ * Create a typed array or a DataView object, which views a region of an ArrayBuffer object
+ *
+ * @return pointer to the new object
+ */
+ecma_object_t *
+ecma_typedarray_new_object (ecma_object_t *arraybuffer_p, /**< viewed ArrayBuffer object */
+                            uint32_t offset, /**< offset of the view, in bytes */
+                            uint32_t length, /**< length of the view, in elements */
+                            ecma_typedarray_type_t type) /**< element type */
+{
+  JERRY_ASSERT (ecma_is_arraybuffer (ecma_make_object_value (arraybuffer_p)));
+  JERRY_ASSERT ((uint64_t) offset + (uint64_t) length * ecma_typedarray_element_sizes[type]
+                <= ecma_arraybuffer_get_length (arraybuffer_p));
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+  ecma_object_t *prototype_obj_p = ecma_builtin_get ((ecma_builtin_id_t) ecma_typedarray_prototype_ids[type]);
+#else /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+  ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
+#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+  bool is_dataview = (type == ECMA_TYPEDARRAY_DATAVIEW);
+
+  ecma_object_t *obj_p = ecma_create_object (prototype_obj_p,
+                                             true,
+                                             is_dataview ? ECMA_OBJECT_TYPE_GENERAL : ECMA_OBJECT_TYPE_TYPEDARRAY);
+  ecma_deref_object (prototype_obj_p);
+
+  ecma_property_t *buffer_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPEDARRAY_BUFFER);
+  ECMA_SET_NON_NULL_POINTER (buffer_prop_p->u.internal_property.value, arraybuffer_p);
+  buffer_prop_p->u.internal_property.value |= (uint32_t) type << ECMA_TYPEDARRAY_TYPE_POS;
+
+  ecma_property_t *offset_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPEDARRAY_OFFSET);
+  offset_prop_p->u.internal_property.value = offset;
+
+  ecma_property_t *length_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPEDARRAY_LENGTH);
+  length_prop_p->u.internal_property.value = length;
+
+  if (is_dataview)
+  {
+    /*
+     * [[Class]] property is not stored explicitly for objects of ECMA_OBJECT_TYPE_TYPEDARRAY type,
+     * and the buffer, byteLength and byteOffset properties of typed arrays are instantiated lazily.
+     *
+     * See also: ecma_op_typedarray_object_get_own_property
+     */
+    ecma_property_t *class_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
+    class_prop_p->u.internal_property.value = LIT_MAGIC_STRING_DATA_VIEW_UL;
+
+    ecma_string_t *buffer_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_BUFFER);
+    ecma_property_t *prop_p = ecma_create_named_data_property (obj_p, buffer_magic_string_p, false, false, false);
+    ecma_set_named_data_property_value (prop_p, ecma_make_object_value (arraybuffer_p));
+    ecma_deref_ecma_string (buffer_magic_string_p);
+
+    ecma_string_t *byte_length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_BYTE_LENGTH_UL);
+    prop_p = ecma_create_named_data_property (obj_p, byte_length_magic_string_p, false, false, false);
+    ecma_number_t *byte_length_value_p = ecma_alloc_number ();
+    *byte_length_value_p = ecma_uint32_to_number (length);
+    ecma_set_named_data_property_value (prop_p, ecma_make_number_value (byte_length_value_p));
+    ecma_deref_ecma_string (byte_length_magic_string_p);
+
+    ecma_string_t *byte_offset_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_BYTE_OFFSET_UL);
+    prop_p = ecma_create_named_data_property (obj_p, byte_offset_magic_string_p, false, false, false);
+    ecma_number_t *byte_offset_value_p = ecma_alloc_number ();
+    *byte_offset_value_p = ecma_uint32_to_number (offset);
+    ecma_set_named_data_property_value (prop_p, ecma_make_number_value (byte_offset_value_p));
+    ecma_deref_ecma_string (byte_offset_magic_string_p);
+  }
+
+  return obj_p;
+} /* ecma_typedarray_new_object */
+
+/**
+ * Convert a value to an offset or a length (ToIndex of later editions of ECMA-262)
+ *
+ * @return ecma value
+ *         true simple value - if the value is converted (the result is stored to out_index_p),
+ *         error - otherwise.
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+ecma_typedarray_to_index (ecma_value_t value, /**< ecma value */
+                          uint32_t *out_index_p) /**< out: the index */
+{
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (index_num, value, ret_value);
+
+  ecma_number_t index = ecma_number_is_nan (index_num) ? ECMA_NUMBER_ZERO : ecma_number_trunc (index_num);
+
+  if (index < ECMA_NUMBER_ZERO || index > (ecma_number_t) UINT32_MAX)
+  {
+    ret_value = ecma_raise_range_error ("Invalid offset or length");
+  }
+  else
+  {
+    *out_index_p = ecma_number_to_uint32 (index);
+
+    ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (index_num);
+
+  return ret_value;
+} /* ecma_typedarray_to_index */
+
+/**
+ * Get an optional argument from the arguments' list
+ *
+ * @return the argument - if it is passed,
+ *         undefined simple value - otherwise.
+ */
+static ecma_value_t
+ecma_typedarray_get_argument (const ecma_value_t *arguments_list_p, /**< arguments list */
+                              ecma_length_t arguments_list_len, /**< number of arguments */
+                              ecma_length_t index) /**< index of the argument */
+{
+  if (index < arguments_list_len)
+  {
+    return arguments_list_p[index];
+  }
+
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+} /* ecma_typedarray_get_argument */
+
+/**
+ * Copy the elements of an array-like object or a typed array to a typed array
+ *
+ * See also: ECMA-262 v6, 22.2.3.22.1 steps 21 - 22; 22.2.3.22.2 steps 23 - 29
+ *
+ * @return ecma value
+ *         empty simple value - if the elements are copied,
+ *         error - otherwise.
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_typedarray_copy_elements (ecma_object_t *target_p, /**< target typed array */
+                               uint32_t target_index, /**< index of the first element to be written */
+                               ecma_object_t *source_p, /**< source object */
+                               uint32_t source_length) /**< number of elements to be copied */
+{
+  JERRY_ASSERT ((uint64_t) target_index + source_length <= ecma_typedarray_get_length (target_p));
+
+  ecma_typedarray_type_t target_type = ecma_typedarray_get_type (target_p);
+  uint32_t target_element_size = ecma_typedarray_get_element_size (target_type);
+
+  if (ecma_get_object_type (source_p) == ECMA_OBJECT_TYPE_TYPEDARRAY)
+  {
+    ecma_typedarray_type_t source_type = ecma_typedarray_get_type (source_p);
+    uint32_t source_element_size = ecma_typedarray_get_element_size (source_type);
+
+    uint8_t *target_buffer_p = ecma_typedarray_get_buffer (target_p) + target_index * target_element_size;
+    uint8_t *source_buffer_p = ecma_typedarray_get_buffer (source_p);
+
+    if (source_type == target_type)
+    {
+      memmove (target_buffer_p, source_buffer_p, source_length * source_element_size);
+    }
+    else
+    {
+      uint8_t *copy_p = NULL;
+
+      if (ecma_typedarray_get_arraybuffer (source_p) == ecma_typedarray_get_arraybuffer (target_p))
+      {
+        /* ECMA-262 v6, 22.2.3.22.2 step 24: the source is cloned, as the regions can overlap */
+        copy_p = (uint8_t *) mem_heap_alloc_block (source_length * source_element_size, MEM_HEAP_ALLOC_SHORT_TERM);
+        memcpy (copy_p, source_buffer_p, source_length * source_element_size);
+        source_buffer_p = copy_p;
+      }
+
+      for (uint32_t i = 0; i < source_length; i++)
+      {
+        ecma_number_t value = ecma_typedarray_get_element (source_buffer_p + i * source_element_size, source_type);
+        ecma_typedarray_set_element (target_buffer_p + i * target_element_size, target_type, value);
+      }
+
+      if (copy_p != NULL)
+      {
+        mem_heap_free_block (copy_p);
+      }
+    }
+
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  for (uint32_t i = 0; i < source_length && ecma_is_value_empty (ret_value); i++)
+  {
+    ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (i);
+
+    ECMA_TRY_CATCH (element_value, ecma_op_object_get (source_p, index_str_p), ret_value);
+    ECMA_OP_TO_NUMBER_TRY_CATCH (element_num, element_value, ret_value);
+
+    /* the buffer is requested for each element, as the getters can run arbitrary code */
+    uint8_t *target_buffer_p = ecma_typedarray_get_buffer (target_p);
+    ecma_typedarray_set_element (target_buffer_p + (target_index + i) * target_element_size,
+                                 target_type,
+                                 element_num);
+
+    ECMA_OP_TO_NUMBER_FINALIZE (element_num);
+    ECMA_FINALIZE (element_value);
+
+    ecma_deref_ecma_string (index_str_p);
+  }
+
+  return ret_value;
+} /* ecma_typedarray_copy_elements */
+
+/**
+ * Create a typed array object with a new ArrayBuffer
+ *
+ * @return pointer to the new typed array object
+ */
+static ecma_object_t *
+ecma_typedarray_new_object_with_buffer (uint32_t length, /**< length, in elements */
+                                        ecma_typedarray_type_t type) /**< element type */
+{
+  uint32_t byte_length = length * ecma_typedarray_get_element_size (type);
+
+  ecma_object_t *arraybuffer_p = ecma_arraybuffer_new_object (byte_length);
+  ecma_object_t *obj_p = ecma_typedarray_new_object (arraybuffer_p, 0, length, type);
+  ecma_deref_object (arraybuffer_p);
+
+  return obj_p;
+} /* ecma_typedarray_new_object_with_buffer */
+
+/**
+ * Typed array object creation operation.
+ *
+ * See also: ECMA-262 v6, 22.2.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_create_typedarray_object (const ecma_value_t *arguments_list_p, /**< list of arguments that
+                                                                         *   are passed to the constructor */
+                                  ecma_length_t arguments_list_len, /**< length of the arguments' list */
+                                  ecma_typedarray_type_t type) /**< element type */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+  JERRY_ASSERT (type != ECMA_TYPEDARRAY_DATAVIEW);
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  uint32_t element_size = ecma_typedarray_get_element_size (type);
+  ecma_value_t first_arg = ecma_typedarray_get_argument (arguments_list_p, arguments_list_len, 0);
+
+  if (!ecma_is_value_object (first_arg))
+  {
+    /* 22.2.1.2 */
+    uint32_t length = 0;
+
+    ECMA_TRY_CATCH (index_value, ecma_typedarray_to_index (first_arg, &length), ret_value);
+
+    if (length > MEM_HEAP_AREA_SIZE / element_size)
+    {
+      ret_value = ecma_raise_range_error ("Invalid typed array length");
+    }
+    else
+    {
+      ret_value = ecma_make_object_value (ecma_typedarray_new_object_with_buffer (length, type));
+    }
+
+    ECMA_FINALIZE (index_value);
+  }
+  else if (ecma_is_arraybuffer (first_arg))
+  {
+    /* 22.2.1.4 */
+    ecma_object_t *arraybuffer_p = ecma_get_object_from_value (first_arg);
+    uint32_t buffer_length = ecma_arraybuffer_get_length (arraybuffer_p);
+    uint32_t offset = 0;
+    uint32_t length = 0;
+
+    ECMA_TRY_CATCH (offset_value,
+                    ecma_typedarray_to_index (ecma_typedarray_get_argument (arguments_list_p, arguments_list_len, 1),
+                                              &offset),
+                    ret_value);
+
+    ecma_value_t length_arg = ecma_typedarray_get_argument (arguments_list_p, arguments_list_len, 2);
+
+    if (offset % element_size != 0)
+    {
+      ret_value = ecma_raise_range_error ("Invalid typed array offset");
+    }
+    else if (ecma_is_value_undefined (length_arg))
+    {
+      if (buffer_length % element_size != 0 || offset > buffer_length)
+      {
+        ret_value = ecma_raise_range_error ("Invalid typed array length");
+      }
+      else
+      {
+        length = (buffer_length - offset) / element_size;
+      }
+    }
+    else
+    {
+      ECMA_TRY_CATCH (length_value, ecma_typedarray_to_index (length_arg, &length), ret_value);
+
+      if ((uint64_t) offset + (uint64_t) length * element_size > buffer_length)
+      {
+        ret_value = ecma_raise_range_error ("Invalid typed array length");
+      }
+
+      ECMA_FINALIZE (length_value);
+    }
+
+    if (ecma_is_value_empty (ret_value))
+    {
+      ret_value = ecma_make_object_value (ecma_typedarray_new_object (arraybuffer_p, offset, length, type));
+    }
+
+    ECMA_FINALIZE (offset_value);
+  }
+  else
+  {
+    /* 22.2.1.3, 22.2.1.4 */
+    ecma_object_t *source_p = ecma_get_object_from_value (first_arg);
+    uint32_t length = 0;
+
+    if (ecma_get_object_type (source_p) == ECMA_OBJECT_TYPE_TYPEDARRAY)
+    {
+      length = ecma_typedarray_get_length (source_p);
+    }
+    else
+    {
+      ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+
+      ECMA_TRY_CATCH (length_value, ecma_op_object_get (source_p, length_magic_string_p), ret_value);
+      ECMA_OP_TO_NUMBER_TRY_CATCH (length_num, length_value, ret_value);
+
+      length = ecma_number_to_uint32 (length_num);
+
+      ECMA_OP_TO_NUMBER_FINALIZE (length_num);
+      ECMA_FINALIZE (length_value);
+
+      ecma_deref_ecma_string (length_magic_string_p);
+    }
+
+    if (ecma_is_value_empty (ret_value))
+    {
+      if (length > MEM_HEAP_AREA_SIZE / element_size)
+      {
+        ret_value = ecma_raise_range_error ("Invalid typed array length");
+      }
+      else
+      {
+        ecma_object_t *obj_p = ecma_typedarray_new_object_with_buffer (length, type);
+
+        ret_value = ecma_typedarray_copy_elements (obj_p, 0, source_p, length);
+
+        if (ecma_is_value_empty (ret_value))
+        {
+          ret_value = ecma_make_object_value (obj_p);
+        }
+        else
+        {
+          ecma_deref_object (obj_p);
+        }
+      }
+    }
+  }
+
+  return ret_value;
+} /* ecma_op_create_typedarray_object */
+
+/**
+ * DataView object creation operation.
+ *
+ * See also: ECMA-262 v6, 24.2.2.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_create_dataview_object (const ecma_value_t *arguments_list_p, /**< list of arguments that
+                                                                       *   are passed to DataView constructor */
+                                ecma_length_t arguments_list_len) /**< length of the arguments' list */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ecma_value_t buffer_arg = ecma_typedarray_get_argument (arguments_list_p, arguments_list_len, 0);
+
+  if (!ecma_is_arraybuffer (buffer_arg))
+  {
+    return ecma_raise_type_error ("Argument is not an ArrayBuffer");
+  }
+
+  ecma_object_t *arraybuffer_p = ecma_get_object_from_value (buffer_arg);
+  uint32_t buffer_length = ecma_arraybuffer_get_length (arraybuffer_p);
+  uint32_t offset = 0;
+  uint32_t length = 0;
+
+  ECMA_TRY_CATCH (offset_value,
+                  ecma_typedarray_to_index (ecma_typedarray_get_argument (arguments_list_p, arguments_list_len, 1),
+                                            &offset),
+                  ret_value);
+
+  ecma_value_t length_arg = ecma_typedarray_get_argument (arguments_list_p, arguments_list_len, 2);
+
+  if (offset > buffer_length)
+  {
+    ret_value = ecma_raise_range_error ("Invalid DataView offset");
+  }
+  else if (ecma_is_value_undefined (length_arg))
+  {
+    length = buffer_length - offset;
+  }
+  else
+  {
+    ECMA_TRY_CATCH (length_value, ecma_typedarray_to_index (length_arg, &length), ret_value);
+
+    if ((uint64_t) offset + length > buffer_length)
+    {
+      ret_value = ecma_raise_range_error ("Invalid DataView length");
+    }
+
+    ECMA_FINALIZE (length_value);
+  }
+
+  if (ecma_is_value_empty (ret_value))
+  {
+    ecma_object_t *obj_p = ecma_typedarray_new_object (arraybuffer_p, offset, length, ECMA_TYPEDARRAY_DATAVIEW);
+    ret_value = ecma_make_object_value (obj_p);
+  }
+
+  ECMA_FINALIZE (offset_value);
+
+  return ret_value;
+} /* ecma_op_create_dataview_object */
+
+/**
+ * Check whether the value is a typed array object
+ *
+ * @return true - if the value is a typed array object,
+ *         false - otherwise.
+ */
+bool
+ecma_is_typedarray (ecma_value_t value) /**< ecma value */
+{
+  return (ecma_is_value_object (value)
+          && ecma_get_object_type (ecma_get_object_from_value (value)) == ECMA_OBJECT_TYPE_TYPEDARRAY);
+} /* ecma_is_typedarray */
+
+/**
+ * Check whether the value is a DataView object
+ *
+ * @return true - if the value is a DataView object,
+ *         false - otherwise.
+ */
+bool
+ecma_is_dataview (ecma_value_t value) /**< ecma value */
+{
+  if (!ecma_is_value_object (value))
+  {
+    return false;
+  }
+
+  ecma_object_t *obj_p = ecma_get_object_from_value (value);
+
+  return (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_GENERAL
+          && ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPEDARRAY_BUFFER) != NULL);
+} /* ecma_is_dataview */
+
+/**
+ * Get the element type of a typed array or a DataView object
+ *
+ * @return element type
+ */
+ecma_typedarray_type_t
+ecma_typedarray_get_type (ecma_object_t *obj_p) /**< typed array or DataView object */
+{
+  ecma_property_t *buffer_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPEDARRAY_BUFFER);
+
+  return (ecma_typedarray_type_t) (buffer_prop_p->u.internal_property.value >> ECMA_TYPEDARRAY_TYPE_POS);
+} /* ecma_typedarray_get_type */
+
+/**
+ * Get the size of the elements of the specified type
+ *
+ * @return size of an element, in bytes
+ */
+uint32_t
+ecma_typedarray_get_element_size (ecma_typedarray_type_t type) /**< element type */
+{
+  JERRY_ASSERT (type <= ECMA_TYPEDARRAY_DATAVIEW);
+
+  return ecma_typedarray_element_sizes[type];
+} /* ecma_typedarray_get_element_size */
+
+/**
+ * Get the ArrayBuffer object viewed by a typed array or a DataView object
+ *
+ * @return pointer to the ArrayBuffer object
+ */
+ecma_object_t *
+ecma_typedarray_get_arraybuffer (ecma_object_t *obj_p) /**< typed array or DataView object */
+{
+  ecma_property_t *buffer_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPEDARRAY_BUFFER);
+  uint32_t buffer_cp = buffer_prop_p->u.internal_property.value & ((1u << ECMA_TYPEDARRAY_TYPE_POS) - 1);
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_object_t, buffer_cp);
+} /* ecma_typedarray_get_arraybuffer */
+
+/**
+ * Get the offset of a typed array or a DataView object in the viewed ArrayBuffer
+ *
+ * @return offset, in bytes
+ */
+uint32_t
+ecma_typedarray_get_offset (ecma_object_t *obj_p) /**< typed array or DataView object */
+{
+  return ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPEDARRAY_OFFSET)->u.internal_property.value;
+} /* ecma_typedarray_get_offset */
+
+/**
+ * Get the length of a typed array or a DataView object
+ *
+ * @return length of a typed array in elements, or length of a DataView object in bytes
+ */
+uint32_t
+ecma_typedarray_get_length (ecma_object_t *obj_p) /**< typed array or DataView object */
+{
+  return ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPEDARRAY_LENGTH)->u.internal_property.value;
+} /* ecma_typedarray_get_length */
+
+/**
+ * Get the data viewed by a typed array or a DataView object
+ *
+ * @return pointer to the first byte of the view
+ */
+uint8_t *
+ecma_typedarray_get_buffer (ecma_object_t *obj_p) /**< typed array or DataView object */
+{
+  return ecma_arraybuffer_get_buffer (ecma_typedarray_get_arraybuffer (obj_p)) + ecma_typedarray_get_offset (obj_p);
+} /* ecma_typedarray_get_buffer */
+
+/**
+ * Get [[Class]] of a typed array object
+ *
+ * @return class name magic string
+ */
+lit_magic_string_id_t
+ecma_typedarray_get_class_name (ecma_object_t *obj_p) /**< typed array object */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPEDARRAY);
+
+  return (lit_magic_string_id_t) ecma_typedarray_class_names[ecma_typedarray_get_type (obj_p)];
+} /* ecma_typedarray_get_class_name */
+
+/**
+ * Read an element in the host's byte order
+ *
+ * See also: ECMA-262 v6, 24.1.1.5
+ *
+ * @return value of the element
+ */
+ecma_number_t
+ecma_typedarray_get_element (const uint8_t *src_p, /**< first byte of the element */
+                             ecma_typedarray_type_t type) /**< element type */
+{
+  switch (type)
+  {
+    case ECMA_TYPEDARRAY_INT8:
+    {
+      return (ecma_number_t) (int8_t) *src_p;
+    }
+    case ECMA_TYPEDARRAY_UINT8:
+    case ECMA_TYPEDARRAY_UINT8_CLAMPED:
+    case ECMA_TYPEDARRAY_DATAVIEW:
+    {
+      return (ecma_number_t) *src_p;
+    }
+    case ECMA_TYPEDARRAY_INT16:
+    {
+      int16_t value;
+      memcpy (&value, src_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPEDARRAY_UINT16:
+    {
+      uint16_t value;
+      memcpy (&value, src_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPEDARRAY_INT32:
+    {
+      int32_t value;
+      memcpy (&value, src_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPEDARRAY_UINT32:
+    {
+      uint32_t value;
+      memcpy (&value, src_p, sizeof (value));
+      return ecma_uint32_to_number (value);
+    }
+    case ECMA_TYPEDARRAY_FLOAT32:
+    {
+      float value;
+      memcpy (&value, src_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPEDARRAY_FLOAT64:
+    {
+      double value;
+      memcpy (&value, src_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+  }
+
+  JERRY_UNREACHABLE ();
+  return ECMA_NUMBER_ZERO;
+} /* ecma_typedarray_get_element */
+
+/**
+ * Convert a number to an Uint8Clamped element
+ *
+ * See also: ECMA-262 v6, 7.1.11
+ *
+ * @return the clamped value
+ */
+static uint8_t
+ecma_typedarray_number_to_uint8_clamped (ecma_number_t value) /**< ecma-number */
+{
+  if (ecma_number_is_nan (value) || value <= ECMA_NUMBER_ZERO)
+  {
+    return 0;
+  }
+
+  if (value >= (ecma_number_t) 255)
+  {
+    return 255;
+  }
+
+  ecma_number_t floor = ecma_number_trunc (value);
+  ecma_number_t half = (ecma_number_t) 0.5;
+  uint8_t result = (uint8_t) floor;
+
+  if (floor + half < value || (floor + half == value && (result & 0x1) != 0))
+  {
+    /* round half to even */
+    result++;
+  }
+
+  return result;
+} /* ecma_typedarray_number_to_uint8_clamped */
+
+/**
+ * Write an element in the host's byte order
+ *
+ * See also: ECMA-262 v6, 24.1.1.6
+ */
+void
+ecma_typedarray_set_element (uint8_t *dst_p, /**< first byte of the element */
+                             ecma_typedarray_type_t type, /**< element type */
+                             ecma_number_t value) /**< value of the element */
+{
+  switch (type)
+  {
+    case ECMA_TYPEDARRAY_INT8:
+    case ECMA_TYPEDARRAY_UINT8:
+    case ECMA_TYPEDARRAY_DATAVIEW:
+    {
+      *dst_p = (uint8_t) ecma_number_to_uint32 (value);
+      break;
+    }
+    case ECMA_TYPEDARRAY_UINT8_CLAMPED:
+    {
+      *dst_p = ecma_typedarray_number_to_uint8_clamped (value);
+      break;
+    }
+    case ECMA_TYPEDARRAY_INT16:
+    case ECMA_TYPEDARRAY_UINT16:
+    {
+      uint16_t element = (uint16_t) ecma_number_to_uint32 (value);
+      memcpy (dst_p, &element, sizeof (element));
+      break;
+    }
+    case ECMA_TYPEDARRAY_INT32:
+    case ECMA_TYPEDARRAY_UINT32:
+    {
+      uint32_t element = ecma_number_to_uint32 (value);
+      memcpy (dst_p, &element, sizeof (element));
+      break;
+    }
+    case ECMA_TYPEDARRAY_FLOAT32:
+    {
+      float element = (float) value;
+      memcpy (dst_p, &element, sizeof (element));
+      break;
+    }
+    case ECMA_TYPEDARRAY_FLOAT64:
+    {
+      double element = (double) value;
+      memcpy (dst_p, &element, sizeof (element));
+      break;
+    }
+  }
+} /* ecma_typedarray_set_element */
+
+/**
+ * Get the value of an element of a typed array
+ *
+ * See also: ECMA-262 v6, 9.4.5.8
+ *
+ * @return number value - if the index is in the range of the typed array,
+ *         undefined simple value - otherwise.
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_typedarray_get_index (ecma_object_t *obj_p, /**< typed array object */
+                              uint32_t index) /**< index of the element */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPEDARRAY);
+
+  if (index >= ecma_typedarray_get_length (obj_p))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  ecma_typedarray_type_t type = ecma_typedarray_get_type (obj_p);
+  uint8_t *element_p = ecma_typedarray_get_buffer (obj_p) + index * ecma_typedarray_get_element_size (type);
+
+  ecma_number_t *value_p = ecma_alloc_number ();
+  *value_p = ecma_typedarray_get_element (element_p, type);
+
+  return ecma_make_number_value (value_p);
+} /* ecma_op_typedarray_get_index */
+
+/**
+ * Set the value of an element of a typed array
+ *
+ * Note:
+ *      writes outside of the range of the typed array are ignored
+ *
+ * See also: ECMA-262 v6, 9.4.5.9
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_typedarray_set_index (ecma_object_t *obj_p, /**< typed array object */
+                              uint32_t index, /**< index of the element */
+                              ecma_value_t value) /**< new value of the element */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPEDARRAY);
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (value_num, value, ret_value);
+
+  /* the length is checked after the conversion, as ToNumber can run arbitrary code */
+  if (index < ecma_typedarray_get_length (obj_p))
+  {
+    ecma_typedarray_type_t type = ecma_typedarray_get_type (obj_p);
+    uint8_t *element_p = ecma_typedarray_get_buffer (obj_p) + index * ecma_typedarray_get_element_size (type);
+
+    ecma_typedarray_set_element (element_p, type, value_num);
+  }
+
+  ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+
+  ECMA_OP_TO_NUMBER_FINALIZE (value_num);
+
+  return ret_value;
+} /* ecma_op_typedarray_set_index */
+
+/**
+ * [[Get]] ecma typed array object's operation
+ *
+ * See also:
+ *          ECMA-262 v6, 9.4.5.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_typedarray_object_get (ecma_object_t *obj_p, /**< typed array object */
+                               ecma_string_t *property_name_p) /**< property name */
+{
+  uint32_t index;
+
+  if (ecma_string_get_array_index (property_name_p, &index))
+  {
+    return ecma_op_typedarray_get_index (obj_p, index);
+  }
+
+  return ecma_op_general_object_get (obj_p, property_name_p);
+} /* ecma_op_typedarray_object_get */
+
+/**
+ * Check whether the property holds an element of a typed array
+ *
+ * @return true - if the property's name is an array index,
+ *         false - otherwise.
+ */
+static bool
+ecma_typedarray_is_element_property (ecma_property_t *prop_p, /**< property */
+                                     uint32_t *out_index_p) /**< out: index of the element */
+{
+  if (prop_p->type != ECMA_PROPERTY_NAMEDDATA)
+  {
+    return false;
+  }
+
+  ecma_string_t *name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_p->u.named_data_property.name_p);
+
+  /* the element properties are created with ecma_new_ecma_string_from_uint32 */
+  return (name_p->container == ECMA_STRING_CONTAINER_UINT32_IN_DESC
+          && ecma_string_get_array_index (name_p, out_index_p));
+} /* ecma_typedarray_is_element_property */
+
+/**
+ * Instantiate the property, which holds the current value of an element of a typed array
+ *
+ * Note:
+ *      a typed array has at most one such property, which is reused for the next requested element,
+ *      so the returned property is valid until the next [[GetOwnProperty]] call for an element.
+ *
+ * @return pointer to the property
+ */
+static ecma_property_t *
+ecma_typedarray_get_element_property (ecma_object_t *obj_p, /**< typed array object */
+                                      uint32_t index) /**< index of the element */
+{
+  ecma_property_t *prop_p = NULL;
+
+  for (ecma_property_t *prop_iter_p = ecma_get_property_list (obj_p);
+       prop_iter_p != NULL;
+       prop_iter_p = ECMA_GET_POINTER (ecma_property_t, prop_iter_p->next_property_p))
+  {
+    uint32_t prop_index;
+
+    if (ecma_typedarray_is_element_property (prop_iter_p, &prop_index))
+    {
+      if (prop_index == index)
+      {
+        prop_p = prop_iter_p;
+      }
+      else
+      {
+        ecma_delete_property (obj_p, prop_iter_p);
+      }
+
+      break;
+    }
+  }
+
+  if (prop_p == NULL)
+  {
+    ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+
+    // ECMA-262 v6, 9.4.5.1 step 3.c.v
+    prop_p = ecma_create_named_data_property (obj_p, index_str_p, true, true, false);
+
+    ecma_deref_ecma_string (index_str_p);
+  }
+
+  ecma_value_t value = ecma_op_typedarray_get_index (obj_p, index);
+  ecma_named_data_property_assign_value (obj_p, prop_p, value);
+  ecma_free_value (value);
+
+  /* the value of the property is refreshed on each request, so it should not be returned from the LCache */
+  ecma_lcache_invalidate (obj_p, NULL, prop_p);
+
+  return prop_p;
+} /* ecma_typedarray_get_element_property */
+
+/**
+ * [[GetOwnProperty]] ecma typed array object's operation
+ *
+ * See also:
+ *          ECMA-262 v6, 9.4.5.1
+ *          ECMA-262 v6, 22.2.3
+ *
+ * @return pointer to a property - if it exists,
+ *         NULL (i.e. ecma-undefined) - otherwise.
+ */
+ecma_property_t *
+ecma_op_typedarray_object_get_own_property (ecma_object_t *obj_p, /**< typed array object */
+                                            ecma_string_t *property_name_p) /**< property name */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPEDARRAY);
+
+  uint32_t index;
+
+  if (ecma_string_get_array_index (property_name_p, &index))
+  {
+    if (index >= ecma_typedarray_get_length (obj_p))
+    {
+      return NULL;
+    }
+
+    return ecma_typedarray_get_element_property (obj_p, index);
+  }
+
+  ecma_property_t *prop_p = ecma_op_general_object_get_own_property (obj_p, property_name_p);
+
+  lit_magic_string_id_t magic_string_id;
+
+  if (prop_p != NULL
+      || !ecma_is_string_magic (property_name_p, &magic_string_id))
+  {
+    return prop_p;
+  }
+
+  /*
+   * The length, byteLength, byteOffset and buffer accessors of %TypedArray%.prototype are represented
+   * with read-only own data properties, which are instantiated on the first access.
+   */
+  ecma_typedarray_type_t type = ecma_typedarray_get_type (obj_p);
+  ecma_value_t value;
+
+  switch (magic_string_id)
+  {
+    case LIT_MAGIC_STRING_LENGTH:
+    case LIT_MAGIC_STRING_BYTE_LENGTH_UL:
+    case LIT_MAGIC_STRING_BYTE_OFFSET_UL:
+    {
+      ecma_number_t *num_p = ecma_alloc_number ();
+
+      if (magic_string_id == LIT_MAGIC_STRING_LENGTH)
+      {
+        *num_p = ecma_uint32_to_number (ecma_typedarray_get_length (obj_p));
+      }
+      else if (magic_string_id == LIT_MAGIC_STRING_BYTE_LENGTH_UL)
+      {
+        *num_p = ecma_uint32_to_number (ecma_typedarray_get_length (obj_p) * ecma_typedarray_get_element_size (type));
+      }
+      else
+      {
+        *num_p = ecma_uint32_to_number (ecma_typedarray_get_offset (obj_p));
+      }
+
+      value = ecma_make_number_value (num_p);
+      break;
+    }
+    case LIT_MAGIC_STRING_BUFFER:
+    {
+      value = ecma_make_object_value (ecma_typedarray_get_arraybuffer (obj_p));
+      break;
+    }
+    default:
+    {
+      return NULL;
+    }
+  }
+
+  prop_p = ecma_create_named_data_property (obj_p, property_name_p, false, false, false);
+  ecma_set_named_data_property_value (prop_p, value);
+
+  return prop_p;
+} /* ecma_op_typedarray_object_get_own_property */
+
+/**
+ * [[Put]] ecma typed array object's operation
+ *
+ * See also:
+ *          ECMA-262 v6, 9.4.5.5
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_typedarray_object_put (ecma_object_t *obj_p, /**< typed array object */
+                               ecma_string_t *property_name_p, /**< property name */
+                               ecma_value_t value, /**< ecma value */
+                               bool is_throw) /**< flag that controls failure handling */
+{
+  uint32_t index;
+
+  if (ecma_string_get_array_index (property_name_p, &index))
+  {
+    return ecma_op_typedarray_set_index (obj_p, index, value);
+  }
+
+  return ecma_op_general_object_put (obj_p, property_name_p, value, is_throw);
+} /* ecma_op_typedarray_object_put */
+
+/**
+ * [[DefineOwnProperty]] ecma typed array object's operation
+ *
+ * See also:
+ *          ECMA-262 v6, 9.4.5.3
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_typedarray_object_define_own_property (ecma_object_t *obj_p, /**< typed array object */
+                                               ecma_string_t *property_name_p, /**< property name */
+                                               const ecma_property_descriptor_t *property_desc_p, /**< property
+                                                                                                   *   descriptor */
+                                               bool is_throw) /**< flag that controls failure handling */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPEDARRAY);
+
+  uint32_t index;
+
+  if (!ecma_string_get_array_index (property_name_p, &index))
+  {
+    return ecma_op_general_object_define_own_property (obj_p,
+                                                       property_name_p,
+                                                       property_desc_p,
+                                                       is_throw);
+  }
+
+  // 3.c.iii - 3.c.viii
+  if (index >= ecma_typedarray_get_length (obj_p)
+      || property_desc_p->is_get_defined
+      || property_desc_p->is_set_defined
+      || (property_desc_p->is_configurable_defined && property_desc_p->is_configurable)
+      || (property_desc_p->is_enumerable_defined && !property_desc_p->is_enumerable)
+      || (property_desc_p->is_writable_defined && !property_desc_p->is_writable))
+  {
+    return ecma_reject (is_throw);
+  }
+
+  // 3.c.ix
+  if (property_desc_p->is_value_defined)
+  {
+    return ecma_op_typedarray_set_index (obj_p, index, property_desc_p->value);
+  }
+
+  return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+} /* ecma_op_typedarray_object_define_own_property */
+
+/**
+ * List names of a typed array object's lazy instantiated properties
+ *
+ * See also:
+ *          ecma_op_typedarray_object_get_own_property
+ */
+void
+ecma_op_typedarray_list_lazy_property_names (ecma_object_t *obj_p, /**< typed array object */
+                                             bool separate_enumerable, /**< true -  list enumerable properties
+                                                                        *           into main collection,
+                                                                        *           and non-enumerable to collection
+                                                                        *           of 'skipped non-enumerable'
+                                                                        *           properties,
+                                                                        *   false - list all properties into main
+                                                                        *           collection.
+                                                                        */
+                                             ecma_collection_header_t *main_collection_p, /**< 'main'
+                                                                                           *   collection */
+                                             ecma_collection_header_t *non_enum_collection_p) /**< skipped
+                                                                                               *   'non-enumerable'
+                                                                                               *   collection */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPEDARRAY);
+
+  ecma_collection_header_t *for_non_enumerable_p = separate_enumerable ? non_enum_collection_p : main_collection_p;
+
+  uint32_t length = ecma_typedarray_get_length (obj_p);
+
+  for (uint32_t i = 0; i < length; i++)
+  {
+    ecma_string_t *name_p = ecma_new_ecma_string_from_uint32 (i);
+
+    /* the elements are enumerable (ECMA-262 v6, 9.4.5.1 step 3.c.v) */
+    ecma_append_to_values_collection (main_collection_p, ecma_make_string_value (name_p), true);
+
+    ecma_deref_ecma_string (name_p);
+  }
+
+  const lit_magic_string_id_t non_enumerable_names[] =
+  {
+    LIT_MAGIC_STRING_LENGTH,
+    LIT_MAGIC_STRING_BYTE_LENGTH_UL,
+    LIT_MAGIC_STRING_BYTE_OFFSET_UL,
+    LIT_MAGIC_STRING_BUFFER
+  };
+
+  for (uint32_t i = 0; i < sizeof (non_enumerable_names) / sizeof (non_enumerable_names[0]); i++)
+  {
+    ecma_string_t *name_p = ecma_get_magic_string (non_enumerable_names[i]);
+
+    ecma_append_to_values_collection (for_non_enumerable_p, ecma_make_string_value (name_p), true);
+
+    ecma_deref_ecma_string (name_p);
+  }
+} /* ecma_op_typedarray_list_lazy_property_names */
+
+/**
+ * Check whether the host stores numbers in little-endian byte order
+ *
+ * @return true - if the host is little-endian,
+ *         false - otherwise.
+ */
+static inline bool __attr_always_inline___
+ecma_typedarray_is_host_little_endian (void)
+{
+  const uint16_t probe = 1;
+
+  return *(const uint8_t *) &probe == 1;
+} /* ecma_typedarray_is_host_little_endian */
+
+/**
+ * Reverse the byte order of an element, if it is stored with other endianness than the host's
+ */
+static void
+ecma_typedarray_swap_bytes_if_needed (uint8_t *element_p, /**< element */
+                                      uint32_t element_size, /**< size of the element */
+                                      bool is_little_endian) /**< byte order of the element */
+{
+  if (is_little_endian == ecma_typedarray_is_host_little_endian ())
+  {
+    return;
+  }
+
+  for (uint32_t i = 0; i < element_size / 2; i++)
+  {
+    uint8_t byte = element_p[i];
+    element_p[i] = element_p[element_size - 1 - i];
+    element_p[element_size - 1 - i] = byte;
+  }
+} /* ecma_typedarray_swap_bytes_if_needed */
+
+/**
+ * Check the arguments of the DataView get and set routines, and compute the address of the element
+ *
+ * See also: ECMA-262 v6, 24.2.1.1 steps 1 - 12; 24.2.1.2 steps 1 - 13
+ *
+ * @return ecma value
+ *         true simple value - if the arguments are valid (the address is stored to out_element_p),
+ *         error - otherwise.
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+ecma_dataview_get_element_address (ecma_value_t view, /**< this argument */
+                                   ecma_value_t request_index, /**< byte offset of the element */
+                                   uint32_t element_size, /**< size of the element */
+                                   uint8_t **out_element_p) /**< out: address of the element */
+{
+  if (!ecma_is_dataview (view))
+  {
+    return ecma_raise_type_error ("Incompatible type");
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  ecma_object_t *view_p = ecma_get_object_from_value (view);
+  uint32_t index = 0;
+
+  ECMA_TRY_CATCH (index_value, ecma_typedarray_to_index (request_index, &index), ret_value);
+
+  if ((uint64_t) index + element_size > ecma_typedarray_get_length (view_p))
+  {
+    ret_value = ecma_raise_range_error ("Offset is outside the bounds of the DataView");
+  }
+  else
+  {
+    *out_element_p = ecma_typedarray_get_buffer (view_p) + index;
+    ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+
+  ECMA_FINALIZE (index_value);
+
+  return ret_value;
+} /* ecma_dataview_get_element_address */
+
+/**
+ * Read an element through a DataView object
+ *
+ * See also: ECMA-262 v6, 24.2.1.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_dataview_get_value (ecma_value_t view, /**< this argument */
+                            ecma_value_t request_index, /**< byte offset of the element */
+                            ecma_value_t is_little_endian, /**< byte order of the element (default: big-endian) */
+                            ecma_typedarray_type_t type) /**< element type */
+{
+  JERRY_ASSERT (type != ECMA_TYPEDARRAY_DATAVIEW && type != ECMA_TYPEDARRAY_UINT8_CLAMPED);
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t element_size = ecma_typedarray_get_element_size (type);
+  uint8_t *element_p = NULL;
+
+  ECMA_TRY_CATCH (address_value,
+                  ecma_dataview_get_element_address (view, request_index, element_size, &element_p),
+                  ret_value);
+
+  uint8_t element[sizeof (double)];
+  memcpy (element, element_p, element_size);
+
+  ecma_value_t is_little_endian_value = ecma_op_to_boolean (is_little_endian);
+  ecma_typedarray_swap_bytes_if_needed (element, element_size, ecma_is_value_true (is_little_endian_value));
+
+  ecma_number_t *value_p = ecma_alloc_number ();
+  *value_p = ecma_typedarray_get_element (element, type);
+
+  ret_value = ecma_make_number_value (value_p);
+
+  ECMA_FINALIZE (address_value);
+
+  return ret_value;
+} /* ecma_op_dataview_get_value */
+
+/**
+ * Write an element through a DataView object
+ *
+ * See also: ECMA-262 v6, 24.2.1.2
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_dataview_set_value (ecma_value_t view, /**< this argument */
+                            ecma_value_t request_index, /**< byte offset of the element */
+                            ecma_value_t is_little_endian, /**< byte order of the element (default: big-endian) */
+                            ecma_value_t value, /**< new value of the element */
+                            ecma_typedarray_type_t type) /**< element type */
+{
+  JERRY_ASSERT (type != ECMA_TYPEDARRAY_DATAVIEW && type != ECMA_TYPEDARRAY_UINT8_CLAMPED);
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t element_size = ecma_typedarray_get_element_size (type);
+  uint8_t *element_p = NULL;
+
+  ECMA_TRY_CATCH (address_value,
+                  ecma_dataview_get_element_address (view, request_index, element_size, &element_p),
+                  ret_value);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (value_num, value, ret_value);
+
+  uint8_t element[sizeof (double)];
+  ecma_typedarray_set_element (element, type, value_num);
+
+  ecma_value_t is_little_endian_value = ecma_op_to_boolean (is_little_endian);
+  ecma_typedarray_swap_bytes_if_needed (element, element_size, ecma_is_value_true (is_little_endian_value));
+
+  memcpy (element_p, element, element_size);
+
+  ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+
+  ECMA_OP_TO_NUMBER_FINALIZE (value_num);
+  ECMA_FINALIZE (address_value);
+
+  return ret_value;
+} /* ecma_op_dataview_set_value */
+
+/**
+ * @}
+ * @}
+ */
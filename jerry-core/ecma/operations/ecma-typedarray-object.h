@@ -0,0 +1,91 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_TYPEDARRAY_OBJECT_H
+#define ECMA_TYPEDARRAY_OBJECT_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmatypedarrayobject ECMA typed array and DataView object related routines
+ * @{
+ */
+
+extern ecma_object_t *
+ecma_typedarray_new_object (ecma_object_t *, uint32_t, uint32_t, ecma_typedarray_type_t);
+extern ecma_value_t
+ecma_op_create_typedarray_object (const ecma_value_t *, ecma_length_t, ecma_typedarray_type_t);
+extern ecma_value_t
+ecma_op_create_dataview_object (const ecma_value_t *, ecma_length_t);
+
+extern bool
+ecma_is_typedarray (ecma_value_t);
+extern bool
+ecma_is_dataview (ecma_value_t);
+extern ecma_typedarray_type_t
+ecma_typedarray_get_type (ecma_object_t *);
+extern uint32_t
+ecma_typedarray_get_element_size (ecma_typedarray_type_t);
+extern ecma_object_t *
+ecma_typedarray_get_arraybuffer (ecma_object_t *);
+extern uint32_t
+ecma_typedarray_get_offset (ecma_object_t *);
+extern uint32_t
+ecma_typedarray_get_length (ecma_object_t *);
+extern uint8_t *
+ecma_typedarray_get_buffer (ecma_object_t *);
+extern lit_magic_string_id_t
+ecma_typedarray_get_class_name (ecma_object_t *);
+
+extern ecma_number_t
+ecma_typedarray_get_element (const uint8_t *, ecma_typedarray_type_t);
+extern void
+ecma_typedarray_set_element (uint8_t *, ecma_typedarray_type_t, ecma_number_t);
+extern ecma_value_t
+ecma_typedarray_copy_elements (ecma_object_t *, uint32_t, ecma_object_t *, uint32_t);
+extern ecma_value_t
+ecma_op_typedarray_get_index (ecma_object_t *, uint32_t);
+extern ecma_value_t
+ecma_op_typedarray_set_index (ecma_object_t *, uint32_t, ecma_value_t);
+
+extern ecma_value_t
+ecma_op_typedarray_object_get (ecma_object_t *, ecma_string_t *);
+extern ecma_property_t *
+ecma_op_typedarray_object_get_own_property (ecma_object_t *, ecma_string_t *);
+extern ecma_value_t
+ecma_op_typedarray_object_put (ecma_object_t *, ecma_string_t *, ecma_value_t, bool);
+extern ecma_value_t
+ecma_op_typedarray_object_define_own_property (ecma_object_t *, ecma_string_t *,
+                                               const ecma_property_descriptor_t *, bool);
+extern void
+ecma_op_typedarray_list_lazy_property_names (ecma_object_t *,
+                                             bool,
+                                             ecma_collection_header_t *,
+                                             ecma_collection_header_t *);
+
+extern ecma_value_t
+ecma_op_dataview_get_value (ecma_value_t, ecma_value_t, ecma_value_t, ecma_typedarray_type_t);
+extern ecma_value_t
+ecma_op_dataview_set_value (ecma_value_t, ecma_value_t, ecma_value_t, ecma_value_t, ecma_typedarray_type_t);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_TYPEDARRAY_OBJECT_H */
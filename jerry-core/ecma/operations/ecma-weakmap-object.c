@@ -0,0 +1,349 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-builtins.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-weakmap-object.h"
+#include "jcontext.h"
+#include "mem-heap.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaweakmapobject ECMA WeakMap object related routines
+ * @{
+ */
+
+/**
+ * Minimum number of entries of a non-empty WeakMap hash table
+ */
+#define ECMA_WEAKMAP_MIN_CAPACITY 8
+
+/**
+ * Create a WeakMap object without entries
+ *
+ * Note:
+ *      the keys of a WeakMap are not kept alive by the map, and an entry is removed
+ *      by the garbage collector, when its key becomes unreachable; the value of an entry
+ *      is kept alive only as long as both the map and the key are reachable (ephemeron)
+ *
+ * @return pointer to the new WeakMap object
+ */
+ecma_object_t *
+ecma_op_create_weakmap_object (void)
+{
+  ecma_weakmap_t *weakmap_p = (ecma_weakmap_t *) mem_heap_alloc_block (sizeof (ecma_weakmap_t),
+                                                                       MEM_HEAP_ALLOC_LONG_TERM);
+  weakmap_p->entries_p = NULL;
+  weakmap_p->count = 0;
+  weakmap_p->used = 0;
+  weakmap_p->capacity = 0;
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_WEAKMAP_BUILTIN
+  ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_WEAKMAP_PROTOTYPE);
+#else /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_WEAKMAP_BUILTIN */
+  ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
+#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_WEAKMAP_BUILTIN */
+
+  ecma_object_t *obj_p = ecma_create_object (prototype_obj_p, true, ECMA_OBJECT_TYPE_GENERAL);
+  ecma_deref_object (prototype_obj_p);
+
+  ecma_property_t *class_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
+  class_prop_p->u.internal_property.value = LIT_MAGIC_STRING_WEAK_MAP_UL;
+
+  ecma_property_t *weakmap_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_WEAKMAP);
+  ECMA_SET_NON_NULL_POINTER (weakmap_prop_p->u.internal_property.value, weakmap_p);
+
+  /* The map is registered after the last allocation, so the garbage collector never sees it half-initialized */
+  weakmap_p->object_p = obj_p;
+  weakmap_p->next_p = JERRY_CONTEXT (ecma_weakmaps_p);
+  JERRY_CONTEXT (ecma_weakmaps_p) = weakmap_p;
+
+  return obj_p;
+} /* ecma_op_create_weakmap_object */
+
+/**
+ * Check whether the value is a WeakMap object
+ *
+ * @return true - if the value is a WeakMap object,
+ *         false - otherwise.
+ */
+bool
+ecma_is_weakmap (ecma_value_t value) /**< ecma value */
+{
+  if (!ecma_is_value_object (value))
+  {
+    return false;
+  }
+
+  ecma_object_t *obj_p = ecma_get_object_from_value (value);
+
+  return (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_GENERAL
+          && ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_WEAKMAP) != NULL);
+} /* ecma_is_weakmap */
+
+/**
+ * Get the hash table of a WeakMap object
+ *
+ * @return pointer to the hash table descriptor
+ */
+static ecma_weakmap_t *
+ecma_weakmap_get_table (ecma_object_t *obj_p) /**< WeakMap object */
+{
+  ecma_property_t *weakmap_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_WEAKMAP);
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_weakmap_t, weakmap_prop_p->u.internal_property.value);
+} /* ecma_weakmap_get_table */
+
+/**
+ * Get the index of the first entry, which is probed for the key
+ *
+ * @return entry index
+ */
+static uint32_t __attr_always_inline___
+ecma_weakmap_hash (const ecma_object_t *key_p, /**< key object */
+                   uint32_t capacity) /**< capacity of the table (a power of 2) */
+{
+  return ((uint32_t) ((uintptr_t) key_p >> MEM_ALIGNMENT_LOG)) & (capacity - 1);
+} /* ecma_weakmap_hash */
+
+/**
+ * Find the entry of a key
+ *
+ * @return pointer to the entry - if the key is in the map,
+ *         NULL - otherwise.
+ */
+static ecma_weakmap_entry_t *
+ecma_weakmap_find_entry (ecma_weakmap_t *weakmap_p, /**< hash table */
+                         const ecma_object_t *key_p) /**< key object */
+{
+  if (weakmap_p->count == 0)
+  {
+    return NULL;
+  }
+
+  uint32_t mask = weakmap_p->capacity - 1;
+
+  /* The load factor is at most 1/2, so the probing always reaches a free entry */
+  for (uint32_t index = ecma_weakmap_hash (key_p, weakmap_p->capacity);; index = (index + 1) & mask)
+  {
+    ecma_weakmap_entry_t *entry_p = weakmap_p->entries_p + index;
+
+    if (entry_p->key_p == key_p)
+    {
+      return entry_p;
+    }
+
+    if (entry_p->key_p == NULL && ecma_is_value_empty (entry_p->value))
+    {
+      return NULL;
+    }
+  }
+} /* ecma_weakmap_find_entry */
+
+/**
+ * Insert a key, which is not in the map, into an entry that is not live
+ *
+ * @return pointer to the entry
+ */
+static ecma_weakmap_entry_t *
+ecma_weakmap_insert_key (ecma_weakmap_t *weakmap_p, /**< hash table */
+                         ecma_object_t *key_p) /**< key object */
+{
+  JERRY_ASSERT (weakmap_p->used < weakmap_p->capacity);
+
+  uint32_t mask = weakmap_p->capacity - 1;
+  uint32_t index = ecma_weakmap_hash (key_p, weakmap_p->capacity);
+
+  while (weakmap_p->entries_p[index].key_p != NULL)
+  {
+    index = (index + 1) & mask;
+  }
+
+  ecma_weakmap_entry_t *entry_p = weakmap_p->entries_p + index;
+
+  if (ecma_is_value_empty (entry_p->value))
+  {
+    weakmap_p->used++;
+  }
+
+  weakmap_p->count++;
+  entry_p->key_p = key_p;
+
+  return entry_p;
+} /* ecma_weakmap_insert_key */
+
+/**
+ * Resize the hash table, so it has room for one more entry, and drop the deleted entries
+ *
+ * Note:
+ *      the allocation may trigger the garbage collector, which can delete entries of the map,
+ *      so the old entries are only read after the allocation
+ */
+static void
+ecma_weakmap_rehash (ecma_weakmap_t *weakmap_p) /**< hash table */
+{
+  uint32_t new_capacity = ECMA_WEAKMAP_MIN_CAPACITY;
+
+  while (new_capacity < (weakmap_p->count + 1) * 2)
+  {
+    new_capacity <<= 1;
+  }
+
+  ecma_weakmap_entry_t *new_entries_p;
+  new_entries_p = (ecma_weakmap_entry_t *) mem_heap_alloc_block (new_capacity * sizeof (ecma_weakmap_entry_t),
+                                                                 MEM_HEAP_ALLOC_LONG_TERM);
+
+  for (uint32_t i = 0; i < new_capacity; i++)
+  {
+    new_entries_p[i].key_p = NULL;
+    new_entries_p[i].value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  }
+
+  ecma_weakmap_entry_t *old_entries_p = weakmap_p->entries_p;
+  uint32_t old_capacity = weakmap_p->capacity;
+
+  weakmap_p->entries_p = new_entries_p;
+  weakmap_p->capacity = new_capacity;
+  weakmap_p->count = 0;
+  weakmap_p->used = 0;
+
+  for (uint32_t i = 0; i < old_capacity; i++)
+  {
+    if (old_entries_p[i].key_p != NULL)
+    {
+      ecma_weakmap_entry_t *entry_p = ecma_weakmap_insert_key (weakmap_p, old_entries_p[i].key_p);
+      entry_p->value = old_entries_p[i].value;
+    }
+  }
+
+  if (old_entries_p != NULL)
+  {
+    mem_heap_free_block (old_entries_p);
+  }
+} /* ecma_weakmap_rehash */
+
+/**
+ * Get the value associated with a key
+ *
+ * See also:
+ *          ECMA-262 v6, 23.3.3.3
+ *
+ * @return ecma value - copy of the associated value, or undefined if the key is not in the map
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_weakmap_get (ecma_object_t *obj_p, /**< WeakMap object */
+                     ecma_object_t *key_p) /**< key object */
+{
+  ecma_weakmap_entry_t *entry_p = ecma_weakmap_find_entry (ecma_weakmap_get_table (obj_p), key_p);
+
+  if (entry_p == NULL)
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  return ecma_copy_value (entry_p->value, true);
+} /* ecma_op_weakmap_get */
+
+/**
+ * Check whether a key is in the map
+ *
+ * See also:
+ *          ECMA-262 v6, 23.3.3.4
+ *
+ * @return true - if the key is in the map,
+ *         false - otherwise.
+ */
+bool
+ecma_op_weakmap_has (ecma_object_t *obj_p, /**< WeakMap object */
+                     ecma_object_t *key_p) /**< key object */
+{
+  return ecma_weakmap_find_entry (ecma_weakmap_get_table (obj_p), key_p) != NULL;
+} /* ecma_op_weakmap_has */
+
+/**
+ * Associate a value with a key
+ *
+ * See also:
+ *          ECMA-262 v6, 23.3.3.5
+ *
+ * Note:
+ *      the caller must keep the map and the key alive during the call
+ */
+void
+ecma_op_weakmap_set (ecma_object_t *obj_p, /**< WeakMap object */
+                     ecma_object_t *key_p, /**< key object */
+                     ecma_value_t value) /**< value */
+{
+  /* Copying a number allocates memory, so it is done before any entry pointer is taken */
+  ecma_value_t value_copy = ecma_copy_value (value, false);
+
+  ecma_weakmap_t *weakmap_p = ecma_weakmap_get_table (obj_p);
+  ecma_weakmap_entry_t *entry_p = ecma_weakmap_find_entry (weakmap_p, key_p);
+
+  if (entry_p != NULL)
+  {
+    ecma_free_value_if_not_object (entry_p->value);
+    entry_p->value = value_copy;
+    return;
+  }
+
+  if ((weakmap_p->used + 1) * 2 > weakmap_p->capacity)
+  {
+    ecma_weakmap_rehash (weakmap_p);
+  }
+
+  entry_p = ecma_weakmap_insert_key (weakmap_p, key_p);
+  entry_p->value = value_copy;
+} /* ecma_op_weakmap_set */
+
+/**
+ * Remove a key from the map
+ *
+ * See also:
+ *          ECMA-262 v6, 23.3.3.2
+ *
+ * @return true - if the key was in the map,
+ *         false - otherwise.
+ */
+bool
+ecma_op_weakmap_delete (ecma_object_t *obj_p, /**< WeakMap object */
+                        ecma_object_t *key_p) /**< key object */
+{
+  ecma_weakmap_t *weakmap_p = ecma_weakmap_get_table (obj_p);
+  ecma_weakmap_entry_t *entry_p = ecma_weakmap_find_entry (weakmap_p, key_p);
+
+  if (entry_p == NULL)
+  {
+    return false;
+  }
+
+  ecma_free_value_if_not_object (entry_p->value);
+  entry_p->key_p = NULL;
+  entry_p->value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  weakmap_p->count--;
+
+  return true;
+} /* ecma_op_weakmap_delete */
+
+/**
+ * @}
+ * @}
+ */
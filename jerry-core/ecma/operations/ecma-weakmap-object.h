@@ -0,0 +1,48 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_WEAKMAP_OBJECT_H
+#define ECMA_WEAKMAP_OBJECT_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaweakmapobject ECMA WeakMap object related routines
+ * @{
+ */
+
+extern ecma_object_t *
+ecma_op_create_weakmap_object (void);
+extern bool
+ecma_is_weakmap (ecma_value_t);
+
+extern ecma_value_t
+ecma_op_weakmap_get (ecma_object_t *, ecma_object_t *);
+extern bool
+ecma_op_weakmap_has (ecma_object_t *, ecma_object_t *);
+extern void
+ecma_op_weakmap_set (ecma_object_t *, ecma_object_t *, ecma_value_t);
+extern bool
+ecma_op_weakmap_delete (ecma_object_t *, ecma_object_t *);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_WEAKMAP_OBJECT_H */
@@ -0,0 +1,71 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+
+/** \addtogroup context Context
+ * @{
+ */
+
+#ifndef JERRY_ENABLE_MULTIPLE_CONTEXTS
+
+/**
+ * Context of the only engine instance
+ */
+jerry_context_t jerry_global_context;
+
+/**
+ * Heap of the only engine instance
+ */
+#ifndef JERRY_HEAP_SECTION_ATTR
+mem_heap_t jerry_global_heap;
+#else /* !JERRY_HEAP_SECTION_ATTR */
+mem_heap_t jerry_global_heap __attribute__ ((section (JERRY_HEAP_SECTION_ATTR)));
+#endif /* JERRY_HEAP_SECTION_ATTR */
+
+#else /* !JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
+/**
+ * Context buffers aligned to JERRY_CONTEXT_ALIGNMENT satisfy the alignment of the heap area
+ */
+JERRY_STATIC_ASSERT (JERRY_MAX (MEM_ALIGNMENT, MEM_HEAP_CHUNK_SIZE) <= JERRY_CONTEXT_ALIGNMENT);
+
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
+/**
+ * Reset the state of the current engine context
+ *
+ * Note:
+ *      the heap area is not cleared, it is initialized by mem_heap_init
+ */
+void
+jcontext_init (void)
+{
+#ifndef JERRY_ENABLE_MULTIPLE_CONTEXTS
+  memset (&jerry_global_context, 0, sizeof (jerry_context_t));
+#else /* !JERRY_ENABLE_MULTIPLE_CONTEXTS */
+  jerry_context_t *context_p = jerry_port_get_current_context ();
+
+  JERRY_ASSERT (context_p != NULL && (uintptr_t) context_p % JERRY_CONTEXT_ALIGNMENT == 0);
+
+  memset (context_p, 0, offsetof (jerry_context_t, heap));
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+} /* jcontext_init */
+
+/**
+ * @}
+ */
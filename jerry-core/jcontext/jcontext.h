@@ -0,0 +1,240 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JCONTEXT_H
+#define JCONTEXT_H
+
+#include <signal.h>
+
+#include "ecma-builtins.h"
+#include "ecma-eval-cache.h"
+#include "ecma-for-in-cache.h"
+#include "ecma-gc.h"
+#include "ecma-handle-table.h"
+#include "ecma-globals.h"
+#include "ecma-lcache.h"
+#include "jerry.h"
+#include "jerry-snapshot.h"
+#include "mem-allocator.h"
+#include "mem-heap.h"
+#include "mem-poolman.h"
+#include "rcs-globals.h"
+#include "vm-defines.h"
+
+/** \addtogroup context Context
+ * @{
+ */
+
+/**
+ * Job of the embedder, which is queued by jerry_api_enqueue_job
+ *
+ * The arguments of the call follow the header.
+ */
+typedef struct jerry_job_t
+{
+  struct jerry_job_t *next_p; /**< next job in the queue */
+  ecma_value_t function; /**< function to call */
+  ecma_value_t this_value; /**< 'this' binding of the call */
+  ecma_length_t args_count; /**< number of the arguments */
+} jerry_job_t;
+
+/**
+ * Engine context
+ *
+ * All state of an engine instance is stored in its context, so independent
+ * instances can be run by switching between their contexts.
+ */
+struct jerry_context_t
+{
+  /* Memory allocator */
+  size_t mem_heap_allocated_chunks; /**< total number of allocated heap chunks */
+  size_t mem_heap_limit; /**< current limit of heap usage, that is upon being reached,
+                          *   causes call of "try give memory back" callbacks */
+  mem_pool_chunk_t *mem_free_chunk_p; /**< list of free pool chunks */
+  mem_try_give_memory_back_callback_t mem_try_give_memory_back_callback; /**< the 'try to give memory
+                                                                          *   back' callback */
+
+#ifdef MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY
+  /**
+   * Number of bytes, allocated in heap block
+   *
+   * The array contains one entry per heap chunk with:
+   *  - number of allocated bytes, if the chunk is at start of an allocated block;
+   *  - 0, if the chunk is at start of free block;
+   *  - -1, if the chunk is not at start of a block.
+   */
+  ssize_t mem_heap_allocated_bytes[MEM_HEAP_CHUNKS_NUM];
+#endif /* MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY */
+
+#ifndef JERRY_NDEBUG
+  /**
+   * Length types for allocated chunks
+   *
+   * The array contains one entry per heap chunk with:
+   *  - length type of corresponding block, if the chunk is at start of an allocated block;
+   *  - MEM_BLOCK_LENGTH_TYPE_GENERAL length type for rest chunks.
+   */
+  mem_block_length_type_t mem_heap_length_types[MEM_HEAP_CHUNKS_NUM];
+  size_t mem_free_chunks_number; /**< number of free pool chunks */
+#endif /* !JERRY_NDEBUG */
+
+#ifdef MEM_STATS
+  mem_heap_stats_t mem_heap_stats; /**< heap's memory usage statistics */
+  mem_pools_stats_t mem_pools_stats; /**< pools' memory usage statistics */
+#endif /* MEM_STATS */
+
+#ifdef JERRY_VALGRIND_FREYA
+  bool valgrind_freya_mempool_request; /**< a pool manager allocator request is in progress */
+#endif /* JERRY_VALGRIND_FREYA */
+
+  /* Literal storage */
+  rcs_record_set_t rcs_lit_storage; /**< literal storage */
+  const lit_utf8_byte_t **lit_magic_string_ex_array; /**< external magic strings data array */
+  uint32_t lit_magic_string_ex_count; /**< number of external magic strings */
+  const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< lengths of external magic strings */
+
+  /**
+   * Result buffer of lit_literal_to_str_internal_buf
+   */
+  lit_utf8_byte_t lit_literal_str_buff[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER + 1];
+
+  /* ECMA engine */
+  ecma_object_t *ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT]; /**< pointer to instances of built-in objects */
+  ecma_object_t *ecma_global_lex_env_p; /**< global lexical environment (See also: ECMA-262 v5, 10.2.3) */
+  ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT]; /**< list of marked (visited during current
+                                                               *   GC session) and umarked objects */
+  bool ecma_gc_visited_flip_flag; /**< current state of an object's visited flag
+                                   *   (See also: ecma_gc_is_object_visited) */
+  size_t ecma_gc_objects_number; /**< number of currently allocated objects */
+  size_t ecma_gc_new_objects_since_last_gc; /**< number of newly allocated objects since last GC session */
+  uint32_t ecma_for_in_delete_epoch; /**< number of property deletions performed since engine initialization */
+  mem_cpointer_t ecma_pinned_bytecode_list_cp; /**< pinned compiled code trees */
+  uint32_t ecma_external_strings_number; /**< number of strings referencing a buffer of the embedder */
+  ecma_handle_t *ecma_handle_table_p; /**< entries of the handle table */
+  uint32_t ecma_handle_table_size; /**< number of entries in the handle table */
+  uint32_t ecma_handle_table_free_list; /**< index + 1 of the first free entry of the handle table, or 0 */
+  uint32_t ecma_handles_number; /**< number of allocated handles */
+  ecma_weakmap_t *ecma_weakmaps_p; /**< list of all WeakMap objects */
+
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+  /**
+   * LCache's hash table
+   */
+  ecma_lcache_hash_entry_t ecma_lcache_hash_table[ECMA_LCACHE_HASH_ROWS_COUNT][ECMA_LCACHE_HASH_ROW_LENGTH];
+#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  ecma_for_in_cache_entry_t ecma_for_in_cache_table[ECMA_FOR_IN_CACHE_ENTRIES_COUNT]; /**< for-in cache
+                                                                                       *   entries */
+  uint32_t ecma_for_in_cache_next_index; /**< index of the entry which is replaced by the next insertion */
+  uint32_t ecma_for_in_cache_chain_mask; /**< bit mask filter of the compressed pointers stored in the cache */
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+  ecma_eval_cache_entry_t ecma_eval_cache_table[ECMA_EVAL_CACHE_ENTRIES_COUNT]; /**< eval cache entries, ordered
+                                                                                 *   from the most recently used
+                                                                                 *   to the least recently used one */
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+
+  /* Virtual machine */
+  vm_frame_ctx_t *vm_top_context_p; /**< top (current) interpreter context */
+  ecma_compiled_code_t *vm_program_p; /**< program bytecode pointer */
+  bool is_direct_eval_form_call; /**< direct call from eval */
+  jerry_api_interrupt_callback_t vm_interrupt_callback; /**< interrupt callback of the embedder */
+  void *vm_interrupt_user_p; /**< user pointer passed to the interrupt callback */
+  uint32_t vm_interrupt_budget; /**< number of safepoints between two calls of the interrupt callback,
+                                 *   or 0 (the callback is called only when an interrupt is requested) */
+  uint32_t vm_interrupt_countdown; /**< number of safepoints left until the next call of the callback */
+  volatile sig_atomic_t vm_interrupt_requested; /**< the interrupt callback is called at the next safepoint
+                                                 *   (set by jerry_api_request_interrupt from a signal
+                                                 *   handler or from another thread) */
+  bool vm_is_aborting; /**< the execution is being aborted by the interrupt callback */
+
+  /* Parser */
+#ifdef PARSER_DUMP_BYTE_CODE
+  int parser_show_instrs; /**< dump byte code after parsing */
+#endif /* PARSER_DUMP_BYTE_CODE */
+
+  /* API */
+  jerry_flag_t jerry_flags; /**< run-time configuration flags */
+  bool jerry_api_available; /**< API availability flag */
+  jerry_job_t *jerry_job_queue_first_p; /**< first job of the job queue */
+  jerry_job_t *jerry_job_queue_last_p; /**< last job of the job queue */
+
+#ifdef JERRY_ENABLE_SNAPSHOT_SAVE
+  bool snapshot_report_byte_code_compilation; /**< snapshot taking is in progress */
+  bool snapshot_error_occured; /**< an error occured while taking the snapshot */
+  uint8_t *snapshot_buffer_p; /**< buffer of the snapshot being taken */
+  size_t snapshot_buffer_size; /**< size of the snapshot buffer */
+  size_t snapshot_buffer_write_offset; /**< write offset in the snapshot buffer */
+  size_t snapshot_last_compiled_code_offset; /**< offset of the last compiled code in the snapshot buffer */
+  compiled_code_map_entry_t *snapshot_map_entries_p; /**< mapping of compiled codes to snapshot offsets */
+  uint32_t snapshot_compiled_codes_num; /**< number of compiled codes in the snapshot */
+#endif /* JERRY_ENABLE_SNAPSHOT_SAVE */
+
+#ifdef JERRY_ENABLE_MULTIPLE_CONTEXTS
+  mem_heap_t heap; /**< heap of the context (must be the last member) */
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+};
+
+#ifndef JERRY_ENABLE_MULTIPLE_CONTEXTS
+
+/**
+ * Context of the only engine instance
+ */
+extern jerry_context_t jerry_global_context;
+
+/**
+ * Heap of the only engine instance
+ */
+extern mem_heap_t jerry_global_heap;
+
+/**
+ * Access a member of the engine context
+ */
+#define JERRY_CONTEXT(field) (jerry_global_context.field)
+
+/**
+ * Heap of the engine context
+ */
+#define JERRY_HEAP (jerry_global_heap)
+
+#else /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
+/**
+ * Access a member of the engine context selected by the port
+ */
+#define JERRY_CONTEXT(field) (jerry_port_get_current_context ()->field)
+
+/**
+ * Heap of the engine context selected by the port
+ */
+#define JERRY_HEAP (jerry_port_get_current_context ()->heap)
+
+#endif /* !JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
+/**
+ * Access a member of the heap of the engine context
+ */
+#define JERRY_HEAP_CONTEXT(field) (JERRY_HEAP.field)
+
+extern void jcontext_init (void);
+
+/**
+ * @}
+ */
+
+#endif /* !JCONTEXT_H */
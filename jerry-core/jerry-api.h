@@ -40,6 +40,7 @@ typedef enum
   JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION      = 1, /**< exception occured and it was not handled */
   JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_VERSION = 2, /**< snapshot version mismatch */
   JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT  = 3, /**< snapshot format is not valid */
+  JERRY_COMPLETION_CODE_ABORTED                  = 4, /**< execution was aborted by the interrupt callback */
 } jerry_completion_code_t;
 
 /**
@@ -138,6 +139,125 @@ typedef bool (*jerry_external_handler_t) (const jerry_api_object_t *function_obj
  */
 typedef void (*jerry_object_free_callback_t) (const uintptr_t native_p);
 
+/**
+ * Free callback of a string, which references the characters of a buffer of the embedder
+ */
+typedef void (*jerry_api_string_free_callback_t) (const jerry_api_char_t *buffer_p, jerry_api_size_t buffer_size);
+
+/**
+ * Free callback of an ArrayBuffer, which references a buffer of the embedder
+ */
+typedef void (*jerry_api_arraybuffer_free_callback_t) (uint8_t *buffer_p, jerry_api_size_t buffer_size);
+
+/**
+ * Handle of the embedder, which references an object
+ */
+typedef uint32_t jerry_api_handle_t;
+
+/**
+ * Callback of a weak handle, which is called when the object of the handle is collected
+ *
+ * Note:
+ *      the handle remains allocated until it is released with jerry_api_release_handle
+ */
+typedef void (*jerry_api_weak_handle_callback_t) (jerry_api_handle_t handle, void *user_p);
+
+/**
+ * Get interceptor of a host object
+ *
+ * @return true - if the host object has the property, its value is stored to value_p
+ *                (the engine releases the value),
+ *         false - otherwise.
+ */
+typedef bool (*jerry_api_host_object_get_t) (const jerry_api_object_t *object_p,
+                                             const jerry_api_string_t *name_p,
+                                             jerry_api_value_t *value_p);
+
+/**
+ * Set interceptor of a host object
+ *
+ * @return true - if the host object stored the value,
+ *         false - otherwise (the value is stored in an ordinary own property of the object).
+ */
+typedef bool (*jerry_api_host_object_set_t) (const jerry_api_object_t *object_p,
+                                             const jerry_api_string_t *name_p,
+                                             const jerry_api_value_t *value_p);
+
+/**
+ * Has interceptor of a host object
+ *
+ * Note:
+ *      it is used by the existence checks ('in' operator, hasOwnProperty, for-in), which do not need the value,
+ *      if it is NULL, the get interceptor is called instead.
+ *
+ * @return true - if the host object has the property,
+ *         false - otherwise.
+ */
+typedef bool (*jerry_api_host_object_has_t) (const jerry_api_object_t *object_p,
+                                             const jerry_api_string_t *name_p);
+
+/**
+ * Delete interceptor of a host object
+ *
+ * @return true - if the property is deleted, or the host object does not have it,
+ *         false - if the property can not be deleted.
+ */
+typedef bool (*jerry_api_host_object_delete_t) (const jerry_api_object_t *object_p,
+                                                const jerry_api_string_t *name_p);
+
+/**
+ * Enumerate interceptor of a host object
+ *
+ * @return array of the property names (strings or numbers), which is released by the engine,
+ *         or NULL - if the host object has no enumerable properties.
+ */
+typedef jerry_api_object_t *(*jerry_api_host_object_enumerate_t) (const jerry_api_object_t *object_p);
+
+/**
+ * Property interceptors of a host object
+ *
+ * Note:
+ *      any of the interceptors can be NULL, the operation is performed on the ordinary own properties then.
+ *
+ *      the interceptors can use the API, but they must not change the own properties of the host object
+ *      and they can not throw exceptions.
+ */
+typedef struct
+{
+  jerry_api_host_object_get_t get_p; /**< get the value of a property */
+  jerry_api_host_object_set_t set_p; /**< set the value of a property */
+  jerry_api_host_object_has_t has_p; /**< check whether a property exists */
+  jerry_api_host_object_delete_t delete_p; /**< delete a property */
+  jerry_api_host_object_enumerate_t enumerate_p; /**< list the enumerable properties */
+} jerry_api_host_object_handlers_t;
+
+/**
+ * Action requested by the interrupt callback
+ */
+typedef enum
+{
+  JERRY_API_INTERRUPT_CONTINUE, /**< continue the execution */
+  JERRY_API_INTERRUPT_ABORT /**< abort the execution (the script can not catch the abort) */
+} jerry_api_interrupt_action_t;
+
+/**
+ * Interrupt callback, which is called at the safepoints of the execution (calls and backward branches)
+ *
+ * Note:
+ *      the callback can pause the execution by blocking, or yield by running other work
+ *      (e.g. scripts of other engine contexts) before it returns.
+ */
+typedef jerry_api_interrupt_action_t (*jerry_api_interrupt_callback_t) (void *user_p);
+
+/**
+ * Error handler of the job queue
+ *
+ * Note:
+ *      the handler is called with the exception thrown by a job, and the engine
+ *      releases the value after the handler returns
+ */
+typedef void (*jerry_api_job_error_handler_t) (const jerry_api_value_t *error_value_p);
+
 /**
  * function type applied for each fields in objects
  */
@@ -270,6 +390,7 @@ jerry_api_value_t jerry_api_create_object_value (jerry_api_object_t *value);
 jerry_api_value_t jerry_api_create_string_value (jerry_api_string_t *value);
 
 ssize_t jerry_api_string_to_char_buffer (const jerry_api_string_t *, jerry_api_char_t *, ssize_t);
+const jerry_api_char_t *jerry_api_string_get_char_buffer (const jerry_api_string_t *, jerry_api_size_t *);
 jerry_api_string_t *jerry_api_acquire_string (jerry_api_string_t *);
 jerry_api_object_t *jerry_api_acquire_object (jerry_api_object_t *);
 
@@ -277,14 +398,38 @@ void jerry_api_release_object (jerry_api_object_t *);
 void jerry_api_release_string (jerry_api_string_t *);
 void jerry_api_release_value (jerry_api_value_t *);
 
+jerry_api_handle_t jerry_api_create_handle (jerry_api_object_t *);
+jerry_api_handle_t jerry_api_create_weak_handle (jerry_api_object_t *, jerry_api_weak_handle_callback_t, void *);
+jerry_api_object_t *jerry_api_get_handle_object (jerry_api_handle_t);
+void jerry_api_release_handle (jerry_api_handle_t);
+
 jerry_api_object_t *jerry_api_create_array_object (jerry_api_size_t);
+jerry_api_object_t *jerry_api_create_arraybuffer (jerry_api_size_t);
+jerry_api_object_t *jerry_api_create_external_arraybuffer (uint8_t *, jerry_api_size_t,
+                                                          jerry_api_arraybuffer_free_callback_t);
+uint8_t *jerry_api_get_arraybuffer_pointer (const jerry_api_object_t *, jerry_api_size_t *);
+jerry_api_object_t *jerry_api_create_weakmap (void);
+bool jerry_api_weakmap_set (jerry_api_object_t *, jerry_api_object_t *, const jerry_api_value_t *);
+bool jerry_api_weakmap_get (jerry_api_object_t *, jerry_api_object_t *, jerry_api_value_t *);
+bool jerry_api_weakmap_delete (jerry_api_object_t *, jerry_api_object_t *);
 jerry_api_object_t *jerry_api_create_object (void);
+jerry_api_object_t *jerry_api_create_host_object (const jerry_api_host_object_handlers_t *);
 jerry_api_string_t *jerry_api_create_string (const jerry_api_char_t *);
 jerry_api_string_t *jerry_api_create_string_sz (const jerry_api_char_t *, jerry_api_size_t);
+jerry_api_string_t *jerry_api_create_external_string_sz (const jerry_api_char_t *, jerry_api_size_t,
+                                                         jerry_api_string_free_callback_t);
 
 bool jerry_api_set_array_index_value (jerry_api_object_t *, jerry_api_length_t, jerry_api_value_t *);
 bool jerry_api_get_array_index_value (jerry_api_object_t *, jerry_api_length_t, jerry_api_value_t *);
 
+jerry_api_object_t *jerry_api_create_array_from_doubles (const double *, jerry_api_length_t);
+jerry_api_object_t *jerry_api_create_array_from_int32s (const int32_t *, jerry_api_length_t);
+jerry_api_object_t *jerry_api_create_array_from_values (const jerry_api_value_t *, jerry_api_length_t);
+jerry_api_length_t jerry_api_get_array_doubles (jerry_api_object_t *, jerry_api_length_t, double *, jerry_api_length_t);
+jerry_api_length_t jerry_api_get_array_int32s (jerry_api_object_t *, jerry_api_length_t, int32_t *, jerry_api_length_t);
+jerry_api_length_t jerry_api_get_array_values (jerry_api_object_t *, jerry_api_length_t,
+                                               jerry_api_value_t *, jerry_api_length_t);
+
 jerry_api_object_t *jerry_api_create_error (jerry_api_error_t, const jerry_api_char_t *);
 jerry_api_object_t *jerry_api_create_error_sz (jerry_api_error_t, const jerry_api_char_t *, jerry_api_size_t);
 jerry_api_object_t *jerry_api_create_external_function (jerry_external_handler_t);
@@ -310,14 +455,28 @@ void jerry_api_set_object_native_handle (jerry_api_object_t *, uintptr_t, jerry_
 bool jerry_api_call_function (jerry_api_object_t *, jerry_api_object_t *, jerry_api_value_t *,
                               const jerry_api_value_t[], uint16_t);
 bool jerry_api_construct_object (jerry_api_object_t *, jerry_api_value_t *, const jerry_api_value_t[], uint16_t);
+bool jerry_api_enqueue_job (jerry_api_object_t *, jerry_api_object_t *, const jerry_api_value_t[], uint16_t);
+jerry_api_length_t jerry_api_run_jobs (jerry_api_length_t, jerry_api_job_error_handler_t);
 jerry_completion_code_t jerry_api_eval (const jerry_api_char_t *, size_t, bool, bool, jerry_api_value_t *);
 jerry_api_object_t *jerry_api_get_global (void);
 
 void jerry_api_gc (void);
+void jerry_api_set_interrupt_callback (jerry_api_interrupt_callback_t, void *, uint32_t);
+void jerry_api_request_interrupt (void);
+bool jerry_api_is_aborted (void);
 void jerry_register_external_magic_strings (const jerry_api_char_ptr_t *, uint32_t, const jerry_api_length_t *);
 
 size_t jerry_parse_and_save_snapshot (const jerry_api_char_t *, size_t, bool, uint8_t *, size_t);
 jerry_completion_code_t jerry_exec_snapshot (const void *, size_t, bool, jerry_api_value_t *);
+size_t jerry_save_snapshot_bundle (const uint8_t * const *, const size_t *, uint32_t, uint8_t *, size_t);
+uint32_t jerry_get_snapshot_bundle_count (const void *, size_t);
+jerry_completion_code_t jerry_exec_snapshot_from_bundle (const void *, size_t, uint32_t, bool, jerry_api_value_t *);
+size_t jerry_save_heap_snapshot (uint8_t *, size_t);
+
+bool jerry_profiler_start (void);
+void jerry_profiler_stop (void);
+void jerry_profiler_sample (void);
+size_t jerry_profiler_dump (uint8_t *, size_t);
 
 /**
  * @}
@@ -29,6 +29,33 @@ jerry_dispatch_external_function (ecma_object_t *, ecma_external_pointer_t, ecma
 extern void
 jerry_dispatch_object_free_callback (ecma_external_pointer_t, ecma_external_pointer_t);
 
+extern void
+jerry_dispatch_external_string_free_callback (ecma_external_pointer_t, const lit_utf8_byte_t *, lit_utf8_size_t);
+
+extern void
+jerry_dispatch_arraybuffer_free_callback (ecma_external_pointer_t, uint8_t *, uint32_t);
+
+extern bool
+jerry_dispatch_host_object_get (ecma_object_t *, ecma_external_pointer_t, ecma_string_t *, ecma_value_t *);
+
+extern bool
+jerry_dispatch_host_object_set (ecma_object_t *, ecma_external_pointer_t, ecma_string_t *, ecma_value_t);
+
+extern bool
+jerry_dispatch_host_object_has (ecma_object_t *, ecma_external_pointer_t, ecma_string_t *);
+
+extern bool
+jerry_dispatch_host_object_delete (ecma_object_t *, ecma_external_pointer_t, ecma_string_t *);
+
+extern void
+jerry_dispatch_host_object_enumerate (ecma_object_t *, ecma_external_pointer_t, ecma_collection_header_t *);
+
+extern void
+jerry_dispatch_weak_handle_callback (ecma_external_pointer_t, uint32_t, ecma_external_pointer_t);
+
+extern bool
+jerry_dispatch_interrupt_callback (void);
+
 extern bool
 jerry_is_abort_on_fail (void);
 
@@ -16,6 +16,10 @@
 #include "jerry-port.h"
 #include <stdarg.h>
 
+#ifdef JERRY_ENABLE_MULTIPLE_CONTEXTS
+#include "jcontext.h"
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
 /**
  * Provide log message to filestream implementation for the engine.
  */
@@ -52,3 +56,35 @@ int jerry_port_putchar (int c) /**< character to put */
 {
   return putchar (c);
 } /* jerry_port_putchar */
+
+#ifdef JERRY_ENABLE_MULTIPLE_CONTEXTS
+
+/**
+ * Engine context used until another context is selected
+ */
+static jerry_context_t jerry_port_default_context __attribute__ ((aligned (JERRY_CONTEXT_ALIGNMENT)));
+
+/**
+ * Engine context selected by jerry_port_set_current_context
+ */
+static jerry_context_t *jerry_port_current_context_p = &jerry_port_default_context;
+
+/**
+ * Get the current engine context implementation for the engine.
+ *
+ * @return engine context, which is used by the engine calls
+ */
+jerry_context_t *jerry_port_get_current_context (void)
+{
+  return jerry_port_current_context_p;
+} /* jerry_port_get_current_context */
+
+/**
+ * Select the engine context used by the subsequent engine calls.
+ */
+void jerry_port_set_current_context (jerry_context_t *context_p) /**< engine context */
+{
+  jerry_port_current_context_p = context_p;
+} /* jerry_port_set_current_context */
+
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
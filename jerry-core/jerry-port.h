@@ -35,6 +35,24 @@ int jerry_port_logmsg (FILE *stream, const char *format, ...);
 int jerry_port_errormsg (const char *format, ...);
 int jerry_port_putchar (int c);
 
+/**
+ * Engine context (its layout is internal to the engine)
+ */
+typedef struct jerry_context_t jerry_context_t;
+
+#ifdef JERRY_ENABLE_MULTIPLE_CONTEXTS
+/**
+ * Target port functions for selecting the engine context
+ *
+ * All engine calls operate on the context returned by jerry_port_get_current_context.
+ * The default port stores the context in a global variable (and provides a default
+ * context until another one is selected), a port running engine instances on
+ * several threads should store it in thread-local storage.
+ */
+jerry_context_t *jerry_port_get_current_context (void);
+void jerry_port_set_current_context (jerry_context_t *context_p);
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
 /**
  * @}
  */
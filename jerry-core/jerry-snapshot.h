@@ -26,21 +26,93 @@ typedef struct
 {
   uint32_t last_compiled_code_offset; /**< offset of the last compiled code */
   uint32_t lit_table_size; /**< size of literal table */
+  uint32_t compiled_codes_num; /**< number of entries in the compiled code offset table,
+                                *   which follows the literal table */
   __extension__ uint32_t is_run_global : 1; /**< flag, indicating whether the snapshot
                                              *   was dumped as 'Global scope'-mode code (true)
                                              *   or as eval-mode code (false) */
+  __extension__ uint32_t has_line_info : 1; /**< flag, indicating whether the byte code headers
+                                             *   contain the offset of the line info table */
 } jerry_snapshot_header_t;
 
+/**
+ * Value of jerry_snapshot_header_t::has_line_info for this build
+ */
+#ifdef JERRY_ENABLE_LINE_INFO
+#define JERRY_SNAPSHOT_HAS_LINE_INFO 1u
+#else /* !JERRY_ENABLE_LINE_INFO */
+#define JERRY_SNAPSHOT_HAS_LINE_INFO 0u
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 /**
  * Jerry snapshot format version
  */
-#define JERRY_SNAPSHOT_VERSION (3u)
+#define JERRY_SNAPSHOT_VERSION (10u)
+
+/**
+ * Snapshot bundle header
+ *
+ * The header is followed by the index of the bundled snapshots (a jerry_snapshot_bundle_entry_t
+ * for each snapshot), and the snapshots, each of them starting at an offset aligned to MEM_ALIGNMENT.
+ */
+typedef struct
+{
+  uint32_t magic; /**< JERRY_SNAPSHOT_BUNDLE_MAGIC */
+  uint32_t version; /**< JERRY_SNAPSHOT_VERSION */
+  uint32_t snapshots_num; /**< number of the bundled snapshots */
+} jerry_snapshot_bundle_header_t;
+
+/**
+ * Index entry of a bundled snapshot
+ */
+typedef struct
+{
+  uint32_t offset; /**< offset of the snapshot from the start of the bundle */
+  uint32_t size; /**< size of the snapshot */
+} jerry_snapshot_bundle_entry_t;
+
+/**
+ * Magic number of snapshot bundles, which distinguishes them from byte code snapshots
+ */
+#define JERRY_SNAPSHOT_BUNDLE_MAGIC (0x4A525342u)
+
+/**
+ * Heap snapshot header
+ */
+typedef struct
+{
+  uint32_t magic; /**< JERRY_HEAP_SNAPSHOT_MAGIC */
+  uint32_t version; /**< JERRY_SNAPSHOT_VERSION */
+  uint32_t configuration; /**< JERRY_HEAP_SNAPSHOT_CONFIGURATION of the engine that saved the snapshot */
+  uint32_t image_size; /**< size of the heap image following the header */
+} jerry_heap_snapshot_header_t;
+
+/**
+ * Magic number of heap snapshots, which distinguishes them from byte code snapshots
+ */
+#define JERRY_HEAP_SNAPSHOT_MAGIC (0x4A524850u)
+
+/**
+ * Configuration of the engine, which should be the same for saving and restoring a heap snapshot
+ */
+#define JERRY_HEAP_SNAPSHOT_CONFIGURATION ((uint32_t) (sizeof (uintptr_t) \
+                                                      | (JERRY_SNAPSHOT_HAS_LINE_INFO << 8) \
+                                                      | (sizeof (ecma_number_t) << 16)))
 
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
 
-/* Snapshot support functions */
+/**
+ * Mapping of compiled codes to their offsets in the snapshot being saved
+ */
+typedef struct
+{
+  mem_cpointer_t next_cp; /**< next entry */
+  mem_cpointer_t compiled_code_cp; /**< compiled code */
+  uint16_t offset; /**< offset of the compiled code in the snapshot */
+  uint16_t index; /**< index of the compiled code in the snapshot */
+} compiled_code_map_entry_t;
 
-extern bool snapshot_report_byte_code_compilation;
+/* Snapshot support functions */
 
 extern void
 snapshot_add_compiled_code (ecma_compiled_code_t *, const uint8_t *, uint32_t);
@@ -17,22 +17,30 @@
 
 #include "ecma-alloc.h"
 #include "ecma-array-object.h"
+#include "ecma-arraybuffer-object.h"
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
 #include "ecma-eval.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
+#include "ecma-handle-table.h"
 #include "ecma-helpers.h"
+#include "ecma-host-object.h"
 #include "ecma-init-finalize.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
+#include "ecma-regexp-object.h"
 #include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "ecma-weakmap-object.h"
+#include "jcontext.h"
 #include "jerry-snapshot.h"
 #include "lit-literal.h"
 #include "lit-magic-strings.h"
 #include "lit-snapshot.h"
 #include "js-parser.h"
 #include "re-compiler.h"
+#include "vm-profiler.h"
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
@@ -52,16 +60,6 @@ const char *jerry_commit_hash = JERRY_COMMIT_HASH;
  */
 const char *jerry_branch_name = JERRY_BRANCH_NAME;
 
-/**
- * Jerry run-time configuration flags
- */
-static jerry_flag_t jerry_flags;
-
-/**
- * Jerry API availability flag
- */
-static bool jerry_api_available;
-
 /** \addtogroup jerry_extension Jerry engine extension interface
  * @{
  */
@@ -89,7 +87,7 @@ FILE *jerry_log_file = NULL;
  * Note:
  *         By convention, there can be some states when API could not be invoked.
  *
- *         While, API can be invoked jerry_api_available flag is set,
+ *         While, API can be invoked JERRY_CONTEXT (jerry_api_available) flag is set,
  *         and while it is incorrect to invoke API - it is not set.
  *
  *         The procedure checks that it is correct to invoke API in current state.
@@ -102,7 +100,7 @@ FILE *jerry_log_file = NULL;
 static void
 jerry_assert_api_available (void)
 {
-  if (!jerry_api_available)
+  if (!JERRY_CONTEXT (jerry_api_available))
   {
     JERRY_UNREACHABLE ();
   }
@@ -114,7 +112,7 @@ jerry_assert_api_available (void)
 static void
 jerry_make_api_available (void)
 {
-  jerry_api_available = true;
+  JERRY_CONTEXT (jerry_api_available) = true;
 } /* jerry_make_api_available */
 
 /**
@@ -123,7 +121,7 @@ jerry_make_api_available (void)
 static void
 jerry_make_api_unavailable (void)
 {
-  jerry_api_available = false;
+  JERRY_CONTEXT (jerry_api_available) = false;
 } /* jerry_make_api_unavailable */
 
 /**
@@ -536,7 +534,14 @@ jerry_api_convert_eval_completion_to_retval (jerry_api_value_t *retval_p, /**< o
   {
     jerry_api_convert_ecma_value_to_api_value (retval_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
 
-    ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
+    if (JERRY_CONTEXT (vm_is_aborting))
+    {
+      ret_code = JERRY_COMPLETION_CODE_ABORTED;
+    }
+    else
+    {
+      ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
+    }
   }
 
   return ret_code;
@@ -566,6 +571,30 @@ jerry_api_string_to_char_buffer (const jerry_api_string_t *string_p, /**< string
   return ecma_string_to_utf8_string (string_p, (lit_utf8_byte_t *) buffer_p, buffer_size);
 } /* jerry_api_string_to_char_buffer */
 
+/**
+ * Borrow a read-only pointer to the characters of a string without copying them
+ *
+ * Note:
+ *      the characters are available directly for strings created by jerry_api_create_external_string_sz
+ *      and for some strings of the engine, other strings should be copied by jerry_api_string_to_char_buffer;
+ *      the pointer is valid until the string is released.
+ *
+ * @return pointer to the CESU-8 characters of the string (the size is stored to out_size_p),
+ *         NULL - if the characters are not stored in a contiguous buffer.
+ */
+const jerry_api_char_t *
+jerry_api_string_get_char_buffer (const jerry_api_string_t *string_p, /**< string descriptor */
+                                  jerry_api_size_t *out_size_p) /**< out: size of the characters */
+{
+  jerry_assert_api_available ();
+
+  lit_utf8_size_t size;
+  const lit_utf8_byte_t *buffer_p = ecma_string_get_chars_buffer (string_p, &size);
+
+  *out_size_p = (jerry_api_size_t) size;
+  return (const jerry_api_char_t *) buffer_p;
+} /* jerry_api_string_get_char_buffer */
+
 /**
  * Acquire string pointer for usage outside of the engine
  * from string retrieved in extension routine call from engine.
@@ -652,6 +681,81 @@ jerry_api_release_value (jerry_api_value_t *value_p) /**< API value */
   }
 } /* jerry_api_release_value */
 
+/**
+ * Create a strong handle, which keeps an object alive until the handle is released
+ *
+ * Note:
+ *      unlike jerry_api_acquire_object, the handle does not use the reference counter of the object,
+ *      and the garbage collector finds it without scanning all objects
+ *
+ * @return the handle, which should be released with jerry_api_release_handle
+ */
+jerry_api_handle_t
+jerry_api_create_handle (jerry_api_object_t *object_p) /**< object */
+{
+  jerry_assert_api_available ();
+
+  return ecma_handle_table_create (object_p, false, (ecma_external_pointer_t) NULL, (ecma_external_pointer_t) NULL);
+} /* jerry_api_create_handle */
+
+/**
+ * Create a weak handle, which references an object without keeping it alive
+ *
+ * @return the handle, which should be released with jerry_api_release_handle
+ */
+jerry_api_handle_t
+jerry_api_create_weak_handle (jerry_api_object_t *object_p, /**< object */
+                              jerry_api_weak_handle_callback_t weak_cb_p, /**< callback, which is called
+                                                                           *   when the object is collected,
+                                                                           *   or NULL */
+                              void *user_p) /**< user pointer passed to the callback */
+{
+  jerry_assert_api_available ();
+
+  return ecma_handle_table_create (object_p,
+                                   true,
+                                   (ecma_external_pointer_t) weak_cb_p,
+                                   (ecma_external_pointer_t) user_p);
+} /* jerry_api_create_weak_handle */
+
+/**
+ * Get the object of a handle
+ *
+ * Note:
+ *       caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to the object,
+ *         NULL - if the object of the weak handle was collected.
+ */
+jerry_api_object_t *
+jerry_api_get_handle_object (jerry_api_handle_t handle) /**< handle */
+{
+  jerry_assert_api_available ();
+
+  ecma_object_t *object_p = ecma_handle_table_get (handle);
+
+  if (object_p != NULL)
+  {
+    ecma_ref_object (object_p);
+  }
+
+  return object_p;
+} /* jerry_api_get_handle_object */
+
+/**
+ * Release a handle
+ *
+ * Note:
+ *      the handles, which are not released, are released by jerry_cleanup (without calling the weak callbacks)
+ */
+void
+jerry_api_release_handle (jerry_api_handle_t handle) /**< handle */
+{
+  jerry_assert_api_available ();
+
+  ecma_handle_table_release (handle);
+} /* jerry_api_release_handle */
+
 /**
  * Create a string
  *
@@ -686,6 +790,30 @@ jerry_api_create_string_sz (const jerry_api_char_t *v, /**< string value */
                                          (lit_utf8_size_t) v_size);
 } /* jerry_api_create_string_sz */
 
+/**
+ * Create a string, which references the characters in a buffer of the caller without copying them
+ *
+ * Note:
+ *      the buffer must contain valid CESU-8 characters, and must be kept alive and unchanged
+ *      until the free callback (if not NULL) is called, which happens when the string is freed
+ *      (or before the function returns, if the engine does not need the buffer);
+ *      caller should release the string with jerry_api_release_string, just when the value becomes unnecessary.
+ *
+ * @return pointer to created string
+ */
+jerry_api_string_t *
+jerry_api_create_external_string_sz (const jerry_api_char_t *v, /**< string value */
+                                     jerry_api_size_t v_size, /**< string size */
+                                     jerry_api_string_free_callback_t free_cb) /**< callback, which releases
+                                                                                *   the buffer (can be NULL) */
+{
+  jerry_assert_api_available ();
+
+  return ecma_new_ecma_external_string ((const lit_utf8_byte_t *) v,
+                                        (lit_utf8_size_t) v_size,
+                                        (ecma_external_pointer_t) free_cb);
+} /* jerry_api_create_external_string_sz */
+
 /**
  * Create an object
  *
@@ -702,6 +830,26 @@ jerry_api_create_object (void)
   return ecma_op_create_object_object_noarg ();
 } /* jerry_api_create_object */
 
+/**
+ * Create a host object, the properties of which are provided by the property interceptors of the embedder
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ *      the interceptors are not copied, so they must remain valid while the object is alive.
+ *
+ * @return pointer to created host object
+ */
+jerry_api_object_t *
+jerry_api_create_host_object (const jerry_api_host_object_handlers_t *handlers_p) /**< property interceptors */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (handlers_p != NULL);
+
+  return ecma_op_create_host_object ((ecma_external_pointer_t) handlers_p);
+} /* jerry_api_create_host_object */
+
 /**
  * Create an array object
  *
@@ -728,6 +876,185 @@ jerry_api_create_array_object (jerry_api_size_t size) /* size of array */
   return obj_p;
 } /* jerry_api_create_array_object */
 
+/**
+ * Create an ArrayBuffer object, which stores its data on the engine's heap
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created ArrayBuffer object, the data of which is filled with zeros
+ */
+jerry_api_object_t *
+jerry_api_create_arraybuffer (jerry_api_size_t size) /**< size of the buffer, in bytes */
+{
+  jerry_assert_api_available ();
+
+  return ecma_arraybuffer_new_object ((uint32_t) size);
+} /* jerry_api_create_arraybuffer */
+
+/**
+ * Create an ArrayBuffer object, which references a buffer of the embedder without copying it
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ *      the buffer must remain valid until the free callback is called, which happens when the object
+ *      is garbage collected (or when the engine is cleaned up)
+ *
+ * @return pointer to created ArrayBuffer object
+ */
+jerry_api_object_t *
+jerry_api_create_external_arraybuffer (uint8_t *buffer_p, /**< buffer of the embedder */
+                                       jerry_api_size_t size, /**< size of the buffer, in bytes */
+                                       jerry_api_arraybuffer_free_callback_t free_cb) /**< callback, which releases
+                                                                                       *   the buffer (can be NULL) */
+{
+  jerry_assert_api_available ();
+
+  return ecma_arraybuffer_new_external_object (buffer_p, (uint32_t) size, (ecma_external_pointer_t) free_cb);
+} /* jerry_api_create_external_arraybuffer */
+
+/**
+ * Get the data of an ArrayBuffer, a typed array or a DataView object
+ *
+ * Note:
+ *      the returned pointer is valid while the object (or the ArrayBuffer viewed by it) is alive,
+ *      and it can be used to access the data without copying
+ *
+ * @return pointer to the first byte of the data (the size of the data, in bytes, is stored to size_p) - if the object
+ *         is an ArrayBuffer, a typed array or a DataView object,
+ *         NULL - otherwise.
+ */
+uint8_t *
+jerry_api_get_arraybuffer_pointer (const jerry_api_object_t *object_p, /**< object */
+                                   jerry_api_size_t *size_p) /**< out: size of the data, in bytes (can be NULL) */
+{
+  jerry_assert_api_available ();
+
+  ecma_object_t *obj_p = (ecma_object_t *) object_p;
+  ecma_value_t value = ecma_make_object_value (obj_p);
+  uint8_t *buffer_p;
+  uint32_t size;
+
+  if (ecma_is_arraybuffer (value))
+  {
+    buffer_p = ecma_arraybuffer_get_buffer (obj_p);
+    size = ecma_arraybuffer_get_length (obj_p);
+  }
+  else if (ecma_is_typedarray (value) || ecma_is_dataview (value))
+  {
+    buffer_p = ecma_typedarray_get_buffer (obj_p);
+    size = ecma_typedarray_get_length (obj_p) * ecma_typedarray_get_element_size (ecma_typedarray_get_type (obj_p));
+  }
+  else
+  {
+    return NULL;
+  }
+
+  if (size_p != NULL)
+  {
+    *size_p = (jerry_api_size_t) size;
+  }
+
+  return buffer_p;
+} /* jerry_api_get_arraybuffer_pointer */
+
+/**
+ * Create a WeakMap object
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ *      the map does not keep its keys alive: an entry is removed when its key is garbage collected,
+ *      and the value of an entry is kept alive only while both the map and the key are alive,
+ *      so the map can be used as a cache of data attached to objects
+ *
+ * @return pointer to created WeakMap object
+ */
+jerry_api_object_t *
+jerry_api_create_weakmap (void)
+{
+  jerry_assert_api_available ();
+
+  return ecma_op_create_weakmap_object ();
+} /* jerry_api_create_weakmap */
+
+/**
+ * Associate a value with a key object in a WeakMap
+ *
+ * @return true - if the value was stored,
+ *         false - if the object is not a WeakMap.
+ */
+bool
+jerry_api_weakmap_set (jerry_api_object_t *map_p, /**< WeakMap object */
+                       jerry_api_object_t *key_p, /**< key object */
+                       const jerry_api_value_t *value_p) /**< value */
+{
+  jerry_assert_api_available ();
+
+  if (!ecma_is_weakmap (ecma_make_object_value (map_p)))
+  {
+    return false;
+  }
+
+  ecma_value_t value;
+  jerry_api_convert_api_value_to_ecma_value (&value, value_p);
+
+  ecma_op_weakmap_set (map_p, key_p, value);
+
+  ecma_free_value (value);
+
+  return true;
+} /* jerry_api_weakmap_set */
+
+/**
+ * Get the value associated with a key object in a WeakMap
+ *
+ * Note:
+ *      if the value is a string or an object, it should be released with
+ *      jerry_api_release_value, just when it becomes unnecessary.
+ *
+ * @return true - if the key is in the map (the value is stored to out_value_p),
+ *         false - if the object is not a WeakMap, or the key is not in the map.
+ */
+bool
+jerry_api_weakmap_get (jerry_api_object_t *map_p, /**< WeakMap object */
+                       jerry_api_object_t *key_p, /**< key object */
+                       jerry_api_value_t *out_value_p) /**< out: value */
+{
+  jerry_assert_api_available ();
+
+  if (!ecma_is_weakmap (ecma_make_object_value (map_p))
+      || !ecma_op_weakmap_has (map_p, key_p))
+  {
+    return false;
+  }
+
+  ecma_value_t value = ecma_op_weakmap_get (map_p, key_p);
+
+  jerry_api_convert_ecma_value_to_api_value (out_value_p, value);
+
+  ecma_free_value (value);
+
+  return true;
+} /* jerry_api_weakmap_get */
+
+/**
+ * Remove a key object from a WeakMap
+ *
+ * @return true - if the key was in the map,
+ *         false - if the object is not a WeakMap, or the key is not in the map.
+ */
+bool
+jerry_api_weakmap_delete (jerry_api_object_t *map_p, /**< WeakMap object */
+                          jerry_api_object_t *key_p) /**< key object */
+{
+  jerry_assert_api_available ();
+
+  return (ecma_is_weakmap (ecma_make_object_value (map_p))
+          && ecma_op_weakmap_delete (map_p, key_p));
+} /* jerry_api_weakmap_delete */
+
 /**
  * Set value of field in the specified array object
  *
@@ -780,45 +1107,375 @@ jerry_api_get_array_index_value (jerry_api_object_t *array_obj_p, /* array objec
 } /* jerry_api_get_array_index_value */
 
 /**
- * Create an error object
+ * Element types of the bulk array transfer functions
+ */
+typedef enum
+{
+  JERRY_API_ARRAY_ELEMENT_DOUBLE, /**< double */
+  JERRY_API_ARRAY_ELEMENT_INT32, /**< int32_t */
+  JERRY_API_ARRAY_ELEMENT_VALUE /**< jerry_api_value_t */
+} jerry_api_array_element_type_t;
+
+/**
+ * Create an array object from a C array, building the elements directly
+ * without [[DefineOwnProperty]] calls
+ *
+ * @return pointer to created array object
+ */
+static jerry_api_object_t *
+jerry_api_create_array_from_elements (const void *elements_p, /**< C array of the elements */
+                                      jerry_api_length_t count, /**< number of the elements */
+                                      jerry_api_array_element_type_t element_type) /**< type of the elements */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (count == 0 || elements_p != NULL);
+
+  ecma_object_t *array_obj_p = ecma_op_new_array_object ((uint32_t) count);
+
+  for (uint32_t index = 0; index < count; index++)
+  {
+    ecma_value_t element_value;
+
+    switch (element_type)
+    {
+      case JERRY_API_ARRAY_ELEMENT_DOUBLE:
+      {
+        ecma_number_t *num_p = ecma_alloc_number ();
+        *num_p = (ecma_number_t) ((const double *) elements_p)[index];
+
+        element_value = ecma_make_number_value (num_p);
+        break;
+      }
+      case JERRY_API_ARRAY_ELEMENT_INT32:
+      {
+        ecma_number_t *num_p = ecma_alloc_number ();
+        *num_p = (ecma_number_t) ((const int32_t *) elements_p)[index];
+
+        element_value = ecma_make_number_value (num_p);
+        break;
+      }
+      default:
+      {
+        JERRY_ASSERT (element_type == JERRY_API_ARRAY_ELEMENT_VALUE);
+
+        jerry_api_convert_api_value_to_ecma_value (&element_value, ((const jerry_api_value_t *) elements_p) + index);
+
+        if (ecma_is_value_object (element_value))
+        {
+          /* Object values of properties are not referenced, see also: ecma_named_data_property_assign_value */
+          ecma_deref_object (ecma_get_object_from_value (element_value));
+        }
+        break;
+      }
+    }
+
+    ecma_op_array_object_init_element (array_obj_p, index, element_value);
+  }
+
+  return array_obj_p;
+} /* jerry_api_create_array_from_elements */
+
+/**
+ * Create an array object from a C array of doubles
  *
  * Note:
  *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
  *
- * @return pointer to created error object
+ * @return pointer to created array object
  */
 jerry_api_object_t *
-jerry_api_create_error (jerry_api_error_t error_type, /**< type of error */
-                        const jerry_api_char_t *message_p) /**< value of 'message' property
-                                                            *   of constructed error object */
+jerry_api_create_array_from_doubles (const double *elements_p, /**< elements */
+                                     jerry_api_length_t count) /**< number of the elements */
 {
-  return jerry_api_create_error_sz (error_type,
-                                    (lit_utf8_byte_t *) message_p,
-                                    lit_zt_utf8_string_size (message_p));
-} /* jerry_api_create_error */
+  return jerry_api_create_array_from_elements (elements_p, count, JERRY_API_ARRAY_ELEMENT_DOUBLE);
+} /* jerry_api_create_array_from_doubles */
 
 /**
- * Create an error object
+ * Create an array object from a C array of int32_t values
  *
  * Note:
  *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
  *
- * @return pointer to created error object
+ * @return pointer to created array object
  */
 jerry_api_object_t *
-jerry_api_create_error_sz (jerry_api_error_t error_type, /**< type of error */
-                           const jerry_api_char_t *message_p, /**< value of 'message' property
-                                                               *   of constructed error object */
-                           jerry_api_size_t message_size) /**< size of the message in bytes */
+jerry_api_create_array_from_int32s (const int32_t *elements_p, /**< elements */
+                                    jerry_api_length_t count) /**< number of the elements */
 {
-  jerry_assert_api_available ();
+  return jerry_api_create_array_from_elements (elements_p, count, JERRY_API_ARRAY_ELEMENT_INT32);
+} /* jerry_api_create_array_from_int32s */
 
-  ecma_standard_error_t standard_error_type = ECMA_ERROR_COMMON;
+/**
+ * Create an array object from a C array of API values
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ *      the values are not released, i.e. the caller still owns them.
+ *
+ * @return pointer to created array object
+ */
+jerry_api_object_t *
+jerry_api_create_array_from_values (const jerry_api_value_t *elements_p, /**< elements */
+                                    jerry_api_length_t count) /**< number of the elements */
+{
+  return jerry_api_create_array_from_elements (elements_p, count, JERRY_API_ARRAY_ELEMENT_VALUE);
+} /* jerry_api_create_array_from_values */
 
-  switch (error_type)
-  {
-    case JERRY_API_ERROR_COMMON:
-    {
+/**
+ * Store a number element to a C array
+ */
+static void
+jerry_api_store_array_number (void *elements_p, /**< C array of the elements */
+                              uint32_t index, /**< index in the C array */
+                              jerry_api_array_element_type_t element_type, /**< type of the elements */
+                              ecma_number_t num) /**< value of the element */
+{
+  switch (element_type)
+  {
+    case JERRY_API_ARRAY_ELEMENT_DOUBLE:
+    {
+      ((double *) elements_p)[index] = (double) num;
+      break;
+    }
+    case JERRY_API_ARRAY_ELEMENT_INT32:
+    {
+      ((int32_t *) elements_p)[index] = ecma_number_to_int32 (num);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (element_type == JERRY_API_ARRAY_ELEMENT_VALUE);
+
+      jerry_api_value_t *value_p = ((jerry_api_value_t *) elements_p) + index;
+
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
+      value_p->type = JERRY_API_DATA_TYPE_FLOAT32;
+      value_p->u.v_float32 = num;
+#elif CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+      value_p->type = JERRY_API_DATA_TYPE_FLOAT64;
+      value_p->u.v_float64 = num;
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
+      break;
+    }
+  }
+} /* jerry_api_store_array_number */
+
+/**
+ * Store an element to a C array
+ *
+ * Note:
+ *      elements, which are not numbers, are stored as NaN in double arrays and as 0 in int32_t arrays
+ */
+static void
+jerry_api_store_array_element (void *elements_p, /**< C array of the elements */
+                               uint32_t index, /**< index in the C array */
+                               jerry_api_array_element_type_t element_type, /**< type of the elements */
+                               ecma_value_t value) /**< value of the element */
+{
+  if (ecma_is_value_number (value))
+  {
+    jerry_api_store_array_number (elements_p, index, element_type, *ecma_get_number_from_value (value));
+  }
+  else if (element_type == JERRY_API_ARRAY_ELEMENT_VALUE)
+  {
+    jerry_api_convert_ecma_value_to_api_value (((jerry_api_value_t *) elements_p) + index, value);
+  }
+  else
+  {
+    jerry_api_store_array_number (elements_p, index, element_type, ecma_number_make_nan ());
+  }
+} /* jerry_api_store_array_element */
+
+/**
+ * Read a range of elements of an array or a typed array object into a C array
+ *
+ * @return number of elements stored to the C array
+ */
+static jerry_api_length_t
+jerry_api_get_array_elements (jerry_api_object_t *array_obj_p, /**< array or typed array object */
+                              jerry_api_length_t start, /**< index of the first element to read */
+                              void *elements_p, /**< out: C array of the elements */
+                              jerry_api_length_t count, /**< maximum number of elements to read */
+                              jerry_api_array_element_type_t element_type) /**< type of the elements */
+{
+  jerry_assert_api_available ();
+
+  ecma_object_type_t object_type = ecma_get_object_type (array_obj_p);
+  uint32_t length;
+
+  if (object_type == ECMA_OBJECT_TYPE_ARRAY)
+  {
+    length = ecma_op_array_object_get_length (array_obj_p);
+  }
+  else if (object_type == ECMA_OBJECT_TYPE_TYPEDARRAY)
+  {
+    length = ecma_typedarray_get_length (array_obj_p);
+  }
+  else
+  {
+    return 0;
+  }
+
+  if (start >= length)
+  {
+    return 0;
+  }
+
+  if (count > length - start)
+  {
+    count = length - start;
+  }
+
+  JERRY_ASSERT (count == 0 || elements_p != NULL);
+
+  if (object_type == ECMA_OBJECT_TYPE_TYPEDARRAY)
+  {
+    ecma_typedarray_type_t typedarray_type = ecma_typedarray_get_type (array_obj_p);
+    uint32_t element_size = ecma_typedarray_get_element_size (typedarray_type);
+    const uint8_t *src_p = ecma_typedarray_get_buffer (array_obj_p) + start * element_size;
+
+    for (uint32_t index = 0; index < count; index++, src_p += element_size)
+    {
+      jerry_api_store_array_number (elements_p,
+                                    index,
+                                    element_type,
+                                    ecma_typedarray_get_element (src_p, typedarray_type));
+    }
+
+    return count;
+  }
+
+  MEM_DEFINE_LOCAL_ARRAY (values_p, count, ecma_value_t);
+
+  if (ecma_op_array_object_get_own_elements (array_obj_p, start, count, values_p))
+  {
+    for (uint32_t index = 0; index < count; index++)
+    {
+      jerry_api_store_array_element (elements_p, index, element_type, values_p[index]);
+    }
+  }
+  else
+  {
+    /* Holes and accessor elements are read with [[Get]], elements whose getter throws are read as undefined. */
+    for (uint32_t index = 0; index < count; index++)
+    {
+      ecma_string_t *str_idx_p = ecma_new_ecma_string_from_uint32 (start + index);
+      ecma_value_t get_completion = ecma_op_object_get (array_obj_p, str_idx_p);
+      ecma_deref_ecma_string (str_idx_p);
+
+      if (ecma_is_value_error (get_completion))
+      {
+        ecma_free_value (get_completion);
+        get_completion = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+      }
+
+      jerry_api_store_array_element (elements_p, index, element_type, get_completion);
+
+      ecma_free_value (get_completion);
+    }
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (values_p);
+
+  return count;
+} /* jerry_api_get_array_elements */
+
+/**
+ * Read a range of elements of an array or a typed array object into a C array of doubles
+ *
+ * Note:
+ *      elements, which are not numbers, are stored as NaN
+ *
+ * @return number of elements stored to the C array (at most count),
+ *         0 - if the object is not an array or a typed array object, or start is not less than its length.
+ */
+jerry_api_length_t
+jerry_api_get_array_doubles (jerry_api_object_t *array_obj_p, /**< array or typed array object */
+                             jerry_api_length_t start, /**< index of the first element to read */
+                             double *elements_p, /**< out: elements */
+                             jerry_api_length_t count) /**< maximum number of elements to read */
+{
+  return jerry_api_get_array_elements (array_obj_p, start, elements_p, count, JERRY_API_ARRAY_ELEMENT_DOUBLE);
+} /* jerry_api_get_array_doubles */
+
+/**
+ * Read a range of elements of an array or a typed array object into a C array of int32_t values
+ *
+ * Note:
+ *      numbers are converted with ToInt32, elements, which are not numbers, are stored as 0
+ *
+ * @return number of elements stored to the C array (at most count),
+ *         0 - if the object is not an array or a typed array object, or start is not less than its length.
+ */
+jerry_api_length_t
+jerry_api_get_array_int32s (jerry_api_object_t *array_obj_p, /**< array or typed array object */
+                            jerry_api_length_t start, /**< index of the first element to read */
+                            int32_t *elements_p, /**< out: elements */
+                            jerry_api_length_t count) /**< maximum number of elements to read */
+{
+  return jerry_api_get_array_elements (array_obj_p, start, elements_p, count, JERRY_API_ARRAY_ELEMENT_INT32);
+} /* jerry_api_get_array_int32s */
+
+/**
+ * Read a range of elements of an array or a typed array object into a C array of API values
+ *
+ * Note:
+ *      the stored values should be released with jerry_api_release_value, just when they become unnecessary.
+ *
+ * @return number of elements stored to the C array (at most count),
+ *         0 - if the object is not an array or a typed array object, or start is not less than its length.
+ */
+jerry_api_length_t
+jerry_api_get_array_values (jerry_api_object_t *array_obj_p, /**< array or typed array object */
+                            jerry_api_length_t start, /**< index of the first element to read */
+                            jerry_api_value_t *elements_p, /**< out: elements */
+                            jerry_api_length_t count) /**< maximum number of elements to read */
+{
+  return jerry_api_get_array_elements (array_obj_p, start, elements_p, count, JERRY_API_ARRAY_ELEMENT_VALUE);
+} /* jerry_api_get_array_values */
+
+/**
+ * Create an error object
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created error object
+ */
+jerry_api_object_t *
+jerry_api_create_error (jerry_api_error_t error_type, /**< type of error */
+                        const jerry_api_char_t *message_p) /**< value of 'message' property
+                                                            *   of constructed error object */
+{
+  return jerry_api_create_error_sz (error_type,
+                                    (lit_utf8_byte_t *) message_p,
+                                    lit_zt_utf8_string_size (message_p));
+} /* jerry_api_create_error */
+
+/**
+ * Create an error object
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created error object
+ */
+jerry_api_object_t *
+jerry_api_create_error_sz (jerry_api_error_t error_type, /**< type of error */
+                           const jerry_api_char_t *message_p, /**< value of 'message' property
+                                                               *   of constructed error object */
+                           jerry_api_size_t message_size) /**< size of the message in bytes */
+{
+  jerry_assert_api_available ();
+
+  ecma_standard_error_t standard_error_type = ECMA_ERROR_COMMON;
+
+  switch (error_type)
+  {
+    case JERRY_API_ERROR_COMMON:
+    {
       standard_error_type = ECMA_ERROR_COMMON;
       break;
     }
@@ -984,137 +1641,403 @@ jerry_dispatch_object_free_callback (ecma_external_pointer_t freecb_p, /**< poin
 } /* jerry_dispatch_object_free_callback */
 
 /**
- * Check if the specified object is a function object.
+ * Dispatch call to the free callback of a string, which references a buffer of the embedder
  *
- * @return true - if the specified object is a function object,
- *         false - otherwise.
+ * Note:
+ *       the callback should not perform any requests to engine
  */
-bool
-jerry_api_is_function (const jerry_api_object_t *object_p) /**< an object */
+void
+jerry_dispatch_external_string_free_callback (ecma_external_pointer_t freecb_p, /**< pointer to free callback
+                                                                                 *   handler (can be NULL) */
+                                              const lit_utf8_byte_t *buffer_p, /**< the released buffer */
+                                              lit_utf8_size_t buffer_size) /**< size of the buffer */
 {
-  jerry_assert_api_available ();
+  if (freecb_p == (ecma_external_pointer_t) NULL)
+  {
+    return;
+  }
 
-  JERRY_ASSERT (object_p != NULL);
+  bool is_api_available = JERRY_CONTEXT (jerry_api_available);
+  jerry_make_api_unavailable ();
 
-  ecma_value_t obj_val = ecma_make_object_value (object_p);
+  ((jerry_api_string_free_callback_t) freecb_p) ((const jerry_api_char_t *) buffer_p,
+                                                 (jerry_api_size_t) buffer_size);
 
-  return ecma_op_is_callable (obj_val);
-} /* jerry_api_is_function */
+  JERRY_CONTEXT (jerry_api_available) = is_api_available;
+} /* jerry_dispatch_external_string_free_callback */
 
 /**
- * Check if the specified object is a constructor function object.
+ * Dispatch call to the free callback of an ArrayBuffer, which references a buffer of the embedder
  *
- * @return true - if the specified object is a function object that implements [[Construct]],
- *         false - otherwise.
+ * Note:
+ *       the callback should not perform any requests to engine
  */
-bool
-jerry_api_is_constructor (const jerry_api_object_t *object_p) /**< an object */
+void
+jerry_dispatch_arraybuffer_free_callback (ecma_external_pointer_t freecb_p, /**< pointer to free callback
+                                                                             *   handler (can be NULL) */
+                                          uint8_t *buffer_p, /**< the released buffer */
+                                          uint32_t buffer_size) /**< size of the buffer */
 {
-  jerry_assert_api_available ();
+  if (freecb_p == (ecma_external_pointer_t) NULL)
+  {
+    return;
+  }
 
-  JERRY_ASSERT (object_p != NULL);
+  bool is_api_available = JERRY_CONTEXT (jerry_api_available);
+  jerry_make_api_unavailable ();
 
-  ecma_value_t obj_val = ecma_make_object_value (object_p);
+  ((jerry_api_arraybuffer_free_callback_t) freecb_p) (buffer_p, (jerry_api_size_t) buffer_size);
 
-  return ecma_is_constructor (obj_val);
-} /* jerry_api_is_constructor */
+  JERRY_CONTEXT (jerry_api_available) = is_api_available;
+} /* jerry_dispatch_arraybuffer_free_callback */
 
 /**
- * Create field (named data property) in the specified object
+ * Dispatch call to the callback of a weak handle, whose object is collected
  *
- * @return true, if field was created successfully, i.e. upon the call:
- *                - there is no field with same name in the object;
- *                - the object is extensible;
+ * Note:
+ *       the callback should not perform any requests to engine
+ */
+void
+jerry_dispatch_weak_handle_callback (ecma_external_pointer_t weak_cb_p, /**< pointer to the weak callback */
+                                     uint32_t handle, /**< the weak handle */
+                                     ecma_external_pointer_t user_p) /**< user pointer of the handle */
+{
+  bool is_api_available = JERRY_CONTEXT (jerry_api_available);
+  jerry_make_api_unavailable ();
+
+  ((jerry_api_weak_handle_callback_t) weak_cb_p) ((jerry_api_handle_t) handle, (void *) user_p);
+
+  JERRY_CONTEXT (jerry_api_available) = is_api_available;
+} /* jerry_dispatch_weak_handle_callback */
+
+/**
+ * Dispatch call to the get interceptor of a host object
+ *
+ * @return true - if the host object has the property (the value is stored to out_value_p,
+ *                and it must be freed with ecma_free_value),
  *         false - otherwise.
  */
 bool
-jerry_api_add_object_field (jerry_api_object_t *object_p, /**< object to add field at */
-                            const jerry_api_char_t *field_name_p, /**< name of the field */
-                            jerry_api_size_t field_name_size, /**< size of field name in bytes */
-                            const jerry_api_value_t *field_value_p, /**< value of the field */
-                            bool is_writable) /**< flag indicating whether the created field should be writable */
+jerry_dispatch_host_object_get (ecma_object_t *object_p, /**< host object */
+                                ecma_external_pointer_t handlers_p, /**< property interceptors */
+                                ecma_string_t *name_p, /**< property name */
+                                ecma_value_t *out_value_p) /**< out: value of the property */
 {
   jerry_assert_api_available ();
 
-  bool is_successful = false;
+  const jerry_api_host_object_handlers_t *host_handlers_p = (const jerry_api_host_object_handlers_t *) handlers_p;
 
-  if (ecma_get_object_extensible (object_p))
+  if (host_handlers_p->get_p == NULL)
   {
-    ecma_string_t *field_name_str_p = ecma_new_ecma_string_from_utf8 ((lit_utf8_byte_t *) field_name_p,
-                                                                      (lit_utf8_size_t) field_name_size);
-
-    ecma_property_t *prop_p = ecma_op_object_get_own_property (object_p, field_name_str_p);
-
-    if (prop_p == NULL)
-    {
-      is_successful = true;
-
-      ecma_value_t value_to_put;
-      jerry_api_convert_api_value_to_ecma_value (&value_to_put, field_value_p);
-
-      prop_p = ecma_create_named_data_property (object_p,
-                                                field_name_str_p,
-                                                is_writable,
-                                                true,
-                                                true);
-      ecma_named_data_property_assign_value (object_p, prop_p, value_to_put);
+    return false;
+  }
 
-      ecma_free_value (value_to_put);
-    }
+  jerry_api_value_t api_value;
+  api_value.type = JERRY_API_DATA_TYPE_UNDEFINED;
 
-    ecma_deref_ecma_string (field_name_str_p);
+  if (!host_handlers_p->get_p (object_p, name_p, &api_value))
+  {
+    return false;
   }
 
-  return is_successful;
-} /* jerry_api_add_object_field */
+  jerry_api_convert_api_value_to_ecma_value (out_value_p, &api_value);
+  jerry_api_release_value (&api_value);
+
+  return true;
+} /* jerry_dispatch_host_object_get */
 
 /**
- * Delete field in the specified object
+ * Dispatch call to the set interceptor of a host object
  *
- * @return true, if field was deleted successfully, i.e. upon the call:
- *                - there is field with specified name in the object;
+ * @return true - if the host object stored the value,
  *         false - otherwise.
  */
 bool
-jerry_api_delete_object_field (jerry_api_object_t *object_p, /**< object to delete field at */
-                               const jerry_api_char_t *field_name_p, /**< name of the field */
-                               jerry_api_size_t field_name_size) /**< size of the field name in bytes */
+jerry_dispatch_host_object_set (ecma_object_t *object_p, /**< host object */
+                                ecma_external_pointer_t handlers_p, /**< property interceptors */
+                                ecma_string_t *name_p, /**< property name */
+                                ecma_value_t value) /**< value to store */
 {
   jerry_assert_api_available ();
 
-  bool is_successful = true;
-
-  ecma_string_t *field_name_str_p = ecma_new_ecma_string_from_utf8 ((lit_utf8_byte_t *) field_name_p,
-                                                                    (lit_utf8_size_t) field_name_size);
-
-  ecma_value_t delete_completion = ecma_op_object_delete (object_p,
-                                                          field_name_str_p,
-                                                          true);
+  const jerry_api_host_object_handlers_t *host_handlers_p = (const jerry_api_host_object_handlers_t *) handlers_p;
 
-  if (ecma_is_value_error (delete_completion))
+  if (host_handlers_p->set_p == NULL)
   {
-    is_successful = false;
+    return false;
   }
 
-  ecma_free_value (delete_completion);
+  jerry_api_value_t api_value;
+  jerry_api_convert_ecma_value_to_api_value (&api_value, value);
 
-  ecma_deref_ecma_string (field_name_str_p);
+  bool is_stored = host_handlers_p->set_p (object_p, name_p, &api_value);
 
-  return is_successful;
-} /* jerry_api_delete_object_field */
+  jerry_api_release_value (&api_value);
+
+  return is_stored;
+} /* jerry_dispatch_host_object_set */
 
 /**
- * Get value of field in the specified object
+ * Dispatch call to the has interceptor of a host object
  *
  * Note:
- *      if value was retrieved successfully, it should be freed
- *      with jerry_api_release_value just when it becomes unnecessary.
+ *      without a has interceptor the get interceptor is called, and the value is dropped
  *
- * @return true, if field value was retrieved successfully, i.e. upon the call:
- *                - there is field with specified name in the object;
+ * @return true - if the host object has the property,
  *         false - otherwise.
  */
-bool jerry_api_get_object_field_value (jerry_api_object_t *object_p, /**< object */
+bool
+jerry_dispatch_host_object_has (ecma_object_t *object_p, /**< host object */
+                                ecma_external_pointer_t handlers_p, /**< property interceptors */
+                                ecma_string_t *name_p) /**< property name */
+{
+  jerry_assert_api_available ();
+
+  const jerry_api_host_object_handlers_t *host_handlers_p = (const jerry_api_host_object_handlers_t *) handlers_p;
+
+  if (host_handlers_p->has_p != NULL)
+  {
+    return host_handlers_p->has_p (object_p, name_p);
+  }
+
+  ecma_value_t value;
+
+  if (jerry_dispatch_host_object_get (object_p, handlers_p, name_p, &value))
+  {
+    ecma_free_value (value);
+    return true;
+  }
+
+  return false;
+} /* jerry_dispatch_host_object_has */
+
+/**
+ * Dispatch call to the delete interceptor of a host object
+ *
+ * Note:
+ *      without a delete interceptor the properties of the host object can not be deleted
+ *
+ * @return true - if the property is deleted, or the host object does not have it,
+ *         false - if the property can not be deleted.
+ */
+bool
+jerry_dispatch_host_object_delete (ecma_object_t *object_p, /**< host object */
+                                   ecma_external_pointer_t handlers_p, /**< property interceptors */
+                                   ecma_string_t *name_p) /**< property name */
+{
+  jerry_assert_api_available ();
+
+  const jerry_api_host_object_handlers_t *host_handlers_p = (const jerry_api_host_object_handlers_t *) handlers_p;
+
+  if (host_handlers_p->delete_p != NULL)
+  {
+    return host_handlers_p->delete_p (object_p, name_p);
+  }
+
+  return !jerry_dispatch_host_object_has (object_p, handlers_p, name_p);
+} /* jerry_dispatch_host_object_delete */
+
+/**
+ * Dispatch call to the enumerate interceptor of a host object
+ */
+void
+jerry_dispatch_host_object_enumerate (ecma_object_t *object_p, /**< host object */
+                                      ecma_external_pointer_t handlers_p, /**< property interceptors */
+                                      ecma_collection_header_t *names_p) /**< collection to append the names to */
+{
+  jerry_assert_api_available ();
+
+  const jerry_api_host_object_handlers_t *host_handlers_p = (const jerry_api_host_object_handlers_t *) handlers_p;
+
+  if (host_handlers_p->enumerate_p == NULL)
+  {
+    return;
+  }
+
+  jerry_api_object_t *names_array_p = host_handlers_p->enumerate_p (object_p);
+
+  if (names_array_p == NULL)
+  {
+    return;
+  }
+
+  uint32_t names_count = 0;
+
+  if (ecma_get_object_type (names_array_p) == ECMA_OBJECT_TYPE_ARRAY)
+  {
+    names_count = ecma_op_array_object_get_length (names_array_p);
+  }
+
+  MEM_DEFINE_LOCAL_ARRAY (name_values_p, names_count, jerry_api_value_t);
+
+  names_count = jerry_api_get_array_values (names_array_p, 0, name_values_p, names_count);
+
+  for (uint32_t i = 0; i < names_count; i++)
+  {
+    ecma_string_t *name_p = NULL;
+
+    if (name_values_p[i].type == JERRY_API_DATA_TYPE_STRING)
+    {
+      name_p = ecma_copy_or_ref_ecma_string (name_values_p[i].u.v_string);
+    }
+    else if (name_values_p[i].type == JERRY_API_DATA_TYPE_FLOAT32
+             || name_values_p[i].type == JERRY_API_DATA_TYPE_FLOAT64
+             || name_values_p[i].type == JERRY_API_DATA_TYPE_UINT32)
+    {
+      ecma_value_t name_value;
+      jerry_api_convert_api_value_to_ecma_value (&name_value, name_values_p + i);
+
+      name_p = ecma_new_ecma_string_from_number (*ecma_get_number_from_value (name_value));
+
+      ecma_free_value (name_value);
+    }
+
+    if (name_p != NULL)
+    {
+      ecma_append_to_values_collection (names_p, ecma_make_string_value (name_p), true);
+      ecma_deref_ecma_string (name_p);
+    }
+
+    jerry_api_release_value (name_values_p + i);
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (name_values_p);
+
+  jerry_api_release_object (names_array_p);
+} /* jerry_dispatch_host_object_enumerate */
+
+/**
+ * Check if the specified object is a function object.
+ *
+ * @return true - if the specified object is a function object,
+ *         false - otherwise.
+ */
+bool
+jerry_api_is_function (const jerry_api_object_t *object_p) /**< an object */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (object_p != NULL);
+
+  ecma_value_t obj_val = ecma_make_object_value (object_p);
+
+  return ecma_op_is_callable (obj_val);
+} /* jerry_api_is_function */
+
+/**
+ * Check if the specified object is a constructor function object.
+ *
+ * @return true - if the specified object is a function object that implements [[Construct]],
+ *         false - otherwise.
+ */
+bool
+jerry_api_is_constructor (const jerry_api_object_t *object_p) /**< an object */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (object_p != NULL);
+
+  ecma_value_t obj_val = ecma_make_object_value (object_p);
+
+  return ecma_is_constructor (obj_val);
+} /* jerry_api_is_constructor */
+
+/**
+ * Create field (named data property) in the specified object
+ *
+ * @return true, if field was created successfully, i.e. upon the call:
+ *                - there is no field with same name in the object;
+ *                - the object is extensible;
+ *         false - otherwise.
+ */
+bool
+jerry_api_add_object_field (jerry_api_object_t *object_p, /**< object to add field at */
+                            const jerry_api_char_t *field_name_p, /**< name of the field */
+                            jerry_api_size_t field_name_size, /**< size of field name in bytes */
+                            const jerry_api_value_t *field_value_p, /**< value of the field */
+                            bool is_writable) /**< flag indicating whether the created field should be writable */
+{
+  jerry_assert_api_available ();
+
+  bool is_successful = false;
+
+  if (ecma_get_object_extensible (object_p))
+  {
+    ecma_string_t *field_name_str_p = ecma_new_ecma_string_from_utf8 ((lit_utf8_byte_t *) field_name_p,
+                                                                      (lit_utf8_size_t) field_name_size);
+
+    ecma_property_t *prop_p = ecma_op_object_get_own_property (object_p, field_name_str_p);
+
+    if (prop_p == NULL)
+    {
+      is_successful = true;
+
+      ecma_value_t value_to_put;
+      jerry_api_convert_api_value_to_ecma_value (&value_to_put, field_value_p);
+
+      prop_p = ecma_create_named_data_property (object_p,
+                                                field_name_str_p,
+                                                is_writable,
+                                                true,
+                                                true);
+      ecma_named_data_property_assign_value (object_p, prop_p, value_to_put);
+
+      ecma_free_value (value_to_put);
+    }
+
+    ecma_deref_ecma_string (field_name_str_p);
+  }
+
+  return is_successful;
+} /* jerry_api_add_object_field */
+
+/**
+ * Delete field in the specified object
+ *
+ * @return true, if field was deleted successfully, i.e. upon the call:
+ *                - there is field with specified name in the object;
+ *         false - otherwise.
+ */
+bool
+jerry_api_delete_object_field (jerry_api_object_t *object_p, /**< object to delete field at */
+                               const jerry_api_char_t *field_name_p, /**< name of the field */
+                               jerry_api_size_t field_name_size) /**< size of the field name in bytes */
+{
+  jerry_assert_api_available ();
+
+  bool is_successful = true;
+
+  ecma_string_t *field_name_str_p = ecma_new_ecma_string_from_utf8 ((lit_utf8_byte_t *) field_name_p,
+                                                                    (lit_utf8_size_t) field_name_size);
+
+  ecma_value_t delete_completion = ecma_op_object_delete (object_p,
+                                                          field_name_str_p,
+                                                          true);
+
+  if (ecma_is_value_error (delete_completion))
+  {
+    is_successful = false;
+  }
+
+  ecma_free_value (delete_completion);
+
+  ecma_deref_ecma_string (field_name_str_p);
+
+  return is_successful;
+} /* jerry_api_delete_object_field */
+
+/**
+ * Get value of field in the specified object
+ *
+ * Note:
+ *      if value was retrieved successfully, it should be freed
+ *      with jerry_api_release_value just when it becomes unnecessary.
+ *
+ * @return true, if field value was retrieved successfully, i.e. upon the call:
+ *                - there is field with specified name in the object;
+ *         false - otherwise.
+ */
+bool jerry_api_get_object_field_value (jerry_api_object_t *object_p, /**< object */
                                        const jerry_api_char_t *field_name_p, /**< field name */
                                        jerry_api_value_t *field_value_p) /**< out: field value */
 {
@@ -1395,6 +2318,8 @@ jerry_api_invoke_function (bool is_invoke_as_constructor, /**< true - invoke fun
 
   ecma_value_t call_completion;
 
+  vm_clear_abort ();
+
   if (is_invoke_as_constructor)
   {
     JERRY_ASSERT (this_arg_p == NULL);
@@ -1475,6 +2400,8 @@ jerry_api_construct_type_error (jerry_api_value_t *retval_p) /**< out: value wit
  *                - no unhandled exceptions were thrown in connection with the call;
  *         false - otherwise, 'retval_p' contains thrown exception:
  *                  if called object is not function object - a TypeError instance;
+ *                  if the call is aborted by the interrupt callback - undefined
+ *                  (see also: jerry_api_is_aborted);
  *                  else - exception, thrown during the function call.
  */
 bool
@@ -1546,70 +2473,336 @@ jerry_api_construct_object (jerry_api_object_t *function_object_p, /**< function
 } /* jerry_api_construct_object */
 
 /**
- * Get global object
+ * Add a function call to the end of the job queue
  *
  * Note:
- *       caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *      the queued jobs are called by jerry_api_run_jobs; the function, the 'this' binding
+ *      and the arguments are kept alive until the job is called;
+ *      a heap snapshot cannot be saved while jobs are queued
  *
- * @return pointer to the global object
+ * @return true - if the job is queued,
+ *         false - if the specified object is not a function object (see also jerry_api_is_function).
  */
-jerry_api_object_t *
-jerry_api_get_global (void)
+bool
+jerry_api_enqueue_job (jerry_api_object_t *function_object_p, /**< function object to call */
+                       jerry_api_object_t *this_arg_p, /**< object for 'this' binding
+                                                        *   or NULL (set 'this' binding to the global object) */
+                       const jerry_api_value_t args_p[], /**< function's call arguments
+                                                          *   (NULL if arguments number is zero) */
+                       uint16_t args_count) /**< number of the arguments */
 {
   jerry_assert_api_available ();
 
-  return ecma_builtin_get (ECMA_BUILTIN_ID_GLOBAL);
-} /* jerry_api_get_global */
-
-/**
- * Perform eval
- *
- * Note:
- *      If current code is executed on top of interpreter, using is_direct argument,
- *      caller can enable direct eval mode that is equivalent to calling eval from
- *      within of current JS execution context.
- *
- * @return completion status
- */
-jerry_completion_code_t
-jerry_api_eval (const jerry_api_char_t *source_p, /**< source code */
-                size_t source_size, /**< length of source code */
-                bool is_direct, /**< perform eval invocation in direct mode */
-                bool is_strict, /**< perform eval as it is called from strict mode code */
-                jerry_api_value_t *retval_p) /**< out: returned value */
-{
-  jerry_assert_api_available ();
+  JERRY_ASSERT (args_count == 0 || args_p != NULL);
 
-  jerry_completion_code_t status;
+  if (!jerry_api_is_function (function_object_p))
+  {
+    return false;
+  }
 
-  ecma_value_t completion = ecma_op_eval_chars_buffer ((const lit_utf8_byte_t *) source_p,
-                                                       source_size,
-                                                       is_direct,
-                                                       is_strict);
+  size_t job_size = sizeof (jerry_job_t) + args_count * sizeof (ecma_value_t);
+  jerry_job_t *job_p = (jerry_job_t *) mem_heap_alloc_block (job_size, MEM_HEAP_ALLOC_SHORT_TERM);
+  ecma_value_t *arguments_list_p = (ecma_value_t *) (job_p + 1);
 
-  status = jerry_api_convert_eval_completion_to_retval (retval_p, completion);
+  job_p->next_p = NULL;
+  job_p->function = ecma_copy_value (ecma_make_object_value (function_object_p), true);
 
-  ecma_free_value (completion);
+  if (this_arg_p == NULL)
+  {
+    job_p->this_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+  else
+  {
+    job_p->this_value = ecma_copy_value (ecma_make_object_value (this_arg_p), true);
+  }
 
-  return status;
-} /* jerry_api_eval */
+  job_p->args_count = args_count;
 
-/**
- * Perform GC
- */
-void
-jerry_api_gc (void)
-{
-  jerry_assert_api_available ();
+  for (uint32_t i = 0; i < args_count; ++i)
+  {
+    jerry_api_convert_api_value_to_ecma_value (arguments_list_p + i, args_p + i);
+  }
+
+  if (JERRY_CONTEXT (jerry_job_queue_last_p) == NULL)
+  {
+    JERRY_CONTEXT (jerry_job_queue_first_p) = job_p;
+  }
+  else
+  {
+    JERRY_CONTEXT (jerry_job_queue_last_p)->next_p = job_p;
+  }
+
+  JERRY_CONTEXT (jerry_job_queue_last_p) = job_p;
+
+  return true;
+} /* jerry_api_enqueue_job */
+
+/**
+ * Remove the first job from the job queue
+ *
+ * @return pointer to the job, which must be freed with jerry_free_job,
+ *         NULL - if the queue is empty.
+ */
+static jerry_job_t *
+jerry_dequeue_job (void)
+{
+  jerry_job_t *job_p = JERRY_CONTEXT (jerry_job_queue_first_p);
+
+  if (job_p != NULL)
+  {
+    JERRY_CONTEXT (jerry_job_queue_first_p) = job_p->next_p;
+
+    if (job_p->next_p == NULL)
+    {
+      JERRY_CONTEXT (jerry_job_queue_last_p) = NULL;
+    }
+  }
+
+  return job_p;
+} /* jerry_dequeue_job */
+
+/**
+ * Release the values referenced by a job and free the job
+ */
+static void
+jerry_free_job (jerry_job_t *job_p) /**< job */
+{
+  ecma_value_t *arguments_list_p = (ecma_value_t *) (job_p + 1);
+
+  for (uint32_t i = 0; i < job_p->args_count; ++i)
+  {
+    ecma_free_value (arguments_list_p[i]);
+  }
+
+  ecma_free_value (job_p->this_value);
+  ecma_free_value (job_p->function);
+
+  mem_heap_free_block (job_p);
+} /* jerry_free_job */
+
+/**
+ * Call the queued jobs until the job queue becomes empty
+ *
+ * Note:
+ *      the jobs are called directly by the engine in their queuing order, without converting their values
+ *      again; the jobs queued by the running jobs are called as well.
+ *
+ *      an exception thrown by a job does not stop the others, it is passed to the error handler.
+ *
+ *      if a job is aborted by the interrupt callback, the error handler is not called, and the remaining
+ *      jobs are left in the queue (see also: jerry_api_is_aborted).
+ *
+ *      the jobs are called in batches of the specified size (0 - in one batch), and the garbage collector
+ *      is given an opportunity to run after each batch (see also: ecma_try_to_give_back_some_memory).
+ *
+ * @return number of the jobs that threw an exception
+ */
+jerry_api_length_t
+jerry_api_run_jobs (jerry_api_length_t batch_size, /**< maximum number of jobs called without giving
+                                                    *   opportunity to the garbage collector, or 0 */
+                    jerry_api_job_error_handler_t error_handler_p) /**< error handler or NULL
+                                                                    *   (to ignore the exceptions) */
+{
+  jerry_assert_api_available ();
+
+  jerry_api_length_t failed_jobs_count = 0;
+  bool is_aborted = false;
+
+  while (!is_aborted && JERRY_CONTEXT (jerry_job_queue_first_p) != NULL)
+  {
+    jerry_api_length_t jobs_count = 0;
+    jerry_job_t *job_p;
+
+    while ((batch_size == 0 || jobs_count < batch_size)
+           && (job_p = jerry_dequeue_job ()) != NULL)
+    {
+      vm_clear_abort ();
+
+      ecma_value_t call_completion = ecma_op_function_call (ecma_get_object_from_value (job_p->function),
+                                                            job_p->this_value,
+                                                            (ecma_value_t *) (job_p + 1),
+                                                            job_p->args_count);
+
+      if (ecma_is_value_error (call_completion) && JERRY_CONTEXT (vm_is_aborting))
+      {
+        /* The abort is not an exception of the job, and it stops the remaining jobs as well. */
+        is_aborted = true;
+      }
+      else if (ecma_is_value_error (call_completion))
+      {
+        failed_jobs_count++;
+
+        if (error_handler_p != NULL)
+        {
+          jerry_api_value_t error_value;
+          jerry_api_convert_ecma_value_to_api_value (&error_value, call_completion);
+
+          error_handler_p (&error_value);
+
+          jerry_api_release_value (&error_value);
+        }
+      }
+
+      ecma_free_value (call_completion);
+      jerry_free_job (job_p);
+
+      if (is_aborted)
+      {
+        break;
+      }
+
+      jobs_count++;
+    }
+
+    ecma_try_to_give_back_some_memory (MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_LOW);
+  }
+
+  return failed_jobs_count;
+} /* jerry_api_run_jobs */
+
+/**
+ * Get global object
+ *
+ * Note:
+ *       caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to the global object
+ */
+jerry_api_object_t *
+jerry_api_get_global (void)
+{
+  jerry_assert_api_available ();
+
+  return ecma_builtin_get (ECMA_BUILTIN_ID_GLOBAL);
+} /* jerry_api_get_global */
+
+/**
+ * Perform eval
+ *
+ * Note:
+ *      If current code is executed on top of interpreter, using is_direct argument,
+ *      caller can enable direct eval mode that is equivalent to calling eval from
+ *      within of current JS execution context.
+ *
+ * @return completion status
+ */
+jerry_completion_code_t
+jerry_api_eval (const jerry_api_char_t *source_p, /**< source code */
+                size_t source_size, /**< length of source code */
+                bool is_direct, /**< perform eval invocation in direct mode */
+                bool is_strict, /**< perform eval as it is called from strict mode code */
+                jerry_api_value_t *retval_p) /**< out: returned value */
+{
+  jerry_assert_api_available ();
+
+  jerry_completion_code_t status;
+
+  ecma_value_t completion = ecma_op_eval_chars_buffer ((const lit_utf8_byte_t *) source_p,
+                                                       source_size,
+                                                       is_direct,
+                                                       is_strict);
+
+  status = jerry_api_convert_eval_completion_to_retval (retval_p, completion);
+
+  ecma_free_value (completion);
+
+  return status;
+} /* jerry_api_eval */
+
+/**
+ * Perform GC
+ */
+void
+jerry_api_gc (void)
+{
+  jerry_assert_api_available ();
 
   ecma_gc_run ();
 } /* jerry_api_gc */
 
 /**
- * Jerry engine initialization
+ * Register the interrupt callback
+ *
+ * Note:
+ *      the callback is called after every 'budget' safepoints of the execution (calls and backward
+ *      branches), and at the next safepoint after jerry_api_request_interrupt is called.
+ *
+ *      if the callback aborts the execution, the running script can not catch the abort, and the
+ *      API function, which started the execution, reports JERRY_COMPLETION_CODE_ABORTED or an
+ *      exception with undefined value.
  */
 void
-jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
+jerry_api_set_interrupt_callback (jerry_api_interrupt_callback_t callback_p, /**< interrupt callback, or NULL
+                                                                              *   (to remove the callback) */
+                                  void *user_p, /**< user pointer passed to the callback */
+                                  uint32_t budget) /**< number of safepoints between two calls of the callback,
+                                                    *   or 0 (to call it only on request) */
+{
+  jerry_assert_api_available ();
+
+  JERRY_CONTEXT (vm_interrupt_callback) = callback_p;
+  JERRY_CONTEXT (vm_interrupt_user_p) = user_p;
+  JERRY_CONTEXT (vm_interrupt_budget) = (callback_p != NULL) ? budget : 0;
+  JERRY_CONTEXT (vm_interrupt_countdown) = JERRY_CONTEXT (vm_interrupt_budget);
+} /* jerry_api_set_interrupt_callback */
+
+/**
+ * Request a call of the interrupt callback at the next safepoint of the execution
+ *
+ * Note:
+ *      the function only sets a flag of the current engine context, so it can be called
+ *      from a signal handler as well; when multiple engine contexts are enabled, the context
+ *      of another thread is interrupted by jerry_request_context_interrupt
+ */
+void
+jerry_api_request_interrupt (void)
+{
+  JERRY_CONTEXT (vm_interrupt_requested) = 1;
+} /* jerry_api_request_interrupt */
+
+/**
+ * Check whether the interrupt callback aborted the last execution started by the embedder
+ *
+ * Note:
+ *      the abort is reported as a failure with undefined value by jerry_api_call_function,
+ *      jerry_api_construct_object and jerry_api_run_jobs, and this function distinguishes it
+ *      from an exception (e.g. 'throw undefined')
+ *
+ * @return true - if the execution was aborted,
+ *         false - otherwise.
+ */
+bool
+jerry_api_is_aborted (void)
+{
+  jerry_assert_api_available ();
+
+  return JERRY_CONTEXT (vm_is_aborting);
+} /* jerry_api_is_aborted */
+
+/**
+ * Dispatch call to the interrupt callback
+ *
+ * @return true - if the callback aborts the execution,
+ *         false - otherwise.
+ */
+bool
+jerry_dispatch_interrupt_callback (void)
+{
+  jerry_api_interrupt_callback_t callback_p = JERRY_CONTEXT (vm_interrupt_callback);
+
+  if (callback_p == NULL)
+  {
+    return false;
+  }
+
+  return callback_p (JERRY_CONTEXT (vm_interrupt_user_p)) == JERRY_API_INTERRUPT_ABORT;
+} /* jerry_dispatch_interrupt_callback */
+
+/**
+ * Check the run-time configuration flags and make the API available
+ */
+static void
+jerry_init_flags (jerry_flag_t flags) /**< combination of Jerry flags */
 {
   if (flags & (JERRY_FLAG_ENABLE_LOG))
   {
@@ -1634,9 +2827,20 @@ jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
 #endif /* MEM_STATS */
   }
 
-  jerry_flags = flags;
+  JERRY_CONTEXT (jerry_flags) = flags;
 
   jerry_make_api_available ();
+} /* jerry_init_flags */
+
+/**
+ * Jerry engine initialization
+ */
+void
+jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
+{
+  jcontext_init ();
+
+  jerry_init_flags (flags);
 
   mem_init ();
   lit_init ();
@@ -1651,14 +2855,54 @@ jerry_cleanup (void)
 {
   jerry_assert_api_available ();
 
-  bool is_show_mem_stats = ((jerry_flags & JERRY_FLAG_MEM_STATS) != 0);
+  bool is_show_mem_stats = ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_MEM_STATS) != 0);
+
+  jerry_job_t *job_p;
+
+  while ((job_p = jerry_dequeue_job ()) != NULL)
+  {
+    jerry_free_job (job_p);
+  }
 
   ecma_finalize ();
   lit_finalize ();
   vm_finalize ();
+  ecma_free_pinned_bytecode ();
+
   mem_finalize (is_show_mem_stats);
 } /* jerry_cleanup */
 
+#ifdef JERRY_ENABLE_MULTIPLE_CONTEXTS
+/**
+ * Get the size of an engine context
+ *
+ * Note:
+ *      an engine instance is created by selecting a buffer of this size
+ *      (aligned to JERRY_CONTEXT_ALIGNMENT) as the current context of the port,
+ *      and calling jerry_init; the instances are independent of each other
+ *
+ * @return size of the context in bytes
+ */
+size_t
+jerry_get_context_size (void)
+{
+  return sizeof (jerry_context_t);
+} /* jerry_get_context_size */
+
+/**
+ * Request a call of the interrupt callback at the next safepoint of the execution in an engine context
+ *
+ * Note:
+ *      the function only sets a flag of the context, so it can be called from a signal handler
+ *      or from a thread, which does not run the engine instance of the context
+ */
+void
+jerry_request_context_interrupt (jerry_context_t *context_p) /**< engine context */
+{
+  context_p->vm_interrupt_requested = 1;
+} /* jerry_request_context_interrupt */
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
 /**
  * Get Jerry configured memory limits
  */
@@ -1680,7 +2924,7 @@ jerry_get_memory_limits (size_t *out_data_bss_brk_limit_p, /**< out: Jerry's max
 bool
 jerry_is_abort_on_fail (void)
 {
-  return ((jerry_flags & JERRY_FLAG_ABORT_ON_FAIL) != 0);
+  return ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_ABORT_ON_FAIL) != 0);
 } /* jerry_is_abort_on_fail */
 
 /**
@@ -1706,7 +2950,7 @@ jerry_parse (const jerry_api_char_t *source_p, /**< script source */
 {
   jerry_assert_api_available ();
 
-  int is_show_instructions = ((jerry_flags & JERRY_FLAG_SHOW_OPCODES) != 0);
+  int is_show_instructions = ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_SHOW_OPCODES) != 0);
 
   parser_set_show_instrs (is_show_instructions);
 
@@ -1715,6 +2959,7 @@ jerry_parse (const jerry_api_char_t *source_p, /**< script source */
 
   parse_status = parser_parse_script (source_p,
                                       source_size,
+                                      (JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_LAZY_FUNCTION_COMPILATION) != 0,
                                       &bytecode_data_p);
 
   if (parse_status != JSP_STATUS_OK)
@@ -1725,20 +2970,50 @@ jerry_parse (const jerry_api_char_t *source_p, /**< script source */
   }
 
 #ifdef MEM_STATS
-  if (jerry_flags & JERRY_FLAG_MEM_STATS_SEPARATE)
+  if (JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_MEM_STATS_SEPARATE)
   {
     mem_stats_print ();
     mem_stats_reset_peak ();
   }
 #endif /* MEM_STATS */
 
-  bool is_show_mem_stats_per_instruction = ((jerry_flags & JERRY_FLAG_MEM_STATS_PER_OPCODE) != 0);
+  bool is_show_mem_stats_per_instruction = ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_MEM_STATS_PER_OPCODE) != 0);
 
   vm_init (bytecode_data_p, is_show_mem_stats_per_instruction);
 
   return true;
 } /* jerry_parse */
 
+/**
+ * Pin the reference counters of the code parsed by jerry_parse
+ *
+ * The reference counters of the global code and its nested functions are pinned (lazily
+ * compiled functions are compiled in advance), so calls and closures no longer write them
+ * until jerry_cleanup releases the code.
+ *
+ * Note:
+ *      this is not a shared code space: the code stays in the heap of the engine, mixed with
+ *      the mutable objects, so other contexts can not reference it, and processes forked after
+ *      this call only keep the pages shared, which contain no mutable objects;
+ *      an engine with pinned code cannot be saved to a heap snapshot
+ *
+ * @return true - if the code parsed by jerry_parse is pinned,
+ *         false - if there is no parsed code.
+ */
+bool
+jerry_pin_parsed_code (void)
+{
+  jerry_assert_api_available ();
+
+  if (JERRY_CONTEXT (vm_program_p) == NULL)
+  {
+    return false;
+  }
+
+  ecma_bytecode_pin (JERRY_CONTEXT (vm_program_p));
+  return true;
+} /* jerry_pin_parsed_code */
+
 /**
  * Run Jerry in specified run context
  *
@@ -1798,31 +3073,6 @@ jerry_register_external_magic_strings (const jerry_api_char_ptr_t *ex_str_items,
 
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
 
-/*
- * Tells whether snapshot taking is in progress.
- */
-bool snapshot_report_byte_code_compilation = false;
-
-/*
- * Mapping snapshot to offset.
- */
-typedef struct
-{
-  mem_cpointer_t next_cp;
-  mem_cpointer_t compiled_code_cp;
-  uint16_t offset;
-} compiled_code_map_entry_t;
-
-/*
- * Variables required to take a snapshot.
- */
-static size_t snapshot_buffer_write_offset;
-static size_t snapshot_last_compiled_code_offset;
-static bool snapshot_error_occured;
-static uint8_t *snapshot_buffer_p;
-static size_t snapshot_buffer_size;
-static compiled_code_map_entry_t *snapshot_map_entries_p;
-
 /**
  * Snapshot callback for byte codes.
  */
@@ -1831,99 +3081,116 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< compiled
                             const uint8_t *regexp_pattern, /**< regular expression pattern */
                             uint32_t size) /**< compiled code or regular expression size */
 {
-  if (snapshot_error_occured)
+  if (JERRY_CONTEXT (snapshot_error_occured))
   {
     return;
   }
 
-  JERRY_ASSERT ((snapshot_buffer_write_offset & (MEM_ALIGNMENT - 1)) == 0);
+  JERRY_ASSERT ((JERRY_CONTEXT (snapshot_buffer_write_offset) & (MEM_ALIGNMENT - 1)) == 0);
 
-  if ((snapshot_buffer_write_offset >> MEM_ALIGNMENT_LOG) > 0xffffu)
+  if ((JERRY_CONTEXT (snapshot_buffer_write_offset) >> MEM_ALIGNMENT_LOG) > 0xffffu
+      || JERRY_CONTEXT (snapshot_compiled_codes_num) >= UINT16_MAX)
   {
-    snapshot_error_occured = true;
+    JERRY_CONTEXT (snapshot_error_occured) = true;
     return;
   }
 
-  snapshot_last_compiled_code_offset = snapshot_buffer_write_offset;
+  JERRY_CONTEXT (snapshot_last_compiled_code_offset) = JERRY_CONTEXT (snapshot_buffer_write_offset);
 
   compiled_code_map_entry_t *new_entry = (compiled_code_map_entry_t *) mem_pools_alloc ();
 
   if (new_entry == NULL)
   {
-    snapshot_error_occured = true;
+    JERRY_CONTEXT (snapshot_error_occured) = true;
     return;
   }
 
-  ECMA_SET_POINTER (new_entry->next_cp, snapshot_map_entries_p);
+  ECMA_SET_POINTER (new_entry->next_cp, JERRY_CONTEXT (snapshot_map_entries_p));
   ECMA_SET_POINTER (new_entry->compiled_code_cp, compiled_code_p);
 
-  new_entry->offset = (uint16_t) (snapshot_buffer_write_offset >> MEM_ALIGNMENT_LOG);
-  snapshot_map_entries_p = new_entry;
-
-  const void *data_p = (const void *) compiled_code_p;
+  new_entry->offset = (uint16_t) (JERRY_CONTEXT (snapshot_buffer_write_offset) >> MEM_ALIGNMENT_LOG);
+  new_entry->index = (uint16_t) JERRY_CONTEXT (snapshot_compiled_codes_num)++;
+  JERRY_CONTEXT (snapshot_map_entries_p) = new_entry;
 
   if (!(compiled_code_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
   {
-    size += (uint32_t) sizeof (uint16_t);
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
+    /* The RegExp byte code is followed by the pattern, whose size is stored in place of the pattern pointer,
+     * so longer patterns than the range of a compressed pointer cannot be saved. */
+    re_compiled_code_t re_header = *(re_compiled_code_t *) compiled_code_p;
+    uint32_t entry_size = re_header.size + size;
+
+    re_header.pattern_cp = (mem_cpointer_t) size;
+
+    if (re_header.pattern_cp != size
+        || !jrt_write_to_buffer_by_offset (JERRY_CONTEXT (snapshot_buffer_p),
+                                        JERRY_CONTEXT (snapshot_buffer_size),
+                                        &JERRY_CONTEXT (snapshot_buffer_write_offset),
+                                        &entry_size,
+                                        sizeof (uint32_t))
+        || !jrt_write_to_buffer_by_offset (JERRY_CONTEXT (snapshot_buffer_p),
+                                           JERRY_CONTEXT (snapshot_buffer_size),
+                                           &JERRY_CONTEXT (snapshot_buffer_write_offset),
+                                           &re_header,
+                                           sizeof (re_compiled_code_t))
+        || !jrt_write_to_buffer_by_offset (JERRY_CONTEXT (snapshot_buffer_p),
+                                           JERRY_CONTEXT (snapshot_buffer_size),
+                                           &JERRY_CONTEXT (snapshot_buffer_write_offset),
+                                           ((re_compiled_code_t *) compiled_code_p) + 1,
+                                           re_header.size - sizeof (re_compiled_code_t))
+        || !jrt_write_to_buffer_by_offset (JERRY_CONTEXT (snapshot_buffer_p),
+                                           JERRY_CONTEXT (snapshot_buffer_size),
+                                           &JERRY_CONTEXT (snapshot_buffer_write_offset),
+                                           regexp_pattern,
+                                           size))
+    {
+      JERRY_CONTEXT (snapshot_error_occured) = true;
+      return;
+    }
+#else /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
+    JERRY_UNREACHABLE ();
+#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
   }
   else
   {
     JERRY_ASSERT (regexp_pattern == NULL);
-  }
-
-  if (!jrt_write_to_buffer_by_offset (snapshot_buffer_p,
-                                      snapshot_buffer_size,
-                                      &snapshot_buffer_write_offset,
-                                      &size,
-                                      sizeof (uint32_t)))
-  {
-    snapshot_error_occured = true;
-    return;
-  }
-
-  if (!(compiled_code_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
-  {
-    size -= (uint32_t) sizeof (uint16_t);
 
-    if (!jrt_write_to_buffer_by_offset (snapshot_buffer_p,
-                                        snapshot_buffer_size,
-                                        &snapshot_buffer_write_offset,
-                                        &compiled_code_p->status_flags,
-                                        sizeof (uint16_t)))
+    if (!jrt_write_to_buffer_by_offset (JERRY_CONTEXT (snapshot_buffer_p),
+                                        JERRY_CONTEXT (snapshot_buffer_size),
+                                        &JERRY_CONTEXT (snapshot_buffer_write_offset),
+                                        &size,
+                                        sizeof (uint32_t))
+        || !jrt_write_to_buffer_by_offset (JERRY_CONTEXT (snapshot_buffer_p),
+                                           JERRY_CONTEXT (snapshot_buffer_size),
+                                           &JERRY_CONTEXT (snapshot_buffer_write_offset),
+                                           compiled_code_p,
+                                           size))
     {
-      snapshot_error_occured = true;
+      JERRY_CONTEXT (snapshot_error_occured) = true;
       return;
     }
-
-    data_p = regexp_pattern;
   }
 
-  if (!jrt_write_to_buffer_by_offset (snapshot_buffer_p,
-                                      snapshot_buffer_size,
-                                      &snapshot_buffer_write_offset,
-                                      data_p,
-                                      size))
-  {
-    snapshot_error_occured = true;
-    return;
-  }
-
-  snapshot_buffer_write_offset = JERRY_ALIGNUP (snapshot_buffer_write_offset, MEM_ALIGNMENT);
+  JERRY_CONTEXT (snapshot_buffer_write_offset) = JERRY_ALIGNUP (JERRY_CONTEXT (snapshot_buffer_write_offset),
+                                                                MEM_ALIGNMENT);
 
-  if (snapshot_buffer_write_offset > snapshot_buffer_size)
+  if (JERRY_CONTEXT (snapshot_buffer_write_offset) > JERRY_CONTEXT (snapshot_buffer_size))
   {
-    snapshot_error_occured = true;
+    JERRY_CONTEXT (snapshot_error_occured) = true;
     return;
   }
 } /* snapshot_add_compiled_code */
 
 /**
- * Set the uint16_t offsets in the code area.
+ * Replace the literal and compiled code references of the code area with literal map indices.
+ *
+ * Index 0 is the NULL literal, followed by the literals and the compiled code of the snapshot.
  */
 static void
 jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
                             uint32_t size, /**< buffer size */
-                            lit_mem_to_snapshot_id_map_entry_t *lit_map_p) /**< literal map */
+                            lit_mem_to_snapshot_id_map_entry_t *lit_map_p, /**< literal map */
+                            uint32_t literals_num) /**< number of literals */
 {
   JERRY_ASSERT (size > 0);
 
@@ -1964,22 +3231,18 @@ jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
 
       for (uint32_t i = 0; i < const_literal_end; i++)
       {
-        lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
-
         if (literal_start_p[i].u.packed_value != MEM_CP_NULL)
         {
-          while (current_p->literal_id.u.packed_value != literal_start_p[i].u.packed_value)
-          {
-            current_p++;
-          }
+          uint32_t literal_index = lit_snapshot_find_literal_index (lit_map_p, literals_num, literal_start_p[i]);
 
-          literal_start_p[i].u.packed_value = (uint16_t) current_p->literal_offset;
+          /* Zero is reserved for the NULL literal. */
+          literal_start_p[i].u.packed_value = (uint16_t) (literal_index + 1);
         }
       }
 
       for (uint32_t i = const_literal_end; i < literal_end; i++)
       {
-        compiled_code_map_entry_t *current_p = snapshot_map_entries_p;
+        compiled_code_map_entry_t *current_p = JERRY_CONTEXT (snapshot_map_entries_p);
 
         while (current_p->compiled_code_cp != literal_start_p[i].u.value.base_cp)
         {
@@ -1987,7 +3250,7 @@ jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
                                                  current_p->next_cp);
         }
 
-        literal_start_p[i].u.packed_value = (uint16_t) current_p->offset;
+        literal_start_p[i].u.packed_value = (uint16_t) (1 + literals_num + current_p->index);
       }
     }
 
@@ -2022,41 +3285,43 @@ jerry_parse_and_save_snapshot (const jerry_api_char_t *source_p, /**< script sou
   jsp_status_t parse_status;
   ecma_compiled_code_t *bytecode_data_p;
 
-  snapshot_buffer_write_offset = 0;
-  snapshot_last_compiled_code_offset = 0;
-  snapshot_error_occured = false;
-  snapshot_buffer_p = buffer_p;
-  snapshot_buffer_size = buffer_size;
-  snapshot_map_entries_p = NULL;
+  JERRY_CONTEXT (snapshot_buffer_write_offset) = 0;
+  JERRY_CONTEXT (snapshot_last_compiled_code_offset) = 0;
+  JERRY_CONTEXT (snapshot_error_occured) = false;
+  JERRY_CONTEXT (snapshot_buffer_p) = buffer_p;
+  JERRY_CONTEXT (snapshot_buffer_size) = buffer_size;
+  JERRY_CONTEXT (snapshot_map_entries_p) = NULL;
+  JERRY_CONTEXT (snapshot_compiled_codes_num) = 0;
 
   uint64_t version = JERRY_SNAPSHOT_VERSION;
   if (!jrt_write_to_buffer_by_offset (buffer_p,
                                       buffer_size,
-                                      &snapshot_buffer_write_offset,
+                                      &JERRY_CONTEXT (snapshot_buffer_write_offset),
                                       &version,
                                       sizeof (version)))
   {
     return 0;
   }
 
-  snapshot_buffer_write_offset = JERRY_ALIGNUP (snapshot_buffer_write_offset, MEM_ALIGNMENT);
+  JERRY_CONTEXT (snapshot_buffer_write_offset) = JERRY_ALIGNUP (JERRY_CONTEXT (snapshot_buffer_write_offset),
+                                                                MEM_ALIGNMENT);
 
-  size_t header_offset = snapshot_buffer_write_offset;
+  size_t header_offset = JERRY_CONTEXT (snapshot_buffer_write_offset);
 
-  snapshot_buffer_write_offset += JERRY_ALIGNUP (sizeof (jerry_snapshot_header_t), MEM_ALIGNMENT);
+  JERRY_CONTEXT (snapshot_buffer_write_offset) += JERRY_ALIGNUP (sizeof (jerry_snapshot_header_t), MEM_ALIGNMENT);
 
-  if (snapshot_buffer_write_offset > buffer_size)
+  if (JERRY_CONTEXT (snapshot_buffer_write_offset) > buffer_size)
   {
     return 0;
   }
 
-  size_t compiled_code_start = snapshot_buffer_write_offset;
+  size_t compiled_code_start = JERRY_CONTEXT (snapshot_buffer_write_offset);
 
-  snapshot_report_byte_code_compilation = true;
+  JERRY_CONTEXT (snapshot_report_byte_code_compilation) = true;
 
   if (is_for_global)
   {
-    parse_status = parser_parse_script (source_p, source_size, &bytecode_data_p);
+    parse_status = parser_parse_script (source_p, source_size, false, &bytecode_data_p);
   }
   else
   {
@@ -2066,45 +3331,69 @@ jerry_parse_and_save_snapshot (const jerry_api_char_t *source_p, /**< script sou
                                       &bytecode_data_p);
   }
 
-  snapshot_report_byte_code_compilation = false;
+  JERRY_CONTEXT (snapshot_report_byte_code_compilation) = false;
 
   if (parse_status == JSP_STATUS_OK
-      && !snapshot_error_occured)
+      && !JERRY_CONTEXT (snapshot_error_occured))
   {
-    JERRY_ASSERT (snapshot_last_compiled_code_offset != 0);
+    JERRY_ASSERT (JERRY_CONTEXT (snapshot_last_compiled_code_offset) != 0);
 
     jerry_snapshot_header_t header;
-    header.last_compiled_code_offset = (uint32_t) snapshot_last_compiled_code_offset;
+    header.last_compiled_code_offset = (uint32_t) JERRY_CONTEXT (snapshot_last_compiled_code_offset);
     header.is_run_global = is_for_global;
+    header.has_line_info = JERRY_SNAPSHOT_HAS_LINE_INFO;
 
-    size_t compiled_code_size = snapshot_buffer_write_offset - compiled_code_start;
+    size_t compiled_code_size = JERRY_CONTEXT (snapshot_buffer_write_offset) - compiled_code_start;
 
     lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
     uint32_t literals_num;
 
     if (!lit_dump_literals_for_snapshot (buffer_p,
                                          buffer_size,
-                                         &snapshot_buffer_write_offset,
+                                         &JERRY_CONTEXT (snapshot_buffer_write_offset),
                                          &lit_map_p,
                                          &literals_num,
                                          &header.lit_table_size))
     {
       JERRY_ASSERT (lit_map_p == NULL);
-      snapshot_buffer_write_offset = 0;
+      JERRY_CONTEXT (snapshot_buffer_write_offset) = 0;
     }
     else
     {
-      if (header.lit_table_size > 0xffff)
+      header.compiled_codes_num = JERRY_CONTEXT (snapshot_compiled_codes_num);
+
+      size_t compiled_code_table_offset = JERRY_CONTEXT (snapshot_buffer_write_offset);
+      JERRY_CONTEXT (snapshot_buffer_write_offset) += JERRY_CONTEXT (snapshot_compiled_codes_num) * sizeof (uint32_t);
+
+      if (1 + literals_num + JERRY_CONTEXT (snapshot_compiled_codes_num) > UINT16_MAX
+          || JERRY_CONTEXT (snapshot_buffer_write_offset) > buffer_size)
       {
-        /* Aligning literals could increase this range, but
-         * it is not a requirement for low-memory environments. */
-        snapshot_buffer_write_offset = 0;
+        /* Literal map indices are stored in 16 bit, which
+         * is not a limitation for low-memory environments. */
+        JERRY_CONTEXT (snapshot_buffer_write_offset) = 0;
       }
       else
       {
         jerry_snapshot_set_offsets (buffer_p + compiled_code_start,
                                     (uint32_t) compiled_code_size,
-                                    lit_map_p);
+                                    lit_map_p,
+                                    literals_num);
+
+        compiled_code_map_entry_t *current_p = JERRY_CONTEXT (snapshot_map_entries_p);
+
+        while (current_p != NULL)
+        {
+          size_t entry_offset = compiled_code_table_offset + current_p->index * sizeof (uint32_t);
+          uint32_t code_offset = (uint32_t) current_p->offset << MEM_ALIGNMENT_LOG;
+
+          jrt_write_to_buffer_by_offset (buffer_p,
+                                         buffer_size,
+                                         &entry_offset,
+                                         &code_offset,
+                                         sizeof (uint32_t));
+
+          current_p = ECMA_GET_POINTER (compiled_code_map_entry_t, current_p->next_cp);
+        }
 
         jrt_write_to_buffer_by_offset (buffer_p,
                                        buffer_size,
@@ -2120,10 +3409,10 @@ jerry_parse_and_save_snapshot (const jerry_api_char_t *source_p, /**< script sou
   }
   else
   {
-    snapshot_buffer_write_offset = 0;
+    JERRY_CONTEXT (snapshot_buffer_write_offset) = 0;
   }
 
-  compiled_code_map_entry_t *current_p = snapshot_map_entries_p;
+  compiled_code_map_entry_t *current_p = JERRY_CONTEXT (snapshot_map_entries_p);
 
   while (current_p != NULL)
   {
@@ -2133,7 +3422,7 @@ jerry_parse_and_save_snapshot (const jerry_api_char_t *source_p, /**< script sou
     current_p = next_p;
   }
 
-  return snapshot_buffer_write_offset;
+  return JERRY_CONTEXT (snapshot_buffer_write_offset);
 #else /* JERRY_ENABLE_SNAPSHOT_SAVE */
   (void) source_p;
   (void) source_size;
@@ -2150,14 +3439,22 @@ jerry_parse_and_save_snapshot (const jerry_api_char_t *source_p, /**< script sou
 /**
  * Load byte code from snapshot.
  *
- * @return byte code
+ * Note:
+ *      the compiled code is stored in the literal map entry specified by entry_index,
+ *      if the byte code is copied, the referenced compiled code entries must be loaded before,
+ *      otherwise they are loaded when they are first instantiated (see also: cbc_get_snapshot_literal)
  */
-static ecma_compiled_code_t *
-snapshot_load_compiled_code (const uint8_t *snapshot_data_p, /**< snapshot data */
-                             size_t offset, /**< byte code offset */
-                             lit_mem_to_snapshot_id_map_entry_t *lit_map_p, /**< literal map */
+void
+snapshot_load_compiled_code (cbc_snapshot_literal_map_t *literal_map_p, /**< literal map */
+                             uint32_t entry_index, /**< literal map entry of the byte code */
                              bool copy_bytecode) /**< byte code should be copied to memory */
 {
+  JERRY_ASSERT (entry_index >= literal_map_p->compiled_code_start
+                && entry_index < literal_map_p->entries_num);
+
+  lit_cpointer_t *entries_p = (lit_cpointer_t *) (literal_map_p + 1);
+  const uint8_t *snapshot_data_p = literal_map_p->snapshot_data_p;
+  size_t offset = literal_map_p->compiled_code_offsets_p[entry_index - literal_map_p->compiled_code_start];
   uint32_t code_size = *(uint32_t *) (snapshot_data_p + offset);
 
   ecma_compiled_code_t *bytecode_p;
@@ -2167,115 +3464,98 @@ snapshot_load_compiled_code (const uint8_t *snapshot_data_p, /**< snapshot data
   if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
   {
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
-    re_compiled_code_t *re_bytecode_p = NULL;
+    const re_compiled_code_t *snapshot_re_bytecode_p = (const re_compiled_code_t *) bytecode_p;
+    uint32_t pattern_size = snapshot_re_bytecode_p->pattern_cp;
+    uint32_t re_code_size = code_size - pattern_size;
+    re_compiled_code_t *re_bytecode_p;
+
+    JERRY_ASSERT (re_code_size == snapshot_re_bytecode_p->size);
+
+    if (copy_bytecode)
+    {
+      re_bytecode_p = (re_compiled_code_t *) mem_heap_alloc_block (re_code_size, MEM_HEAP_ALLOC_LONG_TERM);
+
+      memcpy (re_bytecode_p, snapshot_re_bytecode_p, re_code_size);
+    }
+    else
+    {
+      const uint8_t *real_bytecode_p = (const uint8_t *) (snapshot_re_bytecode_p + 1);
 
-    const uint8_t *regex_start_p = ((const uint8_t *) bytecode_p) + sizeof (uint16_t);
+      re_bytecode_p = (re_compiled_code_t *) mem_heap_alloc_block (sizeof (re_compiled_code_t) + sizeof (uint8_t *),
+                                                                   MEM_HEAP_ALLOC_LONG_TERM);
 
-    code_size -= (uint32_t) sizeof (uint16_t);
+      memcpy (re_bytecode_p, snapshot_re_bytecode_p, sizeof (re_compiled_code_t));
+      memcpy (re_bytecode_p + 1, &real_bytecode_p, sizeof (uint8_t *));
 
-    ecma_string_t *pattern_str_p = ecma_new_ecma_string_from_utf8 (regex_start_p,
-                                                                   code_size);
+      re_bytecode_p->flags |= RE_FLAG_BYTECODE_IN_SNAPSHOT;
+    }
 
-    re_compile_bytecode (&re_bytecode_p,
-                         pattern_str_p,
-                         bytecode_p->status_flags);
+    JERRY_ASSERT ((re_bytecode_p->flags >> ECMA_BYTECODE_REF_SHIFT) == 1);
 
-    ecma_deref_ecma_string (pattern_str_p);
+    ecma_string_t *pattern_str_p = ecma_new_ecma_string_from_utf8 (((const uint8_t *) snapshot_re_bytecode_p)
+                                                                   + re_code_size,
+                                                                   pattern_size);
+    ECMA_SET_NON_NULL_POINTER (re_bytecode_p->pattern_cp, pattern_str_p);
 
-    return (ecma_compiled_code_t *) re_bytecode_p;
+    ECMA_SET_NON_NULL_POINTER (entries_p[entry_index].u.value.base_cp, re_bytecode_p);
+    return;
 #else
     JERRY_UNIMPLEMENTED ("RegExp is not supported in compact profile.");
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
   }
 
-  size_t header_size;
+  size_t header_size = cbc_get_arguments_size (bytecode_p);
   uint32_t literal_end;
-  uint32_t const_literal_end;
 
   if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
   {
-    uint8_t *byte_p = (uint8_t *) bytecode_p;
-    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) byte_p;
-    literal_end = args_p->literal_end;
-    const_literal_end = args_p->const_literal_end;
-    header_size = sizeof (cbc_uint16_arguments_t);
+    literal_end = ((cbc_uint16_arguments_t *) bytecode_p)->literal_end;
   }
   else
   {
-    uint8_t *byte_p = (uint8_t *) bytecode_p;
-    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) byte_p;
-    literal_end = args_p->literal_end;
-    const_literal_end = args_p->const_literal_end;
-    header_size = sizeof (cbc_uint8_arguments_t);
+    literal_end = ((cbc_uint8_arguments_t *) bytecode_p)->literal_end;
   }
 
-  if (copy_bytecode)
+  if (!copy_bytecode)
   {
-    bytecode_p = (ecma_compiled_code_t *) mem_heap_alloc_block (code_size,
-                                                                MEM_HEAP_ALLOC_LONG_TERM);
+    /* Only the byte code arguments are copied to the heap, the literal table
+     * and the instructions are referenced from the snapshot buffer. */
+    cbc_snapshot_code_t snapshot_code;
+    snapshot_code.snapshot_code_p = (const uint8_t *) bytecode_p;
+    ECMA_SET_NON_NULL_POINTER (snapshot_code.literal_map_cp, literal_map_p);
 
-    memcpy (bytecode_p, snapshot_data_p + offset + sizeof (uint32_t), code_size);
-  }
-  else
-  {
-    code_size = (uint32_t) (header_size + literal_end * sizeof (lit_cpointer_t));
+    uint8_t *code_p = (uint8_t *) mem_heap_alloc_block (header_size + sizeof (cbc_snapshot_code_t),
+                                                        MEM_HEAP_ALLOC_LONG_TERM);
 
-    uint8_t *real_bytecode_p = ((uint8_t *) bytecode_p) + code_size;
+    memcpy (code_p, bytecode_p, header_size);
+    memcpy (code_p + header_size, &snapshot_code, sizeof (cbc_snapshot_code_t));
 
-    bytecode_p = (ecma_compiled_code_t *) mem_heap_alloc_block (code_size + 1 + sizeof (uint8_t *),
-                                                                MEM_HEAP_ALLOC_LONG_TERM);
+    bytecode_p = (ecma_compiled_code_t *) code_p;
+    bytecode_p->status_flags &= (1u << ECMA_BYTECODE_REF_SHIFT) - 1;
+    bytecode_p->status_flags |= ECMA_BYTECODE_REF_SNAPSHOT << ECMA_BYTECODE_REF_SHIFT;
 
-    memcpy (bytecode_p, snapshot_data_p + offset + sizeof (uint32_t), code_size);
+    ECMA_SET_NON_NULL_POINTER (entries_p[entry_index].u.value.base_cp, bytecode_p);
+    return;
+  }
 
-    uint8_t *instructions_p = ((uint8_t *) bytecode_p);
+  bytecode_p = (ecma_compiled_code_t *) mem_heap_alloc_block (code_size,
+                                                              MEM_HEAP_ALLOC_LONG_TERM);
 
-    instructions_p[code_size] = CBC_SET_BYTECODE_PTR;
-    memcpy (instructions_p + code_size + 1, &real_bytecode_p, sizeof (uint8_t *));
-  }
+  memcpy (bytecode_p, snapshot_data_p + offset + sizeof (uint32_t), code_size);
 
   JERRY_ASSERT ((bytecode_p->status_flags >> ECMA_BYTECODE_REF_SHIFT) == 1);
 
+  /* Set before resolving the literals, since functions may reference themselves. */
+  ECMA_SET_NON_NULL_POINTER (entries_p[entry_index].u.value.base_cp, bytecode_p);
+
   lit_cpointer_t *literal_start_p = (lit_cpointer_t *) (((uint8_t *) bytecode_p) + header_size);
 
-  for (uint32_t i = 0; i < const_literal_end; i++)
+  for (uint32_t i = 0; i < literal_end; i++)
   {
-    lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
-
-    if (literal_start_p[i].u.packed_value != 0)
-    {
-      while (current_p->literal_offset != literal_start_p[i].u.packed_value)
-      {
-        current_p++;
-      }
+    JERRY_ASSERT (literal_start_p[i].u.packed_value < literal_map_p->entries_num);
 
-      literal_start_p[i] = current_p->literal_id;
-    }
+    literal_start_p[i] = entries_p[literal_start_p[i].u.packed_value];
   }
-
-  for (uint32_t i = const_literal_end; i < literal_end; i++)
-  {
-    size_t literal_offset = ((size_t) literal_start_p[i].u.packed_value) << MEM_ALIGNMENT_LOG;
-
-    if (literal_offset == offset)
-    {
-      /* Self reference */
-      ECMA_SET_NON_NULL_POINTER (literal_start_p[i].u.value.base_cp,
-                                 bytecode_p);
-    }
-    else
-    {
-      ecma_compiled_code_t *literal_bytecode_p;
-      literal_bytecode_p = snapshot_load_compiled_code (snapshot_data_p,
-                                                        literal_offset,
-                                                        lit_map_p,
-                                                        copy_bytecode);
-
-      ECMA_SET_NON_NULL_POINTER (literal_start_p[i].u.value.base_cp,
-                                 literal_bytecode_p);
-    }
-  }
-
-  return bytecode_p;
 } /* snapshot_load_compiled_code */
 
 #endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
@@ -2293,8 +3573,11 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
                                           *   If set the engine should not reference the buffer
                                           *   after the function returns (in this case, the passed
                                           *   buffer could be freed after the call).
-                                          *   Otherwise (if the flag is not set) - the buffer could only be
-                                          *   freed after the engine stops (i.e. after call to jerry_cleanup). */
+                                          *   Otherwise (if the flag is not set) - the code is executed
+                                          *   in place: only the byte code arguments of the functions
+                                          *   are copied, and the buffer (which could be a read-only
+                                          *   mapping of a snapshot file) could only be freed after
+                                          *   the engine stops (i.e. after call to jerry_cleanup). */
                      jerry_api_value_t *retval_p) /**< out: returned value (ECMA-262 'undefined' if
                                                    * code is executed as global scope code) */
 {
@@ -2323,6 +3606,12 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
 
   const jerry_snapshot_header_t *header_p = (const jerry_snapshot_header_t *) (snapshot_data_p + snapshot_read);
 
+  if (header_p->has_line_info != JERRY_SNAPSHOT_HAS_LINE_INFO)
+  {
+    /* The byte code header layout depends on the line info support. */
+    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+  }
+
   snapshot_read = header_p->last_compiled_code_offset;
 
   JERRY_ASSERT (snapshot_read == JERRY_ALIGNUP (snapshot_read, MEM_ALIGNMENT));
@@ -2331,11 +3620,22 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
 
   snapshot_read += JERRY_ALIGNUP (last_code_size + sizeof (uint32_t), MEM_ALIGNMENT);
 
-  lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
+  lit_cpointer_t *lit_map_p = NULL;
   uint32_t literals_num;
 
   JERRY_ASSERT (snapshot_read + header_p->lit_table_size <= snapshot_size);
 
+  const uint32_t *compiled_code_table_p = (const uint32_t *) (snapshot_data_p
+                                                              + snapshot_read
+                                                              + header_p->lit_table_size);
+
+  if (header_p->compiled_codes_num == 0
+      || (const uint8_t *) (compiled_code_table_p + header_p->compiled_codes_num) > snapshot_data_p + snapshot_size
+      || compiled_code_table_p[header_p->compiled_codes_num - 1] != header_p->last_compiled_code_offset)
+  {
+    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+  }
+
   if (!lit_load_literals_from_snapshot (snapshot_data_p + snapshot_read,
                                         header_p->lit_table_size,
                                         &lit_map_p,
@@ -2345,23 +3645,58 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
     return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
   }
 
-  ecma_compiled_code_t *bytecode_p;
+  /* The literal map is kept while the code executed in place is referenced,
+   * and it is only needed during loading otherwise. */
+  uint32_t entries_num = 1 + literals_num + header_p->compiled_codes_num;
+  cbc_snapshot_literal_map_t *literal_map_p;
+  literal_map_p = (cbc_snapshot_literal_map_t *) mem_heap_alloc_block (sizeof (cbc_snapshot_literal_map_t)
+                                                                       + entries_num * sizeof (lit_cpointer_t),
+                                                                       (copy_bytecode ? MEM_HEAP_ALLOC_SHORT_TERM
+                                                                                      : MEM_HEAP_ALLOC_LONG_TERM));
 
-  snapshot_read = header_p->last_compiled_code_offset;
+  JERRY_ASSERT (entries_num <= UINT16_MAX);
+
+  literal_map_p->refs = 1;
+  literal_map_p->compiled_code_start = (uint16_t) (1 + literals_num);
+  literal_map_p->entries_num = (uint16_t) entries_num;
+  literal_map_p->snapshot_data_p = snapshot_data_p;
+  literal_map_p->compiled_code_offsets_p = compiled_code_table_p;
 
-  bytecode_p = snapshot_load_compiled_code (snapshot_data_p,
-                                            snapshot_read,
-                                            lit_map_p,
-                                            copy_bytecode);
+  lit_cpointer_t *entries_p = (lit_cpointer_t *) (literal_map_p + 1);
+  entries_p[0].u.packed_value = MEM_CP_NULL;
 
   if (lit_map_p != NULL)
   {
+    memcpy (entries_p + 1, lit_map_p, literals_num * sizeof (lit_cpointer_t));
     mem_heap_free_block (lit_map_p);
   }
 
-  if (bytecode_p == NULL)
+  if (copy_bytecode)
   {
-    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+    /* Nested functions are saved before the code containing them. */
+    for (uint32_t i = literal_map_p->compiled_code_start; i < entries_num; i++)
+    {
+      snapshot_load_compiled_code (literal_map_p, i, true);
+    }
+  }
+  else
+  {
+    /* Only the global code is loaded, the other compiled code is loaded when it is first instantiated. */
+    for (uint32_t i = literal_map_p->compiled_code_start; i < entries_num - 1; i++)
+    {
+      entries_p[i].u.packed_value = MEM_CP_NULL;
+    }
+
+    snapshot_load_compiled_code (literal_map_p, entries_num - 1, false);
+  }
+
+  ecma_compiled_code_t *bytecode_p;
+  bytecode_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t, entries_p[entries_num - 1].u.value.base_cp);
+
+  if (copy_bytecode)
+  {
+    /* The compiled code is referenced by the literal tables of the code containing it. */
+    mem_heap_free_block (literal_map_p);
   }
 
   jerry_completion_code_t ret_code;
@@ -2394,3 +3729,396 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
   return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_VERSION;
 #endif /* !JERRY_ENABLE_SNAPSHOT_EXEC */
 } /* jerry_exec_snapshot */
+
+/**
+ * Pack byte code snapshots into a snapshot bundle
+ *
+ * Note:
+ *      the snapshots are copied to the bundle, so the source buffers can be freed after the call,
+ *      the snapshots of a bundle can be executed separately (see also: jerry_exec_snapshot_from_bundle)
+ *
+ * @return size of the bundle, if it was generated succesfully
+ *          (i.e. the snapshots have the current snapshot format version and the buffer is large enough),
+ *         0 - otherwise.
+ */
+size_t
+jerry_save_snapshot_bundle (const uint8_t * const *snapshots_p, /**< snapshots */
+                            const size_t *snapshot_sizes_p, /**< sizes of the snapshots */
+                            uint32_t snapshots_num, /**< number of snapshots */
+                            uint8_t *buffer_p, /**< buffer to dump the bundle to */
+                            size_t buffer_size) /**< the buffer's size */
+{
+  if (snapshots_num == 0)
+  {
+    return 0;
+  }
+
+  jerry_snapshot_bundle_header_t header;
+  header.magic = JERRY_SNAPSHOT_BUNDLE_MAGIC;
+  header.version = JERRY_SNAPSHOT_VERSION;
+  header.snapshots_num = snapshots_num;
+
+  size_t buffer_write_offset = 0;
+
+  if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &buffer_write_offset, &header, sizeof (header)))
+  {
+    return 0;
+  }
+
+  size_t index_offset = buffer_write_offset;
+  buffer_write_offset += snapshots_num * sizeof (jerry_snapshot_bundle_entry_t);
+
+  for (uint32_t i = 0; i < snapshots_num; i++)
+  {
+    uint64_t version;
+
+    if (snapshot_sizes_p[i] < sizeof (version)
+        || snapshot_sizes_p[i] > UINT32_MAX)
+    {
+      return 0;
+    }
+
+    memcpy (&version, snapshots_p[i], sizeof (version));
+
+    if (version != JERRY_SNAPSHOT_VERSION)
+    {
+      return 0;
+    }
+
+    size_t aligned_offset = JERRY_ALIGNUP (buffer_write_offset, MEM_ALIGNMENT);
+
+    if (aligned_offset > buffer_size)
+    {
+      return 0;
+    }
+
+    memset (buffer_p + buffer_write_offset, 0, aligned_offset - buffer_write_offset);
+    buffer_write_offset = aligned_offset;
+
+    jerry_snapshot_bundle_entry_t entry;
+    entry.offset = (uint32_t) buffer_write_offset;
+    entry.size = (uint32_t) snapshot_sizes_p[i];
+
+    if (buffer_write_offset > UINT32_MAX
+        || !jrt_write_to_buffer_by_offset (buffer_p,
+                                           buffer_size,
+                                           &buffer_write_offset,
+                                           snapshots_p[i],
+                                           snapshot_sizes_p[i])
+        || !jrt_write_to_buffer_by_offset (buffer_p,
+                                           buffer_size,
+                                           &index_offset,
+                                           &entry,
+                                           sizeof (entry)))
+    {
+      return 0;
+    }
+  }
+
+  return buffer_write_offset;
+} /* jerry_save_snapshot_bundle */
+
+/**
+ * Get the index entry of a bundled snapshot
+ *
+ * @return pointer to the index entry, if the bundle is valid and contains the snapshot,
+ *         NULL - otherwise.
+ */
+static const jerry_snapshot_bundle_entry_t *
+jerry_get_snapshot_bundle_entry (const void *bundle_p, /**< snapshot bundle */
+                                 size_t bundle_size, /**< size of the bundle */
+                                 uint32_t index) /**< index of the snapshot */
+{
+  JERRY_ASSERT (bundle_p != NULL);
+
+  const jerry_snapshot_bundle_header_t *header_p = (const jerry_snapshot_bundle_header_t *) bundle_p;
+
+  if (bundle_size < sizeof (jerry_snapshot_bundle_header_t)
+      || header_p->magic != JERRY_SNAPSHOT_BUNDLE_MAGIC
+      || header_p->version != JERRY_SNAPSHOT_VERSION
+      || index >= header_p->snapshots_num
+      || (bundle_size - sizeof (jerry_snapshot_bundle_header_t)) / sizeof (jerry_snapshot_bundle_entry_t)
+         < header_p->snapshots_num)
+  {
+    return NULL;
+  }
+
+  const jerry_snapshot_bundle_entry_t *entry_p = ((const jerry_snapshot_bundle_entry_t *) (header_p + 1)) + index;
+
+  if (entry_p->offset > bundle_size
+      || entry_p->size > bundle_size - entry_p->offset
+      || entry_p->offset != JERRY_ALIGNUP (entry_p->offset, MEM_ALIGNMENT))
+  {
+    return NULL;
+  }
+
+  return entry_p;
+} /* jerry_get_snapshot_bundle_entry */
+
+/**
+ * Get the number of snapshots in a snapshot bundle
+ *
+ * @return number of snapshots, if the buffer contains a valid snapshot bundle of the current format version,
+ *         0 - otherwise.
+ */
+uint32_t
+jerry_get_snapshot_bundle_count (const void *bundle_p, /**< snapshot bundle */
+                                 size_t bundle_size) /**< size of the bundle */
+{
+  uint32_t index = 0;
+
+  while (jerry_get_snapshot_bundle_entry (bundle_p, bundle_size, index) != NULL)
+  {
+    index++;
+  }
+
+  if (index == 0 || index != ((const jerry_snapshot_bundle_header_t *) bundle_p)->snapshots_num)
+  {
+    return 0;
+  }
+
+  return index;
+} /* jerry_get_snapshot_bundle_count */
+
+/**
+ * Execute a snapshot of a snapshot bundle
+ *
+ * Note:
+ *      if the byte code is not copied, the functions of the snapshot are loaded
+ *      from the bundle when they are first instantiated (see also: jerry_exec_snapshot)
+ *
+ * @return completion code
+ */
+jerry_completion_code_t
+jerry_exec_snapshot_from_bundle (const void *bundle_p, /**< snapshot bundle */
+                                 size_t bundle_size, /**< size of the bundle */
+                                 uint32_t index, /**< index of the snapshot in the bundle */
+                                 bool copy_bytecode, /**< flag, indicating whether the snapshot should be
+                                                      *   copied to the engine's memory
+                                                      *   (see also: jerry_exec_snapshot) */
+                                 jerry_api_value_t *retval_p) /**< out: returned value */
+{
+  const jerry_snapshot_bundle_entry_t *entry_p = jerry_get_snapshot_bundle_entry (bundle_p, bundle_size, index);
+
+  if (entry_p == NULL)
+  {
+    jerry_api_convert_ecma_value_to_api_value (retval_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+
+    if (bundle_size >= sizeof (jerry_snapshot_bundle_header_t)
+        && ((const jerry_snapshot_bundle_header_t *) bundle_p)->magic == JERRY_SNAPSHOT_BUNDLE_MAGIC
+        && ((const jerry_snapshot_bundle_header_t *) bundle_p)->version != JERRY_SNAPSHOT_VERSION)
+    {
+      return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_VERSION;
+    }
+
+    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+  }
+
+  return jerry_exec_snapshot (((const uint8_t *) bundle_p) + entry_p->offset,
+                              entry_p->size,
+                              copy_bytecode,
+                              retval_p);
+} /* jerry_exec_snapshot_from_bundle */
+
+#ifdef JERRY_ENABLE_SNAPSHOT_SAVE
+/**
+ * Write the heap snapshot of the current state of the engine to a buffer
+ *
+ * Note:
+ *      the size of the snapshot only depends on the configuration of the engine
+ *
+ * @return size of snapshot, if it was written succesfully,
+ *         0 - otherwise.
+ */
+static size_t
+jerry_write_heap_snapshot (uint8_t *buffer_p, /**< buffer for the snapshot */
+                           size_t buffer_size) /**< the buffer's size */
+{
+  jerry_heap_snapshot_header_t header;
+  size_t buffer_write_offset = sizeof (header);
+
+  if (JERRY_CONTEXT (ecma_external_strings_number) != 0
+      || buffer_write_offset > buffer_size
+      || !mem_save_image (buffer_p, buffer_size, &buffer_write_offset)
+      || !lit_save_image (buffer_p, buffer_size, &buffer_write_offset)
+      || !ecma_save_image (buffer_p, buffer_size, &buffer_write_offset))
+  {
+    return 0;
+  }
+
+  header.magic = JERRY_HEAP_SNAPSHOT_MAGIC;
+  header.version = JERRY_SNAPSHOT_VERSION;
+  header.configuration = JERRY_HEAP_SNAPSHOT_CONFIGURATION;
+  header.image_size = (uint32_t) (buffer_write_offset - sizeof (header));
+
+  memcpy (buffer_p, &header, sizeof (header));
+
+  return buffer_write_offset;
+} /* jerry_write_heap_snapshot */
+#endif /* JERRY_ENABLE_SNAPSHOT_SAVE */
+
+/**
+ * Save the current state of the engine to a heap snapshot
+ *
+ * The snapshot contains the whole heap (built-in objects, the global object with the properties
+ * created by the already executed code, the literal storage), so an engine initialized with
+ * jerry_init_from_heap_snapshot continues from the saved state without running any initialization.
+ *
+ * Note:
+ *      unreferenced objects are collected before saving, and the code parsed by jerry_parse
+ *      is released if the snapshot is saved (a refused snapshot does not change the state of the engine);
+ *      objects with native handlers, handles or free callbacks, and functions, whose byte code
+ *      is referenced from a snapshot buffer (see also: jerry_exec_snapshot) or is pinned
+ *      (see also: jerry_pin_parsed_code), and strings referencing buffers of the
+ *      embedder (see also: jerry_api_create_external_string_sz) cannot be saved;
+ *      the snapshot is not saved while the job queue is not empty (see also: jerry_api_enqueue_job);
+ *      the snapshot can only be restored by the same build of the engine.
+ *
+ * @return size of snapshot, if it was generated succesfully
+ *          (i.e. the heap does not reference external memory and the buffer is large enough),
+ *         0 - otherwise.
+ */
+size_t
+jerry_save_heap_snapshot (uint8_t *buffer_p, /**< buffer for the snapshot */
+                          size_t buffer_size) /**< the buffer's size */
+{
+#ifdef JERRY_ENABLE_SNAPSHOT_SAVE
+  jerry_assert_api_available ();
+
+  if (ecma_has_pinned_bytecode ()
+      || JERRY_CONTEXT (jerry_job_queue_first_p) != NULL)
+  {
+    return 0;
+  }
+
+  ecma_prepare_image ();
+
+  /* The snapshot is written once before the parsed code is released, so every
+   * refusal is reported while the parsed code can still be executed. */
+  if (jerry_write_heap_snapshot (buffer_p, buffer_size) == 0)
+  {
+    return 0;
+  }
+
+  vm_finalize ();
+
+  size_t snapshot_size = jerry_write_heap_snapshot (buffer_p, buffer_size);
+  JERRY_ASSERT (snapshot_size != 0);
+
+  return snapshot_size;
+#else /* JERRY_ENABLE_SNAPSHOT_SAVE */
+  (void) buffer_p;
+  (void) buffer_size;
+
+  return 0;
+#endif /* !JERRY_ENABLE_SNAPSHOT_SAVE */
+} /* jerry_save_heap_snapshot */
+
+/**
+ * Initialize Jerry engine from a heap snapshot
+ *
+ * Note:
+ *      the function should be called instead of jerry_init;
+ *      external magic strings should be registered again after the call,
+ *      the same way as they were registered before the snapshot was saved;
+ *      the snapshot buffer is not referenced after the function returns.
+ *
+ * @return true - if the engine was initialized,
+ *         false - if the snapshot is invalid or was saved by a different build of the engine
+ *                 (the engine is not initialized in the case).
+ */
+bool
+jerry_init_from_heap_snapshot (jerry_flag_t flags, /**< combination of Jerry flags */
+                               const void *snapshot_p, /**< heap snapshot */
+                               size_t snapshot_size) /**< size of the snapshot */
+{
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  JERRY_ASSERT (snapshot_p != NULL);
+
+  const uint8_t *snapshot_data_p = (const uint8_t *) snapshot_p;
+  jerry_heap_snapshot_header_t header;
+  size_t snapshot_read = 0;
+
+  if (!jrt_read_from_buffer_by_offset (snapshot_data_p, snapshot_size, &snapshot_read, &header, sizeof (header))
+      || header.magic != JERRY_HEAP_SNAPSHOT_MAGIC
+      || header.version != JERRY_SNAPSHOT_VERSION
+      || header.configuration != JERRY_HEAP_SNAPSHOT_CONFIGURATION
+      || header.image_size != snapshot_size - snapshot_read)
+  {
+    return false;
+  }
+
+  jcontext_init ();
+
+  if (!mem_load_image (snapshot_data_p, snapshot_size, &snapshot_read)
+      || !lit_load_image (snapshot_data_p, snapshot_size, &snapshot_read)
+      || !ecma_load_image (snapshot_data_p, snapshot_size, &snapshot_read)
+      || snapshot_read != snapshot_size)
+  {
+    /* The partially restored state is dropped, so the engine can be initialized again. */
+    jcontext_init ();
+    return false;
+  }
+
+  jerry_init_flags (flags);
+
+  return true;
+#else /* JERRY_ENABLE_SNAPSHOT_EXEC */
+  (void) flags;
+  (void) snapshot_p;
+  (void) snapshot_size;
+
+  return false;
+#endif /* !JERRY_ENABLE_SNAPSHOT_EXEC */
+} /* jerry_init_from_heap_snapshot */
+
+/**
+ * Start the sampling profiler
+ *
+ * Note:
+ *      previously recorded samples are discarded
+ *
+ * @return true - if profiling has started,
+ *         false - if profiler support is disabled in current configuration (JERRY_ENABLE_PROFILER).
+ */
+bool
+jerry_profiler_start (void)
+{
+  return vm_profiler_start ();
+} /* jerry_profiler_start */
+
+/**
+ * Stop the sampling profiler
+ */
+void
+jerry_profiler_stop (void)
+{
+  vm_profiler_stop ();
+} /* jerry_profiler_stop */
+
+/**
+ * Record the call stack of the currently executed script
+ *
+ * Note:
+ *      the function is intended to be called periodically from a timer signal handler
+ *      (it is async-signal-safe); calls are ignored if the profiler is not started
+ */
+void
+jerry_profiler_sample (void)
+{
+  vm_profiler_sample ();
+} /* jerry_profiler_sample */
+
+/**
+ * Dump the recorded samples as folded stacks (one line per distinct stack),
+ * which can be turned into a flame graph by flame graph tools
+ *
+ * @return size of the dump, if the dump fits into the buffer,
+ *         0 - otherwise.
+ */
+size_t
+jerry_profiler_dump (uint8_t *buffer_p, /**< buffer to dump the samples to */
+                     size_t buffer_size) /**< the buffer's size */
+{
+  return vm_profiler_dump (buffer_p, buffer_size);
+} /* jerry_profiler_dump */
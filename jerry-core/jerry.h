@@ -43,6 +43,8 @@ extern "C"
                                                      *   FIXME: Remove. */
 #define JERRY_FLAG_ENABLE_LOG             (1u << 5) /**< enable logging */
 #define JERRY_FLAG_ABORT_ON_FAIL          (1u << 6) /**< abort instead of exit in case of failure */
+#define JERRY_FLAG_LAZY_FUNCTION_COMPILATION (1u << 7) /**< compile functions on their first call (the source
+                                                        *   passed to jerry_parse must be kept alive) */
 
 /**
  * Jerry flags
@@ -88,12 +90,24 @@ typedef void (*jerry_error_callback_t) (jerry_fatal_code_t);
 
 
 void jerry_init (jerry_flag_t);
+bool jerry_init_from_heap_snapshot (jerry_flag_t, const void *, size_t);
 void jerry_cleanup (void);
 
+#ifdef JERRY_ENABLE_MULTIPLE_CONTEXTS
+/**
+ * Required alignment of engine context buffers
+ */
+#define JERRY_CONTEXT_ALIGNMENT (64)
+
+size_t jerry_get_context_size (void);
+void jerry_request_context_interrupt (jerry_context_t *);
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
 void jerry_get_memory_limits (size_t *, size_t *);
 void jerry_reg_err_callback (jerry_error_callback_t);
 
 bool jerry_parse (const jerry_api_char_t *, size_t);
+bool jerry_pin_parsed_code (void);
 jerry_completion_code_t jerry_run (void);
 jerry_completion_code_t jerry_run_simple (const jerry_api_char_t *, size_t, jerry_flag_t);
 
@@ -21,8 +21,6 @@
 #include "rcs-iterator.h"
 #include "rcs-records.h"
 
-rcs_record_set_t rcs_lit_storage;
-
 /**
  * Create charset record in the literal storage
  *
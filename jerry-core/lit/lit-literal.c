@@ -16,6 +16,7 @@
 #include "lit-literal.h"
 
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "rcs-allocator.h"
 #include "rcs-records.h"
 #include "rcs-iterator.h"
@@ -29,7 +30,7 @@ lit_init (void)
 {
   JERRY_ASSERT (rcs_get_node_data_space_size () % RCS_DYN_STORAGE_LENGTH_UNIT == 0);
 
-  rcs_chunked_list_init (&rcs_lit_storage);
+  rcs_chunked_list_init (&JERRY_CONTEXT (rcs_lit_storage));
 
   lit_magic_strings_ex_init ();
 } /* lit_init */
@@ -40,17 +41,70 @@ lit_init (void)
 void
 lit_finalize (void)
 {
-  rcs_chunked_list_cleanup (&rcs_lit_storage);
-  rcs_chunked_list_free (&rcs_lit_storage);
+  rcs_chunked_list_cleanup (&JERRY_CONTEXT (rcs_lit_storage));
+  rcs_chunked_list_free (&JERRY_CONTEXT (rcs_lit_storage));
 } /* lit_finalize */
 
+/**
+ * Save state of literal storage to a heap image
+ *
+ * Note:
+ *      the literal records are saved with the heap area
+ *
+ * @return true - if the state was written successfully,
+ *         false - if the buffer is too small.
+ */
+bool
+lit_save_image (uint8_t *buffer_p, /**< buffer */
+                size_t buffer_size, /**< size of buffer */
+                size_t *in_out_buffer_offset_p) /**< in: offset to write to,
+                                                 *   out: offset, incremented on size of the written data */
+{
+  mem_cpointer_t list_cps[2];
+
+  MEM_CP_SET_POINTER (list_cps[0], JERRY_CONTEXT (rcs_lit_storage).head_p);
+  MEM_CP_SET_POINTER (list_cps[1], JERRY_CONTEXT (rcs_lit_storage).tail_p);
+
+  return jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, list_cps, sizeof (list_cps));
+} /* lit_save_image */
+
+/**
+ * Initialize literal storage from a heap image
+ *
+ * Note:
+ *      the routine should be called instead of lit_init, after the heap is restored
+ *
+ * @return true - if the state was restored successfully,
+ *         false - if the image is truncated.
+ */
+bool
+lit_load_image (const uint8_t *buffer_p, /**< buffer */
+                size_t buffer_size, /**< size of buffer */
+                size_t *in_out_buffer_offset_p) /**< in: offset to read from,
+                                                 *   out: offset, incremented on size of the read data */
+{
+  mem_cpointer_t list_cps[2];
+
+  if (!jrt_read_from_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, list_cps, sizeof (list_cps)))
+  {
+    return false;
+  }
+
+  JERRY_CONTEXT (rcs_lit_storage).head_p = MEM_CP_GET_POINTER (rcs_chunked_list_node_t, list_cps[0]);
+  JERRY_CONTEXT (rcs_lit_storage).tail_p = MEM_CP_GET_POINTER (rcs_chunked_list_node_t, list_cps[1]);
+
+  lit_magic_strings_ex_init ();
+
+  return true;
+} /* lit_load_image */
+
 /**
  * Dump records from the literal storage
  */
 void
 lit_dump_literals (void)
 {
-  lit_storage_dump_literals (&rcs_lit_storage);
+  lit_storage_dump_literals (&JERRY_CONTEXT (rcs_lit_storage));
 } /* lit_dump_literals */
 
 /**
@@ -78,7 +132,7 @@ lit_create_literal_from_utf8_string (const lit_utf8_byte_t *str_p, /**< string t
 
     if (!strncmp ((const char *) str_p, (const char *) lit_get_magic_string_utf8 (m_str_id), str_size))
     {
-      return lit_storage_create_magic_literal (&rcs_lit_storage, m_str_id);
+      return lit_storage_create_magic_literal (&JERRY_CONTEXT (rcs_lit_storage), m_str_id);
     }
   }
 
@@ -94,11 +148,11 @@ lit_create_literal_from_utf8_string (const lit_utf8_byte_t *str_p, /**< string t
 
     if (!strncmp ((const char *) str_p, (const char *) lit_get_magic_string_ex_utf8 (m_str_ex_id), str_size))
     {
-      return lit_storage_create_magic_literal_ex (&rcs_lit_storage, m_str_ex_id);
+      return lit_storage_create_magic_literal_ex (&JERRY_CONTEXT (rcs_lit_storage), m_str_ex_id);
     }
   }
 
-  return lit_storage_create_charset_literal (&rcs_lit_storage, str_p, str_size);
+  return lit_storage_create_charset_literal (&JERRY_CONTEXT (rcs_lit_storage), str_p, str_size);
 } /* lit_create_literal_from_utf8_string */
 
 /**
@@ -117,9 +171,9 @@ lit_find_literal_by_utf8_string (const lit_utf8_byte_t *str_p, /**< a string to
 
   lit_literal_t lit;
 
-  for (lit = rcs_record_get_first (&rcs_lit_storage);
+  for (lit = rcs_record_get_first (&JERRY_CONTEXT (rcs_lit_storage));
        lit != NULL;
-       lit = rcs_record_get_next (&rcs_lit_storage, lit))
+       lit = rcs_record_get_next (&JERRY_CONTEXT (rcs_lit_storage), lit))
   {
     rcs_record_type_t type = rcs_record_get_type (lit);
 
@@ -135,7 +189,7 @@ lit_find_literal_by_utf8_string (const lit_utf8_byte_t *str_p, /**< a string to
         continue;
       }
 
-      if (rcs_record_is_equal_charset (&rcs_lit_storage, lit, str_p, str_size))
+      if (rcs_record_is_equal_charset (&JERRY_CONTEXT (rcs_lit_storage), lit, str_p, str_size))
       {
         return lit;
       }
@@ -204,7 +258,7 @@ lit_find_or_create_literal_from_utf8_string (const lit_utf8_byte_t *str_p, /**<
 lit_literal_t
 lit_create_literal_from_num (ecma_number_t num) /**< number to initialize a new number literal */
 {
-  return lit_storage_create_number_literal (&rcs_lit_storage, num);
+  return lit_storage_create_number_literal (&JERRY_CONTEXT (rcs_lit_storage), num);
 } /* lit_create_literal_from_num */
 
 /**
@@ -234,9 +288,9 @@ lit_literal_t
 lit_find_literal_by_num (ecma_number_t num) /**< a number to search for */
 {
   lit_literal_t lit;
-  for (lit = rcs_record_get_first (&rcs_lit_storage);
+  for (lit = rcs_record_get_first (&JERRY_CONTEXT (rcs_lit_storage));
        lit != NULL;
-       lit = rcs_record_get_next (&rcs_lit_storage, lit))
+       lit = rcs_record_get_next (&JERRY_CONTEXT (rcs_lit_storage), lit))
   {
     rcs_record_type_t type = rcs_record_get_type (lit);
 
@@ -245,7 +299,7 @@ lit_find_literal_by_num (ecma_number_t num) /**< a number to search for */
       continue;
     }
 
-    ecma_number_t lit_num = rcs_record_get_number (&rcs_lit_storage, lit);
+    ecma_number_t lit_num = rcs_record_get_number (&JERRY_CONTEXT (rcs_lit_storage), lit);
 
     if (lit_num == num)
     {
@@ -270,12 +324,12 @@ lit_literal_equal_charset_rec (lit_literal_t lit, /**< literal to compare */
   {
     case RCS_RECORD_TYPE_CHARSET:
     {
-      return rcs_record_is_equal (&rcs_lit_storage, lit, record);
+      return rcs_record_is_equal (&JERRY_CONTEXT (rcs_lit_storage), lit, record);
     }
     case RCS_RECORD_TYPE_MAGIC_STR:
     {
       lit_magic_string_id_t magic_string_id = rcs_record_get_magic_str_id (lit);
-      return rcs_record_is_equal_charset (&rcs_lit_storage,
+      return rcs_record_is_equal_charset (&JERRY_CONTEXT (rcs_lit_storage),
                                           record,
                                           lit_get_magic_string_utf8 (magic_string_id),
                                           lit_get_magic_string_size (magic_string_id));
@@ -284,19 +338,19 @@ lit_literal_equal_charset_rec (lit_literal_t lit, /**< literal to compare */
     {
       lit_magic_string_ex_id_t magic_string_id = rcs_record_get_magic_str_ex_id (lit);
 
-      return rcs_record_is_equal_charset (&rcs_lit_storage,
+      return rcs_record_is_equal_charset (&JERRY_CONTEXT (rcs_lit_storage),
                                           record,
                                           lit_get_magic_string_ex_utf8 (magic_string_id),
                                           lit_get_magic_string_ex_size (magic_string_id));
     }
     case RCS_RECORD_TYPE_NUMBER:
     {
-      ecma_number_t num = rcs_record_get_number (&rcs_lit_storage, lit);
+      ecma_number_t num = rcs_record_get_number (&JERRY_CONTEXT (rcs_lit_storage), lit);
 
       lit_utf8_byte_t buff[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
       lit_utf8_size_t copied = ecma_number_to_utf8_string (num, buff, sizeof (buff));
 
-      return rcs_record_is_equal_charset (&rcs_lit_storage, record, buff, copied);
+      return rcs_record_is_equal_charset (&JERRY_CONTEXT (rcs_lit_storage), record, buff, copied);
     }
     default:
     {
@@ -321,7 +375,7 @@ lit_literal_equal_utf8 (lit_literal_t lit, /**< literal to compare */
   {
     case RCS_RECORD_TYPE_CHARSET:
     {
-      return rcs_record_is_equal_charset (&rcs_lit_storage, lit, str_p, str_size);
+      return rcs_record_is_equal_charset (&JERRY_CONTEXT (rcs_lit_storage), lit, str_p, str_size);
     }
     case RCS_RECORD_TYPE_MAGIC_STR:
     {
@@ -335,7 +389,7 @@ lit_literal_equal_utf8 (lit_literal_t lit, /**< literal to compare */
     }
     case RCS_RECORD_TYPE_NUMBER:
     {
-      ecma_number_t num = rcs_record_get_number (&rcs_lit_storage, lit);
+      ecma_number_t num = rcs_record_get_number (&JERRY_CONTEXT (rcs_lit_storage), lit);
 
       lit_utf8_byte_t num_buf[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
       lit_utf8_size_t num_size = ecma_number_to_utf8_string (num, num_buf, sizeof (num_buf));
@@ -399,7 +453,7 @@ lit_literal_equal (lit_literal_t lit1, /**< first literal */
     }
     case RCS_RECORD_TYPE_NUMBER:
     {
-      ecma_number_t num = rcs_record_get_number (&rcs_lit_storage, lit2);
+      ecma_number_t num = rcs_record_get_number (&JERRY_CONTEXT (rcs_lit_storage), lit2);
       return lit_literal_equal_num (lit1, num);
     }
     default:
@@ -500,7 +554,7 @@ lit_literal_to_utf8_string (lit_literal_t lit, /**< literal to be processed */
 
   if (RCS_RECORD_TYPE_IS_CHARSET (type))
   {
-    rcs_record_get_charset (&rcs_lit_storage, lit, buff_p, size);
+    rcs_record_get_charset (&JERRY_CONTEXT (rcs_lit_storage), lit, buff_p, size);
     return buff_p;
   }
   else if (RCS_RECORD_TYPE_IS_MAGIC_STR (type))
@@ -515,7 +569,7 @@ lit_literal_to_utf8_string (lit_literal_t lit, /**< literal to be processed */
   {
     JERRY_ASSERT (RCS_RECORD_TYPE_IS_NUMBER (type));
 
-    ecma_number_t number = rcs_record_get_number (&rcs_lit_storage, lit);
+    ecma_number_t number = rcs_record_get_number (&JERRY_CONTEXT (rcs_lit_storage), lit);
     ecma_number_to_utf8_string (number, buff_p, (ssize_t) size);
     return buff_p;
   }
@@ -530,10 +584,10 @@ lit_literal_to_utf8_string (lit_literal_t lit, /**< literal to be processed */
 const char *
 lit_literal_to_str_internal_buf (lit_literal_t lit) /**< literal */
 {
-  static lit_utf8_byte_t buff[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER + 1];
-  memset (buff, 0, sizeof (buff));
+  lit_utf8_byte_t *buff_p = JERRY_CONTEXT (lit_literal_str_buff);
+  memset (buff_p, 0, sizeof (JERRY_CONTEXT (lit_literal_str_buff)));
 
-  return (const char *) lit_literal_to_utf8_string (lit, buff, sizeof (buff) - 1);
+  return (const char *) lit_literal_to_utf8_string (lit, buff_p, sizeof (JERRY_CONTEXT (lit_literal_str_buff)) - 1);
 } /* lit_literal_to_str_internal_buf */
 
 
@@ -548,9 +602,9 @@ lit_literal_exists (lit_literal_t lit) /**< literal to check for existence */
 {
   lit_literal_t current_lit;
 
-  for (current_lit = rcs_record_get_first (&rcs_lit_storage);
+  for (current_lit = rcs_record_get_first (&JERRY_CONTEXT (rcs_lit_storage));
        current_lit != NULL;
-       current_lit = rcs_record_get_next (&rcs_lit_storage, current_lit))
+       current_lit = rcs_record_get_next (&JERRY_CONTEXT (rcs_lit_storage), current_lit))
   {
     if (current_lit == lit)
     {
@@ -610,7 +664,7 @@ lit_charset_literal_get_length (lit_literal_t lit) /**< literal */
 {
   TODO ("Add special case for literals which doesn't contain long characters");
 
-  rcs_iterator_t it_ctx = rcs_iterator_create (&rcs_lit_storage, lit);
+  rcs_iterator_t it_ctx = rcs_iterator_create (&JERRY_CONTEXT (rcs_lit_storage), lit);
   rcs_iterator_skip (&it_ctx, RCS_CHARSET_HEADER_SIZE);
 
   lit_utf8_size_t lit_utf8_str_size = rcs_record_get_length (lit);
@@ -641,5 +695,5 @@ lit_charset_literal_get_length (lit_literal_t lit) /**< literal */
 ecma_number_t
 lit_number_literal_get_number (lit_literal_t lit) /**< literal */
 {
-  return rcs_record_get_number (&rcs_lit_storage, lit);
+  return rcs_record_get_number (&JERRY_CONTEXT (rcs_lit_storage), lit);
 } /* lit_number_literal_get_number */
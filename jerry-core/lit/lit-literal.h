@@ -20,6 +20,8 @@
 
 extern void lit_init (void);
 extern void lit_finalize (void);
+extern bool lit_save_image (uint8_t *, size_t, size_t *);
+extern bool lit_load_image (const uint8_t *, size_t, size_t *);
 extern void lit_dump_literals (void);
 
 extern lit_literal_t lit_create_literal_from_utf8_string (const lit_utf8_byte_t *, lit_utf8_size_t);
@@ -16,8 +16,10 @@
 
 #include "lit-snapshot.h"
 
+#include "jcontext.h"
 #include "lit-literal.h"
 #include "lit-literal-storage.h"
+#include "lit-strings.h"
 #include "rcs-allocator.h"
 #include "rcs-iterator.h"
 #include "rcs-records.h"
@@ -40,7 +42,7 @@ lit_snapshot_dump (lit_literal_t lit, /**< literal to dump */
 
   if (RCS_RECORD_TYPE_IS_NUMBER (record_type))
   {
-    double num_value = rcs_record_get_number (&rcs_lit_storage, lit);
+    double num_value = rcs_record_get_number (&JERRY_CONTEXT (rcs_lit_storage), lit);
     size_t size = sizeof (num_value);
 
     if (!jrt_write_to_buffer_by_offset (buffer_p,
@@ -67,7 +69,7 @@ lit_snapshot_dump (lit_literal_t lit, /**< literal to dump */
       return 0;
     }
 
-    rcs_iterator_t it_ctx = rcs_iterator_create (&rcs_lit_storage, lit);
+    rcs_iterator_t it_ctx = rcs_iterator_create (&JERRY_CONTEXT (rcs_lit_storage), lit);
     rcs_iterator_skip (&it_ctx, RCS_CHARSET_HEADER_SIZE);
 
     lit_utf8_size_t i;
@@ -127,6 +129,61 @@ lit_snapshot_dump (lit_literal_t lit, /**< literal to dump */
   return 0;
 } /* lit_snapshot_dump */
 
+/**
+ * Restore the heap property of the literal map below the specified entry.
+ */
+static void
+lit_snapshot_map_sift_down (lit_mem_to_snapshot_id_map_entry_t *map_p, /**< literal map */
+                            uint32_t root, /**< root entry of the sub-heap */
+                            uint32_t end) /**< number of entries in the heap */
+{
+  while (2 * root + 1 < end)
+  {
+    uint32_t child = 2 * root + 1;
+
+    if (child + 1 < end
+        && map_p[child + 1].literal_id.u.packed_value > map_p[child].literal_id.u.packed_value)
+    {
+      child++;
+    }
+
+    if (map_p[root].literal_id.u.packed_value >= map_p[child].literal_id.u.packed_value)
+    {
+      return;
+    }
+
+    lit_mem_to_snapshot_id_map_entry_t entry = map_p[root];
+    map_p[root] = map_p[child];
+    map_p[child] = entry;
+
+    root = child;
+  }
+} /* lit_snapshot_map_sift_down */
+
+/**
+ * Sort the literal map by literal identifiers (heap sort).
+ */
+static void
+lit_snapshot_sort_map (lit_mem_to_snapshot_id_map_entry_t *map_p, /**< literal map */
+                       uint32_t map_num) /**< number of entries */
+{
+  uint32_t i;
+
+  for (i = map_num / 2; i > 0; i--)
+  {
+    lit_snapshot_map_sift_down (map_p, i - 1, map_num);
+  }
+
+  for (i = map_num; i > 1; i--)
+  {
+    lit_mem_to_snapshot_id_map_entry_t entry = map_p[0];
+    map_p[0] = map_p[i - 1];
+    map_p[i - 1] = entry;
+
+    lit_snapshot_map_sift_down (map_p, 0, i - 1);
+  }
+} /* lit_snapshot_sort_map */
+
 /**
  * Dump literals to specified snapshot buffer.
  *
@@ -138,12 +195,13 @@ lit_dump_literals_for_snapshot (uint8_t *buffer_p, /**< output snapshot buffer *
                                 size_t buffer_size, /**< size of the buffer */
                                 size_t *in_out_buffer_offset_p, /**< in-out: write position in the buffer */
                                 lit_mem_to_snapshot_id_map_entry_t **out_map_p, /**< out: map from literal identifiers
-                                                                                 *        to the literal offsets
-                                                                                 *        in snapshot */
+                                                                                 *        to the literal indices
+                                                                                 *        in snapshot, sorted by
+                                                                                 *        the identifiers */
                                 uint32_t *out_map_num_p, /**< out: number of literals */
                                 uint32_t *out_lit_table_size_p) /**< out: number of bytes, dumped to snapshot buffer */
 {
-  uint32_t literals_num = lit_storage_count_literals (&rcs_lit_storage);
+  uint32_t literals_num = lit_storage_count_literals (&JERRY_CONTEXT (rcs_lit_storage));
   uint32_t lit_table_size = 0;
 
   *out_map_p = NULL;
@@ -172,9 +230,9 @@ lit_dump_literals_for_snapshot (uint8_t *buffer_p, /**< output snapshot buffer *
     uint32_t literal_index = 0;
     lit_literal_t lit;
 
-    for (lit = rcs_record_get_first (&rcs_lit_storage);
+    for (lit = rcs_record_get_first (&JERRY_CONTEXT (rcs_lit_storage));
          lit != NULL;
-         lit = rcs_record_get_next (&rcs_lit_storage, lit))
+         lit = rcs_record_get_next (&JERRY_CONTEXT (rcs_lit_storage), lit))
     {
       rcs_record_type_t record_type = rcs_record_get_type (lit);
 
@@ -204,7 +262,7 @@ lit_dump_literals_for_snapshot (uint8_t *buffer_p, /**< output snapshot buffer *
 
       rcs_cpointer_t lit_cp = rcs_cpointer_compress (lit);
       id_map_p[literal_index].literal_id = lit_cp;
-      id_map_p[literal_index].literal_offset = lit_table_size;
+      id_map_p[literal_index].literal_index = literal_index;
 
       lit_table_size += (uint32_t) sizeof (record_type);
       lit_table_size += bytes;
@@ -219,6 +277,8 @@ lit_dump_literals_for_snapshot (uint8_t *buffer_p, /**< output snapshot buffer *
     }
 
     JERRY_ASSERT (literal_index == literals_num);
+
+    lit_snapshot_sort_map (id_map_p, literals_num);
     *out_map_p = id_map_p;
   }
 
@@ -250,23 +310,301 @@ lit_dump_literals_for_snapshot (uint8_t *buffer_p, /**< output snapshot buffer *
   return true;
 } /* lit_dump_literals_for_snapshot */
 
+/**
+ * Find the index of a literal in the snapshot literal table.
+ *
+ * @return index of the literal
+ */
+uint32_t
+lit_snapshot_find_literal_index (const lit_mem_to_snapshot_id_map_entry_t *map_p, /**< literal map, produced by
+                                                                                   *   lit_dump_literals_for_snapshot */
+                                 uint32_t map_num, /**< number of literals */
+                                 rcs_cpointer_t literal_id) /**< literal identifier */
+{
+  uint32_t lower = 0;
+  uint32_t upper = map_num;
+
+  while (lower < upper)
+  {
+    uint32_t middle = lower + (upper - lower) / 2;
+
+    if (map_p[middle].literal_id.u.packed_value < literal_id.u.packed_value)
+    {
+      lower = middle + 1;
+    }
+    else
+    {
+      upper = middle;
+    }
+  }
+
+  JERRY_ASSERT (lower < map_num
+                && map_p[lower].literal_id.u.packed_value == literal_id.u.packed_value);
+
+  return map_p[lower].literal_index;
+} /* lit_snapshot_find_literal_index */
+
 #endif /* JERRY_ENABLE_SNAPSHOT_SAVE */
 
 #ifdef JERRY_ENABLE_SNAPSHOT_EXEC
 
+/**
+ * Marker of the last entry in a bucket of the literal index
+ */
+#define LIT_SNAPSHOT_INDEX_END UINT32_MAX
+
+/**
+ * Minimum number of buckets in the literal index
+ */
+#define LIT_SNAPSHOT_INDEX_MIN_BUCKETS 16u
+
+/**
+ * Initial value of the literal index hash (32-bit FNV-1a offset basis)
+ */
+#define LIT_SNAPSHOT_HASH_BASIS 2166136261u
+
+/**
+ * Multiplier of the literal index hash (32-bit FNV-1a prime)
+ */
+#define LIT_SNAPSHOT_HASH_PRIME 16777619u
+
+/**
+ * Entry of the literal index
+ */
+typedef struct
+{
+  rcs_cpointer_t literal_id; /**< literal */
+  uint32_t next_index; /**< next entry in the same bucket */
+} lit_snapshot_index_entry_t;
+
+/**
+ * Hash index of the literal storage, which is used for finding the already
+ * existing literals while the literals of a snapshot are loaded
+ */
+typedef struct
+{
+  uint32_t *buckets_p; /**< first entry of each bucket */
+  uint32_t buckets_mask; /**< number of buckets minus one (the number of buckets is a power of two) */
+  lit_snapshot_index_entry_t *entries_p; /**< entries */
+  uint32_t entries_num; /**< number of used entries */
+} lit_snapshot_index_t;
+
+/**
+ * Update the hash of the literal index with the specified bytes.
+ *
+ * Note:
+ *      the 8-bit lit_string_hash_t would limit the index to 256 buckets,
+ *      so a 32-bit hash is used instead to allow sizing the index to the number of literals
+ *
+ * @return updated hash
+ */
+static uint32_t
+lit_snapshot_update_hash (uint32_t hash, /**< hash of the preceding bytes */
+                          const lit_utf8_byte_t *bytes_p, /**< bytes */
+                          lit_utf8_size_t bytes_size) /**< number of bytes */
+{
+  lit_utf8_size_t i;
+
+  for (i = 0; i < bytes_size; i++)
+  {
+    hash = (hash ^ bytes_p[i]) * LIT_SNAPSHOT_HASH_PRIME;
+  }
+
+  return hash;
+} /* lit_snapshot_update_hash */
+
+/**
+ * Calculate the hash of a string for the literal index.
+ *
+ * @return hash
+ */
+static uint32_t
+lit_snapshot_get_string_hash (const lit_utf8_byte_t *str_p, /**< string */
+                              lit_utf8_size_t str_size) /**< string size */
+{
+  return lit_snapshot_update_hash (LIT_SNAPSHOT_HASH_BASIS, str_p, str_size);
+} /* lit_snapshot_get_string_hash */
+
+/**
+ * Calculate the hash of a charset record for the literal index.
+ *
+ * @return hash, which is equal to the hash of the string stored in the record
+ */
+static uint32_t
+lit_snapshot_get_charset_hash (lit_literal_t lit) /**< charset literal */
+{
+  rcs_iterator_t it_ctx = rcs_iterator_create (&JERRY_CONTEXT (rcs_lit_storage), lit);
+  rcs_iterator_skip (&it_ctx, RCS_CHARSET_HEADER_SIZE);
+
+  lit_utf8_size_t len = rcs_record_get_length (lit);
+  uint32_t hash = LIT_SNAPSHOT_HASH_BASIS;
+  lit_utf8_size_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    lit_utf8_byte_t byte;
+    rcs_iterator_read (&it_ctx, &byte, sizeof (byte));
+    rcs_iterator_skip (&it_ctx, sizeof (byte));
+
+    hash = lit_snapshot_update_hash (hash, &byte, sizeof (byte));
+  }
+
+  return hash;
+} /* lit_snapshot_get_charset_hash */
+
+/**
+ * Calculate the hash of a number literal for the literal index.
+ *
+ * @return hash
+ */
+static uint32_t
+lit_snapshot_get_number_hash (ecma_number_t num) /**< number */
+{
+  if (num == 0)
+  {
+    /* Positive and negative zeros are equal. */
+    num = 0;
+  }
+
+  return lit_snapshot_get_string_hash ((const lit_utf8_byte_t *) &num, sizeof (num));
+} /* lit_snapshot_get_number_hash */
+
+/**
+ * Add a literal to the literal index.
+ */
+static void
+lit_snapshot_index_insert (lit_snapshot_index_t *index_p, /**< literal index */
+                           lit_literal_t lit, /**< literal */
+                           uint32_t hash) /**< hash of the literal */
+{
+  lit_snapshot_index_entry_t *entry_p = index_p->entries_p + index_p->entries_num;
+  uint32_t bucket = hash & index_p->buckets_mask;
+
+  entry_p->literal_id = rcs_cpointer_compress (lit);
+  entry_p->next_index = index_p->buckets_p[bucket];
+  index_p->buckets_p[bucket] = index_p->entries_num++;
+} /* lit_snapshot_index_insert */
+
+/**
+ * Add the literals of the literal storage to the literal index.
+ */
+static void
+lit_snapshot_index_add_storage_literals (lit_snapshot_index_t *index_p) /**< literal index */
+{
+  lit_literal_t lit;
+
+  for (lit = rcs_record_get_first (&JERRY_CONTEXT (rcs_lit_storage));
+       lit != NULL;
+       lit = rcs_record_get_next (&JERRY_CONTEXT (rcs_lit_storage), lit))
+  {
+    rcs_record_type_t type = rcs_record_get_type (lit);
+    uint32_t hash;
+
+    if (RCS_RECORD_TYPE_IS_CHARSET (type))
+    {
+      hash = lit_snapshot_get_charset_hash (lit);
+    }
+    else if (RCS_RECORD_TYPE_IS_MAGIC_STR (type))
+    {
+      lit_magic_string_id_t id = rcs_record_get_magic_str_id (lit);
+      hash = lit_snapshot_get_string_hash (lit_get_magic_string_utf8 (id), lit_get_magic_string_size (id));
+    }
+    else if (RCS_RECORD_TYPE_IS_MAGIC_STR_EX (type))
+    {
+      lit_magic_string_ex_id_t id = rcs_record_get_magic_str_ex_id (lit);
+      hash = lit_snapshot_get_string_hash (lit_get_magic_string_ex_utf8 (id), lit_get_magic_string_ex_size (id));
+    }
+    else if (RCS_RECORD_TYPE_IS_NUMBER (type))
+    {
+      hash = lit_snapshot_get_number_hash (rcs_record_get_number (&JERRY_CONTEXT (rcs_lit_storage), lit));
+    }
+    else
+    {
+      continue;
+    }
+
+    lit_snapshot_index_insert (index_p, lit, hash);
+  }
+} /* lit_snapshot_index_add_storage_literals */
+
+/**
+ * Find or create a string literal using the literal index.
+ *
+ * @return pointer to existing or newly created record
+ */
+static lit_literal_t
+lit_snapshot_find_or_create_string (lit_snapshot_index_t *index_p, /**< literal index */
+                                    const lit_utf8_byte_t *str_p, /**< string */
+                                    lit_utf8_size_t str_size) /**< string size */
+{
+  uint32_t hash = lit_snapshot_get_string_hash (str_p, str_size);
+  uint32_t entry_index = index_p->buckets_p[hash & index_p->buckets_mask];
+
+  while (entry_index != LIT_SNAPSHOT_INDEX_END)
+  {
+    lit_snapshot_index_entry_t *entry_p = index_p->entries_p + entry_index;
+    lit_literal_t lit = lit_get_literal_by_cp (entry_p->literal_id);
+
+    if (lit_literal_equal_type_utf8 (lit, str_p, str_size))
+    {
+      return lit;
+    }
+
+    entry_index = entry_p->next_index;
+  }
+
+  lit_literal_t lit = lit_create_literal_from_utf8_string (str_p, str_size);
+  lit_snapshot_index_insert (index_p, lit, hash);
+  return lit;
+} /* lit_snapshot_find_or_create_string */
+
+/**
+ * Find or create a number literal using the literal index.
+ *
+ * @return pointer to existing or newly created record
+ */
+static lit_literal_t
+lit_snapshot_find_or_create_number (lit_snapshot_index_t *index_p, /**< literal index */
+                                    ecma_number_t num) /**< number */
+{
+  uint32_t hash = lit_snapshot_get_number_hash (num);
+  uint32_t entry_index = index_p->buckets_p[hash & index_p->buckets_mask];
+
+  while (entry_index != LIT_SNAPSHOT_INDEX_END)
+  {
+    lit_snapshot_index_entry_t *entry_p = index_p->entries_p + entry_index;
+    lit_literal_t lit = lit_get_literal_by_cp (entry_p->literal_id);
+
+    if (RCS_RECORD_IS_NUMBER (lit)
+        && rcs_record_get_number (&JERRY_CONTEXT (rcs_lit_storage), lit) == num)
+    {
+      return lit;
+    }
+
+    entry_index = entry_p->next_index;
+  }
+
+  lit_literal_t lit = lit_create_literal_from_num (num);
+  lit_snapshot_index_insert (index_p, lit, hash);
+  return lit;
+} /* lit_snapshot_find_or_create_number */
+
 /**
  * Load literals from snapshot.
  *
+ * Existing literals are found through a temporary hash index of the literal storage,
+ * which has at least as many buckets as literals, so the time of loading is proportional
+ * to the number of literals.
+ *
  * @return true, if load was performed successfully (i.e. literals dump in the snapshot is consistent),
  *         false - otherwise (i.e. snapshot is incorrect).
  */
 bool
 lit_load_literals_from_snapshot (const uint8_t *lit_table_p, /**< buffer with literal table in snapshot */
                                  uint32_t lit_table_size, /**< size of literal table in snapshot */
-                                 lit_mem_to_snapshot_id_map_entry_t **out_map_p, /**< out: map from literal offsets
-                                                                                  *   in snapshot to identifiers
-                                                                                  *   of loaded literals in literal
-                                                                                  *   storage */
+                                 lit_cpointer_t **out_map_p, /**< out: map from literal indices in snapshot
+                                                              *        to identifiers of loaded literals
+                                                              *        in literal storage */
                                  uint32_t *out_map_num_p) /**< out: literals number */
 {
   *out_map_p = NULL;
@@ -289,18 +627,41 @@ lit_load_literals_from_snapshot (const uint8_t *lit_table_p, /**< buffer with li
     return true;
   }
 
-  size_t id_map_size = sizeof (lit_mem_to_snapshot_id_map_entry_t) * literals_num;
-  lit_mem_to_snapshot_id_map_entry_t *id_map_p;
-  id_map_p = (lit_mem_to_snapshot_id_map_entry_t *) mem_heap_alloc_block (id_map_size, MEM_HEAP_ALLOC_SHORT_TERM);
+  size_t id_map_size = sizeof (lit_cpointer_t) * literals_num;
+  lit_cpointer_t *id_map_p;
+  id_map_p = (lit_cpointer_t *) mem_heap_alloc_block (id_map_size, MEM_HEAP_ALLOC_SHORT_TERM);
+
+  uint32_t index_size = lit_storage_count_literals (&JERRY_CONTEXT (rcs_lit_storage)) + literals_num;
+
+  uint32_t buckets_num = LIT_SNAPSHOT_INDEX_MIN_BUCKETS;
+
+  while (buckets_num < index_size && buckets_num < (UINT32_MAX / 2 + 1))
+  {
+    buckets_num <<= 1;
+  }
+
+  lit_snapshot_index_t index;
+  index.buckets_p = (uint32_t *) mem_heap_alloc_block (buckets_num * sizeof (uint32_t),
+                                                       MEM_HEAP_ALLOC_SHORT_TERM);
+  index.buckets_mask = buckets_num - 1;
+  index.entries_p = (lit_snapshot_index_entry_t *) mem_heap_alloc_block (index_size
+                                                                         * sizeof (lit_snapshot_index_entry_t),
+                                                                         MEM_HEAP_ALLOC_SHORT_TERM);
+  index.entries_num = 0;
+
+  uint32_t bucket;
+  for (bucket = 0; bucket < buckets_num; bucket++)
+  {
+    index.buckets_p[bucket] = LIT_SNAPSHOT_INDEX_END;
+  }
+
+  lit_snapshot_index_add_storage_literals (&index);
 
   bool is_ok = true;
   uint32_t lit_index;
 
   for (lit_index = 0; lit_index < literals_num; ++lit_index)
   {
-    uint32_t offset = (uint32_t) lit_table_read;
-    JERRY_ASSERT (offset == lit_table_read);
-
     rcs_record_type_t type;
     if (!jrt_read_from_buffer_by_offset (lit_table_p,
                                          lit_table_size,
@@ -328,7 +689,7 @@ lit_load_literals_from_snapshot (const uint8_t *lit_table_p, /**< buffer with li
         break;
       }
 
-      lit = (lit_literal_t) lit_find_or_create_literal_from_utf8_string (lit_table_p + lit_table_read, length);
+      lit = lit_snapshot_find_or_create_string (&index, lit_table_p + lit_table_read, length);
       lit_table_read += length;
     }
     else if (RCS_RECORD_TYPE_IS_MAGIC_STR (type))
@@ -344,14 +705,9 @@ lit_load_literals_from_snapshot (const uint8_t *lit_table_p, /**< buffer with li
         break;
       }
 
-      const lit_utf8_byte_t *magic_str_p = lit_get_magic_string_utf8 (id);
-      lit_utf8_size_t magic_str_sz = lit_get_magic_string_size (id);
-
-      /*
-       * TODO:
-       *      Consider searching literal storage by magic string identifier instead of by its value
-       */
-      lit = (lit_literal_t) lit_find_or_create_literal_from_utf8_string (magic_str_p, magic_str_sz);
+      lit = lit_snapshot_find_or_create_string (&index,
+                                                lit_get_magic_string_utf8 (id),
+                                                lit_get_magic_string_size (id));
     }
     else if (RCS_RECORD_TYPE_IS_MAGIC_STR_EX (type))
     {
@@ -366,14 +722,9 @@ lit_load_literals_from_snapshot (const uint8_t *lit_table_p, /**< buffer with li
         break;
       }
 
-      const lit_utf8_byte_t *magic_str_ex_p = lit_get_magic_string_ex_utf8 (id);
-      lit_utf8_size_t magic_str_ex_sz = lit_get_magic_string_ex_size (id);
-
-      /*
-       * TODO:
-       *      Consider searching literal storage by magic string identifier instead of by its value
-       */
-      lit = (lit_literal_t) lit_find_or_create_literal_from_utf8_string (magic_str_ex_p, magic_str_ex_sz);
+      lit = lit_snapshot_find_or_create_string (&index,
+                                                lit_get_magic_string_ex_utf8 (id),
+                                                lit_get_magic_string_ex_size (id));
     }
     else if (RCS_RECORD_TYPE_IS_NUMBER (type))
     {
@@ -388,7 +739,7 @@ lit_load_literals_from_snapshot (const uint8_t *lit_table_p, /**< buffer with li
         break;
       }
 
-      lit = (lit_literal_t) lit_find_or_create_literal_from_num ((ecma_number_t) num);
+      lit = lit_snapshot_find_or_create_number (&index, (ecma_number_t) num);
     }
     else
     {
@@ -396,10 +747,12 @@ lit_load_literals_from_snapshot (const uint8_t *lit_table_p, /**< buffer with li
       break;
     }
 
-    id_map_p[lit_index].literal_offset = offset;
-    id_map_p[lit_index].literal_id = rcs_cpointer_compress (lit);
+    id_map_p[lit_index] = rcs_cpointer_compress (lit);
   }
 
+  mem_heap_free_block (index.entries_p);
+  mem_heap_free_block (index.buckets_p);
+
   if (is_ok)
   {
     *out_map_p = id_map_p;
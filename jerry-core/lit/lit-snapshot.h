@@ -17,12 +17,15 @@
 #ifndef RCS_SNAPSHOT_H
 #define RCS_SNAPSHOT_H
 
-#include "rcs-cpointer.h"
+#include "lit-globals.h"
 
+/**
+ * Entry of the map from literal identifiers to the literal indices in the snapshot
+ */
 typedef struct
 {
-  rcs_cpointer_t literal_id;
-  uint32_t literal_offset;
+  rcs_cpointer_t literal_id; /**< literal identifier */
+  uint32_t literal_index; /**< index of the literal in the snapshot literal table */
 } lit_mem_to_snapshot_id_map_entry_t;
 
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
@@ -33,13 +36,18 @@ lit_dump_literals_for_snapshot (uint8_t *,
                                 lit_mem_to_snapshot_id_map_entry_t **,
                                 uint32_t *,
                                 uint32_t *);
+
+extern uint32_t
+lit_snapshot_find_literal_index (const lit_mem_to_snapshot_id_map_entry_t *,
+                                 uint32_t,
+                                 rcs_cpointer_t);
 #endif /* JERRY_ENABLE_SNAPSHOT_SAVE */
 
 #ifdef JERRY_ENABLE_SNAPSHOT_EXEC
 extern bool
 lit_load_literals_from_snapshot (const uint8_t *,
                                  uint32_t,
-                                 lit_mem_to_snapshot_id_map_entry_t **,
+                                 lit_cpointer_t **,
                                  uint32_t *);
 #endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
 
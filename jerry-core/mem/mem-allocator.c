@@ -17,6 +17,7 @@
  * Allocator implementation
  */
 
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "mem-allocator.h"
@@ -27,11 +28,6 @@
 
 #include "mem-allocator-internal.h"
 
-/**
- * The 'try to give memory back' callback
- */
-static mem_try_give_memory_back_callback_t mem_try_give_memory_back_callback = NULL;
-
 /**
  * Initialize memory allocators.
  */
@@ -63,6 +59,43 @@ mem_finalize (bool is_show_mem_stats) /**< show heap memory stats
   mem_heap_finalize ();
 } /* mem_finalize */
 
+/**
+ * Save state of memory allocators to a heap image
+ *
+ * @return true - if the state was written successfully,
+ *         false - if the buffer is too small.
+ */
+bool
+mem_save_image (uint8_t *buffer_p, /**< buffer */
+                size_t buffer_size, /**< size of buffer */
+                size_t *in_out_buffer_offset_p) /**< in: offset to write to,
+                                                 *   out: offset, incremented on size of the written data */
+{
+  return (mem_heap_save_image (buffer_p, buffer_size, in_out_buffer_offset_p)
+          && mem_pools_save_image (buffer_p, buffer_size, in_out_buffer_offset_p));
+} /* mem_save_image */
+
+/**
+ * Initialize memory allocators from a heap image
+ *
+ * Note:
+ *      the routine should be called instead of mem_init
+ *
+ * @return true - if the state was restored successfully,
+ *         false - otherwise.
+ */
+bool
+mem_load_image (const uint8_t *buffer_p, /**< buffer */
+                size_t buffer_size, /**< size of buffer */
+                size_t *in_out_buffer_offset_p) /**< in: offset to read from,
+                                                 *   out: offset, incremented on size of the read data */
+{
+  uintptr_t saved_heap_start;
+
+  return (mem_heap_load_image (buffer_p, buffer_size, in_out_buffer_offset_p, &saved_heap_start)
+          && mem_pools_load_image (buffer_p, buffer_size, in_out_buffer_offset_p, saved_heap_start));
+} /* mem_load_image */
+
 /**
  * Compress pointer
  *
@@ -94,9 +127,9 @@ void
 mem_register_a_try_give_memory_back_callback (mem_try_give_memory_back_callback_t callback) /* callback routine */
 {
   /* Currently only one callback is supported */
-  JERRY_ASSERT (mem_try_give_memory_back_callback == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_try_give_memory_back_callback) == NULL);
 
-  mem_try_give_memory_back_callback = callback;
+  JERRY_CONTEXT (mem_try_give_memory_back_callback) = callback;
 } /* mem_register_a_try_give_memory_back_callback */
 
 /**
@@ -106,9 +139,9 @@ void
 mem_unregister_a_try_give_memory_back_callback (mem_try_give_memory_back_callback_t callback) /* callback routine */
 {
   /* Currently only one callback is supported */
-  JERRY_ASSERT (mem_try_give_memory_back_callback == callback);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_try_give_memory_back_callback) == callback);
 
-  mem_try_give_memory_back_callback = NULL;
+  JERRY_CONTEXT (mem_try_give_memory_back_callback) = NULL;
 } /* mem_unregister_a_try_give_memory_back_callback */
 
 /**
@@ -118,9 +151,9 @@ void
 mem_run_try_to_give_memory_back_callbacks (mem_try_give_memory_back_severity_t severity) /**< severity of
                                                                                               the request */
 {
-  if (mem_try_give_memory_back_callback != NULL)
+  if (JERRY_CONTEXT (mem_try_give_memory_back_callback) != NULL)
   {
-    mem_try_give_memory_back_callback (severity);
+    JERRY_CONTEXT (mem_try_give_memory_back_callback) (severity);
   }
 
   mem_pools_collect_empty ();
@@ -113,6 +113,8 @@ typedef void (*mem_try_give_memory_back_callback_t) (mem_try_give_memory_back_se
 
 extern void mem_init (void);
 extern void mem_finalize (bool);
+extern bool mem_save_image (uint8_t *, size_t, size_t *);
+extern bool mem_load_image (const uint8_t *, size_t, size_t *);
 
 extern uintptr_t mem_compress_pointer (const void *);
 extern void *mem_decompress_pointer (uintptr_t);
@@ -24,6 +24,7 @@
  * Heap implementation
  */
 
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-bit-fields.h"
 #include "jrt-libc-includes.h"
@@ -54,22 +55,17 @@
 #ifdef JERRY_VALGRIND_FREYA
 # include "memcheck.h"
 
-/**
- * Tells whether a pool manager allocator request is in progress.
- */
-static bool valgrind_freya_mempool_request = false;
-
 /**
  * Called by pool manager before a heap allocation or free.
  */
 void mem_heap_valgrind_freya_mempool_request (void)
 {
-  valgrind_freya_mempool_request = true;
+  JERRY_CONTEXT (valgrind_freya_mempool_request) = true;
 } /* mem_heap_valgrind_freya_mempool_request */
 
 # define VALGRIND_FREYA_CHECK_MEMPOOL_REQUEST \
-  bool mempool_request = valgrind_freya_mempool_request; \
-  valgrind_freya_mempool_request = false
+  bool mempool_request = JERRY_CONTEXT (valgrind_freya_mempool_request); \
+  JERRY_CONTEXT (valgrind_freya_mempool_request) = false
 
 # define VALGRIND_FREYA_MALLOCLIKE_SPACE(p, s) \
   if (!mempool_request) \
@@ -89,175 +85,36 @@ void mem_heap_valgrind_freya_mempool_request (void)
 # define VALGRIND_FREYA_FREELIKE_SPACE(p)
 #endif /* JERRY_VALGRIND_FREYA */
 
-/**
- * Length type of the block
- */
-typedef enum __attr_packed___
-{
-  MEM_BLOCK_LENGTH_TYPE_GENERAL     = 0, /**< general (may be multi-chunk) block
-                                          *
-                                          *   Note:
-                                          *         As zero is used for initialization in mem_heap_init,
-                                          *         0 value for the MEM_BLOCK_LENGTH_TYPE_GENERAL is necessary
-                                          */
-  MEM_BLOCK_LENGTH_TYPE_ONE_CHUNKED = 1  /**< one-chunked block (See also: mem_heap_alloc_chunked_block) */
-} mem_block_length_type_t;
-
 /**
  * Chunk size should satisfy the required alignment value
  */
 JERRY_STATIC_ASSERT (MEM_HEAP_CHUNK_SIZE % MEM_ALIGNMENT == 0);
 
-typedef enum
-{
-  MEM_HEAP_BITMAP_IS_ALLOCATED, /**< bitmap of 'chunk allocated' flags */
-  MEM_HEAP_BITMAP_IS_FIRST_IN_BLOCK, /**< bitmap of 'chunk is first in allocated block' flags */
-
-  MEM_HEAP_BITMAP__COUNT /**< number of bitmaps */
-} mem_heap_bitmap_t;
-
-/**
- * Type of bitmap storage item, used to store one or several bitmap blocks
- */
-typedef size_t mem_heap_bitmap_storage_item_t;
-
-/**
- * Mask of a single bit at specified offset in a bitmap storage item
- */
-#define MEM_HEAP_BITMAP_ITEM_BIT(offset) (((mem_heap_bitmap_storage_item_t) 1u) << (offset))
-
-/**
- * Number of bits in a bitmap storage item
- */
-#define MEM_HEAP_BITMAP_BITS_IN_STORAGE_ITEM (sizeof (mem_heap_bitmap_storage_item_t) * JERRY_BITSINBYTE)
-
-/**
- * Full bit mask for a bitmap storage item
- */
-#define MEM_HEAP_BITMAP_STORAGE_ALL_BITS_MASK ((mem_heap_bitmap_storage_item_t) -1)
-
-/**
- * Number of chunks in heap
- *
- *                           bits_in_heap
- * ALIGN_DOWN (-----------------------------------------, bits_in_bitmap_storage_item)
- *               bitmap_bits_per_chunk + bits_in_chunk
- */
-#define MEM_HEAP_CHUNKS_NUM JERRY_ALIGNDOWN (JERRY_BITSINBYTE * MEM_HEAP_SIZE / \
-                                             (MEM_HEAP_BITMAP__COUNT + JERRY_BITSINBYTE * MEM_HEAP_CHUNK_SIZE), \
-                                             MEM_HEAP_BITMAP_BITS_IN_STORAGE_ITEM)
-
-/**
- * Size of heap data area
- */
-#define MEM_HEAP_AREA_SIZE (MEM_HEAP_CHUNKS_NUM * MEM_HEAP_CHUNK_SIZE)
-
-/**
- * Number of bits in heap's bitmap
- */
-#define MEM_HEAP_BITMAP_BITS (MEM_HEAP_CHUNKS_NUM * 1u)
-
 /**
  * Overall number of bitmap bits is multiple of number of bits in a bitmap storage item
  */
 JERRY_STATIC_ASSERT (MEM_HEAP_BITMAP_BITS % MEM_HEAP_BITMAP_BITS_IN_STORAGE_ITEM == 0);
 
-/**
- * Number of bitmap storage items
- */
-#define MEM_HEAP_BITMAP_STORAGE_ITEMS (MEM_HEAP_BITMAP_BITS / MEM_HEAP_BITMAP_BITS_IN_STORAGE_ITEM)
-
-/**
- * Heap structure
- */
-typedef struct
-{
-  /**
-   * Heap bitmaps
-   *
-   * The bitmaps consist of chunks with unique correspondence to the heap chunks
-   */
-  mem_heap_bitmap_storage_item_t bitmaps[MEM_HEAP_BITMAP__COUNT][MEM_HEAP_BITMAP_STORAGE_ITEMS];
-
-  /**
-   * Heap area
-   */
-  uint8_t area[MEM_HEAP_AREA_SIZE] __attribute__ ((aligned (JERRY_MAX (MEM_ALIGNMENT, MEM_HEAP_CHUNK_SIZE))));
-} mem_heap_t;
-
-/**
- * Heap
- */
-#ifndef JERRY_HEAP_SECTION_ATTR
-mem_heap_t mem_heap;
-#else
-mem_heap_t mem_heap __attribute__ ((section (JERRY_HEAP_SECTION_ATTR)));
-#endif
-
 /**
  * Check size of heap is corresponding to configuration
  */
-JERRY_STATIC_ASSERT (sizeof (mem_heap) <= MEM_HEAP_SIZE);
+JERRY_STATIC_ASSERT (sizeof (mem_heap_t) <= MEM_HEAP_SIZE);
 
 /**
  * Bitmap of 'is allocated' flags
  */
-#define MEM_HEAP_IS_ALLOCATED_BITMAP (mem_heap.bitmaps[MEM_HEAP_BITMAP_IS_ALLOCATED])
+#define MEM_HEAP_IS_ALLOCATED_BITMAP (JERRY_HEAP_CONTEXT (bitmaps)[MEM_HEAP_BITMAP_IS_ALLOCATED])
 
 /**
  * Bitmap of 'is first in block' flags
  */
-#define MEM_HEAP_IS_FIRST_IN_BLOCK_BITMAP (mem_heap.bitmaps[MEM_HEAP_BITMAP_IS_FIRST_IN_BLOCK])
-
-/**
- * Total number of allocated heap chunks
- */
-size_t mem_heap_allocated_chunks;
-
-/**
- * Current limit of heap usage, that is upon being reached, causes call of "try give memory back" callbacks
- */
-size_t mem_heap_limit;
-
-#if defined (JERRY_VALGRIND) || defined (MEM_STATS) || !defined (JERRY_DISABLE_HEAVY_DEBUG)
-
-# define MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY
-
-/**
- * Number of bytes, allocated in heap block
- *
- * The array contains one entry per heap chunk with:
- *  - number of allocated bytes, if the chunk is at start of an allocated block;
- *  - 0, if the chunk is at start of free block;
- *  - -1, if the chunk is not at start of a block.
- */
-ssize_t mem_heap_allocated_bytes[MEM_HEAP_CHUNKS_NUM];
-#else /* JERRY_VALGRIND || MEM_STATS || !JERRY_DISABLE_HEAVY_DEBUG */
-# ifdef MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY
-#  error "!"
-# endif /* MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY */
-#endif /* !JERRY_VALGRIND && !MEM_STATS && JERRY_DISABLE_HEAVY_DEBUG */
-
-#ifndef JERRY_NDEBUG
-/**
- * Length types for allocated chunks
- *
- * The array contains one entry per heap chunk with:
- *  - length type of corresponding block, if the chunk is at start of an allocated block;
- *  - MEM_BLOCK_LENGTH_TYPE_GENERAL length type for rest chunks.
- */
-mem_block_length_type_t mem_heap_length_types[MEM_HEAP_CHUNKS_NUM];
-#endif /* !JERRY_NDEBUG */
+#define MEM_HEAP_IS_FIRST_IN_BLOCK_BITMAP (JERRY_HEAP_CONTEXT (bitmaps)[MEM_HEAP_BITMAP_IS_FIRST_IN_BLOCK])
 
 static size_t mem_get_block_chunks_count_from_data_size (size_t block_allocated_size);
 
 static void mem_check_heap (void);
 
 #ifdef MEM_STATS
-/**
- * Heap's memory usage statistics
- */
-static mem_heap_stats_t mem_heap_stats;
 
 static void mem_heap_stat_init (void);
 static void mem_heap_stat_alloc (size_t first_chunk_index, size_t chunks_num);
@@ -291,7 +148,7 @@ mem_get_block_chunks_count_from_data_size (size_t block_allocated_size) /**< siz
 static size_t
 mem_heap_get_chunk_from_address (const void *chunk_start_p) /**< address of a chunk's beginning */
 {
-  uintptr_t heap_start_uintptr = (uintptr_t) mem_heap.area;
+  uintptr_t heap_start_uintptr = (uintptr_t) JERRY_HEAP_CONTEXT (area);
   uintptr_t chunk_start_uintptr = (uintptr_t) chunk_start_p;
 
   uintptr_t chunk_offset = chunk_start_uintptr - heap_start_uintptr;
@@ -330,33 +187,33 @@ void
 mem_heap_init (void)
 {
   JERRY_STATIC_ASSERT ((MEM_HEAP_CHUNK_SIZE & (MEM_HEAP_CHUNK_SIZE - 1u)) == 0);
-  JERRY_STATIC_ASSERT ((uintptr_t) mem_heap.area % MEM_ALIGNMENT == 0);
-  JERRY_STATIC_ASSERT ((uintptr_t) mem_heap.area % MEM_HEAP_CHUNK_SIZE == 0);
+  JERRY_ASSERT ((uintptr_t) JERRY_HEAP_CONTEXT (area) % MEM_ALIGNMENT == 0);
+  JERRY_ASSERT ((uintptr_t) JERRY_HEAP_CONTEXT (area) % MEM_HEAP_CHUNK_SIZE == 0);
   JERRY_STATIC_ASSERT (MEM_HEAP_AREA_SIZE % MEM_HEAP_CHUNK_SIZE == 0);
 
   JERRY_ASSERT (MEM_HEAP_AREA_SIZE <= (1u << MEM_HEAP_OFFSET_LOG));
 
-  mem_heap_limit = CONFIG_MEM_HEAP_DESIRED_LIMIT;
+  JERRY_CONTEXT (mem_heap_limit) = CONFIG_MEM_HEAP_DESIRED_LIMIT;
 
-  VALGRIND_NOACCESS_SPACE (mem_heap.area, MEM_HEAP_AREA_SIZE);
+  VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (area), MEM_HEAP_AREA_SIZE);
 
   memset (MEM_HEAP_IS_ALLOCATED_BITMAP, 0, sizeof (MEM_HEAP_IS_ALLOCATED_BITMAP));
   memset (MEM_HEAP_IS_FIRST_IN_BLOCK_BITMAP, 0, sizeof (MEM_HEAP_IS_FIRST_IN_BLOCK_BITMAP));
 
 #ifdef MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY
-  memset (mem_heap_allocated_bytes, -1, sizeof (mem_heap_allocated_bytes));
+  memset (JERRY_CONTEXT (mem_heap_allocated_bytes), -1, sizeof (JERRY_CONTEXT (mem_heap_allocated_bytes)));
 
   for (size_t i = 0; i < MEM_HEAP_CHUNKS_NUM; i++)
   {
 #ifndef JERRY_NDEBUG
-    JERRY_ASSERT (mem_heap_length_types[i] == MEM_BLOCK_LENGTH_TYPE_GENERAL);
+    JERRY_ASSERT (JERRY_CONTEXT (mem_heap_length_types)[i] == MEM_BLOCK_LENGTH_TYPE_GENERAL);
 #endif /* !JERRY_NDEBUG */
 
-    JERRY_ASSERT (mem_heap_allocated_bytes[i] == -1);
+    JERRY_ASSERT (JERRY_CONTEXT (mem_heap_allocated_bytes)[i] == -1);
   }
 #endif /* MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY */
 
-  VALGRIND_NOACCESS_SPACE (&mem_heap, sizeof (mem_heap));
+  VALGRIND_NOACCESS_SPACE (&JERRY_HEAP, sizeof (mem_heap_t));
 
   MEM_HEAP_STAT_INIT ();
 } /* mem_heap_init */
@@ -367,9 +224,9 @@ mem_heap_init (void)
 void
 mem_heap_finalize (void)
 {
-  JERRY_ASSERT (mem_heap_allocated_chunks == 0);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_allocated_chunks) == 0);
 
-  VALGRIND_NOACCESS_SPACE (&mem_heap, sizeof (mem_heap));
+  VALGRIND_NOACCESS_SPACE (&JERRY_HEAP, sizeof (mem_heap_t));
 } /* mem_heap_finalize */
 
 /**
@@ -403,7 +260,7 @@ mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region to allo
   size_t found_chunks_num = 0;
   size_t first_chunk = MEM_HEAP_CHUNKS_NUM;
 
-  VALGRIND_DEFINED_SPACE (mem_heap.bitmaps, sizeof (mem_heap.bitmaps));
+  VALGRIND_DEFINED_SPACE (JERRY_HEAP_CONTEXT (bitmaps), sizeof (JERRY_HEAP_CONTEXT (bitmaps)));
 
   for (size_t i = 0;
        i < MEM_HEAP_BITMAP_STORAGE_ITEMS && found_chunks_num != req_chunks_num;
@@ -448,7 +305,7 @@ mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region to allo
     }
   }
 
-  VALGRIND_NOACCESS_SPACE (mem_heap.bitmaps, sizeof (mem_heap.bitmaps));
+  VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (bitmaps), sizeof (JERRY_HEAP_CONTEXT (bitmaps)));
 
   if (found_chunks_num != req_chunks_num)
   {
@@ -461,26 +318,26 @@ mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region to allo
   JERRY_ASSERT (req_chunks_num <= found_chunks_num);
 
 #ifdef MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY
-  mem_heap_allocated_bytes[first_chunk] = (ssize_t) size_in_bytes;
+  JERRY_CONTEXT (mem_heap_allocated_bytes)[first_chunk] = (ssize_t) size_in_bytes;
 #endif /* MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY */
 
-  mem_heap_allocated_chunks += req_chunks_num;
+  JERRY_CONTEXT (mem_heap_allocated_chunks) += req_chunks_num;
 
-  JERRY_ASSERT (mem_heap_allocated_chunks * MEM_HEAP_CHUNK_SIZE <= MEM_HEAP_AREA_SIZE);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_allocated_chunks) * MEM_HEAP_CHUNK_SIZE <= MEM_HEAP_AREA_SIZE);
 
-  if (mem_heap_allocated_chunks * MEM_HEAP_CHUNK_SIZE >= mem_heap_limit)
+  if (JERRY_CONTEXT (mem_heap_allocated_chunks) * MEM_HEAP_CHUNK_SIZE >= JERRY_CONTEXT (mem_heap_limit))
   {
-    mem_heap_limit = JERRY_MIN (MEM_HEAP_AREA_SIZE,
-                                JERRY_MAX (mem_heap_limit + CONFIG_MEM_HEAP_DESIRED_LIMIT,
-                                           mem_heap_allocated_chunks * MEM_HEAP_CHUNK_SIZE));
-    JERRY_ASSERT (mem_heap_limit >= mem_heap_allocated_chunks * MEM_HEAP_CHUNK_SIZE);
+    JERRY_CONTEXT (mem_heap_limit) = JERRY_MIN (MEM_HEAP_AREA_SIZE,
+                                JERRY_MAX (JERRY_CONTEXT (mem_heap_limit) + CONFIG_MEM_HEAP_DESIRED_LIMIT,
+                                           JERRY_CONTEXT (mem_heap_allocated_chunks) * MEM_HEAP_CHUNK_SIZE));
+    JERRY_ASSERT (JERRY_CONTEXT (mem_heap_limit) >= JERRY_CONTEXT (mem_heap_allocated_chunks) * MEM_HEAP_CHUNK_SIZE);
   }
 
-  VALGRIND_DEFINED_SPACE (mem_heap.bitmaps, sizeof (mem_heap.bitmaps));
+  VALGRIND_DEFINED_SPACE (JERRY_HEAP_CONTEXT (bitmaps), sizeof (JERRY_HEAP_CONTEXT (bitmaps)));
 
   mem_heap_mark_chunk_allocated (first_chunk, true);
 #ifndef JERRY_NDEBUG
-  mem_heap_length_types[first_chunk] = length_type;
+  JERRY_CONTEXT (mem_heap_length_types)[first_chunk] = length_type;
 #endif /* !JERRY_NDEBUG */
 
   for (size_t chunk_index = first_chunk + 1u;
@@ -491,16 +348,16 @@ mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region to allo
 
 #ifndef JERRY_NDEBUG
     JERRY_ASSERT (length_type == MEM_BLOCK_LENGTH_TYPE_GENERAL
-                  && mem_heap_length_types[chunk_index] == length_type);
+                  && JERRY_CONTEXT (mem_heap_length_types)[chunk_index] == length_type);
 #endif /* !JERRY_NDEBUG */
   }
 
-  VALGRIND_NOACCESS_SPACE (mem_heap.bitmaps, sizeof (mem_heap.bitmaps));
+  VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (bitmaps), sizeof (JERRY_HEAP_CONTEXT (bitmaps)));
 
   MEM_HEAP_STAT_ALLOC (first_chunk, req_chunks_num);
 
   /* return data space beginning address */
-  uint8_t *data_space_p = (uint8_t *) mem_heap.area + (first_chunk * MEM_HEAP_CHUNK_SIZE);
+  uint8_t *data_space_p = (uint8_t *) JERRY_HEAP_CONTEXT (area) + (first_chunk * MEM_HEAP_CHUNK_SIZE);
   JERRY_ASSERT ((uintptr_t) data_space_p % MEM_ALIGNMENT == 0);
 
   VALGRIND_UNDEFINED_SPACE (data_space_p, size_in_bytes);
@@ -539,7 +396,7 @@ mem_heap_alloc_block_try_give_memory_back (size_t size_in_bytes, /**< size of re
 #endif /* MEM_GC_BEFORE_EACH_ALLOC */
 
   size_t chunks = mem_get_block_chunks_count_from_data_size (size_in_bytes);
-  if ((mem_heap_allocated_chunks + chunks) * MEM_HEAP_CHUNK_SIZE >= mem_heap_limit)
+  if ((JERRY_CONTEXT (mem_heap_allocated_chunks) + chunks) * MEM_HEAP_CHUNK_SIZE >= JERRY_CONTEXT (mem_heap_limit))
   {
     mem_run_try_to_give_memory_back_callbacks (MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_LOW);
   }
@@ -632,18 +489,19 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
   uint8_t *uint8_ptr = (uint8_t *) ptr;
 
   /* checking that uint8_ptr points to the heap */
-  JERRY_ASSERT (uint8_ptr >= mem_heap.area && uint8_ptr <= (uint8_t *) mem_heap.area + MEM_HEAP_AREA_SIZE);
+  JERRY_ASSERT (uint8_ptr >= JERRY_HEAP_CONTEXT (area)
+                && uint8_ptr <= (uint8_t *) JERRY_HEAP_CONTEXT (area) + MEM_HEAP_AREA_SIZE);
 
   mem_check_heap ();
 
-  JERRY_ASSERT (mem_heap_limit >= mem_heap_allocated_chunks * MEM_HEAP_CHUNK_SIZE);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_limit) >= JERRY_CONTEXT (mem_heap_allocated_chunks) * MEM_HEAP_CHUNK_SIZE);
 
   size_t chunk_index = mem_heap_get_chunk_from_address (ptr);
 
   size_t chunks = 0;
   bool is_block_end_reached = false;
 
-  VALGRIND_DEFINED_SPACE (mem_heap.bitmaps, sizeof (mem_heap.bitmaps));
+  VALGRIND_DEFINED_SPACE (JERRY_HEAP_CONTEXT (bitmaps), sizeof (JERRY_HEAP_CONTEXT (bitmaps)));
 
   for (size_t bitmap_item_index = chunk_index / MEM_HEAP_BITMAP_BITS_IN_STORAGE_ITEM;
        bitmap_item_index < MEM_HEAP_BITMAP_STORAGE_ITEMS && !is_block_end_reached;
@@ -704,37 +562,38 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
     }
   }
 
-  VALGRIND_NOACCESS_SPACE (mem_heap.bitmaps, sizeof (mem_heap.bitmaps));
+  VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (bitmaps), sizeof (JERRY_HEAP_CONTEXT (bitmaps)));
 
 #ifdef JERRY_VALGRIND
-  VALGRIND_CHECK_MEM_IS_ADDRESSABLE (ptr, mem_heap_allocated_bytes[chunk_index]);
+  VALGRIND_CHECK_MEM_IS_ADDRESSABLE (ptr, JERRY_CONTEXT (mem_heap_allocated_bytes)[chunk_index]);
 #endif /* JERRY_VALGRIND */
 
   VALGRIND_FREYA_FREELIKE_SPACE (ptr);
   VALGRIND_NOACCESS_SPACE (ptr, chunks * MEM_HEAP_CHUNK_SIZE);
 
-  JERRY_ASSERT (mem_heap_allocated_chunks >= chunks);
-  mem_heap_allocated_chunks -= chunks;
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_allocated_chunks) >= chunks);
+  JERRY_CONTEXT (mem_heap_allocated_chunks) -= chunks;
 
-  if (mem_heap_allocated_chunks * MEM_HEAP_CHUNK_SIZE * 3 <= mem_heap_limit)
+  if (JERRY_CONTEXT (mem_heap_allocated_chunks) * MEM_HEAP_CHUNK_SIZE * 3 <= JERRY_CONTEXT (mem_heap_limit))
   {
-    mem_heap_limit /= 2;
+    JERRY_CONTEXT (mem_heap_limit) /= 2;
   }
-  else if (mem_heap_allocated_chunks * MEM_HEAP_CHUNK_SIZE + CONFIG_MEM_HEAP_DESIRED_LIMIT <= mem_heap_limit)
+  else if (JERRY_CONTEXT (mem_heap_allocated_chunks) * MEM_HEAP_CHUNK_SIZE + CONFIG_MEM_HEAP_DESIRED_LIMIT
+           <= JERRY_CONTEXT (mem_heap_limit))
   {
-    mem_heap_limit -= CONFIG_MEM_HEAP_DESIRED_LIMIT;
+    JERRY_CONTEXT (mem_heap_limit) -= CONFIG_MEM_HEAP_DESIRED_LIMIT;
   }
 
-  JERRY_ASSERT (mem_heap_limit >= mem_heap_allocated_chunks * MEM_HEAP_CHUNK_SIZE);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_limit) >= JERRY_CONTEXT (mem_heap_allocated_chunks) * MEM_HEAP_CHUNK_SIZE);
 
   MEM_HEAP_STAT_FREE (chunk_index, chunks);
 
 #ifdef MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY
-  mem_heap_allocated_bytes[chunk_index] = 0;
+  JERRY_CONTEXT (mem_heap_allocated_bytes)[chunk_index] = 0;
 #endif /* MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY */
 
 #ifndef JERRY_NDEBUG
-  mem_heap_length_types[chunk_index] = MEM_BLOCK_LENGTH_TYPE_GENERAL;
+  JERRY_CONTEXT (mem_heap_length_types)[chunk_index] = MEM_BLOCK_LENGTH_TYPE_GENERAL;
 #endif /* !JERRY_NDEBUG */
 
   mem_check_heap ();
@@ -758,9 +617,10 @@ void *
 mem_heap_get_chunked_block_start (void *ptr) /**< pointer into a block */
 {
   JERRY_STATIC_ASSERT ((MEM_HEAP_CHUNK_SIZE & (MEM_HEAP_CHUNK_SIZE - 1u)) == 0);
-  JERRY_STATIC_ASSERT (((uintptr_t) mem_heap.area % MEM_HEAP_CHUNK_SIZE) == 0);
+  JERRY_ASSERT (((uintptr_t) JERRY_HEAP_CONTEXT (area) % MEM_HEAP_CHUNK_SIZE) == 0);
 
-  JERRY_ASSERT (mem_heap.area <= (uint8_t *) ptr && (uint8_t *) ptr < (uint8_t *) mem_heap.area + MEM_HEAP_AREA_SIZE);
+  JERRY_ASSERT (JERRY_HEAP_CONTEXT (area) <= (uint8_t *) ptr
+                && (uint8_t *) ptr < (uint8_t *) JERRY_HEAP_CONTEXT (area) + MEM_HEAP_AREA_SIZE);
 
   uintptr_t uintptr = (uintptr_t) ptr;
   uintptr_t uintptr_chunk_aligned = JERRY_ALIGNDOWN (uintptr, MEM_HEAP_CHUNK_SIZE);
@@ -769,7 +629,7 @@ mem_heap_get_chunked_block_start (void *ptr) /**< pointer into a block */
 
 #ifndef JERRY_NDEBUG
   size_t chunk_index = mem_heap_get_chunk_from_address ((void *) uintptr_chunk_aligned);
-  JERRY_ASSERT (mem_heap_length_types[chunk_index] == MEM_BLOCK_LENGTH_TYPE_ONE_CHUNKED);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_length_types)[chunk_index] == MEM_BLOCK_LENGTH_TYPE_ONE_CHUNKED);
 #endif /* !JERRY_NDEBUG */
 
   return (void *) uintptr_chunk_aligned;
@@ -806,7 +666,7 @@ mem_heap_compress_pointer (const void *pointer_p) /**< pointer to compress */
   JERRY_ASSERT (pointer_p != NULL);
 
   uintptr_t int_ptr = (uintptr_t) pointer_p;
-  uintptr_t heap_start = (uintptr_t) &mem_heap;
+  uintptr_t heap_start = (uintptr_t) &JERRY_HEAP;
 
   JERRY_ASSERT (int_ptr % MEM_ALIGNMENT == 0);
 
@@ -831,7 +691,7 @@ mem_heap_decompress_pointer (uintptr_t compressed_pointer) /**< pointer to decom
   JERRY_ASSERT (compressed_pointer != MEM_CP_NULL);
 
   uintptr_t int_ptr = compressed_pointer;
-  uintptr_t heap_start = (uintptr_t) &mem_heap;
+  uintptr_t heap_start = (uintptr_t) &JERRY_HEAP;
 
   int_ptr <<= MEM_ALIGNMENT_LOG;
   int_ptr += heap_start;
@@ -839,6 +699,197 @@ mem_heap_decompress_pointer (uintptr_t compressed_pointer) /**< pointer to decom
   return (void *) int_ptr;
 } /* mem_heap_decompress_pointer */
 
+/**
+ * Size of the heap's state stored in a heap image
+ */
+#define MEM_HEAP_IMAGE_STATE_SIZE (sizeof (mem_heap_t) \
+                                   + sizeof (JERRY_CONTEXT (mem_heap_allocated_chunks)) \
+                                   + sizeof (JERRY_CONTEXT (mem_heap_limit)) \
+                                   + MEM_HEAP_IMAGE_ALLOCATED_BYTES_SIZE \
+                                   + MEM_HEAP_IMAGE_LENGTH_TYPES_SIZE \
+                                   + MEM_HEAP_IMAGE_STATS_SIZE)
+
+#ifdef MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY
+# define MEM_HEAP_IMAGE_ALLOCATED_BYTES_SIZE (sizeof (JERRY_CONTEXT (mem_heap_allocated_bytes)))
+#else /* MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY */
+# define MEM_HEAP_IMAGE_ALLOCATED_BYTES_SIZE (0)
+#endif /* !MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY */
+
+#ifndef JERRY_NDEBUG
+# define MEM_HEAP_IMAGE_LENGTH_TYPES_SIZE (sizeof (JERRY_CONTEXT (mem_heap_length_types)))
+#else /* !JERRY_NDEBUG */
+# define MEM_HEAP_IMAGE_LENGTH_TYPES_SIZE (0)
+#endif /* JERRY_NDEBUG */
+
+#ifdef MEM_STATS
+# define MEM_HEAP_IMAGE_STATS_SIZE (sizeof (JERRY_CONTEXT (mem_heap_stats)))
+#else /* MEM_STATS */
+# define MEM_HEAP_IMAGE_STATS_SIZE (0)
+#endif /* !MEM_STATS */
+
+/**
+ * Copy the heap's state to or from a heap image
+ */
+static void
+mem_heap_copy_image_state (uint8_t *image_p, /**< heap state in the image */
+                           bool is_save) /**< true - copy the state to the image,
+                                          *   false - copy the state from the image */
+{
+  void *regions[] =
+  {
+    &JERRY_HEAP,
+    &JERRY_CONTEXT (mem_heap_allocated_chunks),
+    &JERRY_CONTEXT (mem_heap_limit),
+#ifdef MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY
+    JERRY_CONTEXT (mem_heap_allocated_bytes),
+#endif /* MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY */
+#ifndef JERRY_NDEBUG
+    JERRY_CONTEXT (mem_heap_length_types),
+#endif /* !JERRY_NDEBUG */
+#ifdef MEM_STATS
+    &JERRY_CONTEXT (mem_heap_stats),
+#endif /* MEM_STATS */
+  };
+
+  const size_t region_sizes[] =
+  {
+    sizeof (mem_heap_t),
+    sizeof (JERRY_CONTEXT (mem_heap_allocated_chunks)),
+    sizeof (JERRY_CONTEXT (mem_heap_limit)),
+#ifdef MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY
+    sizeof (JERRY_CONTEXT (mem_heap_allocated_bytes)),
+#endif /* MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY */
+#ifndef JERRY_NDEBUG
+    sizeof (JERRY_CONTEXT (mem_heap_length_types)),
+#endif /* !JERRY_NDEBUG */
+#ifdef MEM_STATS
+    sizeof (JERRY_CONTEXT (mem_heap_stats)),
+#endif /* MEM_STATS */
+  };
+
+  JERRY_STATIC_ASSERT (sizeof (regions) / sizeof (regions[0]) == sizeof (region_sizes) / sizeof (region_sizes[0]));
+
+  VALGRIND_DEFINED_SPACE (&JERRY_HEAP, sizeof (mem_heap_t));
+
+  for (size_t i = 0; i < sizeof (regions) / sizeof (regions[0]); i++)
+  {
+    if (is_save)
+    {
+      memcpy (image_p, regions[i], region_sizes[i]);
+    }
+    else
+    {
+      memcpy (regions[i], image_p, region_sizes[i]);
+    }
+
+    image_p += region_sizes[i];
+  }
+} /* mem_heap_copy_image_state */
+
+/**
+ * Save the heap's state to a heap image
+ *
+ * Note:
+ *      the whole heap area is saved, so the image can be restored with a single copy;
+ *      the address of the heap is saved as well, see also: mem_heap_relocate_image_pointer
+ *
+ * @return true - if the state was written successfully,
+ *         false - if the buffer is too small.
+ */
+bool
+mem_heap_save_image (uint8_t *buffer_p, /**< buffer */
+                     size_t buffer_size, /**< size of buffer */
+                     size_t *in_out_buffer_offset_p) /**< in: offset to write to,
+                                                      *   out: offset, incremented on size of the written data */
+{
+  uintptr_t heap_start = (uintptr_t) &JERRY_HEAP;
+  uint32_t state_size = (uint32_t) MEM_HEAP_IMAGE_STATE_SIZE;
+
+  if (!jrt_write_to_buffer_by_offset (buffer_p,
+                                      buffer_size,
+                                      in_out_buffer_offset_p,
+                                      &heap_start,
+                                      sizeof (heap_start))
+      || !jrt_write_to_buffer_by_offset (buffer_p,
+                                         buffer_size,
+                                         in_out_buffer_offset_p,
+                                         &state_size,
+                                         sizeof (state_size))
+      || *in_out_buffer_offset_p + state_size > buffer_size)
+  {
+    return false;
+  }
+
+  mem_heap_copy_image_state (buffer_p + *in_out_buffer_offset_p, true);
+  *in_out_buffer_offset_p += state_size;
+
+  return true;
+} /* mem_heap_save_image */
+
+/**
+ * Restore the heap's state from a heap image
+ *
+ * Note:
+ *      the routine should be called instead of mem_heap_init;
+ *      the heap is not modified if the image is invalid.
+ *
+ * @return true - if the state was restored successfully,
+ *         false - if the image does not correspond to the heap's configuration.
+ */
+bool
+mem_heap_load_image (const uint8_t *buffer_p, /**< buffer */
+                     size_t buffer_size, /**< size of buffer */
+                     size_t *in_out_buffer_offset_p, /**< in: offset to read from,
+                                                      *   out: offset, incremented on size of the read data */
+                     uintptr_t *out_saved_heap_start_p) /**< out: address of the heap
+                                                         *        at the time the image was saved */
+{
+  uint32_t state_size;
+
+  if (!jrt_read_from_buffer_by_offset (buffer_p,
+                                       buffer_size,
+                                       in_out_buffer_offset_p,
+                                       out_saved_heap_start_p,
+                                       sizeof (*out_saved_heap_start_p))
+      || !jrt_read_from_buffer_by_offset (buffer_p,
+                                          buffer_size,
+                                          in_out_buffer_offset_p,
+                                          &state_size,
+                                          sizeof (state_size))
+      || state_size != MEM_HEAP_IMAGE_STATE_SIZE
+      || *in_out_buffer_offset_p + state_size > buffer_size)
+  {
+    return false;
+  }
+
+  mem_heap_copy_image_state ((uint8_t *) buffer_p + *in_out_buffer_offset_p, false);
+  *in_out_buffer_offset_p += state_size;
+
+  return true;
+} /* mem_heap_load_image */
+
+/**
+ * Relocate a raw heap pointer stored in a heap image
+ *
+ * @return pointer to the same heap location in the current heap,
+ *         NULL - if the pointer is NULL
+ */
+void *
+mem_heap_relocate_image_pointer (uintptr_t saved_heap_start, /**< address of the heap
+                                                              *   at the time the image was saved */
+                                 void *pointer_p) /**< pointer, stored in the image */
+{
+  if (pointer_p == NULL)
+  {
+    return NULL;
+  }
+
+  JERRY_ASSERT ((uintptr_t) pointer_p >= saved_heap_start
+                && (uintptr_t) pointer_p - saved_heap_start < sizeof (mem_heap_t));
+
+  return (uint8_t *) &JERRY_HEAP + ((uintptr_t) pointer_p - saved_heap_start);
+} /* mem_heap_relocate_image_pointer */
+
 #ifndef JERRY_NDEBUG
 /**
  * Check whether the pointer points to the heap
@@ -854,7 +905,8 @@ mem_is_heap_pointer (const void *pointer) /**< pointer */
 {
   uint8_t *uint8_pointer = (uint8_t *) pointer;
 
-  return (uint8_pointer >= mem_heap.area && uint8_pointer <= ((uint8_t *) mem_heap.area + MEM_HEAP_AREA_SIZE));
+  return (uint8_pointer >= JERRY_HEAP_CONTEXT (area)
+          && uint8_pointer <= ((uint8_t *) JERRY_HEAP_CONTEXT (area) + MEM_HEAP_AREA_SIZE));
 } /* mem_is_heap_pointer */
 #endif /* !JERRY_NDEBUG */
 
@@ -869,13 +921,13 @@ mem_heap_print_block (bool dump_block_data, /**< print block with data (true)
                       bool is_free) /**< is the block free? */
 {
   printf ("Block (%p): state=%s, size in chunks=%lu\n",
-          (uint8_t *) mem_heap.area + start_chunk * MEM_HEAP_CHUNK_SIZE,
+          (uint8_t *) JERRY_HEAP_CONTEXT (area) + start_chunk * MEM_HEAP_CHUNK_SIZE,
           is_free ? "free" : "allocated",
           (unsigned long) chunks_num);
 
   if (dump_block_data)
   {
-    uint8_t *block_data_p = (uint8_t *) mem_heap.area;
+    uint8_t *block_data_p = (uint8_t *) JERRY_HEAP_CONTEXT (area);
     uint8_t *block_data_end_p = block_data_p + start_chunk * MEM_HEAP_CHUNK_SIZE;
 
 #ifdef JERRY_VALGRIND
@@ -910,10 +962,10 @@ mem_heap_print (bool dump_block_headers, /**< print block headers */
 
   if (dump_block_headers)
   {
-    VALGRIND_DEFINED_SPACE (mem_heap.bitmaps, sizeof (mem_heap.bitmaps));
+    VALGRIND_DEFINED_SPACE (JERRY_HEAP_CONTEXT (bitmaps), sizeof (JERRY_HEAP_CONTEXT (bitmaps)));
 
     printf ("Heap: start=%p size=%lu\n",
-            mem_heap.area,
+            JERRY_HEAP_CONTEXT (area),
             (unsigned long) MEM_HEAP_AREA_SIZE);
 
     bool is_free = true;
@@ -936,7 +988,7 @@ mem_heap_print (bool dump_block_headers, /**< print block headers */
       }
     }
 
-    VALGRIND_NOACCESS_SPACE (mem_heap.bitmaps, sizeof (mem_heap.bitmaps));
+    VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (bitmaps), sizeof (JERRY_HEAP_CONTEXT (bitmaps)));
 
     mem_heap_print_block (dump_block_data, start_chunk, chunk_index - start_chunk, is_free);
   }
@@ -962,7 +1014,7 @@ mem_check_heap (void)
 #ifndef JERRY_DISABLE_HEAVY_DEBUG
   size_t allocated_chunks_num = 0;
 
-  VALGRIND_DEFINED_SPACE (mem_heap.bitmaps, sizeof (mem_heap.bitmaps));
+  VALGRIND_DEFINED_SPACE (JERRY_HEAP_CONTEXT (bitmaps), sizeof (JERRY_HEAP_CONTEXT (bitmaps)));
 
   for (size_t chunk_index = 0; chunk_index < MEM_HEAP_CHUNKS_NUM; chunk_index++)
   {
@@ -977,7 +1029,7 @@ mem_check_heap (void)
 
     if ((MEM_HEAP_IS_ALLOCATED_BITMAP[bitmap_item_index] & bit) != 0)
     {
-      if (mem_heap_length_types[chunk_index] == MEM_BLOCK_LENGTH_TYPE_ONE_CHUNKED)
+      if (JERRY_CONTEXT (mem_heap_length_types)[chunk_index] == MEM_BLOCK_LENGTH_TYPE_ONE_CHUNKED)
       {
         JERRY_ASSERT ((MEM_HEAP_IS_FIRST_IN_BLOCK_BITMAP[bitmap_item_index] & bit) != 0);
       }
@@ -986,9 +1038,9 @@ mem_check_heap (void)
     }
   }
 
-  VALGRIND_NOACCESS_SPACE (mem_heap.bitmaps, sizeof (mem_heap.bitmaps));
+  VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (bitmaps), sizeof (JERRY_HEAP_CONTEXT (bitmaps)));
 
-  JERRY_ASSERT (allocated_chunks_num == mem_heap_allocated_chunks);
+  JERRY_ASSERT (allocated_chunks_num == JERRY_CONTEXT (mem_heap_allocated_chunks));
 #endif /* !JERRY_DISABLE_HEAVY_DEBUG */
 } /* mem_check_heap */
 
@@ -999,7 +1051,7 @@ mem_check_heap (void)
 void
 mem_heap_get_stats (mem_heap_stats_t *out_heap_stats_p) /**< out: heap stats */
 {
-  *out_heap_stats_p = mem_heap_stats;
+  *out_heap_stats_p = JERRY_CONTEXT (mem_heap_stats);
 } /* mem_heap_get_stats */
 
 /**
@@ -1008,9 +1060,9 @@ mem_heap_get_stats (mem_heap_stats_t *out_heap_stats_p) /**< out: heap stats */
 void
 mem_heap_stats_reset_peak (void)
 {
-  mem_heap_stats.peak_allocated_chunks = mem_heap_stats.allocated_chunks;
-  mem_heap_stats.peak_allocated_bytes = mem_heap_stats.allocated_bytes;
-  mem_heap_stats.peak_waste_bytes = mem_heap_stats.waste_bytes;
+  JERRY_CONTEXT (mem_heap_stats).peak_allocated_chunks = JERRY_CONTEXT (mem_heap_stats).allocated_chunks;
+  JERRY_CONTEXT (mem_heap_stats).peak_allocated_bytes = JERRY_CONTEXT (mem_heap_stats).allocated_bytes;
+  JERRY_CONTEXT (mem_heap_stats).peak_waste_bytes = JERRY_CONTEXT (mem_heap_stats).waste_bytes;
 } /* mem_heap_stats_reset_peak */
 
 /**
@@ -1019,9 +1071,9 @@ mem_heap_stats_reset_peak (void)
 static void
 mem_heap_stat_init ()
 {
-  memset (&mem_heap_stats, 0, sizeof (mem_heap_stats));
+  memset (&JERRY_CONTEXT (mem_heap_stats), 0, sizeof (JERRY_CONTEXT (mem_heap_stats)));
 
-  mem_heap_stats.size = MEM_HEAP_AREA_SIZE;
+  JERRY_CONTEXT (mem_heap_stats).size = MEM_HEAP_AREA_SIZE;
 } /* mem_heap_stat_init */
 
 /**
@@ -1032,42 +1084,43 @@ mem_heap_stat_alloc (size_t first_chunk_index, /**< first chunk of the allocated
                      size_t chunks_num) /**< number of chunks in the area */
 {
   const size_t chunks = chunks_num;
-  const size_t bytes = (size_t) mem_heap_allocated_bytes[first_chunk_index];
+  const size_t bytes = (size_t) JERRY_CONTEXT (mem_heap_allocated_bytes)[first_chunk_index];
   const size_t waste_bytes = chunks * MEM_HEAP_CHUNK_SIZE - bytes;
 
-  mem_heap_stats.allocated_chunks += chunks;
-  mem_heap_stats.allocated_bytes += bytes;
-  mem_heap_stats.waste_bytes += waste_bytes;
+  JERRY_CONTEXT (mem_heap_stats).allocated_chunks += chunks;
+  JERRY_CONTEXT (mem_heap_stats).allocated_bytes += bytes;
+  JERRY_CONTEXT (mem_heap_stats).waste_bytes += waste_bytes;
 
-  if (mem_heap_stats.allocated_chunks > mem_heap_stats.peak_allocated_chunks)
+  if (JERRY_CONTEXT (mem_heap_stats).allocated_chunks > JERRY_CONTEXT (mem_heap_stats).peak_allocated_chunks)
   {
-    mem_heap_stats.peak_allocated_chunks = mem_heap_stats.allocated_chunks;
+    JERRY_CONTEXT (mem_heap_stats).peak_allocated_chunks = JERRY_CONTEXT (mem_heap_stats).allocated_chunks;
   }
-  if (mem_heap_stats.allocated_chunks > mem_heap_stats.global_peak_allocated_chunks)
+  if (JERRY_CONTEXT (mem_heap_stats).allocated_chunks > JERRY_CONTEXT (mem_heap_stats).global_peak_allocated_chunks)
   {
-    mem_heap_stats.global_peak_allocated_chunks = mem_heap_stats.allocated_chunks;
+    JERRY_CONTEXT (mem_heap_stats).global_peak_allocated_chunks = JERRY_CONTEXT (mem_heap_stats).allocated_chunks;
   }
 
-  if (mem_heap_stats.allocated_bytes > mem_heap_stats.peak_allocated_bytes)
+  if (JERRY_CONTEXT (mem_heap_stats).allocated_bytes > JERRY_CONTEXT (mem_heap_stats).peak_allocated_bytes)
   {
-    mem_heap_stats.peak_allocated_bytes = mem_heap_stats.allocated_bytes;
+    JERRY_CONTEXT (mem_heap_stats).peak_allocated_bytes = JERRY_CONTEXT (mem_heap_stats).allocated_bytes;
   }
-  if (mem_heap_stats.allocated_bytes > mem_heap_stats.global_peak_allocated_bytes)
+  if (JERRY_CONTEXT (mem_heap_stats).allocated_bytes > JERRY_CONTEXT (mem_heap_stats).global_peak_allocated_bytes)
   {
-    mem_heap_stats.global_peak_allocated_bytes = mem_heap_stats.allocated_bytes;
+    JERRY_CONTEXT (mem_heap_stats).global_peak_allocated_bytes = JERRY_CONTEXT (mem_heap_stats).allocated_bytes;
   }
 
-  if (mem_heap_stats.waste_bytes > mem_heap_stats.peak_waste_bytes)
+  if (JERRY_CONTEXT (mem_heap_stats).waste_bytes > JERRY_CONTEXT (mem_heap_stats).peak_waste_bytes)
   {
-    mem_heap_stats.peak_waste_bytes = mem_heap_stats.waste_bytes;
+    JERRY_CONTEXT (mem_heap_stats).peak_waste_bytes = JERRY_CONTEXT (mem_heap_stats).waste_bytes;
   }
-  if (mem_heap_stats.waste_bytes > mem_heap_stats.global_peak_waste_bytes)
+  if (JERRY_CONTEXT (mem_heap_stats).waste_bytes > JERRY_CONTEXT (mem_heap_stats).global_peak_waste_bytes)
   {
-    mem_heap_stats.global_peak_waste_bytes = mem_heap_stats.waste_bytes;
+    JERRY_CONTEXT (mem_heap_stats).global_peak_waste_bytes = JERRY_CONTEXT (mem_heap_stats).waste_bytes;
   }
 
-  JERRY_ASSERT (mem_heap_stats.allocated_bytes <= mem_heap_stats.size);
-  JERRY_ASSERT (mem_heap_stats.allocated_chunks <= mem_heap_stats.size / MEM_HEAP_CHUNK_SIZE);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_bytes <= JERRY_CONTEXT (mem_heap_stats).size);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_chunks
+                <= JERRY_CONTEXT (mem_heap_stats).size / MEM_HEAP_CHUNK_SIZE);
 } /* mem_heap_stat_alloc */
 
 /**
@@ -1078,19 +1131,20 @@ mem_heap_stat_free (size_t first_chunk_index, /**< first chunk of the freed area
                     size_t chunks_num) /**< number of chunks in the area */
 {
   const size_t chunks = chunks_num;
-  const size_t bytes = (size_t) mem_heap_allocated_bytes[first_chunk_index];
+  const size_t bytes = (size_t) JERRY_CONTEXT (mem_heap_allocated_bytes)[first_chunk_index];
   const size_t waste_bytes = chunks * MEM_HEAP_CHUNK_SIZE - bytes;
 
-  JERRY_ASSERT (mem_heap_stats.allocated_bytes <= mem_heap_stats.size);
-  JERRY_ASSERT (mem_heap_stats.allocated_chunks <= mem_heap_stats.size / MEM_HEAP_CHUNK_SIZE);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_bytes <= JERRY_CONTEXT (mem_heap_stats).size);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_chunks
+                <= JERRY_CONTEXT (mem_heap_stats).size / MEM_HEAP_CHUNK_SIZE);
 
-  JERRY_ASSERT (mem_heap_stats.allocated_chunks >= chunks);
-  JERRY_ASSERT (mem_heap_stats.allocated_bytes >= bytes);
-  JERRY_ASSERT (mem_heap_stats.waste_bytes >= waste_bytes);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_chunks >= chunks);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_bytes >= bytes);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).waste_bytes >= waste_bytes);
 
-  mem_heap_stats.allocated_chunks -= chunks;
-  mem_heap_stats.allocated_bytes -= bytes;
-  mem_heap_stats.waste_bytes -= waste_bytes;
+  JERRY_CONTEXT (mem_heap_stats).allocated_chunks -= chunks;
+  JERRY_CONTEXT (mem_heap_stats).allocated_bytes -= bytes;
+  JERRY_CONTEXT (mem_heap_stats).waste_bytes -= waste_bytes;
 } /* mem_heap_stat_free */
 
 /**
@@ -1108,14 +1162,14 @@ mem_heap_stats_print (void)
           "  Peak allocated chunks count = %zu\n"
           "  Peak allocated = %zu bytes\n"
           "  Peak waste = %zu bytes\n",
-          mem_heap_stats.size,
+          JERRY_CONTEXT (mem_heap_stats).size,
           MEM_HEAP_CHUNK_SIZE,
-          mem_heap_stats.allocated_chunks,
-          mem_heap_stats.allocated_bytes,
-          mem_heap_stats.waste_bytes,
-          mem_heap_stats.peak_allocated_chunks,
-          mem_heap_stats.peak_allocated_bytes,
-          mem_heap_stats.peak_waste_bytes);
+          JERRY_CONTEXT (mem_heap_stats).allocated_chunks,
+          JERRY_CONTEXT (mem_heap_stats).allocated_bytes,
+          JERRY_CONTEXT (mem_heap_stats).waste_bytes,
+          JERRY_CONTEXT (mem_heap_stats).peak_allocated_chunks,
+          JERRY_CONTEXT (mem_heap_stats).peak_allocated_bytes,
+          JERRY_CONTEXT (mem_heap_stats).peak_waste_bytes);
 } /* mem_heap_stats_print */
 #endif /* MEM_STATS */
 
@@ -27,6 +27,7 @@
 #define JERRY_MEM_HEAP_H
 
 #include "jrt.h"
+#include "mem-config.h"
 
 /**
  * Type of allocation (argument of mem_Alloc)
@@ -39,6 +40,99 @@ typedef enum
   MEM_HEAP_ALLOC_LONG_TERM /**< allocated region most likely will not be freed soon */
 } mem_heap_alloc_term_t;
 
+/**
+ * Length type of the block
+ */
+typedef enum __attr_packed___
+{
+  MEM_BLOCK_LENGTH_TYPE_GENERAL     = 0, /**< general (may be multi-chunk) block
+                                          *
+                                          *   Note:
+                                          *         As zero is used for initialization in mem_heap_init,
+                                          *         0 value for the MEM_BLOCK_LENGTH_TYPE_GENERAL is necessary
+                                          */
+  MEM_BLOCK_LENGTH_TYPE_ONE_CHUNKED = 1  /**< one-chunked block (See also: mem_heap_alloc_chunked_block) */
+} mem_block_length_type_t;
+
+typedef enum
+{
+  MEM_HEAP_BITMAP_IS_ALLOCATED, /**< bitmap of 'chunk allocated' flags */
+  MEM_HEAP_BITMAP_IS_FIRST_IN_BLOCK, /**< bitmap of 'chunk is first in allocated block' flags */
+
+  MEM_HEAP_BITMAP__COUNT /**< number of bitmaps */
+} mem_heap_bitmap_t;
+
+/**
+ * Type of bitmap storage item, used to store one or several bitmap blocks
+ */
+typedef size_t mem_heap_bitmap_storage_item_t;
+
+/**
+ * Mask of a single bit at specified offset in a bitmap storage item
+ */
+#define MEM_HEAP_BITMAP_ITEM_BIT(offset) (((mem_heap_bitmap_storage_item_t) 1u) << (offset))
+
+/**
+ * Number of bits in a bitmap storage item
+ */
+#define MEM_HEAP_BITMAP_BITS_IN_STORAGE_ITEM (sizeof (mem_heap_bitmap_storage_item_t) * JERRY_BITSINBYTE)
+
+/**
+ * Full bit mask for a bitmap storage item
+ */
+#define MEM_HEAP_BITMAP_STORAGE_ALL_BITS_MASK ((mem_heap_bitmap_storage_item_t) -1)
+
+/**
+ * Number of chunks in heap
+ *
+ *                           bits_in_heap
+ * ALIGN_DOWN (-----------------------------------------, bits_in_bitmap_storage_item)
+ *               bitmap_bits_per_chunk + bits_in_chunk
+ */
+#define MEM_HEAP_CHUNKS_NUM JERRY_ALIGNDOWN (JERRY_BITSINBYTE * MEM_HEAP_SIZE / \
+                                             (MEM_HEAP_BITMAP__COUNT + JERRY_BITSINBYTE * MEM_HEAP_CHUNK_SIZE), \
+                                             MEM_HEAP_BITMAP_BITS_IN_STORAGE_ITEM)
+
+/**
+ * Size of heap data area
+ */
+#define MEM_HEAP_AREA_SIZE (MEM_HEAP_CHUNKS_NUM * MEM_HEAP_CHUNK_SIZE)
+
+/**
+ * Number of bits in heap's bitmap
+ */
+#define MEM_HEAP_BITMAP_BITS (MEM_HEAP_CHUNKS_NUM * 1u)
+
+/**
+ * Number of bitmap storage items
+ */
+#define MEM_HEAP_BITMAP_STORAGE_ITEMS (MEM_HEAP_BITMAP_BITS / MEM_HEAP_BITMAP_BITS_IN_STORAGE_ITEM)
+
+/**
+ * Heap structure
+ */
+typedef struct
+{
+  /**
+   * Heap bitmaps
+   *
+   * The bitmaps consist of chunks with unique correspondence to the heap chunks
+   */
+  mem_heap_bitmap_storage_item_t bitmaps[MEM_HEAP_BITMAP__COUNT][MEM_HEAP_BITMAP_STORAGE_ITEMS];
+
+  /**
+   * Heap area
+   */
+  uint8_t area[MEM_HEAP_AREA_SIZE] __attribute__ ((aligned (JERRY_MAX (1u << MEM_ALIGNMENT_LOG, MEM_HEAP_CHUNK_SIZE))));
+} mem_heap_t;
+
+#if defined (JERRY_VALGRIND) || defined (MEM_STATS) || !defined (JERRY_DISABLE_HEAVY_DEBUG)
+/**
+ * The number of allocated bytes is tracked for each heap block
+ */
+# define MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY
+#endif /* JERRY_VALGRIND || MEM_STATS || !JERRY_DISABLE_HEAVY_DEBUG */
+
 extern void mem_heap_init (void);
 extern void mem_heap_finalize (void);
 extern void *mem_heap_alloc_block (size_t, mem_heap_alloc_term_t);
@@ -51,6 +145,9 @@ extern void *mem_heap_decompress_pointer (uintptr_t);
 extern bool mem_is_heap_pointer (const void *);
 extern size_t __attr_pure___ mem_heap_recommend_allocation_size (size_t);
 extern void mem_heap_print (bool, bool, bool);
+extern bool mem_heap_save_image (uint8_t *, size_t, size_t *);
+extern bool mem_heap_load_image (const uint8_t *, size_t, size_t *, uintptr_t *);
+extern void *mem_heap_relocate_image_pointer (uintptr_t, void *);
 
 #ifdef MEM_STATS
 /**
@@ -24,6 +24,7 @@
  * Memory pool manager implementation
  */
 
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "mem-allocator.h"
@@ -43,20 +44,11 @@
  */
 #define MEM_POOL_CHUNKS_NUMBER (MEM_POOL_SIZE / MEM_POOL_CHUNK_SIZE)
 
-#ifndef JERRY_NDEBUG
-size_t mem_free_chunks_number;
-#endif /* !JERRY_NDEBUG */
-
 /**
  * Index of chunk in a pool
  */
 typedef uint8_t mem_pool_chunk_index_t;
 
-/**
- * Type for mem_pool_chunk
- */
-typedef struct mem_pool_chunk mem_pool_chunk_t;
-
 /**
  * Pool chunk
  */
@@ -114,19 +106,9 @@ struct mem_pool_chunk
  */
 JERRY_STATIC_ASSERT (sizeof (mem_pool_chunk_t) == MEM_POOL_CHUNK_SIZE);
 
-/**
- * List of free pool chunks
- */
-mem_pool_chunk_t *mem_free_chunk_p;
-
 static void mem_check_pools (void);
 
 #ifdef MEM_STATS
-/**
- * Pools' memory usage statistics
- */
-mem_pools_stats_t mem_pools_stats;
-
 static void mem_pools_stat_init (void);
 static void mem_pools_stat_alloc_pool (void);
 static void mem_pools_stat_free_pool (void);
@@ -178,10 +160,10 @@ void
 mem_pools_init (void)
 {
 #ifndef JERRY_NDEBUG
-  mem_free_chunks_number = 0;
+  JERRY_CONTEXT (mem_free_chunks_number) = 0;
 #endif /* !JERRY_NDEBUG */
 
-  mem_free_chunk_p = NULL;
+  JERRY_CONTEXT (mem_free_chunk_p) = NULL;
 
   MEM_POOLS_STAT_INIT ();
 } /* mem_pools_init */
@@ -195,10 +177,122 @@ mem_pools_finalize (void)
   mem_pools_collect_empty ();
 
 #ifndef JERRY_NDEBUG
-  JERRY_ASSERT (mem_free_chunks_number == 0);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_free_chunks_number) == 0);
 #endif /* !JERRY_NDEBUG */
 } /* mem_pools_finalize */
 
+/**
+ * Save the pool manager's state to a heap image
+ *
+ * @return true - if the state was written successfully,
+ *         false - if the buffer is too small.
+ */
+bool
+mem_pools_save_image (uint8_t *buffer_p, /**< buffer */
+                      size_t buffer_size, /**< size of buffer */
+                      size_t *in_out_buffer_offset_p) /**< in: offset to write to,
+                                                       *   out: offset, incremented on size of the written data */
+{
+  /* The chunks of the free list are saved with the heap area */
+  if (!jrt_write_to_buffer_by_offset (buffer_p,
+                                      buffer_size,
+                                      in_out_buffer_offset_p,
+                                      &JERRY_CONTEXT (mem_free_chunk_p),
+                                      sizeof (JERRY_CONTEXT (mem_free_chunk_p))))
+  {
+    return false;
+  }
+
+#ifndef JERRY_NDEBUG
+  if (!jrt_write_to_buffer_by_offset (buffer_p,
+                                      buffer_size,
+                                      in_out_buffer_offset_p,
+                                      &JERRY_CONTEXT (mem_free_chunks_number),
+                                      sizeof (JERRY_CONTEXT (mem_free_chunks_number))))
+  {
+    return false;
+  }
+#endif /* !JERRY_NDEBUG */
+
+#ifdef MEM_STATS
+  if (!jrt_write_to_buffer_by_offset (buffer_p,
+                                      buffer_size,
+                                      in_out_buffer_offset_p,
+                                      &JERRY_CONTEXT (mem_pools_stats),
+                                      sizeof (JERRY_CONTEXT (mem_pools_stats))))
+  {
+    return false;
+  }
+#endif /* MEM_STATS */
+
+  return true;
+} /* mem_pools_save_image */
+
+/**
+ * Restore the pool manager's state from a heap image
+ *
+ * Note:
+ *      the routine should be called instead of mem_pools_init, after the heap is restored
+ *
+ * @return true - if the state was restored successfully,
+ *         false - if the image is truncated.
+ */
+bool
+mem_pools_load_image (const uint8_t *buffer_p, /**< buffer */
+                      size_t buffer_size, /**< size of buffer */
+                      size_t *in_out_buffer_offset_p, /**< in: offset to read from,
+                                                       *   out: offset, incremented on size of the read data */
+                      uintptr_t saved_heap_start) /**< address of the heap at the time the image was saved */
+{
+  mem_pool_chunk_t *saved_free_chunk_p;
+
+  if (!jrt_read_from_buffer_by_offset (buffer_p,
+                                       buffer_size,
+                                       in_out_buffer_offset_p,
+                                       &saved_free_chunk_p,
+                                       sizeof (saved_free_chunk_p)))
+  {
+    return false;
+  }
+
+#ifndef JERRY_NDEBUG
+  if (!jrt_read_from_buffer_by_offset (buffer_p,
+                                       buffer_size,
+                                       in_out_buffer_offset_p,
+                                       &JERRY_CONTEXT (mem_free_chunks_number),
+                                       sizeof (JERRY_CONTEXT (mem_free_chunks_number))))
+  {
+    return false;
+  }
+#endif /* !JERRY_NDEBUG */
+
+#ifdef MEM_STATS
+  if (!jrt_read_from_buffer_by_offset (buffer_p,
+                                       buffer_size,
+                                       in_out_buffer_offset_p,
+                                       &JERRY_CONTEXT (mem_pools_stats),
+                                       sizeof (JERRY_CONTEXT (mem_pools_stats))))
+  {
+    return false;
+  }
+#endif /* MEM_STATS */
+
+  /* The free list is linked with raw pointers, which should be moved to the current heap location */
+  JERRY_CONTEXT (mem_free_chunk_p) = (mem_pool_chunk_t *) mem_heap_relocate_image_pointer (saved_heap_start,
+                                                                                           saved_free_chunk_p);
+
+  for (mem_pool_chunk_t *free_chunk_iter_p = JERRY_CONTEXT (mem_free_chunk_p);
+       free_chunk_iter_p != NULL;
+       free_chunk_iter_p = free_chunk_iter_p->u.free.next_p)
+  {
+    free_chunk_iter_p->u.free.next_p = ((mem_pool_chunk_t *)
+                                        mem_heap_relocate_image_pointer (saved_heap_start,
+                                                                         free_chunk_iter_p->u.free.next_p));
+  }
+
+  return true;
+} /* mem_pools_load_image */
+
 /**
  * Helper for reading magic number and traversal check flag fields of a pool-first chunk,
  * that suppresses valgrind's warnings about undefined values.
@@ -277,7 +371,7 @@ mem_pools_collect_empty (void)
    */
   {
     mem_pool_chunk_t tmp_header;
-    tmp_header.u.free.next_p = mem_free_chunk_p;
+    tmp_header.u.free.next_p = JERRY_CONTEXT (mem_free_chunk_p);
 
     for (mem_pool_chunk_t *free_chunk_iter_p = tmp_header.u.free.next_p,
                           *prev_free_chunk_p = &tmp_header,
@@ -317,7 +411,7 @@ mem_pools_collect_empty (void)
       }
     }
 
-    mem_free_chunk_p = tmp_header.u.free.next_p;
+    JERRY_CONTEXT (mem_free_chunk_p) = tmp_header.u.free.next_p;
   }
 
   if (first_chunks_list_p == NULL)
@@ -345,7 +439,7 @@ mem_pools_collect_empty (void)
   {
     {
       mem_pool_chunk_t tmp_header;
-      tmp_header.u.free.next_p = mem_free_chunk_p;
+      tmp_header.u.free.next_p = JERRY_CONTEXT (mem_free_chunk_p);
 
       for (mem_pool_chunk_t *free_chunk_iter_p = tmp_header.u.free.next_p,
                             *prev_free_chunk_p = &tmp_header,
@@ -384,7 +478,7 @@ mem_pools_collect_empty (void)
         }
       }
 
-      mem_free_chunk_p = tmp_header.u.free.next_p;
+      JERRY_CONTEXT (mem_free_chunk_p) = tmp_header.u.free.next_p;
     }
 
     {
@@ -454,8 +548,8 @@ mem_pools_collect_empty (void)
         }
         else
         {
-          non_first_chunks_iter_p->u.free.next_p = mem_free_chunk_p;
-          mem_free_chunk_p = non_first_chunks_iter_p;
+          non_first_chunks_iter_p->u.free.next_p = JERRY_CONTEXT (mem_free_chunk_p);
+          JERRY_CONTEXT (mem_free_chunk_p) = non_first_chunks_iter_p;
         }
       }
     }
@@ -484,7 +578,7 @@ mem_pools_collect_empty (void)
     if (first_chunks_iter_p->u.pool_gc.free_chunks_num == MEM_POOL_CHUNKS_NUMBER)
     {
 #ifndef JERRY_NDEBUG
-      mem_free_chunks_number -= MEM_POOL_CHUNKS_NUMBER;
+      JERRY_CONTEXT (mem_free_chunks_number) -= MEM_POOL_CHUNKS_NUMBER;
 #endif /* !JERRY_NDEBUG */
 
       MEM_HEAP_VALGRIND_FREYA_MEMPOOL_REQUEST ();
@@ -513,13 +607,13 @@ mem_pools_collect_empty (void)
 
         if (pool_chunks_iter_p->u.free.next_p == NULL)
         {
-          pool_chunks_iter_p->u.free.next_p = mem_free_chunk_p;
+          pool_chunks_iter_p->u.free.next_p = JERRY_CONTEXT (mem_free_chunk_p);
 
           break;
         }
       }
 
-      mem_free_chunk_p = first_chunk_p;
+      JERRY_CONTEXT (mem_free_chunk_p) = first_chunk_p;
     }
   }
 
@@ -527,7 +621,7 @@ mem_pools_collect_empty (void)
   /*
    * Valgrind-mode specific pass that marks all free chunks inaccessible
    */
-  for (mem_pool_chunk_t *free_chunk_iter_p = mem_free_chunk_p, *next_free_chunk_p;
+  for (mem_pool_chunk_t *free_chunk_iter_p = JERRY_CONTEXT (mem_free_chunk_p), *next_free_chunk_p;
        free_chunk_iter_p != NULL;
        free_chunk_iter_p = next_free_chunk_p)
   {
@@ -546,7 +640,7 @@ mem_pools_alloc_longpath (void)
 {
   mem_check_pools ();
 
-  JERRY_ASSERT (mem_free_chunk_p == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_free_chunk_p) == NULL);
 
   JERRY_ASSERT (MEM_POOL_SIZE <= mem_heap_get_chunked_block_data_size ());
   JERRY_ASSERT (MEM_POOL_CHUNKS_NUMBER >= 1);
@@ -554,7 +648,7 @@ mem_pools_alloc_longpath (void)
   MEM_HEAP_VALGRIND_FREYA_MEMPOOL_REQUEST ();
   mem_pool_chunk_t *pool_start_p = (mem_pool_chunk_t *) mem_heap_alloc_chunked_block (MEM_HEAP_ALLOC_LONG_TERM);
 
-  if (mem_free_chunk_p != NULL)
+  if (JERRY_CONTEXT (mem_free_chunk_p) != NULL)
   {
     /* some chunks were freed due to GC invoked by heap allocator */
     MEM_HEAP_VALGRIND_FREYA_MEMPOOL_REQUEST ();
@@ -564,7 +658,7 @@ mem_pools_alloc_longpath (void)
   }
 
 #ifndef JERRY_NDEBUG
-  mem_free_chunks_number += MEM_POOL_CHUNKS_NUMBER;
+  JERRY_CONTEXT (mem_free_chunks_number) += MEM_POOL_CHUNKS_NUMBER;
 #endif /* !JERRY_NDEBUG */
 
   JERRY_STATIC_ASSERT (MEM_POOL_CHUNK_SIZE % MEM_ALIGNMENT == 0);
@@ -604,7 +698,7 @@ mem_pools_alloc_longpath (void)
   }
 #endif /* JERRY_VALGRIND */
 
-  mem_free_chunk_p = pool_start_p;
+  JERRY_CONTEXT (mem_free_chunk_p) = pool_start_p;
 
   MEM_POOLS_STAT_ALLOC_POOL ();
 
@@ -628,19 +722,19 @@ mem_pools_alloc (void)
 
   do
   {
-    if (mem_free_chunk_p != NULL)
+    if (JERRY_CONTEXT (mem_free_chunk_p) != NULL)
     {
-      mem_pool_chunk_t *chunk_p = mem_free_chunk_p;
+      mem_pool_chunk_t *chunk_p = JERRY_CONTEXT (mem_free_chunk_p);
 
       MEM_POOLS_STAT_ALLOC_CHUNK ();
 
 #ifndef JERRY_NDEBUG
-      mem_free_chunks_number--;
+      JERRY_CONTEXT (mem_free_chunks_number)--;
 #endif /* !JERRY_NDEBUG */
 
       VALGRIND_DEFINED_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
 
-      mem_free_chunk_p = chunk_p->u.free.next_p;
+      JERRY_CONTEXT (mem_free_chunk_p) = chunk_p->u.free.next_p;
 
       VALGRIND_UNDEFINED_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
 
@@ -655,7 +749,7 @@ mem_pools_alloc (void)
       mem_pools_alloc_longpath ();
 
       /* the assertion guarantees that there will be no more than two iterations */
-      JERRY_ASSERT (mem_free_chunk_p != NULL);
+      JERRY_ASSERT (JERRY_CONTEXT (mem_free_chunk_p) != NULL);
     }
   } while (true);
 } /* mem_pools_alloc */
@@ -670,14 +764,14 @@ mem_pools_free (uint8_t *chunk_p) /**< pointer to the chunk */
 
   mem_pool_chunk_t *chunk_to_free_p = (mem_pool_chunk_t *) chunk_p;
 
-  chunk_to_free_p->u.free.next_p = mem_free_chunk_p;
-  mem_free_chunk_p = chunk_to_free_p;
+  chunk_to_free_p->u.free.next_p = JERRY_CONTEXT (mem_free_chunk_p);
+  JERRY_CONTEXT (mem_free_chunk_p) = chunk_to_free_p;
 
   VALGRIND_FREYA_FREELIKE_SPACE (chunk_to_free_p);
   VALGRIND_NOACCESS_SPACE (chunk_to_free_p, MEM_POOL_CHUNK_SIZE);
 
 #ifndef JERRY_NDEBUG
-  mem_free_chunks_number++;
+  JERRY_CONTEXT (mem_free_chunks_number)++;
 #endif /* !JERRY_NDEBUG */
 
   MEM_POOLS_STAT_FREE_CHUNK ();
@@ -694,7 +788,7 @@ mem_check_pools (void)
 #ifndef JERRY_DISABLE_HEAVY_DEBUG
   size_t free_chunks_met = 0;
 
-  for (mem_pool_chunk_t *free_chunk_iter_p = mem_free_chunk_p, *next_free_chunk_p;
+  for (mem_pool_chunk_t *free_chunk_iter_p = JERRY_CONTEXT (mem_free_chunk_p), *next_free_chunk_p;
        free_chunk_iter_p != NULL;
        free_chunk_iter_p = next_free_chunk_p)
   {
@@ -707,7 +801,7 @@ mem_check_pools (void)
     free_chunks_met++;
   }
 
-  JERRY_ASSERT (free_chunks_met == mem_free_chunks_number);
+  JERRY_ASSERT (free_chunks_met == JERRY_CONTEXT (mem_free_chunks_number));
 #endif /* !JERRY_DISABLE_HEAVY_DEBUG */
 } /* mem_check_pools */
 
@@ -720,7 +814,7 @@ mem_pools_get_stats (mem_pools_stats_t *out_pools_stats_p) /**< out: pools' stat
 {
   JERRY_ASSERT (out_pools_stats_p != NULL);
 
-  *out_pools_stats_p = mem_pools_stats;
+  *out_pools_stats_p = JERRY_CONTEXT (mem_pools_stats);
 } /* mem_pools_get_stats */
 
 /**
@@ -729,8 +823,8 @@ mem_pools_get_stats (mem_pools_stats_t *out_pools_stats_p) /**< out: pools' stat
 void
 mem_pools_stats_reset_peak (void)
 {
-  mem_pools_stats.peak_pools_count = mem_pools_stats.pools_count;
-  mem_pools_stats.peak_allocated_chunks = mem_pools_stats.allocated_chunks;
+  JERRY_CONTEXT (mem_pools_stats).peak_pools_count = JERRY_CONTEXT (mem_pools_stats).pools_count;
+  JERRY_CONTEXT (mem_pools_stats).peak_allocated_chunks = JERRY_CONTEXT (mem_pools_stats).allocated_chunks;
 } /* mem_pools_stats_reset_peak */
 
 /**
@@ -739,7 +833,7 @@ mem_pools_stats_reset_peak (void)
 static void
 mem_pools_stat_init (void)
 {
-  memset (&mem_pools_stats, 0, sizeof (mem_pools_stats));
+  memset (&JERRY_CONTEXT (mem_pools_stats), 0, sizeof (JERRY_CONTEXT (mem_pools_stats)));
 } /* mem_pools_stat_init */
 
 /**
@@ -748,18 +842,18 @@ mem_pools_stat_init (void)
 static void
 mem_pools_stat_alloc_pool (void)
 {
-  mem_pools_stats.pools_count++;
+  JERRY_CONTEXT (mem_pools_stats).pools_count++;
 
-  if (mem_pools_stats.pools_count > mem_pools_stats.peak_pools_count)
+  if (JERRY_CONTEXT (mem_pools_stats).pools_count > JERRY_CONTEXT (mem_pools_stats).peak_pools_count)
   {
-    mem_pools_stats.peak_pools_count = mem_pools_stats.pools_count;
+    JERRY_CONTEXT (mem_pools_stats).peak_pools_count = JERRY_CONTEXT (mem_pools_stats).pools_count;
   }
-  if (mem_pools_stats.pools_count > mem_pools_stats.global_peak_pools_count)
+  if (JERRY_CONTEXT (mem_pools_stats).pools_count > JERRY_CONTEXT (mem_pools_stats).global_peak_pools_count)
   {
-    mem_pools_stats.global_peak_pools_count = mem_pools_stats.pools_count;
+    JERRY_CONTEXT (mem_pools_stats).global_peak_pools_count = JERRY_CONTEXT (mem_pools_stats).pools_count;
   }
 
-  mem_pools_stats.free_chunks += MEM_POOL_CHUNKS_NUMBER;
+  JERRY_CONTEXT (mem_pools_stats).free_chunks += MEM_POOL_CHUNKS_NUMBER;
 } /* mem_pools_stat_alloc_pool */
 
 /**
@@ -768,13 +862,13 @@ mem_pools_stat_alloc_pool (void)
 static void
 mem_pools_stat_free_pool (void)
 {
-  JERRY_ASSERT (mem_pools_stats.free_chunks >= MEM_POOL_CHUNKS_NUMBER);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_pools_stats).free_chunks >= MEM_POOL_CHUNKS_NUMBER);
 
-  mem_pools_stats.free_chunks -= MEM_POOL_CHUNKS_NUMBER;
+  JERRY_CONTEXT (mem_pools_stats).free_chunks -= MEM_POOL_CHUNKS_NUMBER;
 
-  JERRY_ASSERT (mem_pools_stats.pools_count > 0);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_pools_stats).pools_count > 0);
 
-  mem_pools_stats.pools_count--;
+  JERRY_CONTEXT (mem_pools_stats).pools_count--;
 } /* mem_pools_stat_free_pool */
 
 /**
@@ -783,18 +877,18 @@ mem_pools_stat_free_pool (void)
 static void
 mem_pools_stat_alloc_chunk (void)
 {
-  JERRY_ASSERT (mem_pools_stats.free_chunks > 0);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_pools_stats).free_chunks > 0);
 
-  mem_pools_stats.allocated_chunks++;
-  mem_pools_stats.free_chunks--;
+  JERRY_CONTEXT (mem_pools_stats).allocated_chunks++;
+  JERRY_CONTEXT (mem_pools_stats).free_chunks--;
 
-  if (mem_pools_stats.allocated_chunks > mem_pools_stats.peak_allocated_chunks)
+  if (JERRY_CONTEXT (mem_pools_stats).allocated_chunks > JERRY_CONTEXT (mem_pools_stats).peak_allocated_chunks)
   {
-    mem_pools_stats.peak_allocated_chunks = mem_pools_stats.allocated_chunks;
+    JERRY_CONTEXT (mem_pools_stats).peak_allocated_chunks = JERRY_CONTEXT (mem_pools_stats).allocated_chunks;
   }
-  if (mem_pools_stats.allocated_chunks > mem_pools_stats.global_peak_allocated_chunks)
+  if (JERRY_CONTEXT (mem_pools_stats).allocated_chunks > JERRY_CONTEXT (mem_pools_stats).global_peak_allocated_chunks)
   {
-    mem_pools_stats.global_peak_allocated_chunks = mem_pools_stats.allocated_chunks;
+    JERRY_CONTEXT (mem_pools_stats).global_peak_allocated_chunks = JERRY_CONTEXT (mem_pools_stats).allocated_chunks;
   }
 } /* mem_pools_stat_alloc_chunk */
 
@@ -804,10 +898,10 @@ mem_pools_stat_alloc_chunk (void)
 static void
 mem_pools_stat_free_chunk (void)
 {
-  JERRY_ASSERT (mem_pools_stats.allocated_chunks > 0);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_pools_stats).allocated_chunks > 0);
 
-  mem_pools_stats.allocated_chunks--;
-  mem_pools_stats.free_chunks++;
+  JERRY_CONTEXT (mem_pools_stats).allocated_chunks--;
+  JERRY_CONTEXT (mem_pools_stats).free_chunks++;
 } /* mem_pools_stat_free_chunk */
 #endif /* MEM_STATS */
 
@@ -29,11 +29,18 @@
 
 #include "jrt.h"
 
+/**
+ * Type for mem_pool_chunk
+ */
+typedef struct mem_pool_chunk mem_pool_chunk_t;
+
 extern void mem_pools_init (void);
 extern void mem_pools_finalize (void);
 extern uint8_t *mem_pools_alloc (void);
 extern void mem_pools_free (uint8_t *);
 extern void mem_pools_collect_empty (void);
+extern bool mem_pools_save_image (uint8_t *, size_t, size_t *);
+extern bool mem_pools_load_image (const uint8_t *, size_t, size_t *, uintptr_t);
 
 #ifdef MEM_STATS
 /**
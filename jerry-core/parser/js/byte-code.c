@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "ecma-helpers.h"
 #include "js-parser-internal.h"
 
 /** \addtogroup parser Parser
@@ -47,6 +48,363 @@ const uint8_t cbc_ext_flags[] =
 
 #undef CBC_OPCODE
 
+/**
+ * Get the size of the byte code arguments of a function code.
+ *
+ * @return size of cbc_uint16_arguments_t or cbc_uint8_arguments_t
+ */
+size_t
+cbc_get_arguments_size (const ecma_compiled_code_t *bytecode_header_p) /**< function code */
+{
+  JERRY_ASSERT (bytecode_header_p->status_flags & CBC_CODE_FLAGS_FUNCTION);
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    return sizeof (cbc_uint16_arguments_t);
+  }
+
+  return sizeof (cbc_uint8_arguments_t);
+} /* cbc_get_arguments_size */
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+
+/**
+ * Get the snapshot reference of a function code executed in place from a snapshot buffer.
+ */
+static void
+cbc_get_snapshot_code (const ecma_compiled_code_t *bytecode_header_p, /**< function code */
+                       cbc_snapshot_code_t *out_snapshot_code_p) /**< out: snapshot reference */
+{
+  JERRY_ASSERT (CBC_IS_IN_SNAPSHOT (bytecode_header_p));
+
+  memcpy (out_snapshot_code_p,
+          ((const uint8_t *) bytecode_header_p) + cbc_get_arguments_size (bytecode_header_p),
+          sizeof (cbc_snapshot_code_t));
+} /* cbc_get_snapshot_code */
+
+/**
+ * Get the literal map of the snapshot of a function code executed in place.
+ *
+ * @return literal map
+ */
+cbc_snapshot_literal_map_t *
+cbc_get_snapshot_literal_map (const ecma_compiled_code_t *bytecode_header_p) /**< function code */
+{
+  cbc_snapshot_code_t snapshot_code;
+  cbc_get_snapshot_code (bytecode_header_p, &snapshot_code);
+
+  return ECMA_GET_NON_NULL_POINTER (cbc_snapshot_literal_map_t, snapshot_code.literal_map_cp);
+} /* cbc_get_snapshot_literal_map */
+
+/**
+ * Get a literal of a function code executed in place.
+ *
+ * Note:
+ *      compiled code literals are loaded from the snapshot buffer, if they are not loaded yet
+ *
+ * @return the literal
+ */
+lit_cpointer_t
+cbc_get_snapshot_literal (const ecma_compiled_code_t *bytecode_header_p, /**< function code */
+                          uint32_t literal_index) /**< literal index */
+{
+  cbc_snapshot_code_t snapshot_code;
+  cbc_get_snapshot_code (bytecode_header_p, &snapshot_code);
+
+  cbc_snapshot_literal_map_t *literal_map_p;
+  literal_map_p = ECMA_GET_NON_NULL_POINTER (cbc_snapshot_literal_map_t, snapshot_code.literal_map_cp);
+
+  const lit_cpointer_t *snapshot_literals_p;
+  snapshot_literals_p = (const lit_cpointer_t *) (snapshot_code.snapshot_code_p
+                                                  + cbc_get_arguments_size (bytecode_header_p));
+
+  uint32_t entry_index = snapshot_literals_p[literal_index].u.packed_value;
+  lit_cpointer_t *entries_p = (lit_cpointer_t *) (literal_map_p + 1);
+
+  JERRY_ASSERT (entry_index < literal_map_p->entries_num);
+
+  if (entry_index >= literal_map_p->compiled_code_start
+      && entries_p[entry_index].u.packed_value == MEM_CP_NULL)
+  {
+    snapshot_load_compiled_code (literal_map_p, entry_index, false);
+  }
+
+  return entries_p[entry_index];
+} /* cbc_get_snapshot_literal */
+
+/**
+ * Resolve the literals of a function code executed in place through the literal map of its snapshot.
+ *
+ * Note:
+ *      compiled code literals, which are not loaded yet, are resolved to NULL
+ *      (see also: cbc_get_snapshot_literal)
+ */
+void
+cbc_resolve_snapshot_literals (const ecma_compiled_code_t *bytecode_header_p, /**< function code */
+                               lit_cpointer_t *literals_p, /**< out: literals */
+                               uint32_t literals_num) /**< number of literals to resolve */
+{
+  cbc_snapshot_code_t snapshot_code;
+  cbc_get_snapshot_code (bytecode_header_p, &snapshot_code);
+
+  const cbc_snapshot_literal_map_t *literal_map_p;
+  literal_map_p = ECMA_GET_NON_NULL_POINTER (cbc_snapshot_literal_map_t, snapshot_code.literal_map_cp);
+
+  const lit_cpointer_t *entries_p = (const lit_cpointer_t *) (literal_map_p + 1);
+  const lit_cpointer_t *snapshot_literals_p;
+  snapshot_literals_p = (const lit_cpointer_t *) (snapshot_code.snapshot_code_p
+                                                  + cbc_get_arguments_size (bytecode_header_p));
+
+  for (uint32_t i = 0; i < literals_num; i++)
+  {
+    JERRY_ASSERT (snapshot_literals_p[i].u.packed_value < literal_map_p->entries_num);
+
+    literals_p[i] = entries_p[snapshot_literals_p[i].u.packed_value];
+  }
+} /* cbc_resolve_snapshot_literals */
+
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
+/**
+ * Get the first instruction of a function code.
+ *
+ * @return pointer to the instructions
+ */
+uint8_t *
+cbc_get_byte_code (const ecma_compiled_code_t *bytecode_header_p) /**< function code */
+{
+  const uint8_t *byte_code_p = (const uint8_t *) bytecode_header_p;
+  uint32_t literal_end;
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    literal_end = ((const cbc_uint16_arguments_t *) bytecode_header_p)->literal_end;
+  }
+  else
+  {
+    literal_end = ((const cbc_uint8_arguments_t *) bytecode_header_p)->literal_end;
+  }
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  if (CBC_IS_IN_SNAPSHOT (bytecode_header_p))
+  {
+    cbc_snapshot_code_t snapshot_code;
+    cbc_get_snapshot_code (bytecode_header_p, &snapshot_code);
+    byte_code_p = snapshot_code.snapshot_code_p;
+  }
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
+  byte_code_p += cbc_get_arguments_size (bytecode_header_p) + literal_end * sizeof (lit_cpointer_t);
+  return (uint8_t *) byte_code_p;
+} /* cbc_get_byte_code */
+
+/**
+ * Check whether a compiled code references memory outside of the heap,
+ * i.e. a snapshot buffer, which is executed in place, or the source
+ * code of lazy function code.
+ *
+ * @return true - if the compiled code or one of its nested functions is executed in place
+ *                from a snapshot buffer or is lazy function code,
+ *         false - otherwise.
+ */
+bool
+cbc_is_byte_code_external (const ecma_compiled_code_t *bytecode_header_p) /**< compiled code */
+{
+  if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
+  {
+    return false;
+  }
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  if (CBC_IS_IN_SNAPSHOT (bytecode_header_p))
+  {
+    return true;
+  }
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
+  /* Lazy function code references its source code. */
+  if (CBC_IS_LAZY_FUNCTION (bytecode_header_p))
+  {
+    return true;
+  }
+
+  const lit_cpointer_t *literal_start_p;
+  uint32_t const_literal_end;
+  uint32_t literal_end;
+
+  literal_start_p = (const lit_cpointer_t *) (((const uint8_t *) bytecode_header_p)
+                                              + cbc_get_arguments_size (bytecode_header_p));
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    const_literal_end = ((const cbc_uint16_arguments_t *) bytecode_header_p)->const_literal_end;
+    literal_end = ((const cbc_uint16_arguments_t *) bytecode_header_p)->literal_end;
+  }
+  else
+  {
+    const_literal_end = ((const cbc_uint8_arguments_t *) bytecode_header_p)->const_literal_end;
+    literal_end = ((const cbc_uint8_arguments_t *) bytecode_header_p)->literal_end;
+  }
+
+  /* Nested functions may be lazy function code. */
+  for (uint32_t i = const_literal_end; i < literal_end; i++)
+  {
+    const ecma_compiled_code_t *literal_bytecode_p;
+    literal_bytecode_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t, literal_start_p[i].u.value.base_cp);
+
+    /* Self references are ignored. */
+    if (literal_bytecode_p != bytecode_header_p
+        && cbc_is_byte_code_external (literal_bytecode_p))
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* cbc_is_byte_code_external */
+
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * Get the line info table of a compiled code.
+ *
+ * @return pointer to the table - if the compiled code has line info,
+ *         NULL - otherwise.
+ */
+static const uint8_t *
+cbc_get_line_info (const ecma_compiled_code_t *bytecode_header_p) /**< compiled code */
+{
+  uint32_t line_info_offset;
+
+  if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
+  {
+    return NULL;
+  }
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    line_info_offset = ((const cbc_uint16_arguments_t *) bytecode_header_p)->line_info_offset;
+  }
+  else
+  {
+    line_info_offset = ((const cbc_uint8_arguments_t *) bytecode_header_p)->line_info_offset;
+  }
+
+  if (line_info_offset == 0)
+  {
+    return NULL;
+  }
+
+  return cbc_get_byte_code (bytecode_header_p) + line_info_offset;
+} /* cbc_get_line_info */
+
+/**
+ * Decode an unsigned integer of the line info table.
+ *
+ * @return position after the encoded value
+ */
+static const uint8_t *
+cbc_decode_line_info_uint (const uint8_t *line_info_p, /**< encoded value */
+                           uint32_t *value_p) /**< [out] decoded value */
+{
+  uint32_t value = 0;
+  uint32_t shift = 0;
+
+  do
+  {
+    value |= ((uint32_t) (*line_info_p & CBC_LOWER_SEVEN_BIT_MASK)) << shift;
+    shift += 7;
+  }
+  while (*line_info_p++ & CBC_HIGHEST_BIT_MASK);
+
+  *value_p = value;
+  return line_info_p;
+} /* cbc_decode_line_info_uint */
+
+/**
+ * Find the source position of a byte code offset.
+ *
+ * @return true - if the compiled code has line info,
+ *         false - otherwise.
+ */
+bool
+cbc_get_source_position (const ecma_compiled_code_t *bytecode_header_p, /**< compiled code */
+                         uint32_t offset, /**< byte code offset */
+                         uint32_t *line_p, /**< [out] line */
+                         uint32_t *column_p) /**< [out] column */
+{
+  const uint8_t *line_info_p = cbc_get_line_info (bytecode_header_p);
+  uint32_t count;
+  uint32_t entry_offset = 0;
+  uint32_t line = 0;
+  uint32_t column = 0;
+
+  if (line_info_p == NULL)
+  {
+    return false;
+  }
+
+  line_info_p = cbc_decode_line_info_uint (line_info_p, &count);
+
+  while (count > 0)
+  {
+    uint32_t value;
+
+    line_info_p = cbc_decode_line_info_uint (line_info_p, &value);
+    entry_offset += value;
+
+    if (entry_offset > offset)
+    {
+      break;
+    }
+
+    line_info_p = cbc_decode_line_info_uint (line_info_p, &value);
+    /* Zigzag decoding. */
+    line += (value >> 1) ^ (uint32_t) -(int32_t) (value & 0x1);
+
+    line_info_p = cbc_decode_line_info_uint (line_info_p, &column);
+    count--;
+  }
+
+  *line_p = line;
+  *column_p = column;
+  return true;
+} /* cbc_get_source_position */
+
+/**
+ * Get the source position of the first line info entry, which is the
+ * position of the definition for function code.
+ *
+ * @return true - if the compiled code has line info,
+ *         false - otherwise.
+ */
+bool
+cbc_get_definition_position (const ecma_compiled_code_t *bytecode_header_p, /**< compiled code */
+                             uint32_t *line_p, /**< [out] line */
+                             uint32_t *column_p) /**< [out] column */
+{
+  const uint8_t *line_info_p = cbc_get_line_info (bytecode_header_p);
+  uint32_t value;
+
+  if (line_info_p == NULL)
+  {
+    return false;
+  }
+
+  /* Skip the entry count and the byte code offset. */
+  line_info_p = cbc_decode_line_info_uint (line_info_p, &value);
+  line_info_p = cbc_decode_line_info_uint (line_info_p, &value);
+
+  /* The first line is stored as a difference from zero. */
+  line_info_p = cbc_decode_line_info_uint (line_info_p, &value);
+  *line_p = value >> 1;
+
+  cbc_decode_line_info_uint (line_info_p, column_p);
+  return true;
+} /* cbc_get_definition_position */
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 #ifdef PARSER_DUMP_BYTE_CODE
 
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) #arg1,
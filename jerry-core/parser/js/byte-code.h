@@ -17,6 +17,8 @@
 #ifndef BYTE_CODE_H
 #define BYTE_CODE_H
 
+#include "common.h"
+
 /** \addtogroup parser Parser
  * @{
  *
@@ -199,7 +201,7 @@
 /* Stack consumption of opcodes with context. */
 
 /* PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION must be <= 4 */
-#define PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION 3
+#define PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION 4
 /* PARSER_WITH_CONTEXT_STACK_ALLOCATION must be <= 4 */
 #define PARSER_WITH_CONTEXT_STACK_ALLOCATION 2
 /* PARSER_TRY_CONTEXT_STACK_ALLOCATION must be <= 3 */
@@ -306,8 +308,6 @@
               VM_OC_NONE) \
   CBC_OPCODE (CBC_INITIALIZE_VARS, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
               VM_OC_NONE) \
-  CBC_OPCODE (CBC_SET_BYTECODE_PTR, CBC_NO_FLAG, 0, \
-              VM_OC_NONE) \
   CBC_OPCODE (CBC_RETURN, CBC_NO_FLAG, -1, \
               VM_OC_RET | VM_OC_GET_STACK) \
   CBC_OPCODE (CBC_RETURN_WITH_BLOCK, CBC_NO_FLAG, 0, \
@@ -624,6 +624,10 @@ typedef struct
   uint8_t ident_end;                /**< end position of the identifier group */
   uint8_t const_literal_end;        /**< end position of the const literal group */
   uint8_t literal_end;              /**< end position of the literal group */
+#ifdef JERRY_ENABLE_LINE_INFO
+  uint32_t line_info_offset;        /**< offset of the line info table from the start
+                                     *   of the byte code, 0 if the table is not present */
+#endif /* JERRY_ENABLE_LINE_INFO */
 } cbc_uint8_arguments_t;
 
 /**
@@ -638,6 +642,10 @@ typedef struct
   uint16_t ident_end;               /**< end position of the identifier group */
   uint16_t const_literal_end;       /**< end position of the const literal group */
   uint16_t literal_end;             /**< end position of the literal group */
+#ifdef JERRY_ENABLE_LINE_INFO
+  uint32_t line_info_offset;        /**< offset of the line info table from the start
+                                     *   of the byte code, 0 if the table is not present */
+#endif /* JERRY_ENABLE_LINE_INFO */
 } cbc_uint16_arguments_t;
 
 /* When CBC_CODE_FLAGS_FULL_LITERAL_ENCODING
@@ -649,6 +657,35 @@ typedef struct
 #define CBC_CODE_FLAGS_ARGUMENTS_NEEDED 0x10
 #define CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED 0x20
 
+/* Function code which requires an arguments object also requires a
+ * lexical environment, so this combination marks lazy function code. */
+#define CBC_CODE_FLAGS_LAZY_FUNCTION (CBC_CODE_FLAGS_ARGUMENTS_NEEDED | CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED)
+
+/**
+ * Function code, whose compilation is deferred until its first call.
+ *
+ * The source of the function (starting before its optional name) is only pre-scanned
+ * when the enclosing code is compiled. The byte code arguments contain the status flags
+ * and the number of arguments, other groups of the literal table are empty.
+ */
+typedef struct
+{
+  cbc_uint16_arguments_t header;    /**< byte code arguments */
+  const uint8_t *source_p;          /**< start of the function source */
+  const uint8_t *source_end_p;      /**< end of the function source */
+  uint32_t parser_status_flags;     /**< parser status flags of the function */
+  uint32_t line;                    /**< line of the function source start */
+  uint32_t column;                  /**< column of the function source start */
+  mem_cpointer_t compiled_code_cp;  /**< compiled code, or NULL if the function is not compiled yet */
+} cbc_lazy_function_t;
+
+/**
+ * Check whether a compiled code is lazy function code.
+ */
+#define CBC_IS_LAZY_FUNCTION(bytecode_header_p) \
+  (((bytecode_header_p)->status_flags & (CBC_CODE_FLAGS_FUNCTION | CBC_CODE_FLAGS_LAZY_FUNCTION)) \
+   == (CBC_CODE_FLAGS_FUNCTION | CBC_CODE_FLAGS_LAZY_FUNCTION))
+
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg1,
 
 /**
@@ -675,6 +712,75 @@ typedef enum
 extern const uint8_t cbc_flags[];
 extern const uint8_t cbc_ext_flags[];
 
+extern size_t cbc_get_arguments_size (const ecma_compiled_code_t *);
+extern uint8_t *cbc_get_byte_code (const ecma_compiled_code_t *);
+extern bool cbc_is_byte_code_external (const ecma_compiled_code_t *);
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+
+/**
+ * Literal map of a snapshot, whose function code is executed in place from the snapshot buffer.
+ *
+ * The literal tables of such code are not copied to the heap: they are stored in the snapshot
+ * buffer, and contain indices of the entries of this map. The map is followed by the entries:
+ * the NULL literal, the literals and the compiled code of the snapshot. The compiled code
+ * entries are NULL until the compiled code is loaded when it is first instantiated.
+ */
+typedef struct
+{
+  uint32_t refs; /**< reference counter of all compiled code of the snapshot */
+  uint16_t compiled_code_start; /**< index of the first compiled code entry */
+  uint16_t entries_num; /**< number of entries */
+  const uint8_t *snapshot_data_p; /**< snapshot buffer */
+  const uint32_t *compiled_code_offsets_p; /**< offsets of the compiled code in the snapshot buffer */
+} cbc_snapshot_literal_map_t;
+
+/**
+ * Function code executed in place from a snapshot buffer is represented in the heap by a copy
+ * of its byte code arguments, followed by this structure (without padding). The reference
+ * counter of the copy is ECMA_BYTECODE_REF_SNAPSHOT.
+ */
+typedef struct
+{
+  const uint8_t *snapshot_code_p; /**< the compiled code in the snapshot buffer */
+  mem_cpointer_t literal_map_cp; /**< literal map of the snapshot */
+} cbc_snapshot_code_t;
+
+/**
+ * Check whether a compiled code is executed in place from a snapshot buffer.
+ */
+#define CBC_IS_IN_SNAPSHOT(bytecode_header_p) \
+  (((bytecode_header_p)->status_flags >> ECMA_BYTECODE_REF_SHIFT) == ECMA_BYTECODE_REF_SNAPSHOT)
+
+extern cbc_snapshot_literal_map_t *cbc_get_snapshot_literal_map (const ecma_compiled_code_t *);
+extern lit_cpointer_t cbc_get_snapshot_literal (const ecma_compiled_code_t *, uint32_t);
+extern void cbc_resolve_snapshot_literals (const ecma_compiled_code_t *, lit_cpointer_t *, uint32_t);
+
+/* Implemented by the snapshot loader (jerry.c) */
+extern void snapshot_load_compiled_code (cbc_snapshot_literal_map_t *, uint32_t, bool);
+
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * The line info table maps byte code offsets to source positions. It
+ * starts with the number of entries, followed by the entries in increasing
+ * byte code offset order. Each entry is encoded as three variable length
+ * unsigned integers (7 bits per byte, the highest bit marks continuation):
+ *
+ *  - byte code offset, relative to the previous entry
+ *  - line, relative to the previous entry (zigzag encoded, since it may decrease)
+ *  - column
+ *
+ * The first entry of function code describes the position of the definition.
+ */
+
+extern bool cbc_get_source_position (const ecma_compiled_code_t *, uint32_t, uint32_t *, uint32_t *);
+extern bool cbc_get_definition_position (const ecma_compiled_code_t *, uint32_t *, uint32_t *);
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 #ifdef PARSER_DUMP_BYTE_CODE
 
 /**
@@ -17,6 +17,7 @@
 #include "ecma-alloc.h"
 #include "ecma-helpers.h"
 #include "ecma-function-object.h"
+#include "jcontext.h"
 #include "jerry-snapshot.h"
 #include "js-parser-internal.h"
 #include "lit-char-helpers.h"
@@ -1828,7 +1829,7 @@ lexer_construct_regexp_object (parser_context_t *context_p, /**< context */
   }
 
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
-  if (snapshot_report_byte_code_compilation)
+  if (JERRY_CONTEXT (snapshot_report_byte_code_compilation))
   {
     snapshot_add_compiled_code ((ecma_compiled_code_t *) re_bytecode_p,
                                 regex_start_p,
@@ -51,6 +51,11 @@
 #define PARSER_ARGUMENTS_NOT_NEEDED           0x04000u
 #define PARSER_LEXICAL_ENV_NEEDED             0x08000u
 #define PARSER_HAS_LATE_LIT_INIT              0x10000u
+#define PARSER_LAZY_FUNCTIONS                 0x20000u
+
+/* Strict mode string literal in directive prologues */
+#define PARSER_USE_STRICT_LITERAL  "use strict"
+#define PARSER_USE_STRICT_LENGTH   10
 
 /* Expression parsing flags. */
 #define PARSE_EXPR                            0x00
@@ -199,6 +204,20 @@ typedef struct parser_branch_node_t
   parser_branch_t branch;                     /**< branch */
 } parser_branch_node_t;
 
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * Source position of a statement.
+ */
+typedef struct
+{
+  uint32_t byte_code_offset;                  /**< byte code offset of the statement */
+  parser_line_counter_t line;                 /**< statement start line */
+  parser_line_counter_t column;               /**< statement start column */
+} parser_line_info_t;
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 /**
  * Those members of a context which needs
  * to be saved when a sub-function is parsed.
@@ -221,6 +240,9 @@ typedef struct parser_saved_context_t
   parser_mem_data_t byte_code;                /**< byte code buffer */
   uint32_t byte_code_size;                    /**< byte code size for branches */
   parser_mem_data_t literal_pool_data;        /**< literal list */
+#ifdef JERRY_ENABLE_LINE_INFO
+  parser_mem_data_t line_info_data;           /**< line info list */
+#endif /* JERRY_ENABLE_LINE_INFO */
 
 #ifdef PARSER_DEBUG
   uint16_t context_stack_depth;               /**< current context stack depth */
@@ -265,6 +287,9 @@ typedef struct
   parser_mem_data_t byte_code;                /**< byte code buffer */
   uint32_t byte_code_size;                    /**< current byte code size for branches */
   parser_list_t literal_pool;                 /**< literal list */
+#ifdef JERRY_ENABLE_LINE_INFO
+  parser_list_t line_info;                    /**< source positions of the statements */
+#endif /* JERRY_ENABLE_LINE_INFO */
   parser_mem_data_t stack;                    /**< storage space */
   parser_mem_page_t *free_page_p;             /**< space for fast allocation */
   uint8_t stack_top_uint8;                    /**< top byte stored on the stack */
@@ -321,6 +346,9 @@ void parser_stack_iterator_write (parser_stack_iterator_t *, const void *, size_
 /* Compact byte code emitting functions. */
 
 void parser_flush_cbc (parser_context_t *);
+#ifdef JERRY_ENABLE_LINE_INFO
+void parser_append_line_info (parser_context_t *);
+#endif /* JERRY_ENABLE_LINE_INFO */
 void parser_emit_cbc (parser_context_t *, uint16_t);
 void parser_emit_cbc_literal (parser_context_t *, uint16_t, uint16_t);
 void parser_emit_cbc_literal_from_token (parser_context_t *, uint16_t);
@@ -362,6 +390,8 @@ int lexer_same_identifiers (lexer_lit_location_t *, lexer_lit_location_t *);
 void parser_parse_expression (parser_context_t *, int);
 void parser_parse_statements (parser_context_t *);
 void parser_scan_until (parser_context_t *, lexer_range_t *, lexer_token_type_t);
+int parser_scan_is_eval_or_arguments (lexer_lit_location_t *);
+int parser_scan_function_body (parser_context_t *, uint32_t, const lexer_range_t *);
 ecma_compiled_code_t *parser_parse_function (parser_context_t *, uint32_t);
 void parser_free_jumps (parser_stack_iterator_t);
 
@@ -295,7 +295,9 @@ parser_scan_primary_expression_end (parser_context_t *context_p, /**< context */
   /* Check whether we can enter to statement mode. */
   if (stack_top != SCAN_STACK_BLOCK_STATEMENT
       && stack_top != SCAN_STACK_BLOCK_EXPRESSION
-      && !(stack_top == SCAN_STACK_HEAD && end_type == LEXER_SCAN_SWITCH))
+      && stack_top != SCAN_STACK_BLOCK_PROPERTY
+      && !(stack_top == SCAN_STACK_HEAD
+           && (end_type == LEXER_SCAN_SWITCH || end_type == LEXER_SCAN_FUNCTION)))
   {
     parser_raise_error (context_p, PARSER_ERR_INVALID_EXPRESSION);
   }
@@ -336,9 +338,16 @@ parser_scan_statement (parser_context_t *context_p, /**< context */
     {
       return PARSER_FALSE;
     }
+    case LEXER_KEYW_WITH:
+    {
+      if (context_p->status_flags & PARSER_IS_STRICT)
+      {
+        parser_raise_error (context_p, PARSER_ERR_WITH_NOT_ALLOWED);
+      }
+      /* FALLTHRU */
+    }
     case LEXER_KEYW_IF:
     case LEXER_KEYW_WHILE:
-    case LEXER_KEYW_WITH:
     case LEXER_KEYW_SWITCH:
     case LEXER_KEYW_CATCH:
     {
@@ -380,7 +389,8 @@ parser_scan_statement (parser_context_t *context_p, /**< context */
     {
       lexer_next_token (context_p);
       if (!context_p->token.was_newline
-          && context_p->token.type != LEXER_SEMICOLON)
+          && context_p->token.type != LEXER_SEMICOLON
+          && context_p->token.type != LEXER_RIGHT_BRACE)
       {
         *mode = SCAN_MODE_PRIMARY_EXPRESSION;
       }
@@ -474,8 +484,200 @@ parser_scan_statement (parser_context_t *context_p, /**< context */
   return PARSER_TRUE;
 } /* parser_scan_statement */
 
+/**
+ * Pre-scan the directive prologue of a function body.
+ *
+ * Note: the strict mode flag of the context is set if the prologue contains a use strict directive.
+ *
+ * @return scan mode of the token after the prologue
+ */
+static scan_modes_t
+parser_scan_directive_prologue (parser_context_t *context_p) /**< context */
+{
+  JERRY_ASSERT (context_p->token.type == LEXER_LEFT_BRACE);
+
+  lexer_next_token (context_p);
+
+  while (context_p->token.type == LEXER_LITERAL
+         && context_p->token.lit_location.type == LEXER_STRING_LITERAL)
+  {
+    lexer_lit_location_t lit_location = context_p->token.lit_location;
+    uint32_t status_flags = context_p->status_flags;
+
+    if (lit_location.length == PARSER_USE_STRICT_LENGTH
+        && !lit_location.has_escape
+        && memcmp (PARSER_USE_STRICT_LITERAL, lit_location.char_p, PARSER_USE_STRICT_LENGTH) == 0)
+    {
+      context_p->status_flags |= PARSER_IS_STRICT;
+    }
+
+    lexer_next_token (context_p);
+
+    if (context_p->token.type != LEXER_SEMICOLON
+        && context_p->token.type != LEXER_RIGHT_BRACE)
+    {
+      if (!context_p->token.was_newline
+          || LEXER_IS_BINARY_OP_TOKEN (context_p->token.type)
+          || context_p->token.type == LEXER_LEFT_PAREN
+          || context_p->token.type == LEXER_LEFT_SQUARE
+          || context_p->token.type == LEXER_DOT)
+      {
+        /* The string is part of an expression statement. */
+        context_p->status_flags = status_flags;
+        return SCAN_MODE_POST_PRIMARY_EXPRESSION;
+      }
+    }
+
+    if (context_p->token.type == LEXER_SEMICOLON)
+    {
+      lexer_next_token (context_p);
+    }
+  }
+
+  return SCAN_MODE_STATEMENT;
+} /* parser_scan_directive_prologue */
+
+/**
+ * Identifiers, which cannot be function or argument names in strict mode.
+ */
+static const lexer_lit_location_t parser_scan_eval_literal =
+{
+  (const uint8_t *) "eval", 4, LEXER_IDENT_LITERAL, PARSER_FALSE
+};
+
+static const lexer_lit_location_t parser_scan_arguments_literal =
+{
+  (const uint8_t *) "arguments", 9, LEXER_IDENT_LITERAL, PARSER_FALSE
+};
+
+/**
+ * Checks whether an identifier is eval or arguments.
+ *
+ * @return PARSER_TRUE if the identifier is eval or arguments, PARSER_FALSE otherwise
+ */
+int
+parser_scan_is_eval_or_arguments (lexer_lit_location_t *lit_location_p) /**< identifier */
+{
+  return (lexer_same_identifiers (lit_location_p, (lexer_lit_location_t *) &parser_scan_eval_literal)
+          || lexer_same_identifiers (lit_location_p, (lexer_lit_location_t *) &parser_scan_arguments_literal));
+} /* parser_scan_is_eval_or_arguments */
+
+/**
+ * Check the argument names of a pre-scanned strict mode function.
+ *
+ * The argument list is scanned again in strict mode,
+ * and the state of the lexer is restored afterwards.
+ */
+static void
+parser_scan_check_strict_arguments (parser_context_t *context_p, /**< context */
+                                    const lexer_range_t *arguments_p) /**< start of the argument list */
+{
+  lexer_token_t token = context_p->token;
+  const uint8_t *end_source_p = context_p->source_p;
+  parser_line_counter_t end_line = context_p->line;
+  parser_line_counter_t end_column = context_p->column;
+
+  JERRY_ASSERT (context_p->status_flags & PARSER_IS_STRICT);
+
+  context_p->source_p = arguments_p->source_p;
+  context_p->line = arguments_p->line;
+  context_p->column = arguments_p->column;
+
+  lexer_next_token (context_p);
+
+  while (context_p->token.type == LEXER_LITERAL)
+  {
+    lexer_lit_location_t argument = context_p->token.lit_location;
+    const uint8_t *next_source_p = context_p->source_p;
+    parser_line_counter_t next_line = context_p->line;
+    parser_line_counter_t next_column = context_p->column;
+
+    if (parser_scan_is_eval_or_arguments (&argument))
+    {
+      parser_raise_error (context_p, PARSER_ERR_NON_STRICT_ARG_DEFINITION);
+    }
+
+    /* Compare the argument with the following arguments. */
+    lexer_next_token (context_p);
+
+    while (context_p->token.type == LEXER_COMMA)
+    {
+      lexer_next_token (context_p);
+
+      if (lexer_same_identifiers (&argument, &context_p->token.lit_location))
+      {
+        parser_raise_error (context_p, PARSER_ERR_NON_STRICT_ARG_DEFINITION);
+      }
+
+      lexer_next_token (context_p);
+    }
+
+    context_p->source_p = next_source_p;
+    context_p->line = next_line;
+    context_p->column = next_column;
+
+    lexer_next_token (context_p);
+
+    if (context_p->token.type != LEXER_COMMA)
+    {
+      break;
+    }
+
+    lexer_next_token (context_p);
+  }
+
+  JERRY_ASSERT (context_p->token.type == LEXER_RIGHT_PAREN);
+
+  context_p->token = token;
+  context_p->source_p = end_source_p;
+  context_p->line = end_line;
+  context_p->column = end_column;
+} /* parser_scan_check_strict_arguments */
+
+/**
+ * Pre-scan a function body.
+ *
+ * The body is scanned in strict mode after a use strict directive, and the name
+ * and the arguments of the function are checked when the function is strict.
+ *
+ * Note: the current token must be the left brace of the body, and the scan stops
+ *       at the right brace which closes the body. The arguments_p range must
+ *       start right after the left parenthesis of the argument list.
+ *
+ * @return PARSER_TRUE if the function is strict mode code, PARSER_FALSE otherwise
+ */
+int
+parser_scan_function_body (parser_context_t *context_p, /**< context */
+                           uint32_t status_flags, /**< status flags of the function */
+                           const lexer_range_t *arguments_p) /**< start of the argument list */
+{
+  uint32_t saved_status_flags = context_p->status_flags;
+  int is_strict;
+  lexer_range_t range;
+
+  parser_scan_until (context_p, &range, LEXER_SCAN_FUNCTION);
+
+  is_strict = (context_p->status_flags & PARSER_IS_STRICT) != 0;
+
+  if (is_strict)
+  {
+    if (status_flags & PARSER_HAS_NON_STRICT_ARG)
+    {
+      parser_raise_error (context_p, PARSER_ERR_NON_STRICT_ARG_DEFINITION);
+    }
+
+    parser_scan_check_strict_arguments (context_p, arguments_p);
+  }
+
+  context_p->status_flags = saved_status_flags;
+  return is_strict;
+} /* parser_scan_function_body */
+
 /**
  * Pre-scan for token(s).
+ *
+ * Note: when end_type is LEXER_SCAN_FUNCTION, the current token must be the left brace
+ *       of a function body, and the scan stops at the right brace which closes the body.
  */
 void
 parser_scan_until (parser_context_t *context_p, /**< context */
@@ -498,6 +700,10 @@ parser_scan_until (parser_context_t *context_p, /**< context */
     end_type_b = LEXER_SCAN_SWITCH;
     mode = SCAN_MODE_STATEMENT;
   }
+  else if (end_type == LEXER_SCAN_FUNCTION)
+  {
+    mode = parser_scan_directive_prologue (context_p);
+  }
   else
   {
     lexer_next_token (context_p);
@@ -569,9 +775,10 @@ parser_scan_until (parser_context_t *context_p, /**< context */
       }
       case SCAN_MODE_STATEMENT:
       {
-        if (end_type == LEXER_SCAN_SWITCH
-            && stack_top == SCAN_STACK_HEAD
-            && (type == LEXER_KEYW_DEFAULT || type == LEXER_KEYW_CASE || type == LEXER_RIGHT_BRACE))
+        if (stack_top == SCAN_STACK_HEAD
+            && ((end_type == LEXER_SCAN_SWITCH
+                 && (type == LEXER_KEYW_DEFAULT || type == LEXER_KEYW_CASE || type == LEXER_RIGHT_BRACE))
+                || (end_type == LEXER_SCAN_FUNCTION && type == LEXER_RIGHT_BRACE)))
         {
           parser_stack_pop_uint8 (context_p);
           return;
@@ -585,6 +792,9 @@ parser_scan_until (parser_context_t *context_p, /**< context */
       }
       case SCAN_MODE_FUNCTION_ARGUMENTS:
       {
+        uint32_t status_flags = 0;
+        lexer_range_t arguments;
+
         JERRY_ASSERT (stack_top == SCAN_STACK_BLOCK_STATEMENT
                        || stack_top == SCAN_STACK_BLOCK_EXPRESSION
                        || stack_top == SCAN_STACK_BLOCK_PROPERTY);
@@ -592,6 +802,10 @@ parser_scan_until (parser_context_t *context_p, /**< context */
         if (context_p->token.type == LEXER_LITERAL
             && context_p->token.lit_location.type == LEXER_IDENT_LITERAL)
         {
+          if (parser_scan_is_eval_or_arguments (&context_p->token.lit_location))
+          {
+            status_flags |= PARSER_HAS_NON_STRICT_ARG;
+          }
           lexer_next_token (context_p);
         }
 
@@ -599,6 +813,10 @@ parser_scan_until (parser_context_t *context_p, /**< context */
         {
           parser_raise_error (context_p, PARSER_ERR_ARGUMENT_LIST_EXPECTED);
         }
+
+        arguments.source_p = context_p->source_p;
+        arguments.line = context_p->line;
+        arguments.column = context_p->column;
         lexer_next_token (context_p);
 
         if (context_p->token.type != LEXER_RIGHT_PAREN)
@@ -632,6 +850,15 @@ parser_scan_until (parser_context_t *context_p, /**< context */
           parser_raise_error (context_p, PARSER_ERR_LEFT_BRACE_EXPECTED);
         }
         mode = SCAN_MODE_STATEMENT;
+
+        if (context_p->status_flags & PARSER_LAZY_FUNCTIONS)
+        {
+          /* Nested functions of lazy functions are not parsed before their
+           * first call, so their strict mode restrictions are checked here.
+           * The right brace which closes the body is processed as a statement. */
+          parser_scan_function_body (context_p, status_flags, &arguments);
+          continue;
+        }
         break;
       }
       case SCAN_MODE_PROPERTY_NAME:
@@ -26,10 +26,6 @@
  * @{
  */
 
-/* Strict mode string literal in directive prologues */
-#define PARSER_USE_STRICT_LITERAL  "use strict"
-#define PARSER_USE_STRICT_LENGTH   10
-
 /**
  * Parser statement types.
  *
@@ -1645,6 +1641,15 @@ parser_parse_statements (parser_context_t *context_p) /**< context */
     JERRY_ASSERT (context_p->stack_depth == context_p->context_stack_depth);
 #endif
 
+#ifdef JERRY_ENABLE_LINE_INFO
+    if (context_p->token.type != LEXER_SEMICOLON
+        && context_p->token.type != LEXER_RIGHT_BRACE
+        && context_p->token.type != LEXER_EOS)
+    {
+      parser_append_line_info (context_p);
+    }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
     switch (context_p->token.type)
     {
       case LEXER_SEMICOLON:
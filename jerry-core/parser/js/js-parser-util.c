@@ -218,6 +218,43 @@ parser_flush_cbc (parser_context_t *context_p) /**< context */
   context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
 } /* parser_flush_cbc */
 
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * Record the position of the current token as the
+ * source position of the next byte code instruction.
+ */
+void
+parser_append_line_info (parser_context_t *context_p) /**< context */
+{
+  parser_list_t *list_p = &context_p->line_info;
+  parser_line_info_t *line_info_p;
+
+  /* Positions of statements which produce no byte code are replaced,
+   * except at the start of the code, since the first entry describes
+   * the function definition. */
+  if (list_p->data.last_p != NULL && context_p->byte_code_size > 0)
+  {
+    line_info_p = (parser_line_info_t *) (list_p->data.last_p->bytes
+                                          + list_p->data.last_position
+                                          - list_p->item_size);
+
+    if (line_info_p->byte_code_offset == context_p->byte_code_size)
+    {
+      line_info_p->line = context_p->token.line;
+      line_info_p->column = context_p->token.column;
+      return;
+    }
+  }
+
+  line_info_p = (parser_line_info_t *) parser_list_append (context_p, list_p);
+  line_info_p->byte_code_offset = context_p->byte_code_size;
+  line_info_p->line = context_p->token.line;
+  line_info_p->column = context_p->token.column;
+} /* parser_append_line_info */
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 /**
  * Append a byte code
  */
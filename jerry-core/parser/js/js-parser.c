@@ -15,14 +15,11 @@
  */
 
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "jerry-snapshot.h"
 #include "js-parser-internal.h"
 #include "lit-literal.h"
 
-#ifdef PARSER_DUMP_BYTE_CODE
-static int parser_show_instrs = PARSER_FALSE;
-#endif /* PARSER_DUMP_BYTE_CODE */
-
 /** \addtogroup parser Parser
  * @{
  *
@@ -1216,6 +1213,118 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
 
 #endif /* PARSER_DUMP_BYTE_CODE */
 
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * Encode an unsigned integer of the line info table.
+ *
+ * @return position after the encoded value
+ */
+static uint8_t *
+parser_encode_line_info_uint (uint8_t *dst_p, /**< destination buffer, NULL if
+                                               *   only the size is computed */
+                              uint32_t value, /**< value */
+                              size_t *size_p) /**< [in, out] encoded size */
+{
+  do
+  {
+    uint8_t byte = (uint8_t) (value & CBC_LOWER_SEVEN_BIT_MASK);
+
+    value >>= 7;
+
+    if (value > 0)
+    {
+      byte |= CBC_HIGHEST_BIT_MASK;
+    }
+
+    if (dst_p != NULL)
+    {
+      *dst_p++ = byte;
+    }
+
+    (*size_p)++;
+  }
+  while (value > 0);
+
+  return dst_p;
+} /* parser_encode_line_info_uint */
+
+/**
+ * Encode an entry of the line info table.
+ *
+ * @return position after the encoded entry
+ */
+static uint8_t *
+parser_encode_line_info_entry (uint8_t *dst_p, /**< destination buffer, NULL if
+                                                *   only the size is computed */
+                               uint32_t offset_delta, /**< byte code offset
+                                                       *   relative to the previous entry */
+                               parser_line_counter_t line, /**< line */
+                               parser_line_counter_t last_line, /**< line of the previous entry */
+                               parser_line_counter_t column, /**< column */
+                               size_t *size_p) /**< [in, out] encoded size */
+{
+  int32_t line_delta = (int32_t) (line - last_line);
+  /* Zigzag encoding. */
+  uint32_t encoded_line_delta = ((uint32_t) line_delta << 1) ^ (uint32_t) (line_delta >> 31);
+
+  dst_p = parser_encode_line_info_uint (dst_p, offset_delta, size_p);
+  dst_p = parser_encode_line_info_uint (dst_p, encoded_line_delta, size_p);
+  return parser_encode_line_info_uint (dst_p, column, size_p);
+} /* parser_encode_line_info_entry */
+
+/**
+ * Compute the maximum size of the line info table. The final byte code
+ * offsets are not known before post processing, but the distance of two
+ * instructions cannot be increased by the post processing.
+ *
+ * @return maximum size of the line info table, 0 if there is no entry
+ */
+static size_t
+parser_compute_line_info_size (parser_context_t *context_p, /**< context */
+                               size_t initializers_length) /**< length of the initializer instructions */
+{
+  parser_list_iterator_t line_info_iterator;
+  parser_line_info_t *line_info_p;
+  uint32_t count = 0;
+  uint32_t last_offset = 0;
+  parser_line_counter_t last_line = 0;
+  size_t size = 0;
+
+  parser_list_iterator_init (&context_p->line_info, &line_info_iterator);
+
+  while ((line_info_p = (parser_line_info_t *) parser_list_iterator_next (&line_info_iterator)))
+  {
+    uint32_t offset_delta = line_info_p->byte_code_offset - last_offset;
+
+    if (count == 0)
+    {
+      offset_delta += (uint32_t) initializers_length;
+    }
+
+    parser_encode_line_info_entry (NULL,
+                                   offset_delta,
+                                   line_info_p->line,
+                                   last_line,
+                                   line_info_p->column,
+                                   &size);
+
+    last_offset = line_info_p->byte_code_offset;
+    last_line = line_info_p->line;
+    count++;
+  }
+
+  if (count == 0)
+  {
+    return 0;
+  }
+
+  parser_encode_line_info_uint (NULL, count, &size);
+  return size;
+} /* parser_compute_line_info_size */
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 #define PARSER_NEXT_BYTE(page_p, offset) \
   do { \
     if (++(offset) >= PARSER_CBC_STREAM_PAGE_SIZE) \
@@ -1263,6 +1372,16 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   ecma_compiled_code_t *compiled_code_p;
   lit_cpointer_t *literal_pool_p;
   uint8_t *dst_p;
+#ifdef JERRY_ENABLE_LINE_INFO
+  size_t line_info_size;
+  parser_list_iterator_t line_info_iterator;
+  parser_line_info_t *line_info_p;
+  parser_mem_page_t *line_info_page_p;
+  uint32_t line_info_page_start;
+  uint8_t *line_info_dst_p;
+  uint32_t line_info_last_offset;
+  parser_line_counter_t line_info_last_line;
+#endif /* JERRY_ENABLE_LINE_INFO */
 
   if ((size_t) context_p->stack_limit + (size_t) context_p->register_count > PARSER_MAXIMUM_STACK_LIMIT)
   {
@@ -1459,6 +1578,12 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   }
 
   total_size += length + context_p->literal_count * sizeof (lit_cpointer_t);
+
+#ifdef JERRY_ENABLE_LINE_INFO
+  line_info_size = parser_compute_line_info_size (context_p, initializers_length);
+  total_size += line_info_size;
+#endif /* JERRY_ENABLE_LINE_INFO */
+
   compiled_code_p = (ecma_compiled_code_t *) parser_malloc (context_p, total_size);
 
   byte_code_p = (uint8_t *) compiled_code_p;
@@ -1474,6 +1599,9 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     args_p->ident_end = ident_end;
     args_p->const_literal_end = const_literal_end;
     args_p->literal_end = context_p->literal_count;
+#ifdef JERRY_ENABLE_LINE_INFO
+    args_p->line_info_offset = (line_info_size > 0) ? (uint32_t) length : 0;
+#endif /* JERRY_ENABLE_LINE_INFO */
 
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_UINT16_ARGUMENTS;
     byte_code_p += sizeof (cbc_uint16_arguments_t);
@@ -1488,6 +1616,9 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     args_p->ident_end = (uint8_t) ident_end;
     args_p->const_literal_end = (uint8_t) const_literal_end;
     args_p->literal_end = (uint8_t) context_p->literal_count;
+#ifdef JERRY_ENABLE_LINE_INFO
+    args_p->line_info_offset = (line_info_size > 0) ? (uint32_t) length : 0;
+#endif /* JERRY_ENABLE_LINE_INFO */
 
     byte_code_p += sizeof (cbc_uint8_arguments_t);
   }
@@ -1519,7 +1650,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
 
-  if (snapshot_report_byte_code_compilation
+  if (JERRY_CONTEXT (snapshot_report_byte_code_compilation)
       && context_p->argument_count > 0)
   {
     /* Reset all arguments to NULL. */
@@ -1545,6 +1676,33 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   offset = 0;
   real_offset = 0;
 
+#ifdef JERRY_ENABLE_LINE_INFO
+  line_info_p = NULL;
+  line_info_page_p = page_p;
+  line_info_page_start = 0;
+  line_info_dst_p = byte_code_p + length;
+  line_info_last_offset = 0;
+  line_info_last_line = 0;
+
+  if (line_info_size > 0)
+  {
+    size_t count_size = 0;
+    uint32_t count = 0;
+
+    parser_list_iterator_init (&context_p->line_info, &line_info_iterator);
+
+    while (parser_list_iterator_next (&line_info_iterator))
+    {
+      count++;
+    }
+
+    line_info_dst_p = parser_encode_line_info_uint (line_info_dst_p, count, &count_size);
+
+    parser_list_iterator_init (&context_p->line_info, &line_info_iterator);
+    line_info_p = (parser_line_info_t *) parser_list_iterator_next (&line_info_iterator);
+  }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
   while (page_p != last_page_p || offset < last_position)
   {
     uint8_t flags;
@@ -1553,6 +1711,33 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     cbc_opcode_t opcode;
     size_t branch_offset_length;
 
+#ifdef JERRY_ENABLE_LINE_INFO
+    /* An instruction cannot span more than two pages. */
+    if (page_p != line_info_page_p)
+    {
+      line_info_page_p = page_p;
+      line_info_page_start += PARSER_CBC_STREAM_PAGE_SIZE;
+    }
+
+    while (line_info_p != NULL
+           && line_info_p->byte_code_offset <= line_info_page_start + offset)
+    {
+      size_t entry_size = 0;
+      uint32_t current_offset = (uint32_t) (dst_p - byte_code_p);
+
+      line_info_dst_p = parser_encode_line_info_entry (line_info_dst_p,
+                                                       current_offset - line_info_last_offset,
+                                                       line_info_p->line,
+                                                       line_info_last_line,
+                                                       line_info_p->column,
+                                                       &entry_size);
+
+      line_info_last_offset = current_offset;
+      line_info_last_line = line_info_p->line;
+      line_info_p = (parser_line_info_t *) parser_list_iterator_next (&line_info_iterator);
+    }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
     opcode_p = dst_p;
     branch_mark_p = page_p->bytes + offset;
     opcode = (cbc_opcode_t) (*branch_mark_p);
@@ -1677,6 +1862,31 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     }
   }
 
+#ifdef JERRY_ENABLE_LINE_INFO
+  /* Statements at the end of the code, which produce no byte code. */
+  while (line_info_p != NULL)
+  {
+    size_t entry_size = 0;
+    uint32_t current_offset = (uint32_t) (dst_p - byte_code_p);
+
+    line_info_dst_p = parser_encode_line_info_entry (line_info_dst_p,
+                                                     current_offset - line_info_last_offset,
+                                                     line_info_p->line,
+                                                     line_info_last_line,
+                                                     line_info_p->column,
+                                                     &entry_size);
+
+    line_info_last_offset = current_offset;
+    line_info_last_line = line_info_p->line;
+    line_info_p = (parser_line_info_t *) parser_list_iterator_next (&line_info_iterator);
+  }
+
+  JERRY_ASSERT (line_info_dst_p <= byte_code_p + length + line_info_size);
+
+  /* The unused space at the end of the table is not saved into snapshots. */
+  total_size -= (size_t) (byte_code_p + length + line_info_size - line_info_dst_p);
+#endif /* JERRY_ENABLE_LINE_INFO */
+
   if (!(context_p->status_flags & PARSER_NO_END_LABEL))
   {
     *dst_p++ = CBC_RETURN_WITH_BLOCK;
@@ -1781,7 +1991,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
 
-  if (snapshot_report_byte_code_compilation)
+  if (JERRY_CONTEXT (snapshot_report_byte_code_compilation))
   {
     snapshot_add_compiled_code (compiled_code_p, NULL, (uint32_t) total_size);
   }
@@ -1822,7 +2032,9 @@ parser_free_literals (parser_list_t *literal_pool_p) /**< literals */
 static ecma_compiled_code_t *
 parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
                      size_t size, /**< size of the source code */
-                     int strict_mode, /**< strict mode */
+                     uint32_t status_flags, /**< PARSER_IS_STRICT and PARSER_LAZY_FUNCTIONS flags */
+                     const cbc_lazy_function_t *lazy_function_p, /**< lazy function code which source is
+                                                                  *   compiled, or NULL for global code */
                      parser_error_location *error_location) /**< error location */
 {
   parser_context_t context;
@@ -1837,21 +2049,23 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
   }
 
   context.status_flags = PARSER_NO_REG_STORE | PARSER_LEXICAL_ENV_NEEDED | PARSER_ARGUMENTS_NOT_NEEDED;
+  context.status_flags |= status_flags;
   context.stack_depth = 0;
   context.stack_limit = 0;
   context.last_context_p = NULL;
   context.last_statement.current_p = NULL;
 
-  if (strict_mode)
-  {
-    context.status_flags |= PARSER_IS_STRICT;
-  }
-
   context.source_p = source_p;
   context.source_end_p = source_p + size;
   context.line = 1;
   context.column = 1;
 
+  if (lazy_function_p != NULL)
+  {
+    context.line = lazy_function_p->line;
+    context.column = lazy_function_p->column;
+  }
+
   context.last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
 
   context.argument_count = 0;
@@ -1863,6 +2077,11 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
   parser_list_init (&context.literal_pool,
                     sizeof (lexer_literal_t),
                     (uint32_t) ((128 - sizeof (void *)) / sizeof (lexer_literal_t)));
+#ifdef JERRY_ENABLE_LINE_INFO
+  parser_list_init (&context.line_info,
+                    sizeof (parser_line_info_t),
+                    (uint32_t) ((128 - sizeof (void *)) / sizeof (parser_line_info_t)));
+#endif /* JERRY_ENABLE_LINE_INFO */
   parser_stack_init (&context);
 
 #ifdef PARSER_DEBUG
@@ -1870,7 +2089,7 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
 #endif /* PARSER_DEBUG */
 
 #ifdef PARSER_DUMP_BYTE_CODE
-  context.is_show_opcodes = parser_show_instrs;
+  context.is_show_opcodes = JERRY_CONTEXT (parser_show_instrs);
   context.total_byte_code_size = 0;
 
   if (context.is_show_opcodes)
@@ -1884,27 +2103,48 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
     /* Pushing a dummy value ensures the stack is never empty.
      * This simplifies the stack management routines. */
     parser_stack_push_uint8 (&context, CBC_MAXIMUM_BYTE_VALUE);
-    /* The next token must always be present to make decisions
-     * in the parser. Therefore when a token is consumed, the
-     * lexer_next_token() must be immediately called. */
-    lexer_next_token (&context);
-
-    parser_parse_statements (&context);
-
-    /* When the parsing is successful, only the
-     * dummy value can be remained on the stack. */
-    JERRY_ASSERT (context.stack_top_uint8 == CBC_MAXIMUM_BYTE_VALUE
-                   && context.stack.last_position == 1
-                   && context.stack.first_p != NULL
-                   && context.stack.first_p->next_p == NULL
-                   && context.stack.last_p == NULL);
-    JERRY_ASSERT (context.last_statement.current_p == NULL);
-
-    JERRY_ASSERT (context.last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
-    JERRY_ASSERT (context.allocated_buffer_p == NULL);
-
-    compiled_code = parser_post_processing (&context);
+
+    if (lazy_function_p != NULL)
+    {
+      /* The function is compiled in place of the enclosing code, and
+       * its nested functions are pre-scanned again. The lexer is started
+       * by the function parser. */
+      JERRY_ASSERT (!(context.status_flags & PARSER_LAZY_FUNCTIONS));
+
+      compiled_code = parser_parse_function (&context,
+                                             lazy_function_p->parser_status_flags | PARSER_LAZY_FUNCTIONS);
+
+      JERRY_ASSERT (context.token.type == LEXER_RIGHT_BRACE
+                     && context.source_p == context.source_end_p);
+    }
+    else
+    {
+      /* The next token must always be present to make decisions
+       * in the parser. Therefore when a token is consumed, the
+       * lexer_next_token() must be immediately called. */
+      lexer_next_token (&context);
+
+      parser_parse_statements (&context);
+
+      /* When the parsing is successful, only the
+       * dummy value can be remained on the stack. */
+      JERRY_ASSERT (context.stack_top_uint8 == CBC_MAXIMUM_BYTE_VALUE
+                     && context.stack.last_position == 1
+                     && context.stack.first_p != NULL
+                     && context.stack.first_p->next_p == NULL
+                     && context.stack.last_p == NULL);
+      JERRY_ASSERT (context.last_statement.current_p == NULL);
+
+      JERRY_ASSERT (context.last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
+      JERRY_ASSERT (context.allocated_buffer_p == NULL);
+
+      compiled_code = parser_post_processing (&context);
+    }
+
     parser_list_free (&context.literal_pool);
+#ifdef JERRY_ENABLE_LINE_INFO
+    parser_list_free (&context.line_info);
+#endif /* JERRY_ENABLE_LINE_INFO */
 
 #ifdef PARSER_DUMP_BYTE_CODE
     if (context.is_show_opcodes)
@@ -1936,6 +2176,9 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
     compiled_code = NULL;
     parser_free_literals (&context.literal_pool);
     parser_cbc_stream_free (&context.byte_code);
+#ifdef JERRY_ENABLE_LINE_INFO
+    parser_list_free (&context.line_info);
+#endif /* JERRY_ENABLE_LINE_INFO */
   }
   PARSER_TRY_END
 
@@ -1951,6 +2194,130 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
   return compiled_code;
 } /* parser_parse_source */
 
+/**
+ * Pre-scan function code without compiling it
+ *
+ * The function is compiled by parser_compile_lazy_function when it is called first.
+ *
+ * @return lazy function code
+ */
+static ecma_compiled_code_t *
+parser_scan_lazy_function (parser_context_t *context_p, /**< context */
+                           uint32_t status_flags) /**< extra status flags */
+{
+  cbc_lazy_function_t *lazy_function_p;
+  const uint8_t *source_p = context_p->source_p;
+  parser_line_counter_t line = context_p->line;
+  parser_line_counter_t column = context_p->column;
+  uint16_t argument_count = 0;
+  uint16_t code_flags = (CBC_CODE_FLAGS_FUNCTION
+                         | CBC_CODE_FLAGS_UINT16_ARGUMENTS
+                         | CBC_CODE_FLAGS_LAZY_FUNCTION);
+  lexer_range_t arguments;
+
+  JERRY_ASSERT (status_flags & PARSER_IS_FUNCTION);
+
+  status_flags |= context_p->status_flags & PARSER_IS_STRICT;
+
+  lexer_next_token (context_p);
+
+  if (status_flags & PARSER_IS_FUNC_EXPRESSION
+      && context_p->token.type == LEXER_LITERAL
+      && context_p->token.lit_location.type == LEXER_IDENT_LITERAL)
+  {
+    if (parser_scan_is_eval_or_arguments (&context_p->token.lit_location))
+    {
+      status_flags |= PARSER_HAS_NON_STRICT_ARG;
+    }
+
+    lexer_next_token (context_p);
+  }
+
+  if (context_p->token.type != LEXER_LEFT_PAREN)
+  {
+    parser_raise_error (context_p, PARSER_ERR_ARGUMENT_LIST_EXPECTED);
+  }
+
+  arguments.source_p = context_p->source_p;
+  arguments.line = context_p->line;
+  arguments.column = context_p->column;
+
+  lexer_next_token (context_p);
+
+  /* Argument names are checked when the function is compiled. */
+  if (context_p->token.type != LEXER_RIGHT_PAREN)
+  {
+    while (PARSER_TRUE)
+    {
+      if (context_p->token.type != LEXER_LITERAL
+          || context_p->token.lit_location.type != LEXER_IDENT_LITERAL)
+      {
+        parser_raise_error (context_p, PARSER_ERR_IDENTIFIER_EXPECTED);
+      }
+
+      argument_count++;
+      if (argument_count >= PARSER_MAXIMUM_NUMBER_OF_REGISTERS)
+      {
+        parser_raise_error (context_p, PARSER_ERR_REGISTER_LIMIT_REACHED);
+      }
+
+      lexer_next_token (context_p);
+
+      if (context_p->token.type != LEXER_COMMA)
+      {
+        break;
+      }
+
+      lexer_next_token (context_p);
+    }
+  }
+
+  if (context_p->token.type != LEXER_RIGHT_PAREN)
+  {
+    parser_raise_error (context_p, PARSER_ERR_RIGHT_PAREN_EXPECTED);
+  }
+
+  lexer_next_token (context_p);
+
+  if ((status_flags & PARSER_IS_PROPERTY_GETTER)
+      && argument_count != 0)
+  {
+    parser_raise_error (context_p, PARSER_ERR_NO_ARGUMENTS_EXPECTED);
+  }
+
+  if ((status_flags & PARSER_IS_PROPERTY_SETTER)
+      && argument_count != 1)
+  {
+    parser_raise_error (context_p, PARSER_ERR_ONE_ARGUMENT_EXPECTED);
+  }
+
+  if (context_p->token.type != LEXER_LEFT_BRACE)
+  {
+    parser_raise_error (context_p, PARSER_ERR_LEFT_BRACE_EXPECTED);
+  }
+
+  if (parser_scan_function_body (context_p, status_flags, &arguments))
+  {
+    code_flags |= CBC_CODE_FLAGS_STRICT_MODE;
+  }
+
+  JERRY_ASSERT (context_p->token.type == LEXER_RIGHT_BRACE);
+
+  lazy_function_p = (cbc_lazy_function_t *) parser_malloc (context_p, sizeof (cbc_lazy_function_t));
+
+  memset (&lazy_function_p->header, 0, sizeof (cbc_uint16_arguments_t));
+  lazy_function_p->header.status_flags = (uint16_t) (code_flags | (1u << ECMA_BYTECODE_REF_SHIFT));
+  lazy_function_p->header.argument_end = argument_count;
+  lazy_function_p->source_p = source_p;
+  lazy_function_p->source_end_p = context_p->source_p;
+  lazy_function_p->parser_status_flags = status_flags;
+  lazy_function_p->line = line;
+  lazy_function_p->column = column;
+  lazy_function_p->compiled_code_cp = MEM_CP_NULL;
+
+  return (ecma_compiled_code_t *) lazy_function_p;
+} /* parser_scan_lazy_function */
+
 /**
  * Parse function code
  *
@@ -1965,6 +2332,11 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 
   JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
 
+  if (context_p->status_flags & PARSER_LAZY_FUNCTIONS)
+  {
+    return parser_scan_lazy_function (context_p, status_flags);
+  }
+
   /* Save private part of the context. */
 
   saved_context.status_flags = context_p->status_flags;
@@ -1980,6 +2352,9 @@ parser_parse_function (parser_context_t *context_p, /**< context */
   saved_context.byte_code = context_p->byte_code;
   saved_context.byte_code_size = context_p->byte_code_size;
   saved_context.literal_pool_data = context_p->literal_pool.data;
+#ifdef JERRY_ENABLE_LINE_INFO
+  saved_context.line_info_data = context_p->line_info.data;
+#endif /* JERRY_ENABLE_LINE_INFO */
 
 #ifdef PARSER_DEBUG
   saved_context.context_stack_depth = context_p->context_stack_depth;
@@ -1989,7 +2364,7 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 
   JERRY_ASSERT (status_flags & PARSER_IS_FUNCTION);
 
-  context_p->status_flags &= PARSER_IS_STRICT;
+  context_p->status_flags &= PARSER_IS_STRICT | PARSER_LAZY_FUNCTIONS;
   context_p->status_flags |= status_flags;
   context_p->stack_depth = 0;
   context_p->stack_limit = 0;
@@ -2003,6 +2378,9 @@ parser_parse_function (parser_context_t *context_p, /**< context */
   parser_cbc_stream_init (&context_p->byte_code);
   context_p->byte_code_size = 0;
   parser_list_reset (&context_p->literal_pool);
+#ifdef JERRY_ENABLE_LINE_INFO
+  parser_list_reset (&context_p->line_info);
+#endif /* JERRY_ENABLE_LINE_INFO */
 
 #ifdef PARSER_DEBUG
   context_p->context_stack_depth = 0;
@@ -2017,6 +2395,11 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 
   lexer_next_token (context_p);
 
+#ifdef JERRY_ENABLE_LINE_INFO
+  /* The first entry is the position of the function name or argument list. */
+  parser_append_line_info (context_p);
+#endif /* JERRY_ENABLE_LINE_INFO */
+
   if (context_p->status_flags & PARSER_IS_FUNC_EXPRESSION
       && context_p->token.type == LEXER_LITERAL
       && context_p->token.lit_location.type == LEXER_IDENT_LITERAL)
@@ -2179,6 +2562,9 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 #endif /* PARSER_DUMP_BYTE_CODE */
 
   parser_list_free (&context_p->literal_pool);
+#ifdef JERRY_ENABLE_LINE_INFO
+  parser_list_free (&context_p->line_info);
+#endif /* JERRY_ENABLE_LINE_INFO */
 
   /* Restore private part of the context. */
 
@@ -2197,6 +2583,9 @@ parser_parse_function (parser_context_t *context_p, /**< context */
   context_p->byte_code = saved_context.byte_code;
   context_p->byte_code_size = saved_context.byte_code_size;
   context_p->literal_pool.data = saved_context.literal_pool_data;
+#ifdef JERRY_ENABLE_LINE_INFO
+  context_p->line_info.data = saved_context.line_info_data;
+#endif /* JERRY_ENABLE_LINE_INFO */
 
 #ifdef PARSER_DEBUG
   context_p->context_stack_depth = saved_context.context_stack_depth;
@@ -2226,6 +2615,11 @@ parser_raise_error (parser_context_t *context_p, /**< context */
     parser_free_literals (&context_p->literal_pool);
     context_p->literal_pool.data = saved_context_p->literal_pool_data;
 
+#ifdef JERRY_ENABLE_LINE_INFO
+    parser_list_free (&context_p->line_info);
+    context_p->line_info.data = saved_context_p->line_info_data;
+#endif /* JERRY_ENABLE_LINE_INFO */
+
     if (saved_context_p->last_statement.current_p != NULL)
     {
       parser_free_jumps (saved_context_p->last_statement);
@@ -2247,7 +2641,7 @@ void
 parser_set_show_instrs (int show_instrs) /**< flag indicating whether to dump bytecode */
 {
 #ifdef PARSER_DUMP_BYTE_CODE
-  parser_show_instrs = show_instrs;
+  JERRY_CONTEXT (parser_show_instrs) = show_instrs;
 #else
   (void) show_instrs;
 #endif /* PARSER_DUMP_BYTE_CODE */
@@ -2260,9 +2654,11 @@ parser_set_show_instrs (int show_instrs) /**< flag indicating whether to dump by
 jsp_status_t
 parser_parse_script (const jerry_api_char_t *source_p, /**< source code */
                      size_t size, /**< size of the source code */
+                     bool is_lazy, /**< defer the compilation of functions until their first call
+                                    *   (the source code must be kept alive while the code is used) */
                      ecma_compiled_code_t **bytecode_data_p) /**< result */
 {
-  *bytecode_data_p = parser_parse_source (source_p, size, false, NULL);
+  *bytecode_data_p = parser_parse_source (source_p, size, is_lazy ? PARSER_LAZY_FUNCTIONS : 0, NULL, NULL);
 
   if (!*bytecode_data_p)
   {
@@ -2281,7 +2677,7 @@ parser_parse_eval (const jerry_api_char_t *source_p, /**< source code */
                    bool is_strict, /**< strict mode */
                    ecma_compiled_code_t **bytecode_data_p) /**< result */
 {
-  *bytecode_data_p = parser_parse_source (source_p, size, is_strict, NULL);
+  *bytecode_data_p = parser_parse_source (source_p, size, is_strict ? PARSER_IS_STRICT : 0, NULL, NULL);
 
   if (!*bytecode_data_p)
   {
@@ -2291,6 +2687,45 @@ parser_parse_eval (const jerry_api_char_t *source_p, /**< source code */
   return JSP_STATUS_OK;
 } /* parser_parse_eval */
 
+/**
+ * Compile lazy function code
+ *
+ * Note: the compiled code is kept by the lazy function code
+ *
+ * @return JSP_STATUS_OK - if the compiled code is available,
+ *         JSP_STATUS_SYNTAX_ERROR - if the source code of the function has a syntax error.
+ */
+jsp_status_t
+parser_compile_lazy_function (ecma_compiled_code_t *bytecode_p, /**< lazy function code */
+                              ecma_compiled_code_t **bytecode_data_p) /**< [out] compiled code */
+{
+  cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) bytecode_p;
+
+  JERRY_ASSERT (CBC_IS_LAZY_FUNCTION (bytecode_p));
+
+  if (lazy_function_p->compiled_code_cp == MEM_CP_NULL)
+  {
+    ecma_compiled_code_t *compiled_code_p;
+    size_t size = (size_t) (lazy_function_p->source_end_p - lazy_function_p->source_p);
+
+    compiled_code_p = parser_parse_source (lazy_function_p->source_p,
+                                           size,
+                                           lazy_function_p->parser_status_flags & PARSER_IS_STRICT,
+                                           lazy_function_p,
+                                           NULL);
+
+    if (compiled_code_p == NULL)
+    {
+      return JSP_STATUS_SYNTAX_ERROR;
+    }
+
+    MEM_CP_SET_NON_NULL_POINTER (lazy_function_p->compiled_code_cp, compiled_code_p);
+  }
+
+  *bytecode_data_p = MEM_CP_GET_NON_NULL_POINTER (ecma_compiled_code_t, lazy_function_p->compiled_code_cp);
+  return JSP_STATUS_OK;
+} /* parser_compile_lazy_function */
+
 
 /**
  * @}
@@ -141,10 +141,11 @@ typedef enum
 extern void parser_set_show_instrs (int);
 
 /* Note: source must be a valid UTF-8 string */
-extern jsp_status_t parser_parse_script (const jerry_api_char_t *, size_t,
+extern jsp_status_t parser_parse_script (const jerry_api_char_t *, size_t, bool,
                                          ecma_compiled_code_t **);
 extern jsp_status_t parser_parse_eval (const jerry_api_char_t *, size_t, bool,
                                        ecma_compiled_code_t **);
+extern jsp_status_t parser_compile_lazy_function (ecma_compiled_code_t *, ecma_compiled_code_t **);
 
 const char *parser_error_to_string (parser_error_t);
 
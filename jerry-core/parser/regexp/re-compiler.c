@@ -685,6 +685,7 @@ re_compile_bytecode (re_compiled_code_t **out_bytecode_p, /**< out:pointer to by
                                ecma_copy_or_ref_ecma_string (pattern_str_p));
     re_compiled_code.num_of_captures = re_ctx.num_of_captures * 2;
     re_compiled_code.num_of_non_captures = re_ctx.num_of_non_captures;
+    re_compiled_code.size = (uint32_t) (re_get_bytecode_length (&bc_ctx) + sizeof (re_compiled_code_t));
 
     re_bytecode_list_insert (&bc_ctx,
                              0,
@@ -80,6 +80,7 @@ typedef struct
   mem_cpointer_t pattern_cp;         /**< original RegExp pattern */
   uint32_t num_of_captures;          /**< number of capturing brackets */
   uint32_t num_of_non_captures;      /**< number of non capturing brackets */
+  uint32_t size;                     /**< size of the compiled code, including this header */
 } re_compiled_code_t;
 
 /**
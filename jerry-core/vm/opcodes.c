@@ -18,6 +18,7 @@
 #include "ecma-builtins.h"
 #include "ecma-conversion.h"
 #include "ecma-exceptions.h"
+#include "ecma-for-in-cache.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
@@ -58,6 +59,12 @@ opfunc_call_n (ecma_value_t this_value, /**< this object value */
 
   ecma_object_t *func_obj_p = ecma_get_object_from_value (func_value);
 
+  /* Built-in routines are called through their routine descriptors directly. */
+  if (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION)
+  {
+    return ecma_builtin_call_routine (func_obj_p, this_value, arguments_list_p, arguments_list_len);
+  }
+
   ret_value = ecma_op_function_call (func_obj_p,
                                      this_value,
                                      arguments_list_p,
@@ -398,7 +405,13 @@ opfunc_for_in (ecma_value_t left_value, /**< left value */
                     compl_val);
 
     ecma_object_t *obj_p = ecma_get_object_from_value (obj_expr_value);
-    prop_names_p = ecma_op_object_get_property_names (obj_p, false, true, true);
+    prop_names_p = ecma_for_in_cache_lookup (obj_p);
+
+    if (prop_names_p == NULL)
+    {
+      prop_names_p = ecma_op_object_get_property_names (obj_p, false, true, true);
+      ecma_for_in_cache_insert (obj_p, prop_names_p);
+    }
 
     if (prop_names_p->unit_number != 0)
     {
@@ -40,7 +40,7 @@ typedef const uint8_t *vm_instr_counter_t;
 /**
  * Context of interpreter, related to a JS stack frame
  */
-typedef struct
+typedef struct vm_frame_ctx_t
 {
   const ecma_compiled_code_t *bytecode_header_p;      /**< currently executed byte-code data */
   uint8_t *byte_code_p;                               /**< current byte code pointer */
@@ -49,6 +49,7 @@ typedef struct
   lit_cpointer_t *literal_start_p;                    /**< literal list start pointer */
   ecma_object_t *lex_env_p;                           /**< current lexical environment */
   ecma_value_t this_binding;                          /**< this binding */
+  struct vm_frame_ctx_t *prev_context_p;              /**< context of the calling frame */
   uint16_t context_depth;                             /**< current context depth */
   bool is_eval_code;                                  /**< eval mode flag */
 } vm_frame_ctx_t;
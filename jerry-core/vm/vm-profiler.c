@@ -0,0 +1,558 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jrt-libc-includes.h"
+#include "vm.h"
+#include "vm-profiler.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup profiler Sampling profiler
+ * @{
+ *
+ * The profiler records the chain of the active frame contexts each time
+ * vm_profiler_sample is called (usually from a timer signal handler).
+ * Identical stacks are merged, so the memory consumption depends on the
+ * number of distinct stacks rather than on the number of samples.
+ *
+ * Sampling does not allocate memory and does not modify the state of the
+ * engine, so it can be performed asynchronously to the execution.
+ */
+
+#ifdef JERRY_ENABLE_PROFILER
+
+/**
+ * Maximum number of frames recorded for a sample (the outermost frames are dropped)
+ */
+#define VM_PROFILER_MAX_DEPTH 32
+
+/**
+ * Number of distinct stacks which can be recorded (must be a power of 2)
+ */
+#define VM_PROFILER_MAX_STACKS 2048
+
+/**
+ * Number of frames which can be stored for the distinct stacks
+ */
+#define VM_PROFILER_MAX_FRAMES 16384
+
+/**
+ * Frame kinds
+ */
+typedef enum
+{
+  VM_PROFILER_FRAME_GLOBAL, /**< global code */
+  VM_PROFILER_FRAME_EVAL, /**< eval code */
+  VM_PROFILER_FRAME_FUNCTION, /**< function code */
+  VM_PROFILER_FRAME_TRUNCATED, /**< frames which exceed VM_PROFILER_MAX_DEPTH */
+} vm_profiler_frame_kind_t;
+
+/**
+ * Flag of vm_profiler_frame_t::info indicating that the position of the active call is known
+ */
+#define VM_PROFILER_FRAME_HAS_POSITION 0x4
+
+/**
+ * Shift of the position in vm_profiler_frame_t::info
+ */
+#define VM_PROFILER_FRAME_POSITION_SHIFT 3
+
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * Number of bits used for the column in vm_profiler_frame_t::definition
+ */
+#define VM_PROFILER_COLUMN_BITS 10
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+/**
+ * Recorded frame
+ */
+typedef struct
+{
+  const ecma_compiled_code_t *bytecode_p; /**< byte code of the frame */
+  uint32_t info; /**< frame kind, VM_PROFILER_FRAME_HAS_POSITION flag and the position
+                  *   of the active call: source line if line info is available,
+                  *   byte code offset otherwise */
+#ifdef JERRY_ENABLE_LINE_INFO
+  uint32_t definition; /**< line and column of the function definition, 0 if unknown */
+#endif /* JERRY_ENABLE_LINE_INFO */
+} vm_profiler_frame_t;
+
+/**
+ * Recorded stack
+ */
+typedef struct
+{
+  uint32_t hash; /**< hash of the frames */
+  uint32_t count; /**< number of samples (0 marks the entry unused) */
+  uint16_t first_frame; /**< index of the innermost frame in vm_profiler_frames */
+  uint16_t depth; /**< number of frames */
+} vm_profiler_stack_t;
+
+JERRY_STATIC_ASSERT (VM_PROFILER_MAX_FRAMES <= UINT16_MAX + 1);
+
+/**
+ * Hash table of recorded stacks
+ */
+static vm_profiler_stack_t vm_profiler_stacks[VM_PROFILER_MAX_STACKS];
+
+/**
+ * Frames of the recorded stacks (the innermost frame first)
+ */
+static vm_profiler_frame_t vm_profiler_frames[VM_PROFILER_MAX_FRAMES];
+
+/**
+ * Number of used entries in vm_profiler_stacks
+ */
+static uint32_t vm_profiler_stacks_used;
+
+/**
+ * Number of used entries in vm_profiler_frames
+ */
+static uint32_t vm_profiler_frames_used;
+
+/**
+ * Number of samples which could not be recorded because the tables are full
+ */
+static uint32_t vm_profiler_dropped_samples;
+
+/**
+ * Whether samples are recorded
+ */
+static volatile bool vm_profiler_is_active = false;
+
+/**
+ * Collect the frames of the currently executed code
+ *
+ * @return number of collected frames
+ */
+static uint32_t
+vm_profiler_collect_frames (vm_profiler_frame_t *frames_p, /**< [out] frames, the innermost first */
+                            uint32_t *hash_p) /**< [out] hash of the frames */
+{
+  const vm_frame_ctx_t *frame_ctx_p = vm_get_top_context ();
+  uint32_t depth = 0;
+  uint32_t hash = 2166136261u;
+
+  while (frame_ctx_p != NULL)
+  {
+    vm_profiler_frame_t *frame_p = frames_p + depth;
+
+    if (depth == VM_PROFILER_MAX_DEPTH - 1
+        && frame_ctx_p->prev_context_p != NULL)
+    {
+      frame_p->bytecode_p = NULL;
+      frame_p->info = VM_PROFILER_FRAME_TRUNCATED;
+    }
+    else
+    {
+      uint32_t info;
+
+      if (frame_ctx_p->is_eval_code)
+      {
+        info = VM_PROFILER_FRAME_EVAL;
+      }
+      else if (vm_is_global_code (frame_ctx_p->bytecode_header_p))
+      {
+        info = VM_PROFILER_FRAME_GLOBAL;
+      }
+      else
+      {
+        info = VM_PROFILER_FRAME_FUNCTION;
+      }
+
+      /* The position is only updated by call instructions, so it is
+       * unknown for the innermost frame. */
+      if (depth > 0)
+      {
+        uint32_t position = (uint32_t) (frame_ctx_p->byte_code_p - frame_ctx_p->byte_code_start_p);
+
+#ifdef JERRY_ENABLE_LINE_INFO
+        uint32_t column;
+
+        if (cbc_get_source_position (frame_ctx_p->bytecode_header_p, position, &position, &column))
+        {
+          info |= VM_PROFILER_FRAME_HAS_POSITION | (position << VM_PROFILER_FRAME_POSITION_SHIFT);
+        }
+#else /* !JERRY_ENABLE_LINE_INFO */
+        info |= VM_PROFILER_FRAME_HAS_POSITION | (position << VM_PROFILER_FRAME_POSITION_SHIFT);
+#endif /* JERRY_ENABLE_LINE_INFO */
+      }
+
+      frame_p->bytecode_p = frame_ctx_p->bytecode_header_p;
+      frame_p->info = info;
+    }
+
+#ifdef JERRY_ENABLE_LINE_INFO
+    uint32_t line;
+    uint32_t column;
+
+    frame_p->definition = 0;
+
+    if ((frame_p->info & (VM_PROFILER_FRAME_HAS_POSITION - 1)) == VM_PROFILER_FRAME_FUNCTION
+        && cbc_get_definition_position (frame_p->bytecode_p, &line, &column))
+    {
+      if (column >= (1u << VM_PROFILER_COLUMN_BITS))
+      {
+        column = (1u << VM_PROFILER_COLUMN_BITS) - 1;
+      }
+
+      frame_p->definition = (line << VM_PROFILER_COLUMN_BITS) | column;
+    }
+
+    hash = (hash ^ frame_p->definition) * 16777619u;
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+    hash = (hash ^ (uint32_t) (uintptr_t) frame_p->bytecode_p) * 16777619u;
+    hash = (hash ^ frame_p->info) * 16777619u;
+
+    depth++;
+
+    if (depth == VM_PROFILER_MAX_DEPTH)
+    {
+      break;
+    }
+
+    frame_ctx_p = frame_ctx_p->prev_context_p;
+  }
+
+  *hash_p = hash;
+  return depth;
+} /* vm_profiler_collect_frames */
+
+/**
+ * Compare two frame lists
+ *
+ * @return true - if the frame lists are equal,
+ *         false - otherwise.
+ */
+static bool
+vm_profiler_compare_frames (const vm_profiler_frame_t *frames1_p, /**< first frame list */
+                            const vm_profiler_frame_t *frames2_p, /**< second frame list */
+                            uint32_t depth) /**< number of frames */
+{
+  for (uint32_t i = 0; i < depth; i++)
+  {
+    if (frames1_p[i].bytecode_p != frames2_p[i].bytecode_p
+        || frames1_p[i].info != frames2_p[i].info)
+    {
+      return false;
+    }
+
+#ifdef JERRY_ENABLE_LINE_INFO
+    if (frames1_p[i].definition != frames2_p[i].definition)
+    {
+      return false;
+    }
+#endif /* JERRY_ENABLE_LINE_INFO */
+  }
+
+  return true;
+} /* vm_profiler_compare_frames */
+
+#endif /* JERRY_ENABLE_PROFILER */
+
+/**
+ * Clear the recorded samples and start profiling
+ *
+ * @return true - if the profiler is supported by the build,
+ *         false - otherwise.
+ */
+bool
+vm_profiler_start (void)
+{
+#ifdef JERRY_ENABLE_PROFILER
+  vm_profiler_is_active = false;
+
+  memset (vm_profiler_stacks, 0, sizeof (vm_profiler_stacks));
+  vm_profiler_stacks_used = 0;
+  vm_profiler_frames_used = 0;
+  vm_profiler_dropped_samples = 0;
+
+  vm_profiler_is_active = true;
+  return true;
+#else /* !JERRY_ENABLE_PROFILER */
+  return false;
+#endif /* JERRY_ENABLE_PROFILER */
+} /* vm_profiler_start */
+
+/**
+ * Stop profiling (the recorded samples are kept)
+ */
+void
+vm_profiler_stop (void)
+{
+#ifdef JERRY_ENABLE_PROFILER
+  vm_profiler_is_active = false;
+#endif /* JERRY_ENABLE_PROFILER */
+} /* vm_profiler_stop */
+
+/**
+ * Record the stack of the currently executed code
+ *
+ * Note:
+ *      the function is async-signal-safe, it can be called from a signal handler
+ */
+void
+vm_profiler_sample (void)
+{
+#ifdef JERRY_ENABLE_PROFILER
+  if (!vm_profiler_is_active)
+  {
+    return;
+  }
+
+  vm_profiler_frame_t frames[VM_PROFILER_MAX_DEPTH];
+  uint32_t hash;
+  uint32_t depth = vm_profiler_collect_frames (frames, &hash);
+
+  if (depth == 0)
+  {
+    /* No code is executed. */
+    return;
+  }
+
+  uint32_t index = hash & (VM_PROFILER_MAX_STACKS - 1);
+
+  while (vm_profiler_stacks[index].count != 0)
+  {
+    vm_profiler_stack_t *stack_p = vm_profiler_stacks + index;
+
+    if (stack_p->hash == hash
+        && stack_p->depth == depth
+        && vm_profiler_compare_frames (vm_profiler_frames + stack_p->first_frame, frames, depth))
+    {
+      stack_p->count++;
+      return;
+    }
+
+    index = (index + 1) & (VM_PROFILER_MAX_STACKS - 1);
+  }
+
+  /* The hash table is kept at most 3/4 full to limit the length of the probe sequences. */
+  if (vm_profiler_stacks_used >= (VM_PROFILER_MAX_STACKS / 4) * 3
+      || vm_profiler_frames_used + depth > VM_PROFILER_MAX_FRAMES)
+  {
+    vm_profiler_dropped_samples++;
+    return;
+  }
+
+  memcpy (vm_profiler_frames + vm_profiler_frames_used, frames, depth * sizeof (vm_profiler_frame_t));
+
+  vm_profiler_stacks[index].hash = hash;
+  vm_profiler_stacks[index].first_frame = (uint16_t) vm_profiler_frames_used;
+  vm_profiler_stacks[index].depth = (uint16_t) depth;
+  vm_profiler_stacks[index].count = 1;
+
+  vm_profiler_frames_used += depth;
+  vm_profiler_stacks_used++;
+#endif /* JERRY_ENABLE_PROFILER */
+} /* vm_profiler_sample */
+
+#ifdef JERRY_ENABLE_PROFILER
+
+/**
+ * Output buffer of vm_profiler_dump
+ */
+typedef struct
+{
+  uint8_t *buffer_p; /**< start of the buffer */
+  size_t size; /**< size of the buffer */
+  size_t offset; /**< number of bytes written */
+  bool is_overflow; /**< true if the buffer is too small */
+} vm_profiler_output_t;
+
+/**
+ * Append a zero-terminated string to the output
+ */
+static void
+vm_profiler_output_string (vm_profiler_output_t *output_p, /**< output */
+                           const char *str_p) /**< string */
+{
+  size_t length = strlen (str_p);
+
+  if (output_p->offset + length > output_p->size)
+  {
+    output_p->is_overflow = true;
+    return;
+  }
+
+  memcpy (output_p->buffer_p + output_p->offset, str_p, length);
+  output_p->offset += length;
+} /* vm_profiler_output_string */
+
+/**
+ * Append an unsigned integer to the output
+ */
+static void
+vm_profiler_output_uint (vm_profiler_output_t *output_p, /**< output */
+                         uintptr_t value, /**< value */
+                         uint32_t radix) /**< 10 or 16 */
+{
+  char digits[2 * sizeof (uintptr_t) + 3];
+  char *str_p = digits + sizeof (digits) - 1;
+
+  *str_p = '\0';
+
+  do
+  {
+    *(--str_p) = "0123456789abcdef"[value % radix];
+    value /= radix;
+  }
+  while (value != 0);
+
+  if (radix == 16)
+  {
+    *(--str_p) = 'x';
+    *(--str_p) = '0';
+  }
+
+  vm_profiler_output_string (output_p, str_p);
+} /* vm_profiler_output_uint */
+
+/**
+ * Append the name of a frame to the output
+ */
+static void
+vm_profiler_output_frame (vm_profiler_output_t *output_p, /**< output */
+                          const vm_profiler_frame_t *frame_p) /**< frame */
+{
+  switch (frame_p->info & (VM_PROFILER_FRAME_HAS_POSITION - 1))
+  {
+    case VM_PROFILER_FRAME_GLOBAL:
+    {
+      vm_profiler_output_string (output_p, "<global>");
+      break;
+    }
+    case VM_PROFILER_FRAME_EVAL:
+    {
+      vm_profiler_output_string (output_p, "<eval>");
+      break;
+    }
+    case VM_PROFILER_FRAME_FUNCTION:
+    {
+      vm_profiler_output_string (output_p, "function@");
+
+#ifdef JERRY_ENABLE_LINE_INFO
+      if (frame_p->definition != 0)
+      {
+        vm_profiler_output_uint (output_p, frame_p->definition >> VM_PROFILER_COLUMN_BITS, 10);
+        vm_profiler_output_string (output_p, ":");
+        vm_profiler_output_uint (output_p, frame_p->definition & ((1u << VM_PROFILER_COLUMN_BITS) - 1), 10);
+        break;
+      }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+      vm_profiler_output_uint (output_p, (uintptr_t) frame_p->bytecode_p, 16);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT ((frame_p->info & (VM_PROFILER_FRAME_HAS_POSITION - 1)) == VM_PROFILER_FRAME_TRUNCATED);
+      vm_profiler_output_string (output_p, "<truncated>");
+      return;
+    }
+  }
+
+  if (frame_p->info & VM_PROFILER_FRAME_HAS_POSITION)
+  {
+#ifdef JERRY_ENABLE_LINE_INFO
+    vm_profiler_output_string (output_p, "[");
+    vm_profiler_output_uint (output_p, frame_p->info >> VM_PROFILER_FRAME_POSITION_SHIFT, 10);
+    vm_profiler_output_string (output_p, "]");
+#else /* !JERRY_ENABLE_LINE_INFO */
+    vm_profiler_output_string (output_p, "+");
+    vm_profiler_output_uint (output_p, frame_p->info >> VM_PROFILER_FRAME_POSITION_SHIFT, 10);
+#endif /* JERRY_ENABLE_LINE_INFO */
+  }
+} /* vm_profiler_output_frame */
+
+#endif /* JERRY_ENABLE_PROFILER */
+
+/**
+ * Write the recorded samples in folded stack format
+ *
+ * Each line of the output contains the frames of a stack, from the outermost
+ * to the innermost, separated by semicolons, followed by a space and the
+ * number of samples. Function frames are identified by the line and column of
+ * their definition when line info is available (function@L:C) and by the address
+ * of their byte code otherwise. The position of the active call is appended as
+ * [LINE], or as +N byte code offset when line info is not available.
+ *
+ * The output can be processed by flame graph tools (e.g. flamegraph.pl).
+ *
+ * @return number of bytes written to the buffer - if the output fits into the buffer,
+ *         0 - otherwise.
+ */
+size_t
+vm_profiler_dump (uint8_t *buffer_p, /**< output buffer */
+                  size_t buffer_size) /**< size of the buffer */
+{
+#ifdef JERRY_ENABLE_PROFILER
+  bool is_active = vm_profiler_is_active;
+  vm_profiler_is_active = false;
+
+  vm_profiler_output_t output;
+  output.buffer_p = buffer_p;
+  output.size = buffer_size;
+  output.offset = 0;
+  output.is_overflow = false;
+
+  for (uint32_t index = 0; index < VM_PROFILER_MAX_STACKS && !output.is_overflow; index++)
+  {
+    const vm_profiler_stack_t *stack_p = vm_profiler_stacks + index;
+
+    if (stack_p->count == 0)
+    {
+      continue;
+    }
+
+    const vm_profiler_frame_t *frames_p = vm_profiler_frames + stack_p->first_frame;
+
+    for (uint32_t i = stack_p->depth; i > 0; i--)
+    {
+      vm_profiler_output_frame (&output, frames_p + i - 1);
+      vm_profiler_output_string (&output, (i > 1) ? ";" : " ");
+    }
+
+    vm_profiler_output_uint (&output, stack_p->count, 10);
+    vm_profiler_output_string (&output, "\n");
+  }
+
+  if (vm_profiler_dropped_samples > 0)
+  {
+    vm_profiler_output_string (&output, "<dropped> ");
+    vm_profiler_output_uint (&output, vm_profiler_dropped_samples, 10);
+    vm_profiler_output_string (&output, "\n");
+  }
+
+  vm_profiler_is_active = is_active;
+
+  return output.is_overflow ? 0 : output.offset;
+#else /* !JERRY_ENABLE_PROFILER */
+  (void) buffer_p;
+  (void) buffer_size;
+  return 0;
+#endif /* JERRY_ENABLE_PROFILER */
+} /* vm_profiler_dump */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,39 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_PROFILER_H
+#define VM_PROFILER_H
+
+#include "jrt.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup profiler Sampling profiler
+ * @{
+ */
+
+extern bool vm_profiler_start (void);
+extern void vm_profiler_stop (void);
+extern void vm_profiler_sample (void);
+extern size_t vm_profiler_dump (uint8_t *, size_t);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !VM_PROFILER_H */
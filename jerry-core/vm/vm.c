@@ -21,6 +21,7 @@
 #include "ecma-builtins.h"
 #include "ecma-conversion.h"
 #include "ecma-exceptions.h"
+#include "ecma-for-in-cache.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
@@ -29,11 +30,16 @@
 #include "ecma-objects-general.h"
 #include "ecma-regexp-object.h"
 #include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jcontext.h"
 #include "opcodes.h"
 #include "rcs-records.h"
 #include "vm.h"
 #include "vm-stack.h"
 
+#define JERRY_INTERNAL
+#include "jerry-internal.h"
+
 #include <alloca.h>
 
 /** \addtogroup vm Virtual machine
@@ -44,19 +50,74 @@
  */
 
 /**
- * Top (current) interpreter context
+ * Check whether object[property] is an element of a typed array, which is indexed by a number
+ *
+ * Note:
+ *      such elements are accessed directly, without converting the index to a string
+ *
+ * @return true - if the object is a typed array, and the property is an array index number,
+ *         false - otherwise.
  */
-static vm_frame_ctx_t *vm_top_context_p = NULL;
+static inline bool __attr_always_inline___
+vm_is_typedarray_element (ecma_value_t object, /**< base object */
+                          ecma_value_t property, /**< property name */
+                          uint32_t *out_index_p) /**< out: index of the element */
+{
+  if (!ecma_is_value_object (object)
+      || !ecma_is_value_number (property)
+      || ecma_get_object_type (ecma_get_object_from_value (object)) != ECMA_OBJECT_TYPE_TYPEDARRAY)
+  {
+    return false;
+  }
+
+  ecma_number_t num = *ecma_get_number_from_value (property);
+  uint32_t index = ecma_number_to_uint32 (num);
+
+  *out_index_p = index;
+
+  /* UINT32_MAX is not an array index (ECMA-262 v5, 15.4) */
+  return ((ecma_number_t) index == num && index != UINT32_MAX);
+} /* vm_is_typedarray_element */
 
 /**
- * Direct call from eval;
+ * Check whether the interrupt callback must be called at the current safepoint
+ *
+ * Note:
+ *      the safepoints are the function calls and the backward branches
  */
-static bool is_direct_eval_form_call = false;
+#define VM_IS_INTERRUPT_PENDING() \
+  (unlikely (JERRY_CONTEXT (vm_interrupt_requested) \
+             || (JERRY_CONTEXT (vm_interrupt_countdown) > 0 && --JERRY_CONTEXT (vm_interrupt_countdown) == 0)))
 
 /**
- * Program bytecode pointer
+ * Call the interrupt callback at a safepoint
+ *
+ * Note:
+ *      after the callback aborts the execution, every following safepoint raises the abort again
+ *      (even if a native function ignored it), until a new execution is started by the embedder
+ *
+ * @return empty value - if the execution continues,
+ *         error value - if the execution is aborted.
  */
-static ecma_compiled_code_t *__program = NULL;
+static ecma_value_t __attr_noinline___
+vm_interrupt (void)
+{
+  if (!JERRY_CONTEXT (vm_is_aborting))
+  {
+    JERRY_CONTEXT (vm_interrupt_requested) = 0;
+    JERRY_CONTEXT (vm_interrupt_countdown) = JERRY_CONTEXT (vm_interrupt_budget);
+
+    if (!jerry_dispatch_interrupt_callback ())
+    {
+      return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+    }
+
+    JERRY_CONTEXT (vm_is_aborting) = true;
+    JERRY_CONTEXT (vm_interrupt_requested) = 1;
+  }
+
+  return ecma_make_error_value (ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+} /* vm_interrupt */
 
 /**
  * Get the value of object[property].
@@ -73,6 +134,13 @@ vm_op_get_value (ecma_value_t object, /**< base object */
     return ecma_raise_type_error ("");
   }
 
+  uint32_t index;
+
+  if (vm_is_typedarray_element (object, property, &index))
+  {
+    return ecma_op_typedarray_get_index (ecma_get_object_from_value (object), index);
+  }
+
   ecma_value_t completion_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (property_val,
@@ -103,6 +171,13 @@ vm_op_set_value (ecma_value_t object, /**< base object */
                  ecma_value_t value, /**< ecma value */
                  bool is_strict) /**< strict mode */
 {
+  uint32_t index;
+
+  if (vm_is_typedarray_element (object, property, &index))
+  {
+    return ecma_op_typedarray_set_index (ecma_get_object_from_value (object), index, value);
+  }
+
   ecma_value_t completion_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (obj_val,
@@ -146,9 +221,9 @@ vm_init (ecma_compiled_code_t *program_p, /**< pointer to byte-code data */
 {
   JERRY_ASSERT (!dump_mem_stats);
 
-  JERRY_ASSERT (__program == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_program_p) == NULL);
 
-  __program = program_p;
+  JERRY_CONTEXT (vm_program_p) = program_p;
 } /* vm_init */
 
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg4,
@@ -181,12 +256,12 @@ vm_run_global (void)
 {
   jerry_completion_code_t ret_code;
 
-  JERRY_ASSERT (__program != NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_program_p) != NULL);
 
   ecma_object_t *glob_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_GLOBAL);
   ecma_object_t *lex_env_p = ecma_get_global_environment ();
 
-  ecma_value_t completion_value = vm_run (__program,
+  ecma_value_t completion_value = vm_run (JERRY_CONTEXT (vm_program_p),
                                           ecma_make_object_value (glob_obj_p),
                                           lex_env_p,
                                           false,
@@ -195,7 +270,8 @@ vm_run_global (void)
 
   if (ecma_is_value_error (completion_value))
   {
-    ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
+    ret_code = (JERRY_CONTEXT (vm_is_aborting) ? JERRY_COMPLETION_CODE_ABORTED
+                                               : JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION);
   }
   else
   {
@@ -227,9 +303,9 @@ vm_run_eval (ecma_compiled_code_t *bytecode_data_p, /**< byte-code data */
   /* ECMA-262 v5, 10.4.2 */
   if (is_direct)
   {
-    this_binding = ecma_copy_value (vm_top_context_p->this_binding, true);
-    lex_env_p = vm_top_context_p->lex_env_p;
-    ecma_ref_object (vm_top_context_p->lex_env_p);
+    this_binding = ecma_copy_value (JERRY_CONTEXT (vm_top_context_p)->this_binding, true);
+    lex_env_p = JERRY_CONTEXT (vm_top_context_p)->lex_env_p;
+    ecma_ref_object (JERRY_CONTEXT (vm_top_context_p)->lex_env_p);
   }
   else
   {
@@ -266,8 +342,21 @@ vm_run_eval (ecma_compiled_code_t *bytecode_data_p, /**< byte-code data */
  */
 static ecma_value_t
 vm_construct_literal_object (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
-                             lit_cpointer_t lit_cp) /**< literal */
+                             uint32_t literal_index) /**< index of the compiled code literal */
 {
+  lit_cpointer_t lit_cp = frame_ctx_p->literal_start_p[literal_index];
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  if (lit_cp.u.packed_value == MEM_CP_NULL)
+  {
+    /* The compiled code of a snapshot executed in place is loaded when it is first instantiated. */
+    JERRY_ASSERT (CBC_IS_IN_SNAPSHOT (frame_ctx_p->bytecode_header_p));
+
+    lit_cp = cbc_get_snapshot_literal (frame_ctx_p->bytecode_header_p, literal_index);
+    frame_ctx_p->literal_start_p[literal_index] = lit_cp;
+  }
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
   ecma_compiled_code_t *bytecode_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t,
                                                                 lit_cp.u.value.base_cp);
   bool is_function = ((bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION) != 0);
@@ -327,6 +416,163 @@ vm_get_implicit_this_value (ecma_value_t *this_value_p) /**< in-out: this value
   return false;
 } /* vm_get_implicit_this_value */
 
+/**
+ * Compare two numbers or two strings without calling the generic
+ * comparison routines, which convert the operands to primitive
+ * values and create temporary boolean completion values.
+ *
+ * See also: ECMA-262 v5, 11.8.5, 11.9.3, 11.9.6
+ *
+ * @return true - if both operands have the same simple type and the
+ *                result of the comparison is stored into result_p,
+ *         false - otherwise (the generic path must be used)
+ */
+static bool __attr_always_inline___
+vm_compare_fast (uint32_t compare_op, /**< VM_OC_EQUAL ... VM_OC_GREATER_EQUAL */
+                 ecma_value_t left_value, /**< left value */
+                 ecma_value_t right_value, /**< right value */
+                 bool *result_p) /**< [out] result of the comparison */
+{
+  if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+  {
+    ecma_number_t left_num = *ecma_get_number_from_value (left_value);
+    ecma_number_t right_num = *ecma_get_number_from_value (right_value);
+
+    /* The C comparison operators handle NaN and signed zero values
+     * in the same way as the corresponding ECMAScript operators. */
+    switch (compare_op)
+    {
+      case VM_OC_EQUAL:
+      case VM_OC_STRICT_EQUAL:
+      {
+        *result_p = (left_num == right_num);
+        return true;
+      }
+      case VM_OC_NOT_EQUAL:
+      case VM_OC_STRICT_NOT_EQUAL:
+      {
+        *result_p = (left_num != right_num);
+        return true;
+      }
+      case VM_OC_LESS:
+      {
+        *result_p = (left_num < right_num);
+        return true;
+      }
+      case VM_OC_GREATER:
+      {
+        *result_p = (left_num > right_num);
+        return true;
+      }
+      case VM_OC_LESS_EQUAL:
+      {
+        *result_p = (left_num <= right_num);
+        return true;
+      }
+      default:
+      {
+        JERRY_ASSERT (compare_op == VM_OC_GREATER_EQUAL);
+        *result_p = (left_num >= right_num);
+        return true;
+      }
+    }
+  }
+
+  if (ecma_is_value_string (left_value) && ecma_is_value_string (right_value))
+  {
+    ecma_string_t *left_str_p = ecma_get_string_from_value (left_value);
+    ecma_string_t *right_str_p = ecma_get_string_from_value (right_value);
+
+    switch (compare_op)
+    {
+      case VM_OC_EQUAL:
+      case VM_OC_STRICT_EQUAL:
+      {
+        *result_p = ecma_compare_ecma_strings (left_str_p, right_str_p);
+        return true;
+      }
+      case VM_OC_NOT_EQUAL:
+      case VM_OC_STRICT_NOT_EQUAL:
+      {
+        *result_p = !ecma_compare_ecma_strings (left_str_p, right_str_p);
+        return true;
+      }
+      case VM_OC_LESS:
+      {
+        *result_p = ecma_compare_ecma_strings_relational (left_str_p, right_str_p);
+        return true;
+      }
+      case VM_OC_GREATER:
+      {
+        *result_p = ecma_compare_ecma_strings_relational (right_str_p, left_str_p);
+        return true;
+      }
+      case VM_OC_LESS_EQUAL:
+      {
+        *result_p = !ecma_compare_ecma_strings_relational (right_str_p, left_str_p);
+        return true;
+      }
+      default:
+      {
+        JERRY_ASSERT (compare_op == VM_OC_GREATER_EQUAL);
+        *result_p = !ecma_compare_ecma_strings_relational (left_str_p, right_str_p);
+        return true;
+      }
+    }
+  }
+
+  return false;
+} /* vm_compare_fast */
+
+/**
+ * Compare two values using the generic comparison routines.
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t __attr_noinline___
+vm_compare_generic (uint32_t compare_op, /**< VM_OC_EQUAL ... VM_OC_GREATER_EQUAL */
+                    ecma_value_t left_value, /**< left value */
+                    ecma_value_t right_value) /**< right value */
+{
+  switch (compare_op)
+  {
+    case VM_OC_EQUAL:
+    {
+      return opfunc_equal_value (left_value, right_value);
+    }
+    case VM_OC_NOT_EQUAL:
+    {
+      return opfunc_not_equal_value (left_value, right_value);
+    }
+    case VM_OC_STRICT_EQUAL:
+    {
+      return opfunc_equal_value_type (left_value, right_value);
+    }
+    case VM_OC_STRICT_NOT_EQUAL:
+    {
+      return opfunc_not_equal_value_type (left_value, right_value);
+    }
+    case VM_OC_LESS:
+    {
+      return opfunc_less_than (left_value, right_value);
+    }
+    case VM_OC_GREATER:
+    {
+      return opfunc_greater_than (left_value, right_value);
+    }
+    case VM_OC_LESS_EQUAL:
+    {
+      return opfunc_less_or_equal_than (left_value, right_value);
+    }
+    default:
+    {
+      JERRY_ASSERT (compare_op == VM_OC_GREATER_EQUAL);
+      return opfunc_greater_or_equal_than (left_value, right_value);
+    }
+  }
+} /* vm_compare_generic */
+
 /**
  * Indicate which value should be freed.
  */
@@ -407,7 +653,7 @@ enum
     else \
     { \
       /* Object construction. */ \
-      (target_value) = vm_construct_literal_object (frame_ctx_p, literal_start_p[literal_index]); \
+      (target_value) = vm_construct_literal_object (frame_ctx_p, literal_index); \
       target_free_op; \
     } \
   } \
@@ -419,12 +665,12 @@ enum
 void
 vm_finalize (void)
 {
-  if (__program)
+  if (JERRY_CONTEXT (vm_program_p))
   {
-    ecma_bytecode_deref (__program);
+    ecma_bytecode_deref (JERRY_CONTEXT (vm_program_p));
   }
 
-  __program = NULL;
+  JERRY_CONTEXT (vm_program_p) = NULL;
 } /* vm_finalize */
 
 /**
@@ -526,8 +772,7 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           else
           {
-            lit_value = vm_construct_literal_object (frame_ctx_p,
-                                                     literal_start_p[value_index]);
+            lit_value = vm_construct_literal_object (frame_ctx_p, value_index);
           }
 
           // FIXME: check the return value
@@ -547,15 +792,6 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         break;
       }
 
-#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
-      case CBC_SET_BYTECODE_PTR:
-      {
-        memcpy (&byte_code_p, byte_code_p + 1, sizeof (uint8_t *));
-        frame_ctx_p->byte_code_start_p = byte_code_p;
-        break;
-      }
-#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
-
       default:
       {
         frame_ctx_p->byte_code_p = byte_code_p;
@@ -647,6 +883,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         opcode_data = vm_decode_table[opcode];
       }
 
+      free_flags = 0;
+
       if (opcode_flags & CBC_HAS_BRANCH_ARG)
       {
         branch_offset = 0;
@@ -674,10 +912,19 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         if (CBC_BRANCH_IS_BACKWARD (opcode_flags))
         {
           branch_offset = -branch_offset;
+
+          if (VM_IS_INTERRUPT_PENDING ())
+          {
+            last_completion_value = vm_interrupt ();
+
+            if (ecma_is_value_error (last_completion_value))
+            {
+              goto error;
+            }
+          }
         }
       }
 
-      free_flags = 0;
       if (opcode_data & (VM_OC_GET_DATA_MASK << VM_OC_GET_DATA_SHIFT))
       {
         uint32_t operands = VM_OC_GET_DATA_GET_ID (opcode_data);
@@ -1212,7 +1459,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_EVAL:
         {
-          is_direct_eval_form_call = true;
+          JERRY_CONTEXT (is_direct_eval_form_call) = true;
           JERRY_ASSERT (*byte_code_p >= CBC_CALL && *byte_code_p <= CBC_CALL2_PROP_BLOCK);
           continue;
         }
@@ -1240,12 +1487,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             }
           }
 
+          /* Position of the call for the profiler. */
+          frame_ctx_p->byte_code_p = byte_code_start_p;
+
           last_completion_value = opfunc_call_n (this_value,
                                                  stack_top_p[-1],
                                                  stack_top_p,
                                                  right_value);
 
-          is_direct_eval_form_call = false;
+          JERRY_CONTEXT (is_direct_eval_form_call) = false;
 
           /* Free registers. */
           for (uint32_t i = 0; i < right_value; i++)
@@ -1286,6 +1536,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         {
           stack_top_p -= right_value;
 
+          /* Position of the call for the profiler. */
+          frame_ctx_p->byte_code_p = byte_code_start_p;
+
           last_completion_value = opfunc_construct_n (stack_top_p[-1],
                                                       stack_top_p,
                                                       right_value);
@@ -1570,54 +1823,6 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_EQUAL:
-        {
-          last_completion_value = opfunc_equal_value (left_value, right_value);
-
-          if (ecma_is_value_error (last_completion_value))
-          {
-            goto error;
-          }
-
-          result = last_completion_value;
-          break;
-        }
-        case VM_OC_NOT_EQUAL:
-        {
-          last_completion_value = opfunc_not_equal_value (left_value, right_value);
-
-          if (ecma_is_value_error (last_completion_value))
-          {
-            goto error;
-          }
-
-          result = last_completion_value;
-          break;
-        }
-        case VM_OC_STRICT_EQUAL:
-        {
-          last_completion_value = opfunc_equal_value_type (left_value, right_value);
-
-          if (ecma_is_value_error (last_completion_value))
-          {
-            goto error;
-          }
-
-          result = last_completion_value;
-          break;
-        }
-        case VM_OC_STRICT_NOT_EQUAL:
-        {
-          last_completion_value = opfunc_not_equal_value_type (left_value, right_value);
-
-          if (ecma_is_value_error (last_completion_value))
-          {
-            goto error;
-          }
-
-          result = last_completion_value;
-          break;
-        }
         case VM_OC_BIT_OR:
         {
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_OR,
@@ -1702,52 +1907,78 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
+        case VM_OC_EQUAL:
+        case VM_OC_NOT_EQUAL:
+        case VM_OC_STRICT_EQUAL:
+        case VM_OC_STRICT_NOT_EQUAL:
         case VM_OC_LESS:
+        case VM_OC_GREATER:
+        case VM_OC_LESS_EQUAL:
+        case VM_OC_GREATER_EQUAL:
         {
-          last_completion_value = opfunc_less_than (left_value, right_value);
+          uint32_t compare_op = VM_OC_GROUP_GET_INDEX (opcode_data);
+          bool is_true;
 
-          if (ecma_is_value_error (last_completion_value))
+          if (!vm_compare_fast (compare_op, left_value, right_value, &is_true))
           {
-            goto error;
-          }
+            last_completion_value = vm_compare_generic (compare_op, left_value, right_value);
 
-          result = last_completion_value;
-          break;
-        }
-        case VM_OC_GREATER:
-        {
-          last_completion_value = opfunc_greater_than (left_value, right_value);
+            if (ecma_is_value_error (last_completion_value))
+            {
+              goto error;
+            }
 
-          if (ecma_is_value_error (last_completion_value))
-          {
-            goto error;
+            JERRY_ASSERT (ecma_is_value_boolean (last_completion_value));
+            is_true = ecma_is_value_true (last_completion_value);
           }
 
-          result = last_completion_value;
-          break;
-        }
-        case VM_OC_LESS_EQUAL:
-        {
-          last_completion_value = opfunc_less_or_equal_than (left_value, right_value);
+          /* Fused compare and branch: when the result is consumed by a
+           * conditional branch, the branch is performed here and the
+           * boolean value is never pushed onto the stack. */
+          uint8_t next_opcode = *byte_code_p;
+          uint32_t next_group = VM_OC_GROUP_GET_INDEX (vm_decode_table[next_opcode]);
 
-          if (ecma_is_value_error (last_completion_value))
+          if ((next_group == VM_OC_BRANCH_IF_TRUE || next_group == VM_OC_BRANCH_IF_FALSE)
+              && (opcode_data & (VM_OC_PUT_DATA_MASK << VM_OC_PUT_DATA_SHIFT)) == VM_OC_PUT_STACK)
           {
-            goto error;
-          }
+            uint8_t *branch_start_p = byte_code_p++;
+            uint32_t offset_length = CBC_BRANCH_OFFSET_LENGTH (next_opcode);
 
-          result = last_completion_value;
-          break;
-        }
-        case VM_OC_GREATER_EQUAL:
-        {
-          last_completion_value = opfunc_greater_or_equal_than (left_value, right_value);
+            JERRY_ASSERT (offset_length > 0);
 
-          if (ecma_is_value_error (last_completion_value))
-          {
-            goto error;
+            branch_offset = 0;
+            do
+            {
+              branch_offset <<= 8;
+              branch_offset |= *(byte_code_p++);
+            }
+            while (--offset_length > 0);
+
+            if (is_true == (next_group == VM_OC_BRANCH_IF_TRUE))
+            {
+              if (CBC_BRANCH_IS_BACKWARD (cbc_flags[next_opcode]))
+              {
+                branch_offset = -branch_offset;
+
+                if (VM_IS_INTERRUPT_PENDING ())
+                {
+                  last_completion_value = vm_interrupt ();
+
+                  if (ecma_is_value_error (last_completion_value))
+                  {
+                    goto error;
+                  }
+                }
+              }
+              byte_code_p = branch_start_p + branch_offset;
+            }
+
+            opcode_data &= (uint32_t) ~VM_OC_PUT_STACK;
+            break;
           }
 
-          result = last_completion_value;
+          result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE
+                                                   : ECMA_SIMPLE_VALUE_FALSE);
           break;
         }
         case VM_OC_IN:
@@ -1827,6 +2058,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-1] = (ecma_value_t) VM_CREATE_CONTEXT (VM_CONTEXT_FOR_IN, branch_offset);
           stack_top_p[-2] = header_p->first_chunk_cp;
           stack_top_p[-3] = expr_obj_value;
+          stack_top_p[-4] = ecma_for_in_cache_get_enumeration_epoch (ecma_get_object_from_value (expr_obj_value));
 
           ecma_dealloc_collection_header (header_p);
           break;
@@ -1865,8 +2097,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             lit_utf8_byte_t *data_ptr = chunk_p->data;
             ecma_string_t *prop_name_p = ecma_get_string_from_value (*(ecma_value_t *) data_ptr);
 
-            if (ecma_op_object_get_property (ecma_get_object_from_value (stack_top_p[-3]),
-                                             prop_name_p) == NULL)
+            /* The existence check can be skipped if no property has been deleted
+             * since the enumeration has started, because the names were collected
+             * from the object and its (immutable) prototype chain. Enumerations
+             * involving host objects are never skipped. */
+            if (stack_top_p[-4] != ecma_for_in_cache_get_delete_epoch ()
+                && !ecma_op_object_has_property (ecma_get_object_from_value (stack_top_p[-3]), prop_name_p))
             {
               stack_top_p[-2] = chunk_p->next_chunk_cp;
               ecma_deref_ecma_string (prop_name_p);
@@ -2178,6 +2414,14 @@ error:
         continue;
       }
     }
+    else if (unlikely (JERRY_CONTEXT (vm_is_aborting)))
+    {
+      /* The abort can not be caught, so the contexts are removed without running the catch and finally blocks. */
+      while (frame_ctx_p->context_depth > 0)
+      {
+        stack_top_p = vm_stack_context_abort (frame_ctx_p, stack_top_p);
+      }
+    }
     else
     {
       if (vm_stack_find_finally (frame_ctx_p,
@@ -2246,7 +2490,6 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
 {
   const ecma_compiled_code_t *bytecode_header_p = frame_ctx_p->bytecode_header_p;
   ecma_value_t completion_value;
-  vm_frame_ctx_t *prev_context_p;
   uint16_t argument_end;
   uint16_t register_end;
 
@@ -2315,14 +2558,27 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
     }
   }
 
-  is_direct_eval_form_call = false;
+  JERRY_CONTEXT (is_direct_eval_form_call) = false;
+
+  vm_clear_abort ();
 
-  prev_context_p = vm_top_context_p;
-  vm_top_context_p = frame_ctx_p;
+  frame_ctx_p->prev_context_p = JERRY_CONTEXT (vm_top_context_p);
+  JERRY_CONTEXT (vm_top_context_p) = frame_ctx_p;
 
-  vm_init_loop (frame_ctx_p);
+  completion_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
-  completion_value = vm_loop (frame_ctx_p);
+  /* Safepoint of the function calls. */
+  if (VM_IS_INTERRUPT_PENDING ())
+  {
+    completion_value = vm_interrupt ();
+  }
+
+  if (!ecma_is_value_error (completion_value))
+  {
+    vm_init_loop (frame_ctx_p);
+
+    completion_value = vm_loop (frame_ctx_p);
+  }
 
   /* Free arguments and registers */
   for (uint32_t i = 0; i < register_end; i++)
@@ -2330,7 +2586,7 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
     ecma_free_value (frame_ctx_p->registers_p[i]);
   }
 
-  vm_top_context_p = prev_context_p;
+  JERRY_CONTEXT (vm_top_context_p) = frame_ctx_p->prev_context_p;
   return completion_value;
 } /* vm_execute */
 
@@ -2411,6 +2667,20 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
     call_stack_size = (uint32_t) (args_p->register_end + args_p->stack_limit);
   }
 
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+  if (CBC_IS_IN_SNAPSHOT (bytecode_header_p))
+  {
+    /* The literal table in the snapshot buffer contains literal map
+     * indices, which are resolved for the lifetime of the frame. */
+    uint32_t literal_end = (uint32_t) (literal_p - frame_ctx.literal_start_p);
+
+    frame_ctx.literal_start_p = (lit_cpointer_t *) alloca (literal_end * sizeof (lit_cpointer_t) + 1);
+    cbc_resolve_snapshot_literals (bytecode_header_p, frame_ctx.literal_start_p, literal_end);
+
+    literal_p = (lit_cpointer_t *) cbc_get_byte_code (bytecode_header_p);
+  }
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+
   frame_ctx.bytecode_header_p = bytecode_header_p;
   frame_ctx.byte_code_p = (uint8_t *) literal_p;
   frame_ctx.byte_code_start_p = (uint8_t *) literal_p;
@@ -2436,6 +2706,49 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
   }
 } /* vm_run */
 
+/**
+ * Clear the abort state of the interrupt callback, when a new execution is started by the embedder
+ *
+ * Note:
+ *      nothing happens while code is being executed, because the abort must reach the embedder
+ */
+void
+vm_clear_abort (void)
+{
+  if (JERRY_CONTEXT (vm_top_context_p) == NULL && JERRY_CONTEXT (vm_is_aborting))
+  {
+    JERRY_CONTEXT (vm_is_aborting) = false;
+    JERRY_CONTEXT (vm_interrupt_requested) = 0;
+  }
+} /* vm_clear_abort */
+
+/**
+ * Get the frame context of the currently executed code
+ *
+ * Note:
+ *      the frames of the calling functions can be reached through prev_context_p
+ *
+ * @return frame context - if code is being executed,
+ *         NULL - otherwise.
+ */
+vm_frame_ctx_t *
+vm_get_top_context (void)
+{
+  return JERRY_CONTEXT (vm_top_context_p);
+} /* vm_get_top_context */
+
+/**
+ * Check whether the specified byte code is the global code of the program
+ *
+ * @return true - if the byte code is the global code,
+ *         false - otherwise.
+ */
+bool
+vm_is_global_code (const ecma_compiled_code_t *bytecode_header_p) /**< byte-code data */
+{
+  return bytecode_header_p == JERRY_CONTEXT (vm_program_p);
+} /* vm_is_global_code */
+
 /**
  * Check whether currently executed code is strict mode code
  *
@@ -2445,9 +2758,9 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
 bool
 vm_is_strict_mode (void)
 {
-  JERRY_ASSERT (vm_top_context_p != NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_top_context_p) != NULL);
 
-  return vm_top_context_p->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE;
+  return JERRY_CONTEXT (vm_top_context_p)->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE;
 } /* vm_is_strict_mode */
 
 /**
@@ -2465,7 +2778,7 @@ vm_is_strict_mode (void)
 bool
 vm_is_direct_eval_form_call (void)
 {
-  return is_direct_eval_form_call;
+  return JERRY_CONTEXT (is_direct_eval_form_call);
 } /* vm_is_direct_eval_form_call */
 
 /**
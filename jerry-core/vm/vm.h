@@ -195,6 +195,9 @@ extern ecma_value_t vm_run (const ecma_compiled_code_t *, ecma_value_t,
                             ecma_object_t *, bool, const ecma_value_t *,
                             ecma_length_t);
 
+extern void vm_clear_abort (void);
+extern vm_frame_ctx_t *vm_get_top_context (void);
+extern bool vm_is_global_code (const ecma_compiled_code_t *);
 extern bool vm_is_strict_mode (void);
 extern bool vm_is_direct_eval_form_call (void);
 
@@ -80,6 +80,37 @@
   \
   pop {r4-r12, pc};
 
+/*
+ * mov syscall_no (%r0) -> %r7
+ * mov arg1 (%r1) -> %r0
+ * mov arg2 (%r2) -> %r1
+ * mov arg3 (%r3) -> %r2
+ * ldr arg4 ([sp + 0x28]) -> %r3
+ * svc #0
+ */
+#define SYSCALL_4 \
+  push {r4-r12, lr}; \
+  \
+  mov r7, r0; \
+  mov r0, r1; \
+  mov r1, r2; \
+  mov r2, r3; \
+  ldr r3, [sp, #40]; \
+  \
+  svc #0; \
+  \
+  pop {r4-r12, pc};
+
+/*
+ * Return from signal handler (the handler returns here)
+ *
+ * mov __NR_rt_sigreturn (173) -> %r7
+ * svc #0
+ */
+#define _SIGNAL_RESTORER \
+  mov r7, #173; \
+  svc #0;
+
 /*
  * ldr argc ([sp + 0x0]) -> r0
  * add argv (sp + 0x4) -> r1
@@ -92,6 +92,40 @@
   pop %edi;               \
   ret;
 
+/*
+ * mov syscall_no -> %eax
+ * mov arg1 -> %ebx
+ * mov arg2 -> %ecx
+ * mov arg3 -> %edx
+ * mov arg4 -> %esi
+ * int $0x80
+ * mov %eax -> ret
+ */
+#define SYSCALL_4 \
+  push %edi;               \
+  push %esi;               \
+  push %ebx;               \
+  mov 0x10 (%esp), %eax;   \
+  mov 0x14 (%esp), %ebx;   \
+  mov 0x18 (%esp), %ecx;   \
+  mov 0x1c (%esp), %edx;   \
+  mov 0x20 (%esp), %esi;   \
+  int $0x80;               \
+  pop %ebx;                \
+  pop %esi;                \
+  pop %edi;                \
+  ret;
+
+/*
+ * Return from signal handler (the handler returns here)
+ *
+ * mov __NR_rt_sigreturn (173) -> %eax
+ * int $0x80
+ */
+#define _SIGNAL_RESTORER \
+  mov $173, %eax;          \
+  int $0x80;
+
 /*
  * push argv (%esp + 4)
  * push argc ([%esp + 0x4])
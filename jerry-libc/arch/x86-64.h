@@ -64,6 +64,33 @@
   syscall; \
   ret;
 
+/*
+ * mov syscall_no (%rdi) -> %rax
+ * mov arg1 (%rsi) -> %rdi
+ * mov arg2 (%rdx) -> %rsi
+ * mov arg3 (%rcx) -> %rdx
+ * mov arg4 (%r8) -> %r10
+ * syscall
+ */
+#define SYSCALL_4 \
+  mov %rdi, %rax; \
+  mov %rsi, %rdi; \
+  mov %rdx, %rsi; \
+  mov %rcx, %rdx; \
+  mov %r8, %r10; \
+  syscall; \
+  ret;
+
+/*
+ * Return from signal handler (the handler returns here)
+ *
+ * mov __NR_rt_sigreturn (15) -> %rax
+ * syscall
+ */
+#define _SIGNAL_RESTORER \
+  mov $15, %rax; \
+  syscall;
+
 /*
  * mov argc ([%rsp]) -> %rdi
  * mov argv (%rsp + 0x8) -> %rsi
@@ -0,0 +1,53 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JERRY_LIBC_SIGNAL_H
+#define JERRY_LIBC_SIGNAL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* !__cplusplus */
+
+/**
+ * Signal handler type
+ */
+typedef void (*sighandler_t) (int);
+
+/**
+ * Integer type, which is accessed atomically even in presence of signal handlers
+ */
+typedef int sig_atomic_t;
+
+/**
+ * Special signal handlers
+ */
+#define SIG_DFL ((sighandler_t) 0)
+#define SIG_IGN ((sighandler_t) 1)
+#define SIG_ERR ((sighandler_t) -1)
+
+/**
+ * Signal numbers
+ */
+#define SIGABRT 6  /**< abort */
+#define SIGPROF 27 /**< profiling timer expired */
+
+sighandler_t signal (int signum, sighandler_t handler);
+
+#ifdef __cplusplus
+}
+#endif /* !__cplusplus */
+#endif /* !JERRY_LIBC_SIGNAL_H */
@@ -51,6 +51,7 @@ int vfprintf (FILE *stream, const char *format, va_list ap);
 int puts (const char *s);
 FILE *fopen (const char *path, const char *mode);
 int fclose (FILE *fp);
+int remove (const char *path);
 size_t fread (void *ptr, size_t size, size_t nmemb, FILE *stream);
 size_t fwrite (const void *ptr, size_t size, size_t nmemb, FILE *stream);
 int fseek (FILE *stream, long offset, int whence);
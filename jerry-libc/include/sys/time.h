@@ -0,0 +1,48 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JERRY_LIBC_SYS_TIME_H
+#define JERRY_LIBC_SYS_TIME_H
+
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* !__cplusplus */
+
+/**
+ * Interval timers
+ */
+#define ITIMER_REAL    0 /**< decrements in real time, delivers SIGALRM */
+#define ITIMER_VIRTUAL 1 /**< decrements when the process executes, delivers SIGVTALRM */
+#define ITIMER_PROF    2 /**< decrements when the process or the system on its behalf executes, delivers SIGPROF */
+
+/**
+ * Value of an interval timer
+ */
+struct itimerval
+{
+  struct _timeval it_interval; /**< reload value of the timer */
+  struct _timeval it_value;    /**< time until the next expiration */
+};
+
+int setitimer (int which, const struct itimerval *new_value, struct itimerval *old_value);
+
+#ifdef __cplusplus
+}
+#endif /* !__cplusplus */
+#endif /* !JERRY_LIBC_SYS_TIME_H */
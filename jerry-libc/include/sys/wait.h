@@ -0,0 +1,36 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JERRY_LIBC_SYS_WAIT_H
+#define JERRY_LIBC_SYS_WAIT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* !__cplusplus */
+
+/**
+ * Decoding of the status reported by waitpid
+ */
+#define WIFEXITED(status) (((status) & 0x7f) == 0) /**< the child terminated normally */
+#define WEXITSTATUS(status) (((status) >> 8) & 0xff) /**< exit code of a normally terminated child */
+
+int waitpid (int pid, int *status_p, int options);
+
+#ifdef __cplusplus
+}
+#endif /* !__cplusplus */
+#endif /* !JERRY_LIBC_SYS_WAIT_H */
@@ -28,7 +28,10 @@
 #include <sys/resource.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
 #include <time.h>
+#include <unistd.h>
 
 #include "jerry-libc-defs.h"
 
@@ -295,6 +298,21 @@ fclose (FILE *fp) /**< stream pointer */
   return 0;
 } /* fclose */
 
+/**
+ * Remove a file
+ *
+ * Note:
+ *      the failure is not fatal, as the file is removed by the callers on error paths
+ *
+ * @return 0 - upon successful completion,
+ *         non-zero value - otherwise.
+ */
+int
+remove (const char *path) /**< file path */
+{
+  return (syscall_1_asm (SYS_unlink, (long int) path) == 0) ? 0 : -1;
+} /* remove */
+
 /**
  * fseek
  */
@@ -396,3 +414,78 @@ gettimeofday (void *tp,  /**< struct timeval */
 {
   return (int) syscall_2 (__NR_gettimeofday, (long int) tp, (long int) tzp);
 } /* gettimeofday */
+
+/**
+ * Set value of an interval timer
+ *
+ * Note:
+ *      interval timers are not supported by the darwin port
+ *
+ * @return -1
+ */
+int
+setitimer (int which __attr_unused___, /**< timer */
+           const struct itimerval *new_value_p __attr_unused___, /**< new value of the timer */
+           struct itimerval *old_value_p __attr_unused___) /**< place to store the previous value to */
+{
+  return -1;
+} /* setitimer */
+
+/**
+ * Create a child process
+ *
+ * Note:
+ *      process creation is not supported by the darwin port
+ *
+ * @return -1
+ */
+int
+fork (void)
+{
+  return -1;
+} /* fork */
+
+/**
+ * Wait for state change of a child process
+ *
+ * Note:
+ *      process creation is not supported by the darwin port
+ *
+ * @return -1
+ */
+int
+waitpid (int pid __attr_unused___, /**< child to wait for */
+         int *status_p __attr_unused___, /**< place to store the status of the child to */
+         int options __attr_unused___) /**< WNOHANG / WUNTRACED flags */
+{
+  return -1;
+} /* waitpid */
+
+/**
+ * Get value of a system configuration variable
+ *
+ * Note:
+ *      system configuration variables are not supported by the darwin port
+ *
+ * @return -1
+ */
+long
+sysconf (int name __attr_unused___) /**< variable (_SC_*) */
+{
+  return -1;
+} /* sysconf */
+
+/**
+ * Set handler of a signal
+ *
+ * Note:
+ *      signal handlers are not supported by the darwin port
+ *
+ * @return SIG_ERR
+ */
+sighandler_t
+signal (int signum __attr_unused___, /**< signal number */
+        sighandler_t handler __attr_unused___) /**< new handler */
+{
+  return SIG_ERR;
+} /* signal */
@@ -28,7 +28,10 @@
 #include <sys/resource.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
 #include <time.h>
+#include <unistd.h>
 
 #include "jerry-libc-defs.h"
 
@@ -47,11 +50,14 @@ static long int syscall_0 (long int syscall_no);
 static long int syscall_1 (long int syscall_no, long int arg1);
 static long int syscall_2 (long int syscall_no, long int arg1, long int arg2);
 static long int syscall_3 (long int syscall_no, long int arg1, long int arg2, long int arg3);
+static long int syscall_4 (long int syscall_no, long int arg1, long int arg2, long int arg3, long int arg4);
 
 extern long int syscall_0_asm (long int syscall_no);
 extern long int syscall_1_asm (long int syscall_no, long int arg1);
 extern long int syscall_2_asm (long int syscall_no, long int arg1, long int arg2);
 extern long int syscall_3_asm (long int syscall_no, long int arg1, long int arg2, long int arg3);
+extern long int syscall_4_asm (long int syscall_no, long int arg1, long int arg2, long int arg3, long int arg4);
+extern void signal_restorer_asm (void);
 
 /**
  * System call with no argument.
@@ -119,6 +125,25 @@ syscall_3 (long int syscall_no, /**< syscall number */
   return ret;
 } /* syscall_3 */
 
+/**
+ * System call with four arguments.
+ *
+ * @return syscall's return value
+ */
+static __attr_noinline___ long int
+syscall_4 (long int syscall_no, /**< syscall number */
+           long int arg1, /**< first argument */
+           long int arg2, /**< second argument */
+           long int arg3, /**< third argument */
+           long int arg4) /**< fourth argument */
+{
+  long int ret = syscall_4_asm (syscall_no, arg1, arg2, arg3, arg4);
+
+  LIBC_EXIT_ON_ERROR (ret);
+
+  return ret;
+} /* syscall_4 */
+
 /** Output of character. Writes the character c, cast to an unsigned char, to stdout.  */
 int
 putchar (int c)
@@ -295,6 +320,21 @@ fclose (FILE *fp) /**< stream pointer */
   return 0;
 } /* fclose */
 
+/**
+ * Remove a file
+ *
+ * Note:
+ *      the failure is not fatal, as the file is removed by the callers on error paths
+ *
+ * @return 0 - upon successful completion,
+ *         non-zero value - otherwise.
+ */
+int
+remove (const char *path) /**< file path */
+{
+  return (syscall_1_asm (__NR_unlink, (long int) path) == 0) ? 0 : -1;
+} /* remove */
+
 /**
  * fseek
  */
@@ -397,6 +437,126 @@ gettimeofday (void *tp,  /**< struct timeval */
   return (int) syscall_2 (__NR_gettimeofday, (long int) tp, (long int) tzp);
 } /* gettimeofday */
 
+/**
+ * Set value of an interval timer
+ *
+ * @return 0 - upon success
+ */
+int
+setitimer (int which, /**< timer (ITIMER_REAL, ITIMER_VIRTUAL or ITIMER_PROF) */
+           const struct itimerval *new_value_p, /**< new value of the timer */
+           struct itimerval *old_value_p) /**< place to store the previous value to, or NULL */
+{
+  return (int) syscall_3 (__NR_setitimer, which, (long int) new_value_p, (long int) old_value_p);
+} /* setitimer */
+
+/**
+ * Create a child process
+ *
+ * @return process identifier of the child in the parent, 0 - in the child
+ */
+int
+fork (void)
+{
+  return (int) syscall_0 (__NR_fork);
+} /* fork */
+
+/**
+ * Wait for state change of a child process
+ *
+ * @return process identifier of the child whose state has changed
+ */
+int
+waitpid (int pid, /**< child to wait for, or -1 - to wait for any child */
+         int *status_p, /**< place to store the status of the child to, or NULL */
+         int options) /**< WNOHANG / WUNTRACED flags */
+{
+  return (int) syscall_4 (__NR_wait4, pid, (long int) status_p, options, 0);
+} /* waitpid */
+
+/**
+ * Get value of a system configuration variable
+ *
+ * Note:
+ *      only _SC_NPROCESSORS_ONLN is supported, which is computed from the affinity mask of the process
+ *
+ * @return value of the variable, or -1 - if the variable is not supported
+ */
+long
+sysconf (int name) /**< variable (_SC_*) */
+{
+  if (name != _SC_NPROCESSORS_ONLN)
+  {
+    return -1;
+  }
+
+  unsigned long int mask[1024 / (sizeof (unsigned long int) * 8)];
+
+  long int mask_size = syscall_3 (__NR_sched_getaffinity, 0, (long int) sizeof (mask), (long int) mask);
+  long count = 0;
+
+  for (size_t i = 0; i < (size_t) mask_size / sizeof (unsigned long int); i++)
+  {
+    for (unsigned long int bits = mask[i]; bits != 0; bits &= bits - 1)
+    {
+      count++;
+    }
+  }
+
+  return count;
+} /* sysconf */
+
+/**
+ * Flag of kernel's sigaction structure indicating that interrupted system calls should be restarted
+ */
+#define LIBC_SA_RESTART 0x10000000
+
+/**
+ * Flag of kernel's sigaction structure indicating that sa_restorer is valid
+ */
+#define LIBC_SA_RESTORER 0x04000000
+
+/**
+ * Signal action structure, as expected by rt_sigaction system call
+ */
+typedef struct
+{
+  sighandler_t handler; /**< signal handler */
+  unsigned long int flags; /**< SA_* flags */
+  void (*restorer) (void); /**< routine to return from the handler through */
+  unsigned long int mask[64 / (sizeof (unsigned long int) * 8)]; /**< signals blocked during the handler */
+} libc_kernel_sigaction_t;
+
+/**
+ * Set handler of a signal
+ *
+ * Note:
+ *      interrupted system calls are restarted
+ *
+ * @return previous signal handler
+ */
+sighandler_t
+signal (int signum, /**< signal number */
+        sighandler_t handler) /**< new handler, SIG_DFL or SIG_IGN */
+{
+  libc_kernel_sigaction_t new_action;
+  libc_kernel_sigaction_t old_action;
+
+  memset (&new_action, 0, sizeof (new_action));
+
+  new_action.handler = handler;
+  new_action.flags = LIBC_SA_RESTART | LIBC_SA_RESTORER;
+  new_action.restorer = signal_restorer_asm;
+
+  syscall_4 (__NR_rt_sigaction,
+             signum,
+             (long int) &new_action,
+             (long int) &old_action,
+             (long int) sizeof (new_action.mask));
+
+  return old_action.handler;
+} /* signal */
+
 // FIXME
 #if 0
 /**
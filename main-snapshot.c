@@ -0,0 +1,461 @@
+/* Copyright 2016 Samsung Electronics Co., Ltd.
+ * Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Offline snapshot compiler
+ *
+ * Compiles each input script to a separate snapshot file, and optionally packs the snapshots
+ * into a snapshot bundle. The engine keeps its state in static variables, so the inputs are
+ * compiled concurrently by worker processes, each of which owns a private engine instance.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "jerry.h"
+#include "jrt/jrt.h"
+
+/**
+ * Maximum size of a source script / snapshot
+ */
+#define JERRY_SNAPSHOT_BUFFER_SIZE (1048576)
+
+/**
+ * Maximum size of a snapshot bundle
+ */
+#define JERRY_SNAPSHOT_BUNDLE_BUFFER_SIZE (4 * 1048576)
+
+/**
+ * Maximum number of snapshots in a snapshot bundle
+ */
+#define JERRY_SNAPSHOT_BUNDLE_MAX_SNAPSHOTS (1024)
+
+/**
+ * Maximum length of an output file path
+ */
+#define JERRY_SNAPSHOT_MAX_PATH_LENGTH (1024)
+
+/**
+ * Suffix of the output files
+ */
+#define JERRY_SNAPSHOT_FILE_SUFFIX ".snapshot"
+
+/**
+ * Snapshot compiler exit codes
+ */
+#define JERRY_SNAPSHOT_EXIT_CODE_OK   (0)
+#define JERRY_SNAPSHOT_EXIT_CODE_FAIL (1)
+
+static uint8_t source_buffer[ JERRY_SNAPSHOT_BUFFER_SIZE ];
+static uint8_t snapshot_buffer[ JERRY_SNAPSHOT_BUFFER_SIZE ];
+
+/**
+ * Read a file to a buffer
+ *
+ * @return size of the file, or 0 - if the file could not be read
+ */
+static size_t
+read_file (const char *file_name_p, /**< file */
+           uint8_t *buffer_p, /**< buffer */
+           size_t buffer_size) /**< the buffer's size */
+{
+  FILE *file_p = fopen (file_name_p, "r");
+
+  if (file_p == NULL)
+  {
+    return 0;
+  }
+
+  size_t bytes_read = fread (buffer_p, 1u, buffer_size, file_p);
+  fclose (file_p);
+
+  return bytes_read;
+} /* read_file */
+
+/**
+ * Write a buffer to a file
+ *
+ * Note:
+ *      a partially written file is removed
+ *
+ * @return true - if the whole buffer has been written,
+ *         false - otherwise
+ */
+static bool
+write_file (const char *file_name_p, /**< file */
+            const uint8_t *buffer_p, /**< buffer */
+            size_t buffer_size) /**< the buffer's size */
+{
+  FILE *file_p = fopen (file_name_p, "w");
+
+  if (file_p == NULL)
+  {
+    return false;
+  }
+
+  bool is_written = (fwrite (buffer_p, 1u, buffer_size, file_p) == buffer_size);
+
+  if (fclose (file_p) != 0)
+  {
+    is_written = false;
+  }
+
+  if (!is_written)
+  {
+    remove (file_name_p);
+  }
+
+  return is_written;
+} /* write_file */
+
+/**
+ * Construct path of the snapshot file that corresponds to a source file
+ *
+ * The snapshot is placed next to the source, or to the output directory if one is specified.
+ *
+ * @return true - if the path fits into the buffer,
+ *         false - otherwise
+ */
+static bool
+get_snapshot_path (const char *file_name_p, /**< source file */
+                   const char *output_dir_p, /**< output directory, or NULL */
+                   char *path_p) /**< [out] buffer of JERRY_SNAPSHOT_MAX_PATH_LENGTH bytes */
+{
+  size_t length = 0;
+
+  if (output_dir_p != NULL)
+  {
+    const char *base_name_p = file_name_p;
+
+    for (const char *iter_p = file_name_p; *iter_p != '\0'; iter_p++)
+    {
+      if (*iter_p == '/')
+      {
+        base_name_p = iter_p + 1;
+      }
+    }
+
+    size_t dir_length = strlen (output_dir_p);
+
+    if (dir_length + 1 >= JERRY_SNAPSHOT_MAX_PATH_LENGTH)
+    {
+      return false;
+    }
+
+    memcpy (path_p, output_dir_p, dir_length);
+    length = dir_length;
+    path_p[length++] = '/';
+    file_name_p = base_name_p;
+  }
+
+  size_t name_length = strlen (file_name_p);
+
+  if (length + name_length + sizeof (JERRY_SNAPSHOT_FILE_SUFFIX) > JERRY_SNAPSHOT_MAX_PATH_LENGTH)
+  {
+    return false;
+  }
+
+  memcpy (path_p + length, file_name_p, name_length);
+  length += name_length;
+  memcpy (path_p + length, JERRY_SNAPSHOT_FILE_SUFFIX, sizeof (JERRY_SNAPSHOT_FILE_SUFFIX));
+
+  return true;
+} /* get_snapshot_path */
+
+/**
+ * Compile a source file to a snapshot file
+ *
+ * Note:
+ *      this is the body of a worker process
+ *
+ * @return JERRY_SNAPSHOT_EXIT_CODE_OK - upon success,
+ *         JERRY_SNAPSHOT_EXIT_CODE_FAIL - otherwise
+ */
+static int
+compile_snapshot (const char *file_name_p, /**< source file */
+                  const char *output_dir_p, /**< output directory, or NULL */
+                  bool is_for_global) /**< snapshot for global or eval context */
+{
+  char snapshot_path[JERRY_SNAPSHOT_MAX_PATH_LENGTH];
+
+  if (!get_snapshot_path (file_name_p, output_dir_p, snapshot_path))
+  {
+    JERRY_ERROR_MSG ("%s: output path is too long\n", file_name_p);
+    return JERRY_SNAPSHOT_EXIT_CODE_FAIL;
+  }
+
+  size_t source_size = read_file (file_name_p, source_buffer, sizeof (source_buffer));
+
+  if (source_size == 0 || source_size == sizeof (source_buffer))
+  {
+    JERRY_ERROR_MSG ("%s: failed to read source, or the source is empty or too large\n", file_name_p);
+    return JERRY_SNAPSHOT_EXIT_CODE_FAIL;
+  }
+
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  size_t snapshot_size = jerry_parse_and_save_snapshot (source_buffer,
+                                                        source_size,
+                                                        is_for_global,
+                                                        snapshot_buffer,
+                                                        sizeof (snapshot_buffer));
+
+  jerry_cleanup ();
+
+  if (snapshot_size == 0)
+  {
+    JERRY_ERROR_MSG ("%s: compilation failed\n", file_name_p);
+    return JERRY_SNAPSHOT_EXIT_CODE_FAIL;
+  }
+
+  if (!write_file (snapshot_path, snapshot_buffer, snapshot_size))
+  {
+    JERRY_ERROR_MSG ("%s: failed to write snapshot\n", snapshot_path);
+    return JERRY_SNAPSHOT_EXIT_CODE_FAIL;
+  }
+
+  return JERRY_SNAPSHOT_EXIT_CODE_OK;
+} /* compile_snapshot */
+
+/**
+ * Pack the compiled snapshots into a snapshot bundle
+ *
+ * @return JERRY_SNAPSHOT_EXIT_CODE_OK - upon success,
+ *         JERRY_SNAPSHOT_EXIT_CODE_FAIL - otherwise
+ */
+static int
+save_bundle (const char *bundle_file_name_p, /**< bundle file */
+             char **file_names_p, /**< source files */
+             int files_count, /**< number of source files */
+             const char *output_dir_p) /**< output directory of the snapshots, or NULL */
+{
+  static uint8_t snapshots_buffer[ JERRY_SNAPSHOT_BUNDLE_BUFFER_SIZE ];
+  static uint8_t bundle_buffer[ JERRY_SNAPSHOT_BUNDLE_BUFFER_SIZE ];
+  static const uint8_t *snapshots_p[ JERRY_SNAPSHOT_BUNDLE_MAX_SNAPSHOTS ];
+  static size_t snapshot_sizes[ JERRY_SNAPSHOT_BUNDLE_MAX_SNAPSHOTS ];
+
+  if (files_count > JERRY_SNAPSHOT_BUNDLE_MAX_SNAPSHOTS)
+  {
+    JERRY_ERROR_MSG ("%s: too many snapshots for a bundle\n", bundle_file_name_p);
+    return JERRY_SNAPSHOT_EXIT_CODE_FAIL;
+  }
+
+  uint8_t *snapshots_tail_p = snapshots_buffer;
+
+  for (int i = 0; i < files_count; i++)
+  {
+    char snapshot_path[JERRY_SNAPSHOT_MAX_PATH_LENGTH];
+    size_t free_size = (size_t) (snapshots_buffer + sizeof (snapshots_buffer) - snapshots_tail_p);
+
+    get_snapshot_path (file_names_p[i], output_dir_p, snapshot_path);
+
+    snapshots_p[i] = snapshots_tail_p;
+    snapshot_sizes[i] = read_file (snapshot_path, snapshots_tail_p, free_size);
+
+    if (snapshot_sizes[i] == 0 || snapshot_sizes[i] == free_size)
+    {
+      JERRY_ERROR_MSG ("%s: failed to read snapshot, or the snapshots are too large\n", snapshot_path);
+      return JERRY_SNAPSHOT_EXIT_CODE_FAIL;
+    }
+
+    snapshots_tail_p += snapshot_sizes[i];
+  }
+
+  size_t bundle_size = jerry_save_snapshot_bundle (snapshots_p,
+                                                   snapshot_sizes,
+                                                   (uint32_t) files_count,
+                                                   bundle_buffer,
+                                                   sizeof (bundle_buffer));
+
+  if (bundle_size == 0
+      || !write_file (bundle_file_name_p, bundle_buffer, bundle_size))
+  {
+    JERRY_ERROR_MSG ("%s: failed to write snapshot bundle\n", bundle_file_name_p);
+    return JERRY_SNAPSHOT_EXIT_CODE_FAIL;
+  }
+
+  return JERRY_SNAPSHOT_EXIT_CODE_OK;
+} /* save_bundle */
+
+/**
+ * Wait for a worker process to finish
+ *
+ * @return true - if the worker has compiled its input successfully,
+ *         false - otherwise
+ */
+static bool
+wait_for_worker (void)
+{
+  int status;
+
+  if (waitpid (-1, &status, 0) < 0)
+  {
+    return false;
+  }
+
+  return WIFEXITED (status) && WEXITSTATUS (status) == JERRY_SNAPSHOT_EXIT_CODE_OK;
+} /* wait_for_worker */
+
+/**
+ * Print usage of the snapshot compiler
+ */
+static void
+print_usage (const char *name_p) /**< name of the executable */
+{
+  printf ("Usage: %s [-j JOBS] [--for-eval] [-o OUTPUT_DIR] [-b BUNDLE] FILE...\n"
+          "Compile each FILE to FILE.snapshot (or OUTPUT_DIR/BASENAME.snapshot).\n"
+          "  -j JOBS       number of concurrent workers (default: number of processors)\n"
+          "  --for-eval    compile snapshots for eval context instead of global context\n"
+          "  -o DIR        directory to place the snapshots to\n"
+          "  -b BUNDLE     also pack the snapshots into a snapshot bundle, in the order of the files\n",
+          name_p);
+} /* print_usage */
+
+int
+main (int argc,
+      char **argv)
+{
+  long jobs = sysconf (_SC_NPROCESSORS_ONLN);
+  bool is_for_global = true;
+  const char *output_dir_p = NULL;
+  const char *bundle_file_name_p = NULL;
+  int first_file_index = argc;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp ("-h", argv[i]) || !strcmp ("--help", argv[i]))
+    {
+      print_usage (argv[0]);
+      return JERRY_SNAPSHOT_EXIT_CODE_OK;
+    }
+    else if (!strcmp ("-j", argv[i]) && i + 1 < argc)
+    {
+      jobs = 0;
+
+      for (const char *iter_p = argv[++i]; *iter_p != '\0'; iter_p++)
+      {
+        if (*iter_p < '0' || *iter_p > '9' || jobs > 1024)
+        {
+          jobs = 0;
+          break;
+        }
+
+        jobs = jobs * 10 + (*iter_p - '0');
+      }
+
+      if (jobs == 0)
+      {
+        JERRY_ERROR_MSG ("Invalid number of jobs: %s\n", argv[i]);
+        return JERRY_SNAPSHOT_EXIT_CODE_FAIL;
+      }
+    }
+    else if (!strcmp ("--for-eval", argv[i]))
+    {
+      is_for_global = false;
+    }
+    else if (!strcmp ("-o", argv[i]) && i + 1 < argc)
+    {
+      output_dir_p = argv[++i];
+    }
+    else if (!strcmp ("-b", argv[i]) && i + 1 < argc)
+    {
+      bundle_file_name_p = argv[++i];
+    }
+    else if (argv[i][0] == '-')
+    {
+      JERRY_ERROR_MSG ("Unknown option or missing argument: %s\n", argv[i]);
+      print_usage (argv[0]);
+      return JERRY_SNAPSHOT_EXIT_CODE_FAIL;
+    }
+    else
+    {
+      first_file_index = i;
+      break;
+    }
+  }
+
+  if (first_file_index == argc)
+  {
+    print_usage (argv[0]);
+    return JERRY_SNAPSHOT_EXIT_CODE_FAIL;
+  }
+
+  if (jobs < 1)
+  {
+    jobs = 1;
+  }
+
+  long running_workers = 0;
+  int failed_count = 0;
+
+  for (int i = first_file_index; i < argc; i++)
+  {
+    if (running_workers == jobs)
+    {
+      running_workers--;
+
+      if (!wait_for_worker ())
+      {
+        failed_count++;
+      }
+    }
+
+    int pid = fork ();
+
+    if (pid == 0)
+    {
+      exit (compile_snapshot (argv[i], output_dir_p, is_for_global));
+    }
+    else if (pid < 0)
+    {
+      /* fall back to compiling in this process */
+      if (compile_snapshot (argv[i], output_dir_p, is_for_global) != JERRY_SNAPSHOT_EXIT_CODE_OK)
+      {
+        failed_count++;
+      }
+    }
+    else
+    {
+      running_workers++;
+    }
+  }
+
+  while (running_workers > 0)
+  {
+    running_workers--;
+
+    if (!wait_for_worker ())
+    {
+      failed_count++;
+    }
+  }
+
+  if (failed_count != 0)
+  {
+    JERRY_ERROR_MSG ("%d of %d file(s) failed to compile\n", failed_count, argc - first_file_index);
+    return JERRY_SNAPSHOT_EXIT_CODE_FAIL;
+  }
+
+  if (bundle_file_name_p != NULL)
+  {
+    return save_bundle (bundle_file_name_p, argv + first_file_index, argc - first_file_index, output_dir_p);
+  }
+
+  return JERRY_SNAPSHOT_EXIT_CODE_OK;
+} /* main */
@@ -13,9 +13,11 @@
  * limitations under the License.
  */
 
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/time.h>
 
 #include "jerry.h"
 #include "jrt/jrt.h"
@@ -188,6 +190,104 @@ assert_handler (const jerry_api_object_t *function_obj_p __attr_unused___, /** <
   }
 } /* assert_handler */
 
+/**
+ * Default sampling interval of the profiler, in microseconds
+ */
+#define JERRY_PROFILE_INTERVAL_DEFAULT (1000)
+
+/**
+ * SIGPROF handler, which records a profiler sample
+ */
+static void
+profiler_signal_handler (int signum) /**< signal number */
+{
+  (void) signum;
+
+  jerry_profiler_sample ();
+} /* profiler_signal_handler */
+
+/**
+ * Set the interval of the profiling timer
+ *
+ * @return true - if the timer was set successfully,
+ *         false - otherwise.
+ */
+static bool
+set_profiler_timer (unsigned long interval_us) /**< sampling interval in microseconds, 0 - to disable the timer */
+{
+  struct itimerval timer;
+
+  timer.it_interval.tv_sec = interval_us / 1000000;
+  timer.it_interval.tv_usec = interval_us % 1000000;
+  timer.it_value = timer.it_interval;
+
+  return setitimer (ITIMER_PROF, &timer, NULL) == 0;
+} /* set_profiler_timer */
+
+/**
+ * Start the profiler and the SIGPROF timer which drives it
+ *
+ * @return true - if the profiler was started successfully,
+ *         false - otherwise.
+ */
+static bool
+start_profiler (unsigned long interval_us) /**< sampling interval in microseconds */
+{
+  if (!jerry_profiler_start ())
+  {
+    return false;
+  }
+
+  if (signal (SIGPROF, profiler_signal_handler) == SIG_ERR)
+  {
+    jerry_profiler_stop ();
+    return false;
+  }
+
+  if (!set_profiler_timer (interval_us))
+  {
+    signal (SIGPROF, SIG_IGN);
+    jerry_profiler_stop ();
+    return false;
+  }
+
+  return true;
+} /* start_profiler */
+
+/**
+ * Stop the profiler and write the recorded samples to a file in folded stack format
+ *
+ * @return true - if the samples were written successfully,
+ *         false - otherwise.
+ */
+static bool
+stop_profiler (const char *profile_file_name_p) /**< output file */
+{
+  static uint8_t profile_dump_buffer[ JERRY_BUFFER_SIZE ];
+
+  set_profiler_timer (0);
+  signal (SIGPROF, SIG_IGN);
+  jerry_profiler_stop ();
+
+  size_t profile_size = jerry_profiler_dump (profile_dump_buffer, JERRY_BUFFER_SIZE);
+
+  if (profile_size == 0)
+  {
+    return false;
+  }
+
+  FILE *profile_file_p = fopen (profile_file_name_p, "w");
+
+  if (profile_file_p == NULL)
+  {
+    return false;
+  }
+
+  fwrite (profile_dump_buffer, sizeof (uint8_t), profile_size, profile_file_p);
+  fclose (profile_file_p);
+  return true;
+} /* stop_profiler */
+
 int
 main (int argc,
       char **argv)
@@ -221,6 +321,9 @@ main (int argc,
 
   bool is_repl_mode = false;
 
+  const char *profile_file_name_p = NULL;
+  unsigned long profile_interval_us = JERRY_PROFILE_INTERVAL_DEFAULT;
+
 #ifdef JERRY_ENABLE_LOG
   const char *log_file_name = NULL;
 #endif /* JERRY_ENABLE_LOG */
@@ -253,6 +356,10 @@ main (int argc,
     {
       flags |= JERRY_FLAG_SHOW_OPCODES;
     }
+    else if (!strcmp ("--lazy-function-compilation", argv[i]))
+    {
+      flags |= JERRY_FLAG_LAZY_FUNCTION_COMPILATION;
+    }
     else if (!strcmp ("--dump-snapshot-for-global", argv[i])
              || !strcmp ("--dump-snapshot-for-eval", argv[i]))
     {
@@ -319,6 +426,43 @@ main (int argc,
     {
       flags |= JERRY_FLAG_ABORT_ON_FAIL;
     }
+    else if (!strcmp ("--profile", argv[i]))
+    {
+      if (++i < argc)
+      {
+        profile_file_name_p = argv[i];
+      }
+      else
+      {
+        JERRY_ERROR_MSG ("Error: no file specified for --profile\n");
+        return JERRY_STANDALONE_EXIT_CODE_FAIL;
+      }
+    }
+    else if (!strcmp ("--profile-interval", argv[i]))
+    {
+      profile_interval_us = 0;
+
+      if (++i < argc)
+      {
+        const char *digit_p = argv[i];
+
+        while (*digit_p >= '0' && *digit_p <= '9' && profile_interval_us < 1000000000)
+        {
+          profile_interval_us = profile_interval_us * 10 + (unsigned long) (*digit_p++ - '0');
+        }
+
+        if (*digit_p != '\0')
+        {
+          profile_interval_us = 0;
+        }
+      }
+
+      if (profile_interval_us == 0)
+      {
+        JERRY_ERROR_MSG ("Error: wrong format or invalid argument of --profile-interval\n");
+        return JERRY_STANDALONE_EXIT_CODE_FAIL;
+      }
+    }
     else
     {
       file_names[files_counter++] = argv[i];
@@ -382,6 +526,13 @@ main (int argc,
     JERRY_ERROR_MSG ("Failed to register 'assert' method.");
   }
 
+  if (profile_file_name_p != NULL
+      && !start_profiler (profile_interval_us))
+  {
+    JERRY_ERROR_MSG ("Failed to start the profiler\n");
+    profile_file_name_p = NULL;
+  }
+
   jerry_completion_code_t ret_code = JERRY_COMPLETION_CODE_OK;
 
   bool is_ok = true;
@@ -396,11 +547,27 @@ main (int argc,
     else
     {
       jerry_api_value_t ret_value;
-      ret_code = jerry_exec_snapshot ((void *) buffer,
-                                      snapshot_size,
-                                      true,
-                                      &ret_value);
-      JERRY_ASSERT (ret_value.type == JERRY_API_DATA_TYPE_UNDEFINED);
+      uint32_t bundle_count = jerry_get_snapshot_bundle_count ((void *) buffer, snapshot_size);
+
+      if (bundle_count == 0)
+      {
+        ret_code = jerry_exec_snapshot ((void *) buffer,
+                                        snapshot_size,
+                                        true,
+                                        &ret_value);
+        JERRY_ASSERT (ret_value.type == JERRY_API_DATA_TYPE_UNDEFINED);
+      }
+
+      /* The snapshots of a bundle are executed in order. */
+      for (uint32_t j = 0; j < bundle_count && ret_code == JERRY_COMPLETION_CODE_OK; j++)
+      {
+        ret_code = jerry_exec_snapshot_from_bundle ((void *) buffer,
+                                                    snapshot_size,
+                                                    j,
+                                                    true,
+                                                    &ret_value);
+        JERRY_ASSERT (ret_value.type == JERRY_API_DATA_TYPE_UNDEFINED);
+      }
     }
 
     if (ret_code != JERRY_COMPLETION_CODE_OK)
@@ -534,6 +701,12 @@ main (int argc,
     jerry_api_release_value (&print_function);
   }
 
+  if (profile_file_name_p != NULL
+      && !stop_profiler (profile_file_name_p))
+  {
+    JERRY_ERROR_MSG ("Failed to write the profile: %s\n", profile_file_name_p);
+  }
+
   jerry_cleanup ();
 
 #ifdef JERRY_ENABLE_LOG
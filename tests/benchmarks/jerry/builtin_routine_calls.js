@@ -0,0 +1,25 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var count = 1000000;
+var abs = Math.abs;
+var floor = Math.floor;
+var sum = 0;
+
+for (var i = 0; i < count; i++) {
+    sum += abs (-i) + floor (i / 3) + Math.min (i, 7);
+}
+
+assert (sum > 0);
@@ -0,0 +1,62 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var buffer = new ArrayBuffer (8);
+assert (buffer.byteLength === 8);
+assert (Object.prototype.toString.call (buffer) === "[object ArrayBuffer]");
+assert (buffer instanceof ArrayBuffer);
+assert (ArrayBuffer.length === 1);
+
+assert (new ArrayBuffer ().byteLength === 0);
+assert (new ArrayBuffer (3.7).byteLength === 3);
+assert (new ArrayBuffer ("5").byteLength === 5);
+
+try {
+  new ArrayBuffer (-1);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  ArrayBuffer (1);
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+var bytes = new Uint8Array (buffer);
+for (var i = 0; i < bytes.length; i++) {
+  assert (bytes[i] === 0);
+  bytes[i] = i;
+}
+
+var copy = buffer.slice (2, -2);
+assert (copy.byteLength === 4);
+var copy_bytes = new Uint8Array (copy);
+assert (copy_bytes[0] === 2 && copy_bytes[3] === 5);
+
+/* The slice does not share the data with the original buffer. */
+copy_bytes[0] = 100;
+assert (bytes[2] === 2);
+
+assert (buffer.slice (6, 2).byteLength === 0);
+assert (buffer.slice (-3).byteLength === 3);
+
+assert (ArrayBuffer.isView (bytes));
+assert (ArrayBuffer.isView (new DataView (buffer)));
+assert (!ArrayBuffer.isView (buffer));
+assert (!ArrayBuffer.isView ([]));
+assert (!ArrayBuffer.isView ());
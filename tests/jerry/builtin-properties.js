@@ -0,0 +1,79 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Values of the built-in properties
+assert (isNaN (NaN));
+assert (isNaN (Number.NaN));
+assert (Infinity === 1 / 0);
+assert (Number.POSITIVE_INFINITY === Infinity);
+assert (Number.NEGATIVE_INFINITY === -Infinity);
+assert (Math.PI > 3.14 && Math.PI < 3.15);
+assert (Number.MAX_VALUE > 1e308);
+assert (Number.MIN_VALUE > 0 && Number.MIN_VALUE < 1e-323);
+assert (undefined === void 0);
+assert (RegExp.prototype.source === "(?:)");
+assert (Error.prototype.name === "Error");
+assert (Error.prototype.message === "");
+assert (Object.prototype === Object.getPrototypeOf ({}));
+assert (String.prototype.constructor === String);
+assert (Math.max.length === 2);
+assert (Date.UTC.length === 7);
+assert (Array.prototype.push.length === 1);
+
+// Attributes of the built-in properties
+var desc = Object.getOwnPropertyDescriptor (Math, "E");
+assert (!desc.writable && !desc.enumerable && !desc.configurable);
+desc = Object.getOwnPropertyDescriptor (Math, "floor");
+assert (desc.writable && !desc.enumerable && desc.configurable);
+desc = Object.getOwnPropertyDescriptor (this, "NaN");
+assert (!desc.writable && !desc.enumerable && !desc.configurable);
+desc = Object.getOwnPropertyDescriptor (Error.prototype, "message");
+assert (desc.writable && !desc.enumerable && desc.configurable);
+
+// The same function object is returned by every lookup
+assert (Math.sin === Math.sin);
+
+// Modified built-in properties keep their new values
+var original_cos = Math.cos;
+Math.cos = 5;
+assert (Math.cos === 5);
+Math.cos = original_cos;
+assert (Math.cos (0) === 1);
+
+Math.PI = 3;
+assert (Math.PI !== 3);
+
+// Deleted built-in properties are not instantiated again
+assert (delete Math.tan);
+assert (Math.tan === undefined);
+assert (!Math.hasOwnProperty ("tan"));
+assert (Object.getOwnPropertyNames (Math).indexOf ("tan") === -1);
+
+// Listing the properties does not lose any of them
+var names = Object.getOwnPropertyNames (Math);
+assert (names.indexOf ("sqrt") !== -1);
+assert (names.indexOf ("LN2") !== -1);
+assert (names.indexOf ("cos") !== -1);
+assert (names.length === 25);
+
+names = Object.getOwnPropertyNames (JSON);
+assert (names.length === 2);
+assert (names.indexOf ("parse") !== -1);
+assert (names.indexOf ("stringify") !== -1);
+
+for (var name in Math)
+{
+  assert (false);
+}
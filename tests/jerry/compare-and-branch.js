@@ -0,0 +1,109 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Loop conditions with numbers. */
+var count = 0;
+for (var i = 0; i < 100; i++)
+{
+  count++;
+}
+assert (count === 100);
+
+count = 0;
+for (var i = 100; i >= 0; i--)
+{
+  count++;
+}
+assert (count === 101);
+
+count = 0;
+var j = 0;
+do
+{
+  count++;
+  j += 0.5;
+}
+while (j <= 10);
+assert (count === 21);
+
+count = 0;
+while (count != 10)
+{
+  count++;
+}
+assert (count === 10);
+
+/* NaN and signed zero. */
+var nan = NaN;
+assert (!(nan < 1) && !(nan > 1) && !(nan <= 1) && !(nan >= 1));
+assert (!(nan == nan) && !(nan === nan));
+assert (nan != nan && nan !== nan);
+assert (0 === -0 && 0 == -0 && 0 <= -0 && 0 >= -0 && !(0 < -0));
+
+if (nan < 1 || nan >= 1)
+{
+  assert (false);
+}
+
+/* Strings. */
+assert ("a" < "b" && "b" > "a" && "a" <= "a" && "b" >= "a");
+assert (!("b" < "a") && !("a" > "b") && !("b" <= "a") && !("a" >= "b"));
+assert ("abc" == "ab" + "c" && "abc" === "ab" + "c");
+assert ("abc" != "abd" && "abc" !== "abd");
+assert ("10" < "9");
+
+var str = "";
+while (str < "aaaa")
+{
+  str += "a";
+}
+assert (str === "aaaa");
+
+/* Mixed types take the generic path. */
+assert ("10" > 9 && 9 < "10");
+assert ("1" == 1 && !("1" === 1));
+assert (null == undefined && !(null === undefined));
+
+var valueof_calls = 0;
+var obj = { valueOf: function () { valueof_calls++; return 5; } };
+
+count = 0;
+for (var k = 0; k < obj; k++)
+{
+  count++;
+}
+assert (count === 5);
+assert (valueof_calls === 6);
+
+try
+{
+  var thrower = { valueOf: function () { throw "error"; } };
+  if (thrower < 5)
+  {
+    assert (false);
+  }
+  assert (false);
+}
+catch (e)
+{
+  assert (e === "error");
+}
+
+/* The result of a comparison is still available as a value. */
+var results = [1 < 2, 2 < 1, "a" === "a", 1 !== 1];
+assert (results[0] === true && results[1] === false);
+assert (results[2] === true && results[3] === false);
+assert ((1 < 2 ? "yes" : "no") === "yes");
+assert ((1 < 2) + (3 > 4) === 1);
@@ -0,0 +1,94 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var buffer = new ArrayBuffer (12);
+var view = new DataView (buffer, 2);
+
+assert (DataView.length === 3);
+assert (view.byteLength === 10 && view.byteOffset === 2 && view.buffer === buffer);
+assert (Object.prototype.toString.call (view) === "[object DataView]");
+
+/* Big-endian is the default byte order */
+view.setUint16 (0, 0x1234);
+var bytes = new Uint8Array (buffer);
+assert (bytes[2] === 0x12 && bytes[3] === 0x34);
+assert (view.getUint16 (0) === 0x1234);
+assert (view.getUint16 (0, true) === 0x3412);
+
+view.setInt32 (2, -2, true);
+assert (bytes[4] === 0xfe && bytes[7] === 0xff);
+assert (view.getInt32 (2, true) === -2);
+assert (view.getUint32 (2, true) === 4294967294);
+
+view.setInt8 (9, -3);
+assert (view.getInt8 (9) === -3 && view.getUint8 (9) === 253);
+
+view.setFloat32 (0, 1.5);
+assert (view.getFloat32 (0) === 1.5);
+view.setFloat64 (2, -0.1, true);
+assert (view.getFloat64 (2, true) === -0.1);
+assert (view.getFloat64 (2, false) !== -0.1);
+
+view.setInt16 (0, 40000);
+assert (view.getInt16 (0) === 40000 - 65536);
+
+try {
+  view.getFloat64 (3);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  view.setUint8 (-1, 0);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  DataView.prototype.getInt8.call (bytes, 0);
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+try {
+  new DataView ({});
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+try {
+  new DataView (buffer, 13);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  new DataView (buffer, 4, 9);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  DataView (buffer);
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
@@ -0,0 +1,133 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Repeated evaluation of the same source. */
+var sum = 0;
+for (var i = 0; i < 20; i++)
+{
+  sum += eval ("i * 2");
+}
+assert (sum === 380);
+
+/* The same source evaluated in strict and non-strict code. */
+function sloppy ()
+{
+  return eval ("var v = 1; typeof v");
+}
+
+function strict ()
+{
+  "use strict";
+  return eval ("var v = 1; typeof v");
+}
+
+for (var i = 0; i < 3; i++)
+{
+  assert (sloppy () === "number");
+  assert (strict () === "number");
+}
+
+var w = 5;
+function sloppy_var ()
+{
+  eval ("var w = 7");
+  return w;
+}
+
+function strict_var ()
+{
+  "use strict";
+  eval ("var w = 7");
+  return w;
+}
+
+for (var i = 0; i < 3; i++)
+{
+  assert (strict_var () === 5);
+  assert (sloppy_var () === 7);
+}
+
+/* Direct and indirect eval of the same source. */
+var scope = "global";
+function direct_and_indirect ()
+{
+  var scope = "local";
+  var indirect_eval = eval;
+  return eval ("scope") + "," + indirect_eval ("scope");
+}
+
+for (var i = 0; i < 3; i++)
+{
+  assert (direct_and_indirect () === "local,global");
+}
+
+/* Functions created from the same source are distinct objects with fresh closures. */
+var functions = [];
+for (var i = 0; i < 3; i++)
+{
+  functions.push (new Function ("a", "b", "return a + b"));
+}
+assert (functions[0] !== functions[1]);
+assert (functions[0] (1, 2) === 3);
+assert (functions[2] ("a", "b") === "ab");
+
+var counters = [];
+for (var i = 0; i < 3; i++)
+{
+  counters.push (eval ("(function () { var n = 0; return function () { return ++n; }; }) ()"));
+}
+assert (counters[0] !== counters[1]);
+assert (counters[0] () === 1);
+assert (counters[0] () === 2);
+assert (counters[1] () === 1);
+
+/* Syntax errors are reported every time. */
+for (var i = 0; i < 3; i++)
+{
+  try
+  {
+    eval ("var = 1");
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+/* More different sources than cache entries. */
+for (var round = 0; round < 3; round++)
+{
+  for (var i = 0; i < 16; i++)
+  {
+    assert (eval ("" + i + " + " + round) === i + round);
+  }
+}
+
+/* Many live functions created from the same source do not exhaust the reference counter of the cached code. */
+var many_functions = [];
+for (var i = 0; i < 1100; i++)
+{
+  many_functions.push (new Function ("a", "return a + 1"));
+}
+assert (many_functions[1099] (1) === 2);
+
+var many_evals = [];
+for (var i = 0; i < 1100; i++)
+{
+  many_evals.push (eval ("(function (a) { return function () { return a * 2; }; })") (i));
+}
+assert (many_evals[0] () === 0);
+assert (many_evals[1099] () === 2198);
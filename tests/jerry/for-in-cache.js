@@ -0,0 +1,147 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Loop conditions with numbers. */
+function keys (obj)
+{
+  var result = [];
+  for (var key in obj)
+  {
+    result.push (key);
+  }
+  return result.join (",");
+}
+
+/* Repeated enumeration of an unchanged object. */
+var obj = { a: 1, b: 2, c: 3 };
+for (var i = 0; i < 5; i++)
+{
+  assert (keys (obj) === "a,b,c");
+}
+
+/* Adding and deleting properties between enumerations. */
+obj.d = 4;
+assert (keys (obj) === "a,b,c,d");
+delete obj.b;
+assert (keys (obj) === "a,c,d");
+obj.b = 5;
+assert (keys (obj) === "a,c,d,b");
+
+/* Changing the enumerable attribute. */
+Object.defineProperty (obj, "a", { enumerable: false });
+assert (keys (obj) === "c,d,b");
+Object.defineProperty (obj, "a", { enumerable: true });
+assert (keys (obj) === "a,c,d,b");
+
+/* Converting a data property into an accessor. */
+Object.defineProperty (obj, "c", { get: function () { return 6; } });
+assert (keys (obj) === "a,d,b,c");
+
+/* Changes of the prototype chain. */
+function Base ()
+{
+}
+Base.prototype.x = 1;
+
+var derived = new Base ();
+derived.y = 2;
+assert (keys (derived) === "y,x");
+assert (keys (derived) === "y,x");
+
+Base.prototype.z = 3;
+assert (keys (derived) === "y,x,z");
+delete Base.prototype.x;
+assert (keys (derived) === "y,z");
+derived.z = 4;
+assert (keys (derived) === "y,z");
+Object.prototype.w = 5;
+assert (keys (derived) === "y,z,w");
+assert (keys ({}) === "w");
+delete Object.prototype.w;
+assert (keys (derived) === "y,z");
+assert (keys ({}) === "");
+
+/* Deleting properties during enumeration. */
+var obj2 = { a: 1, b: 2, c: 3, d: 4 };
+keys (obj2);
+
+var visited = [];
+for (var key in obj2)
+{
+  visited.push (key);
+  if (key === "a")
+  {
+    delete obj2.c;
+  }
+}
+assert (visited.join (",") === "a,b,d");
+
+/* Deleting properties of another object does not hide keys. */
+var other = { p: 1 };
+visited = [];
+for (var key in obj2)
+{
+  visited.push (key);
+  delete other.p;
+}
+assert (visited.join (",") === "a,b,d");
+
+/* Adding properties during enumeration does not affect the current one. */
+visited = [];
+for (var key in obj2)
+{
+  visited.push (key);
+  obj2["n" + key] = 0;
+}
+assert (visited.join (",") === "a,b,d");
+assert (keys (obj2) === "a,b,d,na,nb,nd");
+
+/* Nested enumeration of the same object. */
+var obj3 = { a: 1, b: 2 };
+var pairs = [];
+for (var k1 in obj3)
+{
+  for (var k2 in obj3)
+  {
+    pairs.push (k1 + k2);
+  }
+}
+assert (pairs.join (",") === "aa,ab,ba,bb");
+
+/* Arrays and strings. */
+var arr = [1, 2, 3];
+assert (keys (arr) === "0,1,2");
+arr.length = 1;
+assert (keys (arr) === "0");
+arr[5] = 1;
+assert (keys (arr) === "0,5");
+assert (keys ("ab") === "0,1");
+
+/* Enumeration of more objects than the cache can hold. */
+var objects = [];
+for (var i = 0; i < 10; i++)
+{
+  var o = {};
+  o["k" + i] = i;
+  objects.push (o);
+}
+
+for (var j = 0; j < 3; j++)
+{
+  for (var i = 0; i < 10; i++)
+  {
+    assert (keys (objects[i]) === "k" + i);
+  }
+}
@@ -0,0 +1,172 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var constructors = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+                    Int32Array, Uint32Array, Float32Array, Float64Array];
+var element_sizes = [1, 1, 1, 2, 2, 4, 4, 4, 8];
+
+for (var i = 0; i < constructors.length; i++) {
+  var ctor = constructors[i];
+  var array = new ctor (4);
+
+  assert (ctor.length === 3);
+  assert (ctor.BYTES_PER_ELEMENT === element_sizes[i]);
+  assert (ctor.prototype.BYTES_PER_ELEMENT === element_sizes[i]);
+  assert (array.length === 4);
+  assert (array.byteLength === 4 * element_sizes[i]);
+  assert (array.byteOffset === 0);
+  assert (array.buffer.byteLength === array.byteLength);
+  assert (array instanceof ctor);
+  assert (array[0] === 0 && array[4] === undefined);
+
+  array[1] = 7;
+  assert (array[1] === 7 && array["1"] === 7);
+
+  try {
+    ctor (1);
+    assert (false);
+  } catch (e) {
+    assert (e instanceof TypeError);
+  }
+}
+
+/* Conversion of the stored values */
+var int8 = new Int8Array ([127, 128, -129, 1.9, -1.9, NaN]);
+assert (int8[0] === 127 && int8[1] === -128 && int8[2] === 127);
+assert (int8[3] === 1 && int8[4] === -1 && int8[5] === 0);
+
+var uint8 = new Uint8Array ([256, -1, "12"]);
+assert (uint8[0] === 0 && uint8[1] === 255 && uint8[2] === 12);
+
+var clamped = new Uint8ClampedArray ([300, -5, 0.5, 1.5, 2.5, 254.6, NaN]);
+assert (clamped[0] === 255 && clamped[1] === 0);
+assert (clamped[2] === 0 && clamped[3] === 2 && clamped[4] === 2);
+assert (clamped[5] === 255 && clamped[6] === 0);
+
+var uint32 = new Uint32Array ([-1, 4294967296]);
+assert (uint32[0] === 4294967295 && uint32[1] === 0);
+
+var float32 = new Float32Array ([0.1, Infinity]);
+assert (float32[0] !== 0.1 && Math.abs (float32[0] - 0.1) < 1e-7);
+assert (float32[1] === Infinity);
+
+var float64 = new Float64Array ([0.1, -0]);
+assert (float64[0] === 0.1 && 1 / float64[1] === -Infinity);
+
+/* Views of a shared buffer */
+var buffer = new ArrayBuffer (8);
+var bytes = new Uint8Array (buffer);
+var words = new Int16Array (buffer, 2, 2);
+assert (words.length === 2 && words.byteOffset === 2 && words.buffer === buffer);
+words[0] = -2;
+assert (bytes[2] + bytes[3] === 254 + 255);
+
+try {
+  new Int16Array (buffer, 1);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  new Int32Array (buffer, 4, 2);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+try {
+  new Int16Array (new ArrayBuffer (3));
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+/* Construction from typed arrays and array-like objects */
+var from_typed = new Int16Array (new Int8Array ([-1, 2]));
+assert (from_typed.length === 2 && from_typed[0] === -1 && from_typed[1] === 2);
+assert (from_typed.buffer !== bytes.buffer);
+
+var from_object = new Float64Array ({ length: 2, 0: "1.5", 1: 2 });
+assert (from_object.length === 2 && from_object[0] === 1.5 && from_object[1] === 2);
+
+/* Out of range accesses */
+var small = new Uint8Array (2);
+small[5] = 1;
+assert (small[5] === undefined);
+assert (!small.hasOwnProperty (5));
+assert (small.hasOwnProperty (1));
+small.foo = "bar";
+assert (small.foo === "bar");
+
+/* Properties of the elements */
+var desc = Object.getOwnPropertyDescriptor (small, 1);
+assert (desc.value === 0 && desc.writable && desc.enumerable && !desc.configurable);
+assert (Object.keys (new Int8Array (3)).join () === "0,1,2");
+
+var keys = [];
+for (var key in new Uint16Array (2)) {
+  keys.push (key);
+}
+assert (keys.join () === "0,1");
+
+Object.defineProperty (small, 0, { value: 42 });
+assert (small[0] === 42);
+
+try {
+  Object.defineProperty (small, 0, { get: function () { return 1; } });
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+try {
+  Object.defineProperty (small, 2, { value: 1 });
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+assert (Object.prototype.toString.call (small) === "[object Uint8Array]");
+assert (Object.prototype.toString.call (clamped) === "[object Uint8ClampedArray]");
+assert (Object.prototype.toString.call (Uint8Array.prototype) === "[object Object]");
+assert (Object.getPrototypeOf (Int8Array.prototype) === Object.getPrototypeOf (Float64Array.prototype));
+
+/* set */
+var target = new Uint8Array (6);
+target.set ([1, 2, 3], 1);
+assert (target[0] === 0 && target[1] === 1 && target[3] === 3 && target[4] === 0);
+target.set (new Int8Array ([-1]), 5);
+assert (target[5] === 255);
+
+try {
+  target.set ([1, 2], 5);
+  assert (false);
+} catch (e) {
+  assert (e instanceof RangeError);
+}
+
+/* Overlapping regions are copied as if the source was cloned first */
+var overlap = new Uint8Array ([1, 2, 3, 4]);
+overlap.set (new Uint16Array (overlap.buffer, 0, 1), 1);
+assert (overlap[0] === 1 && overlap[1] === 0x0201 % 256);
+
+/* subarray */
+var sub = bytes.subarray (2, -2);
+assert (sub.length === 4 && sub.byteOffset === 2 && sub.buffer === buffer);
+sub[0] = 9;
+assert (bytes[2] === 9);
+assert (bytes.subarray (5, 1).length === 0);
+assert (words.subarray (1).byteOffset === 4);
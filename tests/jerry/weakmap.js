@@ -0,0 +1,116 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var map = new WeakMap ();
+assert (Object.prototype.toString.call (map) === "[object WeakMap]");
+assert (map instanceof WeakMap);
+assert (WeakMap.length === 0);
+assert (WeakMap.prototype.constructor === WeakMap);
+
+var key1 = {};
+var key2 = function () {};
+var key3 = [];
+
+assert (map.set (key1, "one") === map);
+map.set (key2, 2.5).set (key3, key1);
+
+assert (map.get (key1) === "one");
+assert (map.get (key2) === 2.5);
+assert (map.get (key3) === key1);
+assert (map.get ({}) === undefined);
+assert (map.get ("key1") === undefined);
+
+assert (map.has (key1));
+assert (!map.has ({}));
+assert (!map.has (1));
+
+map.set (key1, 1);
+assert (map.get (key1) === 1);
+
+assert (map.delete (key2));
+assert (!map.delete (key2));
+assert (!map.delete (null));
+assert (!map.has (key2));
+assert (map.get (key2) === undefined);
+
+map.set (key2, "again");
+assert (map.get (key2) === "again");
+
+/* Keys are looked up by identity */
+var keys = [];
+for (var i = 0; i < 100; i++)
+{
+  keys.push ({ index: i });
+  map.set (keys[i], i * 2);
+}
+
+for (var i = 0; i < 100; i += 2)
+{
+  assert (map.delete (keys[i]));
+}
+
+for (var i = 0; i < 100; i++)
+{
+  assert (map.has (keys[i]) === (i % 2 === 1));
+  assert (map.get (keys[i]) === (i % 2 === 1 ? i * 2 : undefined));
+}
+
+/* Entries of unreachable keys are removed by the garbage collector */
+for (var i = 0; i < 1000; i++)
+{
+  map.set ({}, { payload: "temporary " + i });
+}
+
+assert (map.get (key1) === 1);
+assert (map.get (key3) === key1);
+assert (map.get (keys[99]) === 198);
+
+/* A value referencing its own key does not keep the entry alive */
+for (var i = 0; i < 100; i++)
+{
+  var cyclic = {};
+  map.set (cyclic, { key: cyclic });
+}
+
+try {
+  WeakMap ();
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+try {
+  new WeakMap ([]);
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+try {
+  map.set ("key", 1);
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+try {
+  WeakMap.prototype.get.call ({}, key1);
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+assert (new WeakMap (undefined) instanceof WeakMap);
+assert (new WeakMap (null) instanceof WeakMap);
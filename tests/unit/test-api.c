@@ -137,6 +137,24 @@ handler (const jerry_api_object_t *function_obj_p,
   return true;
 } /* handler */
 
+static bool
+handler_profiler_sample (const jerry_api_object_t *function_obj_p, /**< function object */
+                         const jerry_api_value_t *this_p, /**< this value */
+                         jerry_api_value_t *ret_val_p, /**< return value */
+                         const jerry_api_value_t args_p[], /**< arguments */
+                         const jerry_api_length_t args_cnt) /**< number of arguments */
+{
+  (void) function_obj_p;
+  (void) this_p;
+  (void) args_p;
+  (void) args_cnt;
+
+  jerry_profiler_sample ();
+
+  ret_val_p->type = JERRY_API_DATA_TYPE_UNDEFINED;
+  return true;
+} /* handler_profiler_sample */
+
 static bool
 handler_throw_test (const jerry_api_object_t *function_obj_p,
                     const jerry_api_value_t *this_p,
@@ -318,6 +336,213 @@ static bool foreach_subset (const jerry_api_string_t *name, const jerry_api_valu
   return true;
 } /* foreach_subset */
 
+/**
+ * Number of external string buffers released by the engine
+ */
+static int test_api_external_strings_freed = 0;
+
+static void
+external_string_free_cb (const jerry_api_char_t *buffer_p, /**< released buffer */
+                         jerry_api_size_t buffer_size) /**< size of the buffer */
+{
+  JERRY_ASSERT (buffer_p != NULL && buffer_size > 0);
+
+  test_api_external_strings_freed++;
+} /* external_string_free_cb */
+
+/**
+ * Number of external ArrayBuffer data released by the engine
+ */
+static int test_api_external_arraybuffers_freed = 0;
+
+static void
+external_arraybuffer_free_cb (uint8_t *buffer_p, /**< released buffer */
+                              jerry_api_size_t buffer_size) /**< size of the buffer */
+{
+  JERRY_ASSERT (buffer_p != NULL && buffer_size == 4);
+
+  test_api_external_arraybuffers_freed++;
+} /* external_arraybuffer_free_cb */
+
+/**
+ * The only property of the host object in the test: "x", stored by the embedder
+ */
+static bool test_api_host_x_exists = true;
+static double test_api_host_x_value = 42.0;
+
+/**
+ * Number of calls of the get interceptor of the host object for "x"
+ */
+static int test_api_host_x_get_calls = 0;
+
+static bool
+host_object_is_x (const jerry_api_string_t *name_p) /**< property name */
+{
+  char str_buf_p[16];
+  ssize_t sz = jerry_api_string_to_char_buffer (name_p, (jerry_api_char_t *) str_buf_p, (ssize_t) sizeof (str_buf_p));
+
+  return (sz == 1 && str_buf_p[0] == 'x');
+} /* host_object_is_x */
+
+static bool
+host_object_get (const jerry_api_object_t *object_p, /**< host object */
+                 const jerry_api_string_t *name_p, /**< property name */
+                 jerry_api_value_t *value_p) /**< [out] property value */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+  if (!host_object_is_x (name_p))
+  {
+    return false;
+  }
+
+  test_api_host_x_get_calls++;
+
+  if (!test_api_host_x_exists)
+  {
+    return false;
+  }
+
+  test_api_init_api_value_float64 (value_p, test_api_host_x_value);
+  return true;
+} /* host_object_get */
+
+static bool
+host_object_set (const jerry_api_object_t *object_p, /**< host object */
+                 const jerry_api_string_t *name_p, /**< property name */
+                 const jerry_api_value_t *value_p) /**< new value */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+  if (!host_object_is_x (name_p) || value_p->type != JERRY_API_DATA_TYPE_FLOAT64)
+  {
+    return false;
+  }
+
+  test_api_host_x_exists = true;
+  test_api_host_x_value = value_p->u.v_float64;
+  return true;
+} /* host_object_set */
+
+static bool
+host_object_has (const jerry_api_object_t *object_p, /**< host object */
+                 const jerry_api_string_t *name_p) /**< property name */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+  return test_api_host_x_exists && host_object_is_x (name_p);
+} /* host_object_has */
+
+static bool
+host_object_delete (const jerry_api_object_t *object_p, /**< host object */
+                    const jerry_api_string_t *name_p) /**< property name */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+  if (host_object_is_x (name_p))
+  {
+    test_api_host_x_exists = false;
+  }
+
+  return true;
+} /* host_object_delete */
+
+static jerry_api_object_t *
+host_object_enumerate (const jerry_api_object_t *object_p) /**< host object */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+  if (!test_api_host_x_exists)
+  {
+    return NULL;
+  }
+
+  jerry_api_value_t name;
+  test_api_init_api_value_string (&name, "x");
+
+  jerry_api_object_t *names_p = jerry_api_create_array_from_values (&name, 1);
+  jerry_api_release_value (&name);
+
+  return names_p;
+} /* host_object_enumerate */
+
+static bool
+host_object_drop_x (const jerry_api_object_t *function_obj_p,
+                    const jerry_api_value_t *this_p,
+                    jerry_api_value_t *ret_val_p,
+                    const jerry_api_value_t args_p[],
+                    const jerry_api_length_t args_cnt)
+{
+  (void) function_obj_p;
+  (void) this_p;
+  (void) ret_val_p;
+  (void) args_p;
+  (void) args_cnt;
+
+  /* The property disappears on the native side, without a delete operation. */
+  test_api_host_x_exists = false;
+  return true;
+} /* host_object_drop_x */
+
+static const jerry_api_host_object_handlers_t host_object_handlers =
+{
+  host_object_get,
+  host_object_set,
+  host_object_has,
+  host_object_delete,
+  host_object_enumerate
+};
+
+/**
+ * Number of exceptions passed to the error handler of the job queue
+ */
+static int test_api_job_errors = 0;
+
+static void
+job_error_handler (const jerry_api_value_t *error_value_p) /**< exception thrown by a job */
+{
+  JERRY_ASSERT (error_value_p->type == JERRY_API_DATA_TYPE_FLOAT64 && error_value_p->u.v_float64 == -1.0);
+
+  test_api_job_errors++;
+} /* job_error_handler */
+
+/**
+ * Number of calls of the interrupt callback, and the call which aborts the execution (0 - never)
+ */
+static uint32_t test_api_interrupts = 0;
+static uint32_t test_api_interrupt_abort_at = 0;
+
+static jerry_api_interrupt_action_t
+interrupt_callback (void *user_p) /**< user pointer */
+{
+  JERRY_ASSERT (user_p == &test_api_interrupts);
+
+  test_api_interrupts++;
+
+  if (test_api_interrupts == test_api_interrupt_abort_at)
+  {
+    return JERRY_API_INTERRUPT_ABORT;
+  }
+
+  return JERRY_API_INTERRUPT_CONTINUE;
+} /* interrupt_callback */
+
+/**
+ * Weak handle, whose object was collected
+ */
+static jerry_api_handle_t test_api_collected_handle = 0;
+static int test_api_weak_callbacks = 0;
+
+static void
+weak_handle_callback (jerry_api_handle_t handle, /**< weak handle */
+                      void *user_p) /**< user pointer */
+{
+  JERRY_ASSERT (user_p == &test_api_weak_callbacks);
+
+  test_api_collected_handle = handle;
+  test_api_weak_callbacks++;
+} /* weak_handle_callback */
+
 int
 main (void)
 {
@@ -642,6 +867,433 @@ main (void)
 
   jerry_api_release_object (array_obj_p);
 
+  // Test: bulk array transfer
+  {
+    double doubles_in[] = { 1.5, -2.0, 3.25, 4.0 };
+    int32_t int32s_in[] = { 7, -8, 9 };
+    double doubles_out[4];
+    int32_t int32s_out[4];
+    jerry_api_value_t values_out[3];
+    jerry_completion_code_t bulk_status;
+
+    array_obj_p = jerry_api_create_array_from_doubles (doubles_in, 4);
+    JERRY_ASSERT (jerry_api_get_array_doubles (array_obj_p, 0, doubles_out, 4) == 4);
+    JERRY_ASSERT (memcmp (doubles_in, doubles_out, sizeof (doubles_in)) == 0);
+    JERRY_ASSERT (jerry_api_get_array_int32s (array_obj_p, 1, int32s_out, 10) == 3);
+    JERRY_ASSERT (int32s_out[0] == -2 && int32s_out[1] == 3 && int32s_out[2] == 4);
+    JERRY_ASSERT (jerry_api_get_array_doubles (array_obj_p, 4, doubles_out, 4) == 0);
+
+    jerry_api_value_t array_value;
+    array_value.type = JERRY_API_DATA_TYPE_OBJECT;
+    array_value.u.v_object = array_obj_p;
+    is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "bulk", &array_value);
+    JERRY_ASSERT (is_ok);
+    jerry_api_release_object (array_obj_p);
+
+    const char *bulk_src_p = ("bulk.length === 4 && bulk[2] === 3.25 && bulk.join () === '1.5,-2,3.25,4'"
+                              " && (bulk.push (5), bulk.length === 5)");
+    bulk_status = jerry_api_eval ((jerry_api_char_t *) bulk_src_p, strlen (bulk_src_p), false, false, &res);
+    JERRY_ASSERT (bulk_status == JERRY_COMPLETION_CODE_OK
+                  && res.type == JERRY_API_DATA_TYPE_BOOLEAN
+                  && res.u.v_bool);
+
+    array_obj_p = jerry_api_create_array_from_int32s (int32s_in, 3);
+    JERRY_ASSERT (jerry_api_get_array_values (array_obj_p, 0, values_out, 3) == 3);
+    JERRY_ASSERT (values_out[1].type == JERRY_API_DATA_TYPE_FLOAT64 && values_out[1].u.v_float64 == -8.0);
+
+    values_out[0].type = JERRY_API_DATA_TYPE_STRING;
+    values_out[0].u.v_string = jerry_api_create_string ((jerry_api_char_t *) "str");
+    values_out[2].type = JERRY_API_DATA_TYPE_OBJECT;
+    values_out[2].u.v_object = array_obj_p;
+    jerry_api_object_t *values_array_obj_p = jerry_api_create_array_from_values (values_out, 3);
+    jerry_api_release_value (&values_out[0]);
+    jerry_api_release_object (array_obj_p);
+
+    JERRY_ASSERT (jerry_api_get_array_doubles (values_array_obj_p, 0, doubles_out, 3) == 3);
+    JERRY_ASSERT (doubles_out[0] != doubles_out[0] && doubles_out[1] == -8.0);
+    JERRY_ASSERT (jerry_api_get_array_values (values_array_obj_p, 0, values_out, 3) == 3);
+    JERRY_ASSERT (values_out[0].type == JERRY_API_DATA_TYPE_STRING);
+    JERRY_ASSERT (values_out[2].type == JERRY_API_DATA_TYPE_OBJECT);
+    JERRY_ASSERT (jerry_api_get_array_int32s (values_out[2].u.v_object, 2, int32s_out, 1) == 1
+                  && int32s_out[0] == 9);
+    jerry_api_release_value (&values_out[0]);
+    jerry_api_release_value (&values_out[2]);
+    jerry_api_release_object (values_array_obj_p);
+
+    /* Holes and accessor elements are read with [[Get]]. */
+    const char *sparse_src_p = ("var a = [1, , 3];"
+                                " Object.defineProperty (a, '2', { get: function () { return 30; } }); a");
+    bulk_status = jerry_api_eval ((jerry_api_char_t *) sparse_src_p, strlen (sparse_src_p), false, false, &res);
+    JERRY_ASSERT (bulk_status == JERRY_COMPLETION_CODE_OK && res.type == JERRY_API_DATA_TYPE_OBJECT);
+    JERRY_ASSERT (jerry_api_get_array_doubles (res.u.v_object, 0, doubles_out, 4) == 3);
+    JERRY_ASSERT (doubles_out[0] == 1.0 && doubles_out[1] != doubles_out[1] && doubles_out[2] == 30.0);
+    jerry_api_release_value (&res);
+
+    const char *typedarray_src_p = "new Int16Array ([-3, 4, 5])";
+    bulk_status = jerry_api_eval ((jerry_api_char_t *) typedarray_src_p,
+                                  strlen (typedarray_src_p),
+                                  false,
+                                  false,
+                                  &res);
+    JERRY_ASSERT (bulk_status == JERRY_COMPLETION_CODE_OK && res.type == JERRY_API_DATA_TYPE_OBJECT);
+    JERRY_ASSERT (jerry_api_get_array_int32s (res.u.v_object, 1, int32s_out, 4) == 2);
+    JERRY_ASSERT (int32s_out[0] == 4 && int32s_out[1] == 5);
+    jerry_api_release_value (&res);
+
+    /* Other objects are not read. */
+    JERRY_ASSERT (jerry_api_get_array_doubles (global_obj_p, 0, doubles_out, 4) == 0);
+  }
+
+
+  // Test: host objects
+  {
+    jerry_api_object_t *host_obj_p = jerry_api_create_host_object (&host_object_handlers);
+    test_api_init_api_value_object (&val_t, host_obj_p);
+    is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "host", &val_t);
+    JERRY_ASSERT (is_ok);
+    jerry_api_release_value (&val_t);
+
+    const char *host_src_p = ("var r = [];"
+                              "r.push (host.x === 42);"
+                              "r.push ('x' in host && host.hasOwnProperty ('x') && !host.hasOwnProperty ('y'));"
+                              "r.push (Object.keys (host).join () === 'x');"
+                              "host.x = 7;"
+                              "r.push (host.x === 7);"
+                              "host.y = 'ordinary';"
+                              "r.push (host.y === 'ordinary' && Object.keys (host).join () === 'y,x');"
+                              "r.push (typeof host.toString === 'function' && host.z === undefined);"
+                              "Object.defineProperty (host, 'x', { value : 'shadow', writable : false });"
+                              "r.push (host.x === 'shadow');"
+                              "delete host.x;"
+                              "r.push (host.x === 7);"
+                              "delete host.x;"
+                              "r.push (!('x' in host) && host.x === undefined);"
+                              "r.indexOf (false) === -1");
+    jerry_completion_code_t host_status = jerry_api_eval ((jerry_api_char_t *) host_src_p,
+                                                          strlen (host_src_p),
+                                                          false,
+                                                          false,
+                                                          &res);
+    JERRY_ASSERT (host_status == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_BOOLEAN && res.u.v_bool);
+    JERRY_ASSERT (!test_api_host_x_exists && test_api_host_x_value == 7.0);
+    jerry_api_release_value (&res);
+
+    /* Properties removed by the embedder during a for-in enumeration are not visited. */
+    jerry_api_object_t *drop_x_p = jerry_api_create_external_function (host_object_drop_x);
+    test_api_init_api_value_object (&val_t, drop_x_p);
+    is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "drop_x", &val_t);
+    JERRY_ASSERT (is_ok);
+    jerry_api_release_value (&val_t);
+    jerry_api_release_object (drop_x_p);
+
+    const char *host_for_in_src_p = ("host.x = 1;"
+                                     "var keys = [];"
+                                     "for (var k in host) { keys.push (k); drop_x (); }"
+                                     "keys.join () === 'y' && !('x' in host)");
+    host_status = jerry_api_eval ((jerry_api_char_t *) host_for_in_src_p,
+                                  strlen (host_for_in_src_p),
+                                  false,
+                                  false,
+                                  &res);
+    JERRY_ASSERT (host_status == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_BOOLEAN && res.u.v_bool);
+    jerry_api_release_value (&res);
+
+    /* Existence checks use the has interceptor, the getter is not called. */
+    const char *host_has_src_p = ("host.x = 3;"
+                                  "var found = 0;"
+                                  "for (var k in host) { found++; }"
+                                  "found === 2 && 'x' in host && host.hasOwnProperty ('x') && !('z' in host)");
+    test_api_host_x_get_calls = 0;
+    host_status = jerry_api_eval ((jerry_api_char_t *) host_has_src_p,
+                                  strlen (host_has_src_p),
+                                  false,
+                                  false,
+                                  &res);
+    JERRY_ASSERT (host_status == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_BOOLEAN && res.u.v_bool);
+    JERRY_ASSERT (test_api_host_x_get_calls == 0);
+    jerry_api_release_value (&res);
+
+    jerry_api_release_object (host_obj_p);
+  }
+
+  // Test: job queue
+  {
+    const char *job_src_p = ("var job_sum = 0;"
+                             "(function (value) { if (value < 0) { throw value; } job_sum += value; })");
+    jerry_completion_code_t job_status = jerry_api_eval ((jerry_api_char_t *) job_src_p,
+                                                         strlen (job_src_p),
+                                                         false,
+                                                         false,
+                                                         &val_t);
+    JERRY_ASSERT (job_status == JERRY_COMPLETION_CODE_OK && val_t.type == JERRY_API_DATA_TYPE_OBJECT);
+
+    for (int i = 1; i <= 10; i++)
+    {
+      test_api_init_api_value_float64 (&args[0], (i == 5) ? -1.0 : (double) i);
+      is_ok = jerry_api_enqueue_job (val_t.u.v_object, NULL, args, 1);
+      JERRY_ASSERT (is_ok);
+    }
+
+    /* Non-function objects are not queued. */
+    JERRY_ASSERT (!jerry_api_enqueue_job (global_obj_p, NULL, NULL, 0));
+
+    JERRY_ASSERT (jerry_api_run_jobs (3, job_error_handler) == 1);
+    JERRY_ASSERT (test_api_job_errors == 1);
+    JERRY_ASSERT (jerry_api_run_jobs (0, NULL) == 0);
+
+    is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "job_sum", &res);
+    JERRY_ASSERT (is_ok && res.type == JERRY_API_DATA_TYPE_FLOAT64 && res.u.v_float64 == 50.0);
+    jerry_api_release_value (&res);
+
+    /* The jobs left in the queue are released by jerry_cleanup. */
+    test_api_init_api_value_float64 (&args[0], 1.0);
+    is_ok = jerry_api_enqueue_job (val_t.u.v_object, global_obj_p, args, 1);
+    JERRY_ASSERT (is_ok);
+
+    jerry_api_release_value (&val_t);
+  }
+
+  // Test: interrupt callback
+  {
+    const char *loop_src_p = "var loop_sum = 0; for (var i = 0; i < 1000; i++) { loop_sum += i; }";
+    jerry_api_set_interrupt_callback (interrupt_callback, &test_api_interrupts, 100);
+    jerry_completion_code_t interrupt_status = jerry_api_eval ((jerry_api_char_t *) loop_src_p,
+                                                               strlen (loop_src_p),
+                                                               false,
+                                                               false,
+                                                               &res);
+    JERRY_ASSERT (interrupt_status == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (test_api_interrupts >= 10);
+    jerry_api_release_value (&res);
+
+    /* The script can not catch the abort. */
+    const char *endless_src_p = ("var caught = false;"
+                                 "try { while (true) { } } catch (e) { caught = true; } finally { caught = true; }");
+    test_api_interrupt_abort_at = test_api_interrupts + 3;
+    interrupt_status = jerry_api_eval ((jerry_api_char_t *) endless_src_p,
+                                       strlen (endless_src_p),
+                                       false,
+                                       false,
+                                       &res);
+    JERRY_ASSERT (interrupt_status == JERRY_COMPLETION_CODE_ABORTED);
+    JERRY_ASSERT (test_api_interrupts == test_api_interrupt_abort_at);
+    jerry_api_release_value (&res);
+
+    is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "caught", &res);
+    JERRY_ASSERT (is_ok && res.type == JERRY_API_DATA_TYPE_BOOLEAN && !res.u.v_bool);
+    jerry_api_release_value (&res);
+
+    /* Without budget, the callback is called only on request. */
+    jerry_api_set_interrupt_callback (interrupt_callback, &test_api_interrupts, 0);
+    test_api_interrupts = 0;
+    test_api_interrupt_abort_at = 0;
+    interrupt_status = jerry_api_eval ((jerry_api_char_t *) loop_src_p,
+                                       strlen (loop_src_p),
+                                       false,
+                                       false,
+                                       &res);
+    JERRY_ASSERT (interrupt_status == JERRY_COMPLETION_CODE_OK && test_api_interrupts == 0);
+    jerry_api_release_value (&res);
+
+    jerry_api_request_interrupt ();
+    test_api_interrupt_abort_at = 1;
+    interrupt_status = jerry_api_eval ((jerry_api_char_t *) loop_src_p,
+                                       strlen (loop_src_p),
+                                       false,
+                                       false,
+                                       &res);
+    JERRY_ASSERT (interrupt_status == JERRY_COMPLETION_CODE_ABORTED && test_api_interrupts == 1);
+    jerry_api_release_value (&res);
+
+    /* An abort is distinguishable from 'throw undefined'. */
+    const char *abort_funcs_src_p = ("var job_after_abort = false;"
+                                     "[function () { while (true) { } },"
+                                     " function () { throw undefined; },"
+                                     " function () { job_after_abort = true; }]");
+    interrupt_status = jerry_api_eval ((jerry_api_char_t *) abort_funcs_src_p,
+                                       strlen (abort_funcs_src_p),
+                                       false,
+                                       false,
+                                       &val_t);
+    JERRY_ASSERT (interrupt_status == JERRY_COMPLETION_CODE_OK && val_t.type == JERRY_API_DATA_TYPE_OBJECT);
+
+    jerry_api_value_t endless_func, throw_func, after_func;
+    is_ok = (jerry_api_get_array_index_value (val_t.u.v_object, 0, &endless_func)
+             && jerry_api_get_array_index_value (val_t.u.v_object, 1, &throw_func)
+             && jerry_api_get_array_index_value (val_t.u.v_object, 2, &after_func));
+    JERRY_ASSERT (is_ok);
+    jerry_api_release_value (&val_t);
+
+    jerry_api_set_interrupt_callback (interrupt_callback, &test_api_interrupts, 100);
+    test_api_interrupt_abort_at = test_api_interrupts + 2;
+    is_ok = jerry_api_call_function (endless_func.u.v_object, NULL, &res, NULL, 0);
+    JERRY_ASSERT (!is_ok && res.type == JERRY_API_DATA_TYPE_UNDEFINED && jerry_api_is_aborted ());
+    jerry_api_release_value (&res);
+
+    is_ok = jerry_api_call_function (throw_func.u.v_object, NULL, &res, NULL, 0);
+    JERRY_ASSERT (!is_ok && res.type == JERRY_API_DATA_TYPE_UNDEFINED && !jerry_api_is_aborted ());
+    jerry_api_release_value (&res);
+
+    /* The abort stops the job queue, the remaining jobs are called later. */
+    JERRY_ASSERT (jerry_api_enqueue_job (endless_func.u.v_object, NULL, NULL, 0));
+    JERRY_ASSERT (jerry_api_enqueue_job (after_func.u.v_object, NULL, NULL, 0));
+
+    int job_errors_before_abort = test_api_job_errors;
+    test_api_interrupt_abort_at = test_api_interrupts + 2;
+    JERRY_ASSERT (jerry_api_run_jobs (0, job_error_handler) == 0);
+    JERRY_ASSERT (jerry_api_is_aborted () && test_api_job_errors == job_errors_before_abort);
+
+    is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "job_after_abort", &res);
+    JERRY_ASSERT (is_ok && res.type == JERRY_API_DATA_TYPE_BOOLEAN && !res.u.v_bool);
+    jerry_api_release_value (&res);
+
+    JERRY_ASSERT (jerry_api_run_jobs (0, job_error_handler) == 0);
+    JERRY_ASSERT (!jerry_api_is_aborted ());
+
+    is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "job_after_abort", &res);
+    JERRY_ASSERT (is_ok && res.type == JERRY_API_DATA_TYPE_BOOLEAN && res.u.v_bool);
+    jerry_api_release_value (&res);
+
+    /* Keep a job in the queue for jerry_cleanup, as the job queue test does. */
+    JERRY_ASSERT (jerry_api_enqueue_job (after_func.u.v_object, NULL, NULL, 0));
+
+    jerry_api_release_value (&endless_func);
+    jerry_api_release_value (&throw_func);
+    jerry_api_release_value (&after_func);
+
+    jerry_api_set_interrupt_callback (NULL, NULL, 0);
+  }
+
+  // Test: handles
+  {
+    jerry_api_object_t *handle_obj_p = jerry_api_create_object ();
+    jerry_api_handle_t strong_handle = jerry_api_create_handle (handle_obj_p);
+    jerry_api_handle_t weak_handle = jerry_api_create_weak_handle (handle_obj_p,
+                                                                   weak_handle_callback,
+                                                                   &test_api_weak_callbacks);
+    jerry_api_release_object (handle_obj_p);
+
+    /* Handles do not use the reference counter, so their number is not limited by its width. */
+    jerry_api_handle_t many_handles[2000];
+
+    for (int i = 0; i < 2000; i++)
+    {
+      many_handles[i] = jerry_api_create_handle (global_obj_p);
+    }
+
+    for (int i = 0; i < 2000; i++)
+    {
+      jerry_api_release_handle (many_handles[i]);
+    }
+
+    /* The strong handle keeps the object alive. */
+    jerry_api_gc ();
+    JERRY_ASSERT (test_api_weak_callbacks == 0);
+
+    jerry_api_object_t *handle_get_p = jerry_api_get_handle_object (weak_handle);
+    JERRY_ASSERT (handle_get_p != NULL);
+    jerry_api_release_object (handle_get_p);
+
+    jerry_api_release_handle (strong_handle);
+    jerry_api_gc ();
+
+    JERRY_ASSERT (test_api_weak_callbacks == 1 && test_api_collected_handle == weak_handle);
+    JERRY_ASSERT (jerry_api_get_handle_object (weak_handle) == NULL);
+    jerry_api_release_handle (weak_handle);
+
+    /* The for-in cache does not keep the enumerated objects alive. */
+    const char *enumerated_src_p = "var enumerated = { a : 1, b : 2 }; for (var k in enumerated) { } enumerated";
+    is_ok = (jerry_api_eval ((jerry_api_char_t *) enumerated_src_p,
+                             strlen (enumerated_src_p),
+                             false,
+                             false,
+                             &res) == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (is_ok && res.type == JERRY_API_DATA_TYPE_OBJECT);
+    weak_handle = jerry_api_create_weak_handle (res.u.v_object, weak_handle_callback, &test_api_weak_callbacks);
+    jerry_api_release_value (&res);
+
+    const char *unset_src_p = "enumerated = undefined";
+    is_ok = (jerry_api_eval ((jerry_api_char_t *) unset_src_p,
+                             strlen (unset_src_p),
+                             false,
+                             false,
+                             &res) == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (is_ok);
+    jerry_api_release_value (&res);
+
+    jerry_api_gc ();
+
+    JERRY_ASSERT (test_api_weak_callbacks == 2 && test_api_collected_handle == weak_handle);
+    jerry_api_release_handle (weak_handle);
+
+    /* The handles left allocated are released by jerry_cleanup. */
+    jerry_api_create_handle (global_obj_p);
+  }
+
+  // Test: WeakMap
+  {
+    jerry_api_object_t *map_p = jerry_api_create_weakmap ();
+    jerry_api_object_t *key1_p = jerry_api_create_object ();
+    jerry_api_object_t *key2_p = jerry_api_create_object ();
+    jerry_api_object_t *chained_p = jerry_api_create_object ();
+    jerry_api_object_t *value_obj_p = jerry_api_create_object ();
+
+    /* key1 -> key2 -> chained: values are reachable only through their keys. */
+    jerry_api_value_t map_value;
+    map_value.type = JERRY_API_DATA_TYPE_OBJECT;
+    map_value.u.v_object = key2_p;
+    JERRY_ASSERT (jerry_api_weakmap_set (map_p, key1_p, &map_value));
+    map_value.u.v_object = chained_p;
+    JERRY_ASSERT (jerry_api_weakmap_set (map_p, key2_p, &map_value));
+    map_value.u.v_object = value_obj_p;
+    JERRY_ASSERT (jerry_api_weakmap_set (map_p, chained_p, &map_value));
+    JERRY_ASSERT (!jerry_api_weakmap_set (key1_p, key2_p, &map_value));
+
+    jerry_api_handle_t key2_handle = jerry_api_create_weak_handle (key2_p, NULL, NULL);
+    jerry_api_handle_t value_handle = jerry_api_create_weak_handle (value_obj_p, NULL, NULL);
+    jerry_api_release_object (key2_p);
+    jerry_api_release_object (chained_p);
+    jerry_api_release_object (value_obj_p);
+
+    jerry_api_gc ();
+
+    jerry_api_object_t *alive_p = jerry_api_get_handle_object (value_handle);
+    JERRY_ASSERT (alive_p != NULL);
+    JERRY_ASSERT (!jerry_api_weakmap_get (map_p, alive_p, &map_value));
+    jerry_api_release_object (alive_p);
+
+    JERRY_ASSERT (jerry_api_weakmap_get (map_p, key1_p, &map_value));
+    JERRY_ASSERT (map_value.type == JERRY_API_DATA_TYPE_OBJECT);
+    JERRY_ASSERT (jerry_api_weakmap_get (map_p, map_value.u.v_object, &res));
+    jerry_api_release_value (&res);
+    jerry_api_release_value (&map_value);
+
+    JERRY_ASSERT (jerry_api_weakmap_delete (map_p, key1_p));
+    JERRY_ASSERT (!jerry_api_weakmap_delete (map_p, key1_p));
+
+    /* Without the key1 -> key2 entry the chain is collected. */
+    jerry_api_gc ();
+    JERRY_ASSERT (jerry_api_get_handle_object (key2_handle) == NULL);
+    JERRY_ASSERT (jerry_api_get_handle_object (value_handle) == NULL);
+
+    /* Releasing the key removes the entry. */
+    map_value.type = JERRY_API_DATA_TYPE_FLOAT64;
+    map_value.u.v_float64 = 4.5;
+    JERRY_ASSERT (jerry_api_weakmap_set (map_p, key1_p, &map_value));
+    jerry_api_handle_t key1_handle = jerry_api_create_weak_handle (key1_p, NULL, NULL);
+    jerry_api_release_object (key1_p);
+
+    jerry_api_gc ();
+    JERRY_ASSERT (jerry_api_get_handle_object (key1_handle) == NULL);
+
+    jerry_api_release_handle (key1_handle);
+    jerry_api_release_handle (key2_handle);
+    jerry_api_release_handle (value_handle);
+    jerry_api_release_object (map_p);
+  }
 
   // Test: eval
   const char *eval_code_src_p = "(function () { return 123; })";
@@ -747,5 +1399,691 @@ main (void)
     jerry_cleanup ();
   }
 
+  // Save / restore heap snapshot
+  {
+    static uint8_t heap_snapshot_buffer[320 * 1024];
+
+    const char *code_to_init_p = ("var counter = 40;\n"
+                                  "var items = { count: function () { return ++counter; } };\n"
+                                  "String.prototype.twice = function () { return this + this; };\n");
+    const char *code_to_eval_p = "items.count () + items.count () + 'x'.twice ().length";
+
+    jerry_init (JERRY_FLAG_EMPTY);
+
+    is_ok = jerry_parse ((jerry_api_char_t *) code_to_init_p, strlen (code_to_init_p));
+    JERRY_ASSERT (is_ok);
+
+    /* A refused snapshot keeps the parsed code. */
+    JERRY_ASSERT (jerry_save_heap_snapshot (heap_snapshot_buffer, 64) == 0);
+
+    is_ok = (jerry_run () == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (is_ok);
+
+    /* Queued jobs cannot be stored in a heap snapshot. */
+    const char *job_function_src_p = "items.count";
+    is_ok = (jerry_api_eval ((jerry_api_char_t *) job_function_src_p,
+                             strlen (job_function_src_p),
+                             false,
+                             false,
+                             &res) == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (is_ok && res.type == JERRY_API_DATA_TYPE_OBJECT);
+    is_ok = jerry_api_enqueue_job (res.u.v_object, NULL, NULL, 0);
+    JERRY_ASSERT (is_ok);
+    jerry_api_release_value (&res);
+
+    JERRY_ASSERT (jerry_save_heap_snapshot (heap_snapshot_buffer, sizeof (heap_snapshot_buffer)) == 0);
+    JERRY_ASSERT (jerry_api_run_jobs (0, NULL) == 0);
+
+    size_t heap_snapshot_size = jerry_save_heap_snapshot (heap_snapshot_buffer, sizeof (heap_snapshot_buffer));
+    JERRY_ASSERT (heap_snapshot_size != 0);
+
+    /* Native handlers cannot be stored in a heap snapshot. */
+    global_obj_p = jerry_api_get_global ();
+    external_func_p = jerry_api_create_external_function (handler);
+    test_api_init_api_value_object (&val_external, external_func_p);
+    is_ok = jerry_api_set_object_field_value (global_obj_p,
+                                              (jerry_api_char_t *) "external",
+                                              &val_external);
+    JERRY_ASSERT (is_ok);
+    jerry_api_release_value (&val_external);
+    jerry_api_release_object (external_func_p);
+    jerry_api_release_object (global_obj_p);
+
+    JERRY_ASSERT (jerry_save_heap_snapshot (heap_snapshot_buffer + heap_snapshot_size,
+                                            sizeof (heap_snapshot_buffer) - heap_snapshot_size) == 0);
+
+    jerry_cleanup ();
+
+    /* Truncated snapshot */
+    JERRY_ASSERT (!jerry_init_from_heap_snapshot (JERRY_FLAG_EMPTY, heap_snapshot_buffer, heap_snapshot_size - 1));
+
+    /* Truncated image with a matching size in the header (the last field of the header). */
+    uint32_t image_size;
+    const size_t image_size_offset = 3 * sizeof (uint32_t);
+    memcpy (&image_size, heap_snapshot_buffer + image_size_offset, sizeof (image_size));
+    image_size--;
+    memcpy (heap_snapshot_buffer + image_size_offset, &image_size, sizeof (image_size));
+
+    JERRY_ASSERT (!jerry_init_from_heap_snapshot (JERRY_FLAG_EMPTY, heap_snapshot_buffer, heap_snapshot_size - 1));
+
+    image_size++;
+    memcpy (heap_snapshot_buffer + image_size_offset, &image_size, sizeof (image_size));
+
+    /* The engine can be initialized after a refused snapshot. */
+    jerry_init (JERRY_FLAG_EMPTY);
+    jerry_cleanup ();
+
+    /* Each engine restored from the snapshot starts from the same state. */
+    for (int i = 0; i < 2; i++)
+    {
+      is_ok = jerry_init_from_heap_snapshot (JERRY_FLAG_EMPTY, heap_snapshot_buffer, heap_snapshot_size);
+      JERRY_ASSERT (is_ok);
+
+      is_ok = (jerry_api_eval ((jerry_api_char_t *) code_to_eval_p,
+                               strlen (code_to_eval_p),
+                               false,
+                               false,
+                               &res) == JERRY_COMPLETION_CODE_OK);
+      JERRY_ASSERT (is_ok
+                    && res.type == JERRY_API_DATA_TYPE_FLOAT64
+                    && res.u.v_float64 == 87.0);
+      jerry_api_release_value (&res);
+
+      jerry_cleanup ();
+    }
+  }
+
+  // Sampling profiler (it is not available on every platform)
+  is_ok = jerry_profiler_start ();
+  jerry_profiler_stop ();
+
+  if (is_ok)
+  {
+    static uint8_t profile_buffer[256];
+    const char *code_to_profile_p = ("function f () {\n"
+                                     "  sample ();\n"
+                                     "}\n"
+                                     "for (var i = 0; i < 3; i++) {\n"
+                                     "  f ();\n"
+                                     "}\n");
+    const char *expected_profile_p = "<global>[5];function@1:12 3\n";
+
+    jerry_init (JERRY_FLAG_EMPTY);
+
+    global_obj_p = jerry_api_get_global ();
+    external_func_p = jerry_api_create_external_function (handler_profiler_sample);
+    test_api_init_api_value_object (&val_t, external_func_p);
+    is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "sample", &val_t);
+    JERRY_ASSERT (is_ok);
+    jerry_api_release_value (&val_t);
+    jerry_api_release_object (external_func_p);
+    jerry_api_release_object (global_obj_p);
+
+    JERRY_ASSERT (jerry_profiler_start ());
+
+    is_ok = jerry_parse ((jerry_api_char_t *) code_to_profile_p, strlen (code_to_profile_p));
+    JERRY_ASSERT (is_ok);
+    is_ok = (jerry_run () == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (is_ok);
+
+    jerry_profiler_stop ();
+
+    /* Ignored, since the profiler is stopped. */
+    jerry_profiler_sample ();
+
+    size_t profile_size = jerry_profiler_dump (profile_buffer, sizeof (profile_buffer));
+    JERRY_ASSERT (profile_size == strlen (expected_profile_p));
+    JERRY_ASSERT (!strncmp ((char *) profile_buffer, expected_profile_p, profile_size));
+
+    /* The buffer is too small. */
+    JERRY_ASSERT (jerry_profiler_dump (profile_buffer, profile_size - 1) == 0);
+
+    jerry_cleanup ();
+
+    /* Line info is stored in snapshots as well. */
+    static uint8_t profile_snapshot_buffer[512];
+
+    jerry_init (JERRY_FLAG_EMPTY);
+    size_t profile_snapshot_size = jerry_parse_and_save_snapshot ((jerry_api_char_t *) code_to_profile_p,
+                                                                  strlen (code_to_profile_p),
+                                                                  true,
+                                                                  profile_snapshot_buffer,
+                                                                  sizeof (profile_snapshot_buffer));
+    JERRY_ASSERT (profile_snapshot_size != 0);
+    jerry_cleanup ();
+
+    jerry_init (JERRY_FLAG_EMPTY);
+
+    global_obj_p = jerry_api_get_global ();
+    external_func_p = jerry_api_create_external_function (handler_profiler_sample);
+    test_api_init_api_value_object (&val_t, external_func_p);
+    is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "sample", &val_t);
+    JERRY_ASSERT (is_ok);
+    jerry_api_release_value (&val_t);
+    jerry_api_release_object (external_func_p);
+    jerry_api_release_object (global_obj_p);
+
+    JERRY_ASSERT (jerry_profiler_start ());
+
+    is_ok = (jerry_exec_snapshot (profile_snapshot_buffer,
+                                  profile_snapshot_size,
+                                  false,
+                                  &res) == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (is_ok);
+    jerry_api_release_value (&res);
+
+    jerry_profiler_stop ();
+
+    profile_size = jerry_profiler_dump (profile_buffer, sizeof (profile_buffer));
+    JERRY_ASSERT (profile_size == strlen (expected_profile_p));
+    JERRY_ASSERT (!strncmp ((char *) profile_buffer, expected_profile_p, profile_size));
+
+    jerry_cleanup ();
+  }
+
+  // Regular expressions in snapshots
+  {
+    static uint8_t regexp_snapshot_buffer[1024];
+    const char *code_to_snapshot_p = ("var re = /^(a+)b{2,3}$/i;\n"
+                                      "re.test ('AAbb') && !re.test ('abbbb') && re.source === '^(a+)b{2,3}$'\n"
+                                      "&& 'xyzyxz'.match (/x(y|z)*/g).length === 2;");
+
+    jerry_init (JERRY_FLAG_EMPTY);
+    size_t regexp_snapshot_size = jerry_parse_and_save_snapshot ((jerry_api_char_t *) code_to_snapshot_p,
+                                                                 strlen (code_to_snapshot_p),
+                                                                 false,
+                                                                 regexp_snapshot_buffer,
+                                                                 sizeof (regexp_snapshot_buffer));
+    JERRY_ASSERT (regexp_snapshot_size != 0);
+    jerry_cleanup ();
+
+    /* The byte code is either copied to the heap or referenced from the snapshot buffer. */
+    for (int copy_bytecode = 0; copy_bytecode < 2; copy_bytecode++)
+    {
+      jerry_init (JERRY_FLAG_EMPTY);
+
+      is_ok = (jerry_exec_snapshot (regexp_snapshot_buffer,
+                                    regexp_snapshot_size,
+                                    copy_bytecode != 0,
+                                    &res) == JERRY_COMPLETION_CODE_OK);
+      JERRY_ASSERT (is_ok);
+      JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_BOOLEAN && res.u.v_bool);
+      jerry_api_release_value (&res);
+
+      jerry_cleanup ();
+    }
+  }
+
+  // Execute function code in place from the snapshot buffer
+  {
+    static uint8_t function_snapshot_buffer[2048];
+    const char *code_to_snapshot_p = ("function fact (n) { return n <= 1 ? 1 : n * fact (n - 1); }\n"
+                                      "function counter (start) {\n"
+                                      "  arguments[0] += 10;\n"
+                                      "  return function (step) { start += step; return start; };\n"
+                                      "}\n"
+                                      "var next = counter (5);\n"
+                                      "next (1);\n"
+                                      "fact (5) === 120 && next (2) === 18 && /a+/.test ('caab');");
+    const char *code_to_eval_p = "next (3) === 21 && fact (3) === 6";
+
+    jerry_init (JERRY_FLAG_EMPTY);
+    size_t function_snapshot_size = jerry_parse_and_save_snapshot ((jerry_api_char_t *) code_to_snapshot_p,
+                                                                   strlen (code_to_snapshot_p),
+                                                                   false,
+                                                                   function_snapshot_buffer,
+                                                                   sizeof (function_snapshot_buffer));
+    JERRY_ASSERT (function_snapshot_size != 0);
+    jerry_cleanup ();
+
+    for (int copy_bytecode = 0; copy_bytecode < 2; copy_bytecode++)
+    {
+      jerry_init (JERRY_FLAG_EMPTY);
+
+      is_ok = (jerry_exec_snapshot (function_snapshot_buffer,
+                                    function_snapshot_size,
+                                    copy_bytecode != 0,
+                                    &res) == JERRY_COMPLETION_CODE_OK);
+      JERRY_ASSERT (is_ok);
+      JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_BOOLEAN && res.u.v_bool);
+      jerry_api_release_value (&res);
+
+      /* The functions are still referenced after the snapshot code is finished. */
+      is_ok = (jerry_api_eval ((jerry_api_char_t *) code_to_eval_p,
+                               strlen (code_to_eval_p),
+                               false,
+                               false,
+                               &res) == JERRY_COMPLETION_CODE_OK);
+      JERRY_ASSERT (is_ok);
+      JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_BOOLEAN && res.u.v_bool);
+      jerry_api_release_value (&res);
+
+      jerry_cleanup ();
+    }
+  }
+
+  // Literals of a snapshot are merged with the existing literals
+  {
+    static uint8_t literal_snapshot_buffer[1024];
+    const char *code_to_snapshot_p = ("var obj = { shared: 'literal', 'own literal': 2.5, length: -0 };\n"
+                                      "obj.shared === 'lit' + 'eral' && obj['own literal'] === 2.5\n"
+                                      "&& 1 / obj.length === -Infinity && shared_value === 'literal';");
+    const char *code_to_eval_p = "var shared_value = 'literal', zero = 0, number = 2.5;";
+
+    jerry_init (JERRY_FLAG_EMPTY);
+    size_t literal_snapshot_size = jerry_parse_and_save_snapshot ((jerry_api_char_t *) code_to_snapshot_p,
+                                                                  strlen (code_to_snapshot_p),
+                                                                  false,
+                                                                  literal_snapshot_buffer,
+                                                                  sizeof (literal_snapshot_buffer));
+    JERRY_ASSERT (literal_snapshot_size != 0);
+    jerry_cleanup ();
+
+    jerry_init (JERRY_FLAG_EMPTY);
+
+    is_ok = (jerry_api_eval ((jerry_api_char_t *) code_to_eval_p,
+                             strlen (code_to_eval_p),
+                             false,
+                             false,
+                             &res) == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (is_ok);
+    jerry_api_release_value (&res);
+
+    for (int i = 0; i < 2; i++)
+    {
+      is_ok = (jerry_exec_snapshot (literal_snapshot_buffer,
+                                    literal_snapshot_size,
+                                    false,
+                                    &res) == JERRY_COMPLETION_CODE_OK);
+      JERRY_ASSERT (is_ok);
+      JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_BOOLEAN && res.u.v_bool);
+      jerry_api_release_value (&res);
+    }
+
+    jerry_cleanup ();
+  }
+
+  // Snapshot bundles
+  {
+    static uint8_t library_snapshot_buffer[1024];
+    static uint8_t main_snapshot_buffer[1024];
+    static uint8_t bundle_buffer[2048];
+    const char *library_code_p = ("function square (x) { return x * x; }\n"
+                                  "function unused () { return /never (called)/.test ('') || unused (); }\n"
+                                  "function make_adder (n) { return function (x) { return x + n; }; }\n"
+                                  "typeof unused === 'function';");
+    const char *main_code_p = "make_adder (square (3)) (1) === 10 && make_adder (1) (1) === 2;";
+
+    jerry_init (JERRY_FLAG_EMPTY);
+    size_t library_snapshot_size = jerry_parse_and_save_snapshot ((jerry_api_char_t *) library_code_p,
+                                                                  strlen (library_code_p),
+                                                                  false,
+                                                                  library_snapshot_buffer,
+                                                                  sizeof (library_snapshot_buffer));
+    JERRY_ASSERT (library_snapshot_size != 0);
+    jerry_cleanup ();
+
+    jerry_init (JERRY_FLAG_EMPTY);
+    size_t main_snapshot_size = jerry_parse_and_save_snapshot ((jerry_api_char_t *) main_code_p,
+                                                               strlen (main_code_p),
+                                                               false,
+                                                               main_snapshot_buffer,
+                                                               sizeof (main_snapshot_buffer));
+    JERRY_ASSERT (main_snapshot_size != 0);
+    jerry_cleanup ();
+
+    const uint8_t *snapshots_p[] = { library_snapshot_buffer, main_snapshot_buffer };
+    size_t snapshot_sizes[] = { library_snapshot_size, main_snapshot_size };
+
+    /* Empty bundles, and too small buffers */
+    JERRY_ASSERT (jerry_save_snapshot_bundle (snapshots_p,
+                                              snapshot_sizes,
+                                              0,
+                                              bundle_buffer,
+                                              sizeof (bundle_buffer)) == 0);
+    JERRY_ASSERT (jerry_save_snapshot_bundle (snapshots_p, snapshot_sizes, 2, bundle_buffer, 64) == 0);
+
+    size_t bundle_size = jerry_save_snapshot_bundle (snapshots_p,
+                                                     snapshot_sizes,
+                                                     2,
+                                                     bundle_buffer,
+                                                     sizeof (bundle_buffer));
+    JERRY_ASSERT (bundle_size != 0);
+    JERRY_ASSERT (jerry_get_snapshot_bundle_count (bundle_buffer, bundle_size) == 2);
+    JERRY_ASSERT (jerry_get_snapshot_bundle_count (bundle_buffer, bundle_size - 1) == 0);
+    JERRY_ASSERT (jerry_get_snapshot_bundle_count (library_snapshot_buffer, library_snapshot_size) == 0);
+
+    for (int copy_bytecode = 0; copy_bytecode < 2; copy_bytecode++)
+    {
+      jerry_init (JERRY_FLAG_EMPTY);
+
+      for (uint32_t i = 0; i < 2; i++)
+      {
+        is_ok = (jerry_exec_snapshot_from_bundle (bundle_buffer,
+                                                  bundle_size,
+                                                  i,
+                                                  copy_bytecode != 0,
+                                                  &res) == JERRY_COMPLETION_CODE_OK);
+        JERRY_ASSERT (is_ok);
+        JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_BOOLEAN && res.u.v_bool);
+        jerry_api_release_value (&res);
+      }
+
+      is_ok = (jerry_exec_snapshot_from_bundle (bundle_buffer,
+                                                bundle_size,
+                                                2,
+                                                copy_bytecode != 0,
+                                                &res) == JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT);
+      JERRY_ASSERT (is_ok);
+      JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_UNDEFINED);
+
+      jerry_cleanup ();
+    }
+  }
+
+  // Lazy function compilation
+  {
+    static uint8_t heap_snapshot_buffer[320 * 1024];
+
+    const char *code_to_parse_p = ("var counter = 0;\n"
+                                   "function make_counter (step) {\n"
+                                   "  return function () { counter += step; return counter; };\n"
+                                   "}\n"
+                                   "function strict_this (a, b, c) { 'use strict'; return this; }\n"
+                                   "var obj = { get twice () { return counter * 2; } };\n"
+                                   "function invalid () { break; }\n");
+    const char *code_to_eval_p = ("var add = make_counter (5);\n"
+                                  "add (); add ();\n"
+                                  "var is_syntax_error = false;\n"
+                                  "try { invalid (); } catch (e) { is_syntax_error = e instanceof SyntaxError; }\n"
+                                  "(is_syntax_error && strict_this () === undefined && strict_this.length === 3\n"
+                                  " && make_counter.length === 1) ? obj.twice : -1");
+
+    jerry_init (JERRY_FLAG_LAZY_FUNCTION_COMPILATION);
+
+    /* Syntax errors outside of function bodies are still detected by the pre-scan. */
+    const char *invalid_code_p = "function f (a b) { }";
+    is_ok = jerry_parse ((jerry_api_char_t *) invalid_code_p, strlen (invalid_code_p));
+    JERRY_ASSERT (!is_ok);
+
+    invalid_code_p = "function f () { 'use strict'; var a = 010; }";
+    is_ok = jerry_parse ((jerry_api_char_t *) invalid_code_p, strlen (invalid_code_p));
+    JERRY_ASSERT (!is_ok);
+
+    invalid_code_p = "function f (a, a) { 'use strict'; }";
+    is_ok = jerry_parse ((jerry_api_char_t *) invalid_code_p, strlen (invalid_code_p));
+    JERRY_ASSERT (!is_ok);
+
+    /* Strict mode restrictions are also checked in the nested functions of lazy functions. */
+    invalid_code_p = "'use strict'; function a () { function inner (eval) { } }";
+    is_ok = jerry_parse ((jerry_api_char_t *) invalid_code_p, strlen (invalid_code_p));
+    JERRY_ASSERT (!is_ok);
+
+    invalid_code_p = "function a () { 'use strict'; with ({}) { } }";
+    is_ok = jerry_parse ((jerry_api_char_t *) invalid_code_p, strlen (invalid_code_p));
+    JERRY_ASSERT (!is_ok);
+
+    invalid_code_p = "function a () { return function (x, x) { 'use strict'; }; }";
+    is_ok = jerry_parse ((jerry_api_char_t *) invalid_code_p, strlen (invalid_code_p));
+    JERRY_ASSERT (!is_ok);
+
+    invalid_code_p = "function a () { 'use strict'; return function eval () { }; }";
+    is_ok = jerry_parse ((jerry_api_char_t *) invalid_code_p, strlen (invalid_code_p));
+    JERRY_ASSERT (!is_ok);
+
+    is_ok = jerry_parse ((jerry_api_char_t *) code_to_parse_p, strlen (code_to_parse_p));
+    JERRY_ASSERT (is_ok);
+    is_ok = (jerry_run () == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (is_ok);
+
+    /* Lazy function code references the source, so it cannot be stored in a heap snapshot. */
+    JERRY_ASSERT (jerry_save_heap_snapshot (heap_snapshot_buffer, sizeof (heap_snapshot_buffer)) == 0);
+
+    for (int i = 0; i < 2; i++)
+    {
+      is_ok = (jerry_api_eval ((jerry_api_char_t *) code_to_eval_p,
+                               strlen (code_to_eval_p),
+                               false,
+                               false,
+                               &res) == JERRY_COMPLETION_CODE_OK);
+      JERRY_ASSERT (is_ok
+                    && res.type == JERRY_API_DATA_TYPE_FLOAT64
+                    && res.u.v_float64 == 20.0 * (i + 1));
+      jerry_api_release_value (&res);
+    }
+
+    jerry_cleanup ();
+  }
+
+  // Pinned code
+  {
+    static uint8_t heap_snapshot_buffer[320 * 1024];
+
+    const char *code_to_pin_p = ("function scale (a) {\n"
+                                   "  function twice () { return a * 2; }\n"
+                                   "  return twice () + /x+/.exec ('axxb')[0].length;\n"
+                                   "}\n"
+                                   "var result = scale (3);\n");
+    const char *code_to_eval_p = "result + scale (4)";
+
+    const uint32_t flags[] = { JERRY_FLAG_EMPTY, JERRY_FLAG_LAZY_FUNCTION_COMPILATION };
+
+    for (uint32_t i = 0; i < sizeof (flags) / sizeof (flags[0]); i++)
+    {
+      jerry_init (flags[i]);
+
+      JERRY_ASSERT (!jerry_pin_parsed_code ());
+
+      is_ok = jerry_parse ((jerry_api_char_t *) code_to_pin_p, strlen (code_to_pin_p));
+      JERRY_ASSERT (is_ok);
+      is_ok = jerry_pin_parsed_code () && jerry_pin_parsed_code ();
+      JERRY_ASSERT (is_ok);
+      is_ok = (jerry_run () == JERRY_COMPLETION_CODE_OK);
+      JERRY_ASSERT (is_ok);
+
+      is_ok = (jerry_api_eval ((jerry_api_char_t *) code_to_eval_p,
+                               strlen (code_to_eval_p),
+                               false,
+                               false,
+                               &res) == JERRY_COMPLETION_CODE_OK);
+      JERRY_ASSERT (is_ok
+                    && res.type == JERRY_API_DATA_TYPE_FLOAT64
+                    && res.u.v_float64 == 18.0);
+      jerry_api_release_value (&res);
+
+      JERRY_ASSERT (jerry_save_heap_snapshot (heap_snapshot_buffer, sizeof (heap_snapshot_buffer)) == 0);
+
+      jerry_cleanup ();
+    }
+  }
+
+  // External strings
+  {
+    static const char external_payload[] = "external string payload";
+    static uint8_t heap_snapshot_buffer[320 * 1024];
+    const char *code_to_eval_p = ("var obj = {}; obj[payload] = 5;\n"
+                                  "(payload === 'external string payload' ? obj['external ' + 'string payload'] : 0)"
+                                  " + payload.length + payload.indexOf ('payload') + Number (payload.charAt (1) === 'x')");
+
+    jerry_init (JERRY_FLAG_EMPTY);
+
+    jerry_api_string_t *ext_str_p;
+    jerry_api_size_t ext_size;
+    ext_str_p = jerry_api_create_external_string_sz ((const jerry_api_char_t *) external_payload,
+                                                     (jerry_api_size_t) strlen (external_payload),
+                                                     external_string_free_cb);
+    const jerry_api_char_t *ext_buffer_p = jerry_api_string_get_char_buffer (ext_str_p, &ext_size);
+    JERRY_ASSERT (ext_buffer_p == (const jerry_api_char_t *) external_payload
+                  && ext_size == strlen (external_payload));
+
+    sz = jerry_api_string_to_char_buffer (ext_str_p, (jerry_api_char_t *) buffer, (ssize_t) sizeof (buffer));
+    JERRY_ASSERT (sz == (ssize_t) strlen (external_payload) && !strncmp (buffer, external_payload, (size_t) sz));
+
+    global_obj_p = jerry_api_get_global ();
+    jerry_api_value_t ext_value = jerry_api_create_string_value (ext_str_p);
+    is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "payload", &ext_value);
+    JERRY_ASSERT (is_ok);
+    jerry_api_release_value (&ext_value);
+
+    is_ok = (jerry_api_eval ((jerry_api_char_t *) code_to_eval_p,
+                             strlen (code_to_eval_p),
+                             false,
+                             false,
+                             &res) == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (is_ok
+                  && res.type == JERRY_API_DATA_TYPE_FLOAT64
+                  && res.u.v_float64 == 5.0 + 23.0 + 16.0 + 1.0);
+    jerry_api_release_value (&res);
+
+    /* Magic strings do not reference the buffer. */
+    ext_str_p = jerry_api_create_external_string_sz ((const jerry_api_char_t *) "length", 6, external_string_free_cb);
+    JERRY_ASSERT (test_api_external_strings_freed == 1);
+    JERRY_ASSERT (jerry_api_string_get_char_buffer (ext_str_p, &ext_size) != NULL && ext_size == 6);
+    jerry_api_release_string (ext_str_p);
+
+    JERRY_ASSERT (jerry_save_heap_snapshot (heap_snapshot_buffer, sizeof (heap_snapshot_buffer)) == 0);
+
+    jerry_api_release_object (global_obj_p);
+    jerry_cleanup ();
+
+    JERRY_ASSERT (test_api_external_strings_freed == 2);
+  }
+
+  // ArrayBuffers
+  {
+    static uint8_t external_data[4] = { 1, 2, 3, 4 };
+    static uint8_t heap_snapshot_buffer[320 * 1024];
+    const char *code_to_eval_p = ("var view = new Uint16Array (external, 2);\n"
+                                  "view[0] = 0x0505;\n"
+                                  "new Uint8Array (external)[0] + new Uint8Array (internal)[1]");
+
+    jerry_init (JERRY_FLAG_EMPTY);
+
+    jerry_api_size_t data_size;
+    jerry_api_object_t *internal_p = jerry_api_create_arraybuffer (8);
+    uint8_t *internal_data_p = jerry_api_get_arraybuffer_pointer (internal_p, &data_size);
+    JERRY_ASSERT (internal_data_p != NULL && data_size == 8 && internal_data_p[1] == 0);
+    internal_data_p[1] = 10;
+
+    jerry_api_object_t *external_p = jerry_api_create_external_arraybuffer (external_data,
+                                                                            sizeof (external_data),
+                                                                            external_arraybuffer_free_cb);
+    JERRY_ASSERT (jerry_api_get_arraybuffer_pointer (external_p, &data_size) == external_data
+                  && data_size == sizeof (external_data));
+
+    global_obj_p = jerry_api_get_global ();
+    JERRY_ASSERT (jerry_api_get_arraybuffer_pointer (global_obj_p, &data_size) == NULL);
+
+    val_t.type = JERRY_API_DATA_TYPE_OBJECT;
+    val_t.u.v_object = internal_p;
+    is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "internal", &val_t);
+    JERRY_ASSERT (is_ok);
+    val_t.u.v_object = external_p;
+    is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "external", &val_t);
+    JERRY_ASSERT (is_ok);
+
+    is_ok = (jerry_api_eval ((jerry_api_char_t *) code_to_eval_p,
+                             strlen (code_to_eval_p),
+                             false,
+                             false,
+                             &res) == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (is_ok
+                  && res.type == JERRY_API_DATA_TYPE_FLOAT64
+                  && res.u.v_float64 == 11.0);
+    jerry_api_release_value (&res);
+    JERRY_ASSERT (external_data[2] == 5 && external_data[3] == 5);
+
+    /* Typed arrays expose the data of the viewed region. */
+    is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "view", &res);
+    JERRY_ASSERT (is_ok && res.type == JERRY_API_DATA_TYPE_OBJECT);
+    JERRY_ASSERT (jerry_api_get_arraybuffer_pointer (res.u.v_object, &data_size) == external_data + 2
+                  && data_size == 2);
+    jerry_api_release_value (&res);
+
+    JERRY_ASSERT (jerry_save_heap_snapshot (heap_snapshot_buffer, sizeof (heap_snapshot_buffer)) == 0);
+
+    jerry_api_release_object (internal_p);
+    jerry_api_release_object (external_p);
+    jerry_api_release_object (global_obj_p);
+    JERRY_ASSERT (test_api_external_arraybuffers_freed == 0);
+    jerry_cleanup ();
+
+    JERRY_ASSERT (test_api_external_arraybuffers_freed == 1);
+  }
+
+#ifdef JERRY_ENABLE_MULTIPLE_CONTEXTS
+  // Multiple engine contexts
+  {
+    static uint8_t context_buffers[2][CONFIG_MEM_HEAP_AREA_SIZE + 64 * 1024]
+      __attribute__ ((aligned (JERRY_CONTEXT_ALIGNMENT)));
+    JERRY_ASSERT (jerry_get_context_size () <= sizeof (context_buffers[0]));
+
+    jerry_context_t *default_context_p = jerry_port_get_current_context ();
+    const char *set_code_p[2] = { "var context_id = 0", "var context_id = 1" };
+    const char *get_code_p = "context_id";
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      jerry_port_set_current_context ((jerry_context_t *) context_buffers[i]);
+      jerry_init (JERRY_FLAG_EMPTY);
+    }
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      jerry_port_set_current_context ((jerry_context_t *) context_buffers[i]);
+      is_ok = (jerry_api_eval ((jerry_api_char_t *) set_code_p[i],
+                               strlen (set_code_p[i]),
+                               false,
+                               false,
+                               &res) == JERRY_COMPLETION_CODE_OK);
+      JERRY_ASSERT (is_ok);
+      jerry_api_release_value (&res);
+    }
+
+    /* An interrupt request can be sent to a context which is not the current one. */
+    const char *loop_code_p = "for (var i = 0; i < 10; i++) { }";
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      jerry_port_set_current_context ((jerry_context_t *) context_buffers[i]);
+      jerry_api_set_interrupt_callback (interrupt_callback, &test_api_interrupts, 0);
+    }
+
+    jerry_request_context_interrupt ((jerry_context_t *) context_buffers[1]);
+    test_api_interrupts = 0;
+    test_api_interrupt_abort_at = 1;
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      jerry_port_set_current_context ((jerry_context_t *) context_buffers[i]);
+      jerry_completion_code_t status = jerry_api_eval ((jerry_api_char_t *) loop_code_p,
+                                                       strlen (loop_code_p),
+                                                       false,
+                                                       false,
+                                                       &res);
+      JERRY_ASSERT (status == (i == 1 ? JERRY_COMPLETION_CODE_ABORTED : JERRY_COMPLETION_CODE_OK));
+      JERRY_ASSERT (test_api_interrupts == i);
+      jerry_api_release_value (&res);
+    }
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      jerry_port_set_current_context ((jerry_context_t *) context_buffers[i]);
+      is_ok = (jerry_api_eval ((jerry_api_char_t *) get_code_p,
+                               strlen (get_code_p),
+                               false,
+                               false,
+                               &res) == JERRY_COMPLETION_CODE_OK);
+      JERRY_ASSERT (is_ok
+                    && res.type == JERRY_API_DATA_TYPE_FLOAT64
+                    && res.u.v_float64 == (double) i);
+      jerry_api_release_value (&res);
+      jerry_cleanup ();
+    }
+
+    jerry_port_set_current_context (default_context_p);
+  }
+#endif /* JERRY_ENABLE_MULTIPLE_CONTEXTS */
+
   return 0;
 } /* main */